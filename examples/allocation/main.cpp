@@ -0,0 +1,144 @@
+/**
+ * @file main.cpp
+ * @Synopsis RROSACE allocation of the models to cores from their measured
+ * costs, predicted and measured speedups.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The costs of the model steps are measured on a first loop. For each number
+ * of cores, the models are allocated, and a fresh loop runs on the static
+ * executor; its speedup over a serial loop is compared to the predicted one,
+ * and its altitude to the serial one.
+ *
+ * Usage: example_allocation [cores [duration (s)]]
+ */
+
+#include <time.h>
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <rrosace.h>
+
+#include "../common/loop.hpp"
+
+using namespace RROSACE;
+
+#define NB_CORES (4)
+#define DURATION (50.0)
+#define VZ_C (2.5)
+
+static const char *const model_names[] = {
+    "engine", "elevator", "flight_dynamics", "h_filter", "vz_filter",
+    "va_filter", "q_filter", "az_filter", "flight_mode", "fcu",
+    "fcc1a", "fcc1b", "fcc2a", "fcc2b", "cables"};
+
+static double now() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return static_cast<double>(ts.tv_sec) +
+         static_cast<double>(ts.tv_nsec) * 1e-9;
+}
+
+static void print_allocation(const Allocation &allocation) {
+  const std::vector<Allocation::Job> &jobs = allocation.get_jobs();
+
+  for (size_t core = 0; core < allocation.get_nb_cores(); ++core) {
+    const Allocation::Jobs &schedule = allocation.get_schedule(core);
+
+    std::cout << "  core " << core << ":";
+    for (size_t job = 0; job < schedule.size(); ++job) {
+      const Allocation::Job &scheduled = jobs[schedule[job]];
+
+      std::cout << " " << model_names[scheduled.model] << "@"
+                << scheduled.phase;
+    }
+    std::cout << std::endl;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  const size_t max_cores =
+      argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : NB_CORES;
+  const double duration = argc > 2 ? std::atof(argv[2]) : DURATION;
+  Allocation::Costs costs;
+  double serial_time;
+  double serial_h;
+  size_t nb_hyperperiods;
+
+  if (!max_cores || (argc > 3)) {
+    std::cerr << "Usage: " << argv[0] << " [cores [duration (s)]]"
+              << std::endl;
+    return (EXIT_FAILURE);
+  }
+
+  try {
+    {
+      Loop loop(VZ_C);
+      const size_t hyperperiod = loop.get_dataflow().get_hyperperiod();
+
+      nb_hyperperiods = static_cast<size_t>(
+          duration * DEFAULT_PHYSICAL_FREQ / static_cast<double>(hyperperiod));
+      costs = Allocation::measure(loop.get_dataflow(), nb_hyperperiods);
+    }
+
+    std::cout << "Measured step costs (ns):" << std::endl;
+    for (size_t model = 0; model < costs.size(); ++model) {
+      std::cout << "  " << std::left << std::setw(16) << model_names[model]
+                << std::right << std::fixed << std::setprecision(1)
+                << costs[model] * 1e9 << std::endl;
+    }
+
+    {
+      Loop loop(VZ_C);
+      ParallelExecutor executor(loop.get_dataflow(), 0);
+      const size_t nb_ticks =
+          nb_hyperperiods * loop.get_dataflow().get_hyperperiod();
+      const double start = now();
+
+      for (size_t tick = 0; tick < nb_ticks; ++tick) {
+        executor.step();
+      }
+      serial_time = now() - start;
+      serial_h = loop.get_values().h;
+    }
+
+    std::cout << "Serial: " << std::setprecision(3) << serial_time * 1e3
+              << " ms for " << nb_hyperperiods << " hyperperiods" << std::endl;
+
+    for (size_t nb_cores = 1; nb_cores <= max_cores; ++nb_cores) {
+      Loop loop(VZ_C);
+      const Allocation allocation(loop.get_dataflow(), costs, nb_cores);
+      StaticExecutor executor(allocation, true);
+      const double start = now();
+      double time;
+
+      executor.run(nb_hyperperiods);
+      time = now() - start;
+
+      std::cout << nb_cores << " cores: makespan " << std::setprecision(1)
+                << allocation.get_makespan() * 1e9 << " ns (bound "
+                << allocation.get_lower_bound() * 1e9 << " ns), speedup "
+                << std::setprecision(2)
+                << allocation.get_serial_cost() / allocation.get_makespan()
+                << " predicted, " << serial_time / time << " measured, "
+                << (loop.get_values().h == serial_h ? "serial altitude"
+                                                    : "altitude differs")
+                << std::endl;
+
+      if (nb_cores == max_cores) {
+        print_allocation(allocation);
+      }
+    }
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return (EXIT_FAILURE);
+  }
+
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,217 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE what-if analysis: a running simulation branched into
+ * futures with other altitude commands or a biased altitude sensor.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * A climb runs to the branch point, then forks into futures, each one in a
+ * process of its own sharing the climb copy-on-write. The first futures
+ * change the altitude command, the others bias the altitude read by the
+ * filters. The branching is timed against the same futures run one after the
+ * other on copies of the simulation.
+ *
+ * Usage: example_branch [workers [branch point (s) [future (s)]]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rrosace.h>
+
+#define BRANCH_POINT (20.0)
+#define FUTURE (60.0)
+
+/* Climb of 100 m */
+#define H_C (RROSACE_H_EQ + 100.0)
+#define VZ_C (-2.5)
+#define VA_C (RROSACE_VA_EQ)
+
+/* Futures: altitude commands from -200 m to +200 m around the climb, then
+ * altitude biases from 5 m to 40 m */
+#define NB_COMMANDS (16)
+#define NB_BIASES (8)
+#define NB_BRANCHES (NB_COMMANDS + NB_BIASES)
+#define COMMAND_STEP (400.0 / (NB_COMMANDS - 1))
+#define BIAS_STEP (5.0)
+
+enum result { H, H_MAX, VZ, NB_RESULTS };
+
+struct future {
+  size_t nb_ticks;
+  /* Bias of the future, while it runs */
+  double bias;
+};
+
+static double now(void);
+
+static int biased_step(rrosace_sim_t * /* p_sim */,
+                       rrosace_sim_task_t /* task */, double /* dt */,
+                       void * /* p_arg */);
+
+static int future(rrosace_sim_t * /* p_sim */, size_t /* branch */,
+                  void * /* p_arg */, double /* results */[]);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Step a task, the altitude biased between the flight dynamics and
+ * the filters
+ */
+static int biased_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                       double dt, void *p_arg) {
+  const struct future *p_future = (const struct future *)p_arg;
+  rrosace_sim_values_t values;
+
+  if (rrosace_sim_step_task(p_sim, task, dt) == EXIT_FAILURE) {
+    return (EXIT_FAILURE);
+  }
+  if (task != RROSACE_SIM_TASK_FLIGHT_DYNAMICS) {
+    return (EXIT_SUCCESS);
+  }
+
+  values = *rrosace_sim_get_values(p_sim);
+  values.h += p_future->bias;
+
+  return (rrosace_sim_set_values(p_sim, &values));
+}
+
+/**
+ * @brief Change the command, or bias the altitude, and run to the end
+ */
+static int future(rrosace_sim_t *p_sim, size_t branch, void *p_arg,
+                  double results[]) {
+  struct future *p_future = (struct future *)p_arg;
+  double h = 0.;
+  size_t tick;
+
+  if (branch < NB_COMMANDS) {
+    p_future->bias = 0.;
+    if (rrosace_sim_set_commands(p_sim,
+                                 H_C - 200. + COMMAND_STEP * (double)branch,
+                                 VZ_C, VA_C) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+  } else {
+    p_future->bias = BIAS_STEP * (double)(branch - NB_COMMANDS + 1);
+  }
+
+  results[H_MAX] = rrosace_sim_get_values(p_sim)->h;
+  for (tick = 0; tick < p_future->nb_ticks; ++tick) {
+    if (rrosace_sim_run_delegated(p_sim, biased_step, p_future) ==
+        EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+    h = rrosace_sim_get_values(p_sim)->h - p_future->bias;
+    if (h > results[H_MAX]) {
+      results[H_MAX] = h;
+    }
+  }
+  results[H] = h;
+  results[VZ] = rrosace_sim_get_values(p_sim)->vz;
+
+  return (EXIT_SUCCESS);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  size_t nb_workers = (size_t)sysconf(_SC_NPROCESSORS_ONLN);
+  double branch_point = BRANCH_POINT;
+  double duration = FUTURE;
+  rrosace_sim_t *p_sim = NULL;
+  rrosace_sim_t *p_copy = NULL;
+  struct future future_arg;
+  double results[NB_BRANCHES][NB_RESULTS];
+  double serial[NB_RESULTS];
+  double start;
+  double branched;
+  double copied;
+  size_t branch;
+
+  if (argc > 1) {
+    nb_workers = (size_t)strtoul(argv[1], NULL, 10);
+  }
+  if (argc > 2) {
+    branch_point = strtod(argv[2], NULL);
+  }
+  if (argc > 3) {
+    duration = strtod(argv[3], NULL);
+  }
+  future_arg.nb_ticks = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ);
+  future_arg.bias = 0.;
+
+  p_sim = rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+  if (!p_sim ||
+      (rrosace_sim_run(p_sim, (size_t)(branch_point *
+                                       RROSACE_DEFAULT_PHYSICAL_FREQ)) ==
+       EXIT_FAILURE)) {
+    fprintf(stderr, "Climb to the branch point failed.\n");
+    goto out;
+  }
+
+  start = now();
+  if (rrosace_sim_branch(p_sim, NB_BRANCHES, nb_workers ? nb_workers : 1,
+                         future, &future_arg, NB_RESULTS,
+                         &results[0][0]) == EXIT_FAILURE) {
+    fprintf(stderr, "Branching failed.\n");
+    goto out;
+  }
+  branched = now() - start;
+
+  /* The same futures on copies, for the time and the results */
+  start = now();
+  for (branch = 0; branch < NB_BRANCHES; ++branch) {
+    p_copy = rrosace_sim_copy(p_sim);
+    if (!p_copy ||
+        (future(p_copy, branch, &future_arg, serial) == EXIT_FAILURE)) {
+      fprintf(stderr, "Future %lu on a copy failed.\n", (unsigned long)branch);
+      goto out;
+    }
+    if ((serial[H] != results[branch][H]) ||
+        (serial[VZ] != results[branch][VZ])) {
+      fprintf(stderr, "Future %lu differs on a copy.\n", (unsigned long)branch);
+      goto out;
+    }
+    rrosace_sim_del(p_copy);
+    p_copy = NULL;
+  }
+  copied = now() - start;
+
+  printf("Branched at %.1f s, altitude %.3f m, for %.1f s\n\n",
+         rrosace_sim_get_time(p_sim), rrosace_sim_get_values(p_sim)->h,
+         duration);
+  printf("branch,altitude command (m),altitude bias (m),altitude (m),"
+         "largest altitude (m),vertical speed (m/s)\n");
+  for (branch = 0; branch < NB_BRANCHES; ++branch) {
+    const int command = branch < NB_COMMANDS;
+
+    printf("%lu,%.3f,%.1f,%.3f,%.3f,%.6f\n", (unsigned long)branch,
+           command ? H_C - 200. + COMMAND_STEP * (double)branch : H_C,
+           command ? 0. : BIAS_STEP * (double)(branch - NB_COMMANDS + 1),
+           results[branch][H], results[branch][H_MAX], results[branch][VZ]);
+  }
+
+  printf("\n%d futures, %lu workers: branched in %.3f s, on copies in "
+         "%.3f s\n",
+         NB_BRANCHES, (unsigned long)(nb_workers ? nb_workers : 1), branched,
+         copied);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_copy);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
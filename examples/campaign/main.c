@@ -0,0 +1,362 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE campaign sharded over processes or hosts, the results of
+ * the shards merged in a tree.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Each run follows a vertical speed command drawn from its index in the
+ * campaign, until the altitude leaves the envelope, so that any partition of
+ * the campaign gives the same results. A shard writes its results in a
+ * binary file, which is renamed once complete, so that shards run on other
+ * hosts can share a filesystem. Merged results are shard files themselves,
+ * and merge again.
+ *
+ * Usage:
+ *   example_campaign launch shards [runs [directory]]
+ *     Run the shards in local processes, then merge them
+ *   example_campaign run shard shards runs file [workers]
+ *     Run a shard, on any host
+ *   example_campaign merge output input...
+ *     Merge shards, or merged shards, in a tree
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <rrosace.h>
+
+#define NB_RUNS (1024)
+#define MAX_SHARDS (256)
+#define SEED (2016UL)
+
+/* Longest run, in physical ticks */
+#define MAX_TICKS (60 * RROSACE_DEFAULT_PHYSICAL_FREQ)
+/* Envelope checked every tenth of second */
+#define CHECK_TICKS (RROSACE_DEFAULT_PHYSICAL_FREQ / 10)
+#define ENVELOPE (50.0)
+#define MAX_VZ_C (5.0)
+
+enum result_index { DURATION, ALTITUDE, EXCEEDED, NB_RESULTS };
+
+static const char *const result_names[NB_RESULTS] = {"duration (s)",
+                                                     "altitude (m)",
+                                                     "exceeded"};
+
+static int run_func(rrosace_sim_t * /* p_sim */, size_t /* run */,
+                    void * /* p_arg */, double results[]);
+
+static int write_file(const rrosace_campaign_t * /* p_campaign */,
+                      const char * /* path */);
+
+static rrosace_campaign_t *read_file(const char * /* path */);
+
+static int run_shard(size_t /* shard */, size_t /* nb_shards */,
+                     size_t /* nb_runs */, const char * /* path */,
+                     size_t /* nb_workers */);
+
+static int merge(const char * /* output */, char *const * /* inputs */,
+                 size_t /* nb_inputs */);
+
+static int launch(size_t /* nb_shards */, size_t /* nb_runs */,
+                  const char * /* directory */);
+
+static int usage(const char * /* program */);
+
+/**
+ * @brief Run from trim at a vertical speed command drawn from the index of
+ * the run, until the envelope is left
+ */
+static int run_func(rrosace_sim_t *p_sim, size_t run, void *p_arg,
+                    double results[]) {
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+  unsigned long seed = SEED + (unsigned long)run * 2654435761UL;
+  double vz_c;
+  double deviation = 0.;
+  size_t ticks = 0;
+
+  (void)p_arg;
+
+  seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+  vz_c = MAX_VZ_C * (2. * (double)seed / (double)0x7fffffffUL - 1.);
+
+  if (rrosace_sim_set_commands(p_sim, RROSACE_H_EQ, vz_c, RROSACE_VA_EQ) ==
+      EXIT_FAILURE) {
+    return (EXIT_FAILURE);
+  }
+
+  while ((ticks < MAX_TICKS) && (deviation <= ENVELOPE)) {
+    if (rrosace_sim_run(p_sim, CHECK_TICKS) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+    ticks += CHECK_TICKS;
+    deviation = p_values->h - RROSACE_H_EQ;
+    if (deviation < 0.) {
+      deviation = -deviation;
+    }
+  }
+
+  results[DURATION] = (double)ticks / RROSACE_DEFAULT_PHYSICAL_FREQ;
+  results[ALTITUDE] = p_values->h;
+  results[EXCEEDED] = (deviation > ENVELOPE) ? 1. : 0.;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Write results in a temporary file, renamed once complete
+ */
+static int write_file(const rrosace_campaign_t *p_campaign, const char *path) {
+  int ret = EXIT_FAILURE;
+  const size_t size = rrosace_campaign_get_size(p_campaign);
+  unsigned char *buffer = (unsigned char *)malloc(size);
+  char *temporary = (char *)malloc(strlen(path) + 5);
+  FILE *p_file = NULL;
+
+  if (!buffer || !temporary ||
+      (rrosace_campaign_write(p_campaign, buffer, size) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  sprintf(temporary, "%s.tmp", path);
+  p_file = fopen(temporary, "wb");
+  if (!p_file || (fwrite(buffer, 1, size, p_file) != size)) {
+    goto out;
+  }
+  if (fclose(p_file)) {
+    p_file = NULL;
+    goto out;
+  }
+  p_file = NULL;
+
+  if (!rename(temporary, path)) {
+    ret = EXIT_SUCCESS;
+  }
+
+out:
+  if (p_file) {
+    fclose(p_file);
+  }
+  free(temporary);
+  free(buffer);
+
+  return (ret);
+}
+
+static rrosace_campaign_t *read_file(const char *path) {
+  rrosace_campaign_t *p_campaign = NULL;
+  unsigned char *buffer = NULL;
+  FILE *p_file = fopen(path, "rb");
+  long size;
+
+  if (!p_file || fseek(p_file, 0, SEEK_END) || ((size = ftell(p_file)) < 0) ||
+      fseek(p_file, 0, SEEK_SET)) {
+    goto out;
+  }
+
+  buffer = (unsigned char *)malloc(size ? (size_t)size : 1);
+  if (buffer && (fread(buffer, 1, (size_t)size, p_file) == (size_t)size)) {
+    p_campaign = rrosace_campaign_read(buffer, (size_t)size);
+  }
+
+out:
+  if (!p_campaign) {
+    fprintf(stderr, "Reading %s failed.\n", path);
+  }
+  if (p_file) {
+    fclose(p_file);
+  }
+  free(buffer);
+
+  return (p_campaign);
+}
+
+static int run_shard(size_t shard, size_t nb_shards, size_t nb_runs,
+                     const char *path, size_t nb_workers) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, 0., RROSACE_VA_EQ);
+  rrosace_campaign_t *p_campaign = rrosace_campaign_new(nb_runs, NB_RESULTS);
+
+  if (p_sim && p_campaign &&
+      (rrosace_campaign_run_shard(p_campaign, p_sim, nb_shards, shard,
+                                  nb_workers, run_func,
+                                  NULL) == EXIT_SUCCESS) &&
+      (write_file(p_campaign, path) == EXIT_SUCCESS)) {
+    ret = EXIT_SUCCESS;
+  } else {
+    fprintf(stderr, "Shard %lu failed.\n", (unsigned long)shard);
+  }
+
+  rrosace_campaign_del(p_campaign);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Merge pairs of inputs, then pairs of pairs, and print the statistics
+ */
+static int merge(const char *output, char *const *inputs, size_t nb_inputs) {
+  int ret = EXIT_FAILURE;
+  rrosace_campaign_t **p_campaigns = (rrosace_campaign_t **)calloc(
+      nb_inputs, sizeof(rrosace_campaign_t *));
+  size_t width;
+  size_t i;
+
+  if (!p_campaigns) {
+    goto out;
+  }
+
+  for (i = 0; i < nb_inputs; ++i) {
+    p_campaigns[i] = read_file(inputs[i]);
+    if (!p_campaigns[i]) {
+      goto out;
+    }
+  }
+
+  for (width = 1; width < nb_inputs; width *= 2) {
+    for (i = 0; i + width < nb_inputs; i += 2 * width) {
+      if (rrosace_campaign_merge(p_campaigns[i], p_campaigns[i + width]) ==
+          EXIT_FAILURE) {
+        fprintf(stderr, "Merging %s failed, not of the campaign or "
+                        "overlapping.\n",
+                inputs[i + width]);
+        goto out;
+      }
+    }
+  }
+
+  if (write_file(p_campaigns[0], output) == EXIT_FAILURE) {
+    goto out;
+  }
+
+  printf("%lu shards merged in %s: %lu runs done\n", (unsigned long)nb_inputs,
+         output, (unsigned long)rrosace_campaign_get_nb_done(p_campaigns[0]));
+  for (i = 0; i < NB_RESULTS; ++i) {
+    double mean;
+    double min;
+    double max;
+
+    if (rrosace_campaign_get_stats(p_campaigns[0], i, &mean, &min, &max) ==
+        EXIT_SUCCESS) {
+      printf("  %-13s mean %12.6f, min %12.6f, max %12.6f\n", result_names[i],
+             mean, min, max);
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  if (p_campaigns) {
+    for (i = 0; i < nb_inputs; ++i) {
+      rrosace_campaign_del(p_campaigns[i]);
+    }
+  }
+  free(p_campaigns);
+
+  return (ret);
+}
+
+/**
+ * @brief Run the shards in child processes, then merge their files
+ */
+static int launch(size_t nb_shards, size_t nb_runs, const char *directory) {
+  int ret = EXIT_SUCCESS;
+  char *paths[MAX_SHARDS + 1];
+  pid_t pids[MAX_SHARDS];
+  size_t shard;
+
+  memset(paths, 0, sizeof(paths));
+
+  for (shard = 0; shard <= nb_shards; ++shard) {
+    paths[shard] = (char *)malloc(strlen(directory) + 32);
+    if (!paths[shard]) {
+      ret = EXIT_FAILURE;
+      goto out;
+    }
+    if (shard < nb_shards) {
+      sprintf(paths[shard], "%s/shard_%lu.bin", directory,
+              (unsigned long)shard);
+    } else {
+      sprintf(paths[shard], "%s/campaign.bin", directory);
+    }
+  }
+
+  for (shard = 0; shard < nb_shards; ++shard) {
+    pids[shard] = fork();
+    if (!pids[shard]) {
+      _exit(run_shard(shard, nb_shards, nb_runs, paths[shard], 1));
+    }
+  }
+
+  for (shard = 0; shard < nb_shards; ++shard) {
+    int status;
+
+    if ((pids[shard] < 0) || (waitpid(pids[shard], &status, 0) < 0) ||
+        !WIFEXITED(status) || (WEXITSTATUS(status) != EXIT_SUCCESS)) {
+      ret = EXIT_FAILURE;
+    }
+  }
+
+  if (ret == EXIT_SUCCESS) {
+    ret = merge(paths[nb_shards], paths, nb_shards);
+  }
+
+out:
+  for (shard = 0; shard <= nb_shards; ++shard) {
+    free(paths[shard]);
+  }
+
+  return (ret);
+}
+
+static int usage(const char *program) {
+  fprintf(stderr,
+          "Usage: %s launch shards [runs [directory]]\n"
+          "       %s run shard shards runs file [workers]\n"
+          "       %s merge output input...\n",
+          program, program, program);
+
+  return (EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[]) {
+  if ((argc > 2) && !strcmp(argv[1], "launch") && (argc <= 5)) {
+    const size_t nb_shards = (size_t)atol(argv[2]);
+    const size_t nb_runs = (argc > 3) ? (size_t)atol(argv[3]) : NB_RUNS;
+
+    if (!nb_shards || (nb_shards > MAX_SHARDS) || !nb_runs) {
+      return (usage(argv[0]));
+    }
+
+    return (launch(nb_shards, nb_runs, (argc > 4) ? argv[4] : "."));
+  }
+
+  if ((argc >= 6) && !strcmp(argv[1], "run") && (argc <= 7)) {
+    const size_t shard = (size_t)atol(argv[2]);
+    const size_t nb_shards = (size_t)atol(argv[3]);
+    const size_t nb_runs = (size_t)atol(argv[4]);
+    const size_t nb_workers = (argc > 6) ? (size_t)atol(argv[6]) : 1;
+
+    if ((shard >= nb_shards) || !nb_runs || !nb_workers ||
+        (nb_workers > RROSACE_ENSEMBLE_MAX_WORKERS)) {
+      return (usage(argv[0]));
+    }
+
+    return (run_shard(shard, nb_shards, nb_runs, argv[5], nb_workers));
+  }
+
+  if ((argc >= 4) && !strcmp(argv[1], "merge")) {
+    return (merge(argv[2], &argv[3], (size_t)(argc - 3)));
+  }
+
+  return (usage(argv[0]));
+}
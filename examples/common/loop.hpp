@@ -0,0 +1,223 @@
+/**
+ * @file loop.hpp
+ * @brief RROSACE closed loop of the C++ models shared by the example tools,
+ * header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Same models and serial order as the C++ loop example, owned by a class so
+ * that several loops can be run from one tool.
+ */
+
+#ifndef LOOP_HPP
+#define LOOP_HPP
+
+#include <vector>
+
+#include <rrosace.h>
+
+namespace RROSACE {
+
+/** @class Loop
+ *  @brief Models of the simple loop, wired to their values, and their
+ * dataflow
+ */
+class Loop {
+public:
+  struct Values {
+    FlightMode::Mode mode;
+    double delta_e;
+    double delta_e_c_partial_1;
+    double delta_e_c_partial_2;
+    double delta_th_c_partial_1;
+    double delta_th_c_partial_2;
+    Cables::RelayState relay_delta_e_c_1;
+    Cables::RelayState relay_delta_e_c_2;
+    Cables::RelayState relay_delta_th_c_1;
+    Cables::RelayState relay_delta_th_c_2;
+    double delta_e_c;
+    double delta_th_c;
+    double t;
+    double h;
+    double vz;
+    double va;
+    double q;
+    double az;
+    double h_f;
+    double vz_f;
+    double va_f;
+    double q_f;
+    double az_f;
+    FlightControlComputer::MasterInLaw master_in_law_1;
+    FlightControlComputer::MasterInLaw master_in_law_2;
+    FlightControlComputer::MasterInLaw other_master_in_law_1;
+    FlightControlComputer::MasterInLaw other_master_in_law_2;
+    double h_c;
+    double vz_c;
+    double va_c;
+  };
+
+  /**
+   * @brief Loop constructor, at trim
+   * @param[in] vz_c The vertical speed command
+   */
+  explicit Loop(double vz_c = 2.5)
+      : m_values(trim(vz_c)),
+        engine(TAU, m_values.delta_th_c, m_values.t),
+        elevator(OMEGA, XI, m_values.delta_e_c, m_values.delta_e),
+        flight_dynamics(m_values.delta_e, m_values.t, m_values.h, m_values.vz,
+                        m_values.va, m_values.q, m_values.az),
+        h_filter(m_values.h, m_values.h_f),
+        vz_filter(m_values.vz, m_values.vz_f),
+        va_filter(m_values.va, m_values.va_f),
+        q_filter(m_values.q, m_values.q_f),
+        az_filter(m_values.az, m_values.az_f),
+        flight_mode(m_values.mode, m_values.mode),
+        fcu(m_values.h_c, m_values.vz_c, m_values.va_c, m_values.h_c,
+            m_values.vz_c, m_values.va_c),
+        fcc1a(m_values.mode, m_values.h_f, m_values.vz_f, m_values.va_f,
+              m_values.q_f, m_values.az_f, m_values.h_c, m_values.vz_c,
+              m_values.va_c, m_values.delta_e_c_partial_1,
+              m_values.delta_th_c_partial_1),
+        fcc1b(m_values.mode, m_values.h_f, m_values.vz_f, m_values.va_f,
+              m_values.q_f, m_values.az_f, m_values.h_c, m_values.vz_c,
+              m_values.va_c, m_values.delta_e_c_partial_1,
+              m_values.delta_th_c_partial_1, m_values.other_master_in_law_1,
+              m_values.relay_delta_e_c_1, m_values.relay_delta_th_c_1,
+              m_values.master_in_law_1),
+        fcc2a(m_values.mode, m_values.h_f, m_values.vz_f, m_values.va_f,
+              m_values.q_f, m_values.az_f, m_values.h_c, m_values.vz_c,
+              m_values.va_c, m_values.delta_e_c_partial_2,
+              m_values.delta_th_c_partial_2),
+        fcc2b(m_values.mode, m_values.h_f, m_values.vz_f, m_values.va_f,
+              m_values.q_f, m_values.az_f, m_values.h_c, m_values.vz_c,
+              m_values.va_c, m_values.delta_e_c_partial_2,
+              m_values.delta_th_c_partial_2, m_values.other_master_in_law_2,
+              m_values.relay_delta_e_c_2, m_values.relay_delta_th_c_2,
+              m_values.master_in_law_2),
+        cables(m_values.delta_e_c_partial_1, m_values.delta_th_c_partial_1,
+               m_values.relay_delta_e_c_1, m_values.relay_delta_th_c_1,
+               m_values.delta_e_c_partial_2, m_values.delta_th_c_partial_2,
+               m_values.relay_delta_e_c_2, m_values.relay_delta_th_c_2,
+               m_values.delta_e_c, m_values.delta_th_c),
+        m_dataflow(wire_models()) {}
+
+  /** Get the dataflow of the models */
+  const Dataflow &get_dataflow() const { return m_dataflow; }
+
+  /** Get the values exchanged by the models */
+  const Values &get_values() const { return m_values; }
+
+  /** Get the models, in serial order */
+  const Dataflow::Models &get_models() const {
+    return m_dataflow.get_models();
+  }
+
+#ifdef RROSACE_COROUTINES
+  /**
+   * @brief Spawn a task per model, in serial order, each stepping its model
+   * of its concrete type
+   * @param[in,out] scheduler The scheduler of the tasks
+   */
+  void spawn(Scheduler &scheduler) {
+    scheduler.spawn(run(engine, scheduler));
+    scheduler.spawn(run(elevator, scheduler));
+    scheduler.spawn(run(flight_dynamics, scheduler));
+    scheduler.spawn(run(h_filter, scheduler));
+    scheduler.spawn(run(vz_filter, scheduler));
+    scheduler.spawn(run(va_filter, scheduler));
+    scheduler.spawn(run(q_filter, scheduler));
+    scheduler.spawn(run(az_filter, scheduler));
+    scheduler.spawn(run(flight_mode, scheduler));
+    scheduler.spawn(run(fcu, scheduler));
+    scheduler.spawn(run(fcc1a, scheduler));
+    scheduler.spawn(run(fcc1b, scheduler));
+    scheduler.spawn(run(fcc2a, scheduler));
+    scheduler.spawn(run(fcc2b, scheduler));
+    scheduler.spawn(run(cables, scheduler));
+  }
+#endif /* RROSACE_COROUTINES */
+
+private:
+  Values m_values;
+  Engine engine;
+  Elevator elevator;
+  FlightDynamics flight_dynamics;
+  AltitudeFilter h_filter;
+  VerticalAirspeedFilter vz_filter;
+  TrueAirspeedFilter va_filter;
+  PitchRateFilter q_filter;
+  VerticalAccelerationFilter az_filter;
+  FlightMode flight_mode;
+  FlightControlUnit fcu;
+  FlightControlComputer fcc1a;
+  FlightControlComputer fcc1b;
+  FlightControlComputer fcc2a;
+  FlightControlComputer fcc2b;
+  Cables cables;
+  Dataflow m_dataflow;
+
+  Loop(const Loop &);
+  Loop &operator=(const Loop &);
+
+  static Values trim(double vz_c) {
+    const Values values = {RROSACE_COMMANDED,
+                           DELTA_E_EQ,
+                           DELTA_E_C_EQ,
+                           DELTA_E_C_EQ,
+                           DELTA_TH_C_EQ,
+                           DELTA_TH_C_EQ,
+                           RROSACE_RELAY_CLOSED,
+                           RROSACE_RELAY_OPENED,
+                           RROSACE_RELAY_CLOSED,
+                           RROSACE_RELAY_OPENED,
+                           DELTA_E_C_EQ,
+                           DELTA_TH_C_EQ,
+                           T_EQ,
+                           H_EQ,
+                           VZ_EQ,
+                           VA_EQ,
+                           Q_EQ,
+                           AZ_EQ,
+                           H_F_EQ,
+                           VZ_F_EQ,
+                           VA_F_EQ,
+                           Q_F_EQ,
+                           AZ_F_EQ,
+                           RROSACE_MASTER_IN_LAW,
+                           RROSACE_NOT_MASTER_IN_LAW,
+                           RROSACE_NOT_MASTER_IN_LAW,
+                           RROSACE_MASTER_IN_LAW,
+                           H_EQ,
+                           vz_c,
+                           VA_EQ};
+
+    return values;
+  }
+
+  Dataflow::Models wire_models() {
+    std::vector<Model *> models;
+
+    models.push_back(&engine);
+    models.push_back(&elevator);
+    models.push_back(&flight_dynamics);
+    models.push_back(&h_filter);
+    models.push_back(&vz_filter);
+    models.push_back(&va_filter);
+    models.push_back(&q_filter);
+    models.push_back(&az_filter);
+    models.push_back(&flight_mode);
+    models.push_back(&fcu);
+    models.push_back(&fcc1a);
+    models.push_back(&fcc1b);
+    models.push_back(&fcc2a);
+    models.push_back(&fcc2b);
+    models.push_back(&cables);
+
+    return models;
+  }
+};
+} /* namespace RROSACE */
+
+#endif /* LOOP_HPP */
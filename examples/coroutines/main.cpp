@@ -0,0 +1,134 @@
+/**
+ * @file main.cpp
+ * @Synopsis RROSACE thousands of loops as coroutines, sharing a small pool of
+ * threads.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Each loop has its own scheduler, resuming the tasks of its models at their
+ * releases. The pool advances all the schedulers one second at a time. The
+ * loops descend at various vertical speeds; the one at 2.5 m/s is checked
+ * against the serial C++ loop.
+ *
+ * Usage: example_coroutines [loops [threads [duration (s)]]]
+ */
+
+#include <time.h>
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <rrosace.h>
+
+#include "../common/loop.hpp"
+
+using namespace RROSACE;
+
+#define NB_LOOPS (1000)
+#define NB_THREADS (3)
+#define DURATION (50.0)
+#define VZ_C (2.5)
+
+/* Vertical speed commands, from 0.5 to 2.5 m/s */
+#define NB_VZ_C (5)
+
+static double now() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return static_cast<double>(ts.tv_sec) +
+         static_cast<double>(ts.tv_nsec) * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+  const size_t nb_loops =
+      argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : NB_LOOPS;
+  const size_t nb_threads =
+      argc > 2 ? static_cast<size_t>(std::atol(argv[2])) : NB_THREADS;
+  const double duration = argc > 3 ? std::atof(argv[3]) : DURATION;
+  const size_t nb_ticks =
+      static_cast<size_t>(duration * DEFAULT_PHYSICAL_FREQ);
+
+  if (!nb_loops || !nb_ticks || (argc > 4)) {
+    std::cerr << "Usage: " << argv[0] << " [loops [threads [duration (s)]]]"
+              << std::endl;
+    return (EXIT_FAILURE);
+  }
+
+  try {
+    std::vector<Loop *> loops;
+    std::vector<Scheduler *> schedulers;
+    double serial_h;
+    size_t nb_resumes = 0;
+
+    {
+      Loop loop(VZ_C);
+      ParallelExecutor executor(loop.get_dataflow(), 0);
+
+      for (size_t tick = 0; tick < nb_ticks; ++tick) {
+        executor.step();
+      }
+      serial_h = loop.get_values().h;
+    }
+
+    for (size_t i = 0; i < nb_loops; ++i) {
+      Loop *const p_loop = new Loop(VZ_C * static_cast<double>(
+                                                NB_VZ_C - i % NB_VZ_C) /
+                                    NB_VZ_C);
+      Scheduler *const p_scheduler = new Scheduler();
+
+      loops.push_back(p_loop);
+      schedulers.push_back(p_scheduler);
+      p_loop->spawn(*p_scheduler);
+    }
+
+    {
+      SchedulerPool pool(nb_threads);
+      const double start = now();
+      double time;
+
+      for (size_t tick = 0; tick < nb_ticks;) {
+        tick = std::min(nb_ticks,
+                        tick + static_cast<size_t>(DEFAULT_PHYSICAL_FREQ));
+        pool.run_until(schedulers, tick);
+      }
+      time = now() - start;
+
+      for (size_t i = 0; i < nb_loops; ++i) {
+        nb_resumes += schedulers[i]->get_nb_resumes();
+      }
+
+      std::cout << nb_loops << " loops, " << nb_threads + 1 << " threads, "
+                << std::fixed << std::setprecision(1) << duration
+                << " s flights: " << std::setprecision(3) << time
+                << " s, " << std::setprecision(1)
+                << static_cast<double>(nb_resumes) / time * 1e-6
+                << " M resumptions/s" << std::endl;
+    }
+
+    for (size_t i = 0; i < NB_VZ_C && i < nb_loops; ++i) {
+      std::cout << "  vz_c " << std::setprecision(1)
+                << loops[i]->get_values().vz_c << " m/s: h "
+                << std::setprecision(3) << loops[i]->get_values().h << " m"
+                << std::endl;
+    }
+    std::cout << (loops[0]->get_values().h == serial_h
+                      ? "Same altitude as the serial loop"
+                      : "Altitude differs from the serial loop")
+              << std::endl;
+
+    for (size_t i = 0; i < nb_loops; ++i) {
+      delete schedulers[i];
+      delete loops[i];
+    }
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return (EXIT_FAILURE);
+  }
+
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,190 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE bus latency between the cables and the actuators, on
+ * transport delay lines, and the cost of a line.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Each run climbs 100 m from trim, the elevator and the engine reading the
+ * commands of the cables a number of physical ticks late. The commands are
+ * delayed in place, between the cables writing them and the actuators
+ * reading them on the next tick. Then a bank of lines is stepped to time a
+ * line step.
+ *
+ * Usage: example_delays [duration (s)]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define DURATION (80.0)
+
+/* Climb of 100 m */
+#define H_C (RROSACE_H_EQ + 100.0)
+#define VZ_C (-2.5)
+#define VA_C (RROSACE_VA_EQ)
+
+/* Bank of lines timed */
+#define NB_LINES (1024)
+#define BANK_DELAY (8)
+#define BANK_TICKS (20000)
+
+static const size_t latencies[] = {0, 8, 16, 32, 48, 64, 96};
+
+static double now(void);
+
+static int climb(size_t /* nb_ticks */, double /* duration */);
+
+static int time_bank(void);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Climb with the actuator commands delayed, and print the overshoot
+ */
+static int climb(size_t nb_ticks, double duration) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+  rrosace_sim_values_t values;
+  rrosace_delay_line_t *p_delta_e_c = NULL;
+  rrosace_delay_line_t *p_delta_th_c = NULL;
+  const size_t nb_steps = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ);
+  double h_max = RROSACE_H_EQ;
+  double vz_max = 0.;
+  size_t step;
+
+  if (!p_sim) {
+    goto out;
+  }
+
+  values = *rrosace_sim_get_values(p_sim);
+  p_delta_e_c = rrosace_delay_line_new(nb_ticks, values.delta_e_c);
+  p_delta_th_c = rrosace_delay_line_new(nb_ticks, values.delta_th_c);
+  if (!p_delta_e_c || !p_delta_th_c) {
+    goto out;
+  }
+
+  for (step = 0; step < nb_steps; ++step) {
+    if (rrosace_sim_run(p_sim, 1) == EXIT_FAILURE) {
+      goto out;
+    }
+    values = *rrosace_sim_get_values(p_sim);
+    if ((rrosace_delay_line_step(p_delta_e_c, values.delta_e_c,
+                                 &values.delta_e_c) == EXIT_FAILURE) ||
+        (rrosace_delay_line_step(p_delta_th_c, values.delta_th_c,
+                                 &values.delta_th_c) == EXIT_FAILURE) ||
+        (rrosace_sim_set_values(p_sim, &values) == EXIT_FAILURE)) {
+      goto out;
+    }
+    if (values.h > h_max) {
+      h_max = values.h;
+    }
+    if (fabs(values.vz) > vz_max) {
+      vz_max = fabs(values.vz);
+    }
+  }
+
+  printf("%lu,%.0f,%.6f,%.6f,%.6f\n", (unsigned long)nb_ticks,
+         (double)nb_ticks * 1e3 / RROSACE_DEFAULT_PHYSICAL_FREQ, values.h,
+         h_max - H_C, vz_max);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_delay_line_del(p_delta_th_c);
+  rrosace_delay_line_del(p_delta_e_c);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Step a bank of lines, each on its own signal
+ */
+static int time_bank(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_delay_line_t *p_lines[NB_LINES];
+  double signals[NB_LINES];
+  double start;
+  double elapsed;
+  size_t tick;
+  size_t i;
+
+  for (i = 0; i < NB_LINES; ++i) {
+    p_lines[i] = rrosace_delay_line_new(BANK_DELAY, 0.);
+    signals[i] = 0.;
+  }
+  for (i = 0; i < NB_LINES; ++i) {
+    if (!p_lines[i]) {
+      goto out;
+    }
+  }
+
+  start = now();
+  for (tick = 0; tick < BANK_TICKS; ++tick) {
+    for (i = 0; i < NB_LINES; ++i) {
+      rrosace_delay_line_step(p_lines[i], (double)tick, &signals[i]);
+    }
+  }
+  elapsed = now() - start;
+
+  /* The last tick read is the delay before the last one written */
+  if (signals[NB_LINES - 1] != (double)(BANK_TICKS - 1 - BANK_DELAY)) {
+    fprintf(stderr, "Unexpected delayed value %f.\n", signals[NB_LINES - 1]);
+    goto out;
+  }
+
+  printf("%d lines of %d ticks, %.2f ns per line step\n", NB_LINES,
+         BANK_DELAY, elapsed * 1e9 / ((double)NB_LINES * BANK_TICKS));
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (i = 0; i < NB_LINES; ++i) {
+    rrosace_delay_line_del(p_lines[i]);
+  }
+
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_SUCCESS;
+  double duration = DURATION;
+  size_t i;
+
+  if (argc > 1) {
+    duration = strtod(argv[1], NULL);
+  }
+
+  printf("latency (ticks),latency (ms),altitude (m),overshoot (m),"
+         "largest vertical speed (m/s)\n");
+  for (i = 0; (i < sizeof(latencies) / sizeof(latencies[0])) &&
+              (ret == EXIT_SUCCESS);
+       ++i) {
+    ret = climb(latencies[i], duration);
+    if (ret == EXIT_FAILURE) {
+      fprintf(stderr, "Climb with a latency of %lu ticks failed.\n",
+              (unsigned long)latencies[i]);
+    }
+  }
+
+  if (ret == EXIT_SUCCESS) {
+    ret = time_bank();
+  }
+
+  return (ret);
+}
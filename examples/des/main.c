@@ -0,0 +1,99 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE FCCs at non harmonic rates, with phase offsets and
+ * jittered releases, on the discrete-event executor.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Each scenario descends from trim at 2.5 m/s with the COM and MON FCCs at
+ * their own rate. The other tasks keep their default rates.
+ *
+ * Usage: example_des [duration (s)]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rrosace.h>
+
+#define DURATION (50.0)
+#define VZ_C (2.5)
+#define SEED (2016UL)
+
+struct scenario {
+  const char *name;
+  unsigned long period;     /* ns */
+  unsigned long com_offset; /* ns */
+  unsigned long mon_offset; /* ns */
+  unsigned long jitter;     /* ns */
+};
+
+static const struct scenario scenarios[] = {
+    {"50 Hz (ticks)", 20000000UL, 0UL, 0UL, 0UL},
+    {"30 Hz", 33333333UL, 0UL, 0UL, 0UL},
+    {"60 Hz", 16666667UL, 0UL, 0UL, 0UL},
+    {"60 Hz, offset 2.5 ms", 16666667UL, 2500000UL, 2500000UL, 0UL},
+    {"60 Hz, MON 1 ms after COM", 16666667UL, 0UL, 1000000UL, 0UL},
+    {"60 Hz, jitter 2 ms", 16666667UL, 0UL, 0UL, 2000000UL},
+    {NULL, 0UL, 0UL, 0UL, 0UL}};
+
+static int run(const struct scenario * /* p_scenario */, double /* duration */);
+
+static int run(const struct scenario *p_scenario, double duration) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_des_t *p_des = rrosace_des_new(p_sim, SEED);
+  const rrosace_sim_values_t *p_values;
+
+  if (!p_des ||
+      (rrosace_des_set_timing(p_des, RROSACE_SIM_TASK_FCCS_COM,
+                              p_scenario->period, p_scenario->com_offset,
+                              p_scenario->jitter) == EXIT_FAILURE) ||
+      (rrosace_des_set_timing(p_des, RROSACE_SIM_TASK_FCCS_MON,
+                              p_scenario->period, p_scenario->mon_offset,
+                              p_scenario->jitter) == EXIT_FAILURE) ||
+      (rrosace_des_run_until(p_des, duration) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  p_values = rrosace_sim_get_values(p_sim);
+  printf("%s,%lu,%5.6f,%5.6f,%5.6f,%s\n", p_scenario->name,
+         (unsigned long)rrosace_des_get_nb_events(p_des), p_values->h,
+         p_values->vz, p_values->va,
+         p_values->master_in_laws[0] == RROSACE_MASTER_IN_LAW ? "first"
+                                                               : "second");
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_des_del(p_des);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_SUCCESS;
+  double duration = DURATION;
+  const struct scenario *p_scenario;
+
+  if (argc > 1) {
+    duration = atof(argv[1]);
+  }
+
+  if (!(duration > 0.) || (argc > 2)) {
+    fprintf(stderr, "Usage: %s [duration (s)]\n", argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  printf("FCCs,events,altitude (m),vertical speed (m/s),airspeed (m/s),couple "
+         "in law\n");
+  for (p_scenario = scenarios; p_scenario->name && (ret == EXIT_SUCCESS);
+       ++p_scenario) {
+    ret = run(p_scenario, duration);
+  }
+
+  return (ret);
+}
@@ -0,0 +1,215 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE ensemble of closed loops of heterogeneous lengths, run by
+ * work-stealing workers.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Each run follows a pseudo-random vertical speed command, and stops early
+ * once the altitude leaves the envelope, so that the runs last from a few
+ * seconds to the whole duration. The results are collected while the runs go
+ * on, then the campaign is timed from one worker up to the number given.
+ *
+ * Usage: example_ensemble [runs [max workers]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define NB_RUNS (256)
+#define MAX_WORKERS (8)
+#define SEED (2016UL)
+
+/* Longest run, in physical ticks */
+#define MAX_TICKS (60 * RROSACE_DEFAULT_PHYSICAL_FREQ)
+/* Envelope checked every tenth of second */
+#define CHECK_TICKS (RROSACE_DEFAULT_PHYSICAL_FREQ / 10)
+#define ENVELOPE (50.0)
+#define MAX_VZ_C (5.0)
+
+enum result_index { TICKS, ALTITUDE, EXCEEDED, NB_RESULTS };
+
+static double now(void);
+
+static int run_func(rrosace_sim_t * /* p_sim */, size_t /* run */,
+                    void * /* p_arg */, double results[]);
+
+static int campaign(const rrosace_sim_t * /* p_sim */, size_t /* nb_runs */,
+                    size_t /* nb_workers */, int /* verbose */,
+                    double * /* p_duration */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Run from trim at a vertical speed command drawn from the index of
+ * the run, until the envelope is left
+ */
+static int run_func(rrosace_sim_t *p_sim, size_t run, void *p_arg,
+                    double results[]) {
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+  unsigned long seed = SEED + (unsigned long)run * 2654435761UL;
+  double vz_c;
+  double deviation = 0.;
+  size_t ticks = 0;
+
+  (void)p_arg;
+
+  seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+  vz_c = MAX_VZ_C * (2. * (double)seed / (double)0x7fffffffUL - 1.);
+
+  if (rrosace_sim_set_commands(p_sim, RROSACE_H_EQ, vz_c, RROSACE_VA_EQ) ==
+      EXIT_FAILURE) {
+    return (EXIT_FAILURE);
+  }
+
+  while ((ticks < MAX_TICKS) && (deviation <= ENVELOPE)) {
+    if (rrosace_sim_run(p_sim, CHECK_TICKS) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+    ticks += CHECK_TICKS;
+    deviation = p_values->h - RROSACE_H_EQ;
+    if (deviation < 0.) {
+      deviation = -deviation;
+    }
+  }
+
+  results[TICKS] = (double)ticks;
+  results[ALTITUDE] = p_values->h;
+  results[EXCEEDED] = (deviation > ENVELOPE) ? 1. : 0.;
+
+  return (EXIT_SUCCESS);
+}
+
+static int campaign(const rrosace_sim_t *p_sim, size_t nb_runs,
+                    size_t nb_workers, int verbose, double *p_duration) {
+  int ret = EXIT_FAILURE;
+  rrosace_ensemble_t *p_ensemble;
+  const double start = now();
+  size_t runs[64];
+  size_t nb_collected = 0;
+  size_t nb_exceeded = 0;
+  double ticks = 0.;
+  size_t worker;
+
+  p_ensemble = rrosace_ensemble_new(p_sim, nb_workers, NB_RESULTS);
+  if (!p_ensemble || (rrosace_ensemble_start(p_ensemble, nb_runs, run_func,
+                                             NULL) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  /* Results consumed as the runs finish */
+  while (nb_collected < nb_runs) {
+    const size_t nb_new = rrosace_ensemble_collect(
+        p_ensemble, runs, sizeof(runs) / sizeof(runs[0]));
+    size_t i;
+
+    for (i = 0; i < nb_new; ++i) {
+      const double *p_results =
+          rrosace_ensemble_get_results(p_ensemble, runs[i]);
+
+      ticks += p_results[TICKS];
+      nb_exceeded += (p_results[EXCEEDED] != 0.);
+    }
+    nb_collected += nb_new;
+    if (!nb_new) {
+      struct timespec pause = {0, 1000000};
+
+      nanosleep(&pause, NULL);
+    }
+  }
+
+  if (rrosace_ensemble_wait(p_ensemble) == EXIT_FAILURE) {
+    goto out;
+  }
+  *p_duration = now() - start;
+
+  if (verbose) {
+    printf("%lu runs, %lu left the envelope, %.1f s simulated on average\n",
+           (unsigned long)nb_runs, (unsigned long)nb_exceeded,
+           ticks / (double)nb_runs / RROSACE_DEFAULT_PHYSICAL_FREQ);
+    for (worker = 0; worker < nb_workers; ++worker) {
+      size_t nb_worker_runs;
+      size_t nb_steals;
+
+      if (rrosace_ensemble_get_stats(p_ensemble, worker, &nb_worker_runs,
+                                     &nb_steals) == EXIT_FAILURE) {
+        goto out;
+      }
+      printf("  worker %lu: %lu runs, %lu stolen\n", (unsigned long)worker,
+             (unsigned long)nb_worker_runs, (unsigned long)nb_steals);
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_ensemble_del(p_ensemble);
+
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_SUCCESS;
+  size_t nb_runs = NB_RUNS;
+  size_t max_workers = MAX_WORKERS;
+  rrosace_sim_t *p_sim;
+  double reference = 0.;
+  size_t nb_workers;
+  size_t next;
+
+  if (argc > 1) {
+    nb_runs = (size_t)atol(argv[1]);
+  }
+  if (argc > 2) {
+    max_workers = (size_t)atol(argv[2]);
+  }
+
+  if (!nb_runs || !max_workers ||
+      (max_workers > RROSACE_ENSEMBLE_MAX_WORKERS) || (argc > 3)) {
+    fprintf(stderr, "Usage: %s [runs [max workers]]\n", argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  p_sim = rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, 0., RROSACE_VA_EQ);
+  if (!p_sim) {
+    fprintf(stderr, "Simulation creation failed.\n");
+    return (EXIT_FAILURE);
+  }
+
+  /* Powers of two workers, then the largest number */
+  for (nb_workers = 1; nb_workers; nb_workers = next) {
+    double duration;
+
+    if (campaign(p_sim, nb_runs, nb_workers, nb_workers == max_workers,
+                 &duration) == EXIT_FAILURE) {
+      fprintf(stderr, "Campaign failed.\n");
+      ret = EXIT_FAILURE;
+      break;
+    }
+    if (nb_workers == 1) {
+      reference = duration;
+    }
+    printf("%3lu workers: %.3f s, speedup %.2f\n", (unsigned long)nb_workers,
+           duration, reference / duration);
+    next = (nb_workers == max_workers)
+               ? 0
+               : ((2 * nb_workers < max_workers) ? 2 * nb_workers
+                                                  : max_workers);
+  }
+
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
@@ -0,0 +1,529 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE variable-step physical mode with zero-crossing events,
+ * compared with the fixed-step loop.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The cyber part keeps its sampling instants. Between two instants where a
+ * command reaches the physical part or a measure is sampled, the engine, the
+ * elevator and the flight dynamics take a single step, shortened to land on
+ * the altitude crossing the altitude hold switch, h_c +/- H_SWITCH. The
+ * altitude hold switch and the relays only change on the discrete FCC
+ * outputs, their events are therefore taken at the FCC instants.
+ *
+ * Usage: example_events [duration (s)]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace.h>
+
+#define DURATION (240.0)
+#define TIME_TOLERANCE (1e-6)
+#define MAX_EVENTS (64)
+
+/* Climb of 200 m, then descent back to the trim altitude */
+#define H_C (RROSACE_H_EQ + 200.0)
+#define VZ_C (-2.5)
+#define VA_C (RROSACE_VA_EQ + 5.0)
+
+/* Altitude, last state of the flight dynamics */
+#define H_INDEX (RROSACE_SIM_PHYSICAL_STATE_SIZE - 1)
+
+/* Altitude hold switch state of an FCC */
+#define FCC_SWITCH_INDEX (1)
+
+enum guard_index { BELOW_SWITCH, ABOVE_SWITCH, NB_GUARDS };
+
+enum event_kind { CROSSING, HOLD_SWITCH, RELAY };
+
+static const char *const event_names[] = {"altitude crossing",
+                                          "altitude hold switch", "relay"};
+
+struct event {
+  enum event_kind kind;
+  double time;
+};
+
+/** Events of a run */
+struct events_log {
+  struct event events[MAX_EVENTS];
+  size_t nb_events;
+  size_t nb_evaluations;
+};
+
+/** Tick of the fixed-step loop, watched for altitude crossings */
+struct fixed {
+  struct events_log *p_log;
+  double h_c;
+  double h_previous;
+  double time;
+};
+
+/** Physical part of the loop, stepped from any state over any duration */
+struct physical {
+  /* Copy of the loop whose physical tasks take the steps */
+  rrosace_sim_t *p_sim;
+  const rrosace_sim_t *p_loop;
+  double state[RROSACE_SIM_STATE_SIZE];
+  rrosace_sim_values_t outputs;
+  double h_c;
+  size_t nb_evaluations;
+};
+
+/** Discrete outputs of the cyber part watched for events */
+struct discrete {
+  double hold_switch;
+  rrosace_relay_state_t relay_delta_e_c[RROSACE_SIM_NB_FCCS_COUPLES];
+  rrosace_relay_state_t relay_delta_th_c[RROSACE_SIM_NB_FCCS_COUPLES];
+};
+
+static void log_event(struct events_log * /* p_log */,
+                      enum event_kind /* kind */, double /* time */);
+
+static int get_discrete(const rrosace_sim_t * /* p_sim */,
+                        struct discrete * /* p_discrete */);
+
+static int watch_discrete(const rrosace_sim_t * /* p_sim */, double /* time */,
+                          struct discrete * /* p_discrete */,
+                          struct events_log * /* p_log */);
+
+static double switch_guard(double /* h */, double /* h_c */,
+                           size_t /* guard */);
+
+static int physical_step(void * /* p_context */, const double * /* state_in */,
+                         double /* dt */, double * /* state_out */);
+
+static double physical_guard(void * /* p_context */, size_t /* guard */,
+                             const double * /* state */);
+
+static int get_physical_state(const rrosace_sim_t * /* p_sim */,
+                              double * /* state */);
+
+static int fixed_step(rrosace_sim_t * /* p_sim */,
+                      rrosace_sim_task_t /* task */, double /* dt */,
+                      void * /* p_arg */);
+
+static int cyber_step(rrosace_sim_t * /* p_sim */,
+                      rrosace_sim_task_t /* task */, double /* dt */,
+                      void * /* p_arg */);
+
+static size_t next_breakpoint(size_t /* tick */);
+
+static int run_fixed(size_t /* nb_ticks */, struct events_log * /* p_log */,
+                     double * /* p_h */);
+
+static int run_variable(size_t /* nb_ticks */, struct events_log * /* p_log */,
+                        double * /* p_h */);
+
+static void log_event(struct events_log *p_log, enum event_kind kind,
+                      double time) {
+  if (p_log->nb_events < MAX_EVENTS) {
+    p_log->events[p_log->nb_events].kind = kind;
+    p_log->events[p_log->nb_events].time = time;
+  }
+  ++p_log->nb_events;
+}
+
+static int get_discrete(const rrosace_sim_t *p_sim,
+                        struct discrete *p_discrete) {
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+  double state[RROSACE_SIM_STATE_SIZE];
+  size_t i;
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+    p_discrete->relay_delta_e_c[i] = p_values->relay_delta_e_c[i];
+    p_discrete->relay_delta_th_c[i] = p_values->relay_delta_th_c[i];
+  }
+
+  if (rrosace_sim_get_state(p_sim, state) == EXIT_FAILURE) {
+    return (EXIT_FAILURE);
+  }
+  p_discrete->hold_switch =
+      state[RROSACE_SIM_FCCS_STATE_OFFSET + FCC_SWITCH_INDEX];
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Log the changes of the discrete outputs since the last call
+ */
+static int watch_discrete(const rrosace_sim_t *p_sim, double time,
+                          struct discrete *p_discrete,
+                          struct events_log *p_log) {
+  struct discrete current;
+  size_t i;
+
+  if (get_discrete(p_sim, &current) == EXIT_FAILURE) {
+    return (EXIT_FAILURE);
+  }
+
+  if (current.hold_switch != p_discrete->hold_switch) {
+    log_event(p_log, HOLD_SWITCH, time);
+  }
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+    if ((current.relay_delta_e_c[i] != p_discrete->relay_delta_e_c[i]) ||
+        (current.relay_delta_th_c[i] != p_discrete->relay_delta_th_c[i])) {
+      log_event(p_log, RELAY, time);
+    }
+  }
+
+  *p_discrete = current;
+
+  return (EXIT_SUCCESS);
+}
+
+static double switch_guard(double h, double h_c, size_t guard) {
+  return (h - h_c +
+          (guard == BELOW_SWITCH ? RROSACE_FCC_H_SWITCH
+                                 : -RROSACE_FCC_H_SWITCH));
+}
+
+/**
+ * @brief Step the engine, the elevator and the flight dynamics of the loop
+ * from a state, with the commands held, the outputs at the start of the step
+ * being kept aside
+ */
+static int physical_step(void *p_context, const double *state_in, double dt,
+                         double *state_out) {
+  int ret = EXIT_FAILURE;
+  struct physical *p_physical = (struct physical *)p_context;
+  rrosace_sim_t *p_sim = p_physical->p_sim;
+  const rrosace_sim_t *p_loop = p_physical->p_loop;
+
+  ++p_physical->nb_evaluations;
+
+  memcpy(p_physical->state + RROSACE_SIM_PHYSICAL_STATE_OFFSET, state_in,
+         RROSACE_SIM_PHYSICAL_STATE_SIZE * sizeof(double));
+
+  if ((rrosace_sim_set_state(p_sim, p_physical->state) == EXIT_FAILURE) ||
+      (rrosace_sim_set_values(p_sim, rrosace_sim_get_values(p_loop)) ==
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  if ((rrosace_sim_step_task(p_sim, RROSACE_SIM_TASK_ELEVATOR, dt) ==
+       EXIT_FAILURE) ||
+      (rrosace_sim_step_task(p_sim, RROSACE_SIM_TASK_ENGINE, dt) ==
+       EXIT_FAILURE) ||
+      (rrosace_sim_step_task(p_sim, RROSACE_SIM_TASK_FLIGHT_DYNAMICS, dt) ==
+       EXIT_FAILURE)) {
+    goto out;
+  }
+  p_physical->outputs = *rrosace_sim_get_values(p_sim);
+
+  ret = get_physical_state(p_sim, state_out);
+
+out:
+  return (ret);
+}
+
+static double physical_guard(void *p_context, size_t guard,
+                             const double *state) {
+  const struct physical *p_physical = (const struct physical *)p_context;
+
+  return (switch_guard(state[H_INDEX], p_physical->h_c, guard));
+}
+
+static int get_physical_state(const rrosace_sim_t *p_sim, double *state) {
+  double sim_state[RROSACE_SIM_STATE_SIZE];
+
+  if (rrosace_sim_get_state(p_sim, sim_state) == EXIT_FAILURE) {
+    return (EXIT_FAILURE);
+  }
+  memcpy(state, sim_state + RROSACE_SIM_PHYSICAL_STATE_OFFSET,
+         RROSACE_SIM_PHYSICAL_STATE_SIZE * sizeof(double));
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Step a task of the fixed-step loop, the crossings being seen at the
+ * first tick past them
+ */
+static int fixed_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task, double dt,
+                      void *p_arg) {
+  struct fixed *p_fixed = (struct fixed *)p_arg;
+  double h;
+  size_t guard;
+
+  if (rrosace_sim_step_task(p_sim, task, dt) == EXIT_FAILURE) {
+    return (EXIT_FAILURE);
+  }
+
+  if (task == RROSACE_SIM_TASK_FLIGHT_DYNAMICS) {
+    h = rrosace_sim_get_values(p_sim)->h;
+
+    for (guard = 0; guard < NB_GUARDS; ++guard) {
+      const double g0 = switch_guard(p_fixed->h_previous, p_fixed->h_c, guard);
+      const double g = switch_guard(h, p_fixed->h_c, guard);
+
+      if (((g0 < 0.) && (g >= 0.)) || ((g0 > 0.) && (g <= 0.))) {
+        log_event(p_fixed->p_log, CROSSING, p_fixed->time);
+      }
+    }
+    p_fixed->h_previous = h;
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Step a cyber task, the physical part being stepped apart
+ */
+static int cyber_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task, double dt,
+                      void *p_arg) {
+  (void)p_arg;
+
+  return ((task > RROSACE_SIM_TASK_FLIGHT_DYNAMICS)
+              ? rrosace_sim_step_task(p_sim, task, dt)
+              : EXIT_SUCCESS);
+}
+
+/**
+ * @brief Next tick where the physical part has to be sampled or receives a
+ * new command: the 100 Hz filters sample it every 2 ticks, and the FCC
+ * commands computed every 4 ticks are applied at the next tick
+ */
+static size_t next_breakpoint(size_t tick) {
+  return (tick + ((tick % 4 == 2) ? 2 : 1));
+}
+
+/**
+ * @brief Reference, the loop at its fixed 200 Hz step
+ */
+static int run_fixed(size_t nb_ticks, struct events_log *p_log, double *p_h) {
+  int ret = EXIT_FAILURE;
+  const double dt = 1. / RROSACE_DEFAULT_PHYSICAL_FREQ;
+  rrosace_sim_t *p_sim;
+  struct fixed fixed;
+  struct discrete discrete;
+  double state[RROSACE_SIM_PHYSICAL_STATE_SIZE];
+  size_t tick;
+
+  p_sim = rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+  if (!p_sim || (get_discrete(p_sim, &discrete) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  fixed.p_log = p_log;
+  fixed.h_c = H_C;
+  fixed.h_previous = rrosace_sim_get_values(p_sim)->h;
+
+  for (tick = 0; tick < nb_ticks; ++tick) {
+    if (tick == nb_ticks / 2) {
+      if (rrosace_sim_set_commands(p_sim, RROSACE_H_EQ, VZ_C, VA_C) ==
+          EXIT_FAILURE) {
+        goto out;
+      }
+      fixed.h_c = RROSACE_H_EQ;
+    }
+
+    fixed.time = (double)tick * dt;
+    if ((rrosace_sim_run_delegated(p_sim, fixed_step, &fixed) ==
+         EXIT_FAILURE) ||
+        (watch_discrete(p_sim, fixed.time, &discrete, p_log) ==
+         EXIT_FAILURE)) {
+      goto out;
+    }
+    ++p_log->nb_evaluations;
+  }
+
+  if (get_physical_state(p_sim, state) == EXIT_FAILURE) {
+    goto out;
+  }
+  *p_h = state[H_INDEX];
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Variable-step physical mode, one physical step between two
+ * breakpoints, shortened at the altitude crossings
+ */
+static int run_variable(size_t nb_ticks, struct events_log *p_log,
+                        double *p_h) {
+  int ret = EXIT_FAILURE;
+  const double dt = 1. / RROSACE_DEFAULT_PHYSICAL_FREQ;
+  rrosace_sim_t *p_loop;
+  struct physical physical;
+  struct discrete discrete;
+  rrosace_events_t *p_events = NULL;
+  double state[RROSACE_SIM_PHYSICAL_STATE_SIZE];
+  size_t tick;
+  size_t i;
+
+  memset(&physical, 0, sizeof(physical));
+  p_loop = rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+  physical.p_sim = rrosace_sim_copy(p_loop);
+  physical.p_loop = p_loop;
+  physical.h_c = H_C;
+
+  if (!p_loop || !physical.p_sim ||
+      (rrosace_sim_get_state(p_loop, physical.state) == EXIT_FAILURE)) {
+    goto out;
+  }
+  memcpy(state, physical.state + RROSACE_SIM_PHYSICAL_STATE_OFFSET,
+         sizeof(state));
+
+  p_events = rrosace_events_new(RROSACE_SIM_PHYSICAL_STATE_SIZE, NB_GUARDS,
+                                physical_step, physical_guard, &physical);
+  if (!p_events || (get_discrete(p_loop, &discrete) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (tick = 0; tick < nb_ticks; tick = next_breakpoint(tick)) {
+    const size_t next = next_breakpoint(tick);
+    double remaining = (double)(next - tick) * dt;
+    int first = 1;
+
+    if ((tick < nb_ticks / 2) && (next > nb_ticks / 2)) {
+      fprintf(stderr, "Command change not on a breakpoint.\n");
+      goto out;
+    }
+    if (tick == nb_ticks / 2) {
+      if (rrosace_sim_set_commands(p_loop, RROSACE_H_EQ, VZ_C, VA_C) ==
+          EXIT_FAILURE) {
+        goto out;
+      }
+      physical.h_c = RROSACE_H_EQ;
+    }
+
+    while (remaining > TIME_TOLERANCE) {
+      double elapsed;
+      size_t guard;
+
+      if (rrosace_events_step(p_events, state, remaining, TIME_TOLERANCE,
+                              &elapsed, &guard) == EXIT_FAILURE) {
+        goto out;
+      }
+
+      /* The outputs at the breakpoint are those of its first step */
+      if (first) {
+        rrosace_sim_values_t values = *rrosace_sim_get_values(p_loop);
+
+        values.delta_e = physical.outputs.delta_e;
+        values.t = physical.outputs.t;
+        values.h = physical.outputs.h;
+        values.vz = physical.outputs.vz;
+        values.va = physical.outputs.va;
+        values.q = physical.outputs.q;
+        values.az = physical.outputs.az;
+        if (rrosace_sim_set_values(p_loop, &values) == EXIT_FAILURE) {
+          goto out;
+        }
+        first = 0;
+      }
+
+      if (guard != RROSACE_EVENTS_NO_EVENT) {
+        log_event(p_log, CROSSING,
+                  (double)tick * dt + ((double)(next - tick) * dt -
+                                       remaining + elapsed));
+      }
+      remaining -= elapsed;
+    }
+
+    /* The ticks between two breakpoints only carry unchanged cables */
+    for (i = tick; i < next; ++i) {
+      if (rrosace_sim_run_delegated(p_loop, cyber_step, NULL) ==
+          EXIT_FAILURE) {
+        goto out;
+      }
+    }
+    if (watch_discrete(p_loop, (double)tick * dt, &discrete, p_log) ==
+        EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  *p_h = state[H_INDEX];
+  p_log->nb_evaluations = physical.nb_evaluations;
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_events_del(p_events);
+  rrosace_sim_del(physical.p_sim);
+  rrosace_sim_del(p_loop);
+
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  double duration = DURATION;
+  struct events_log fixed;
+  struct events_log variable;
+  double h_fixed;
+  double h_variable;
+  size_t nb_ticks;
+  size_t i;
+
+  if (argc > 1) {
+    duration = atof(argv[1]);
+  }
+
+  nb_ticks = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ);
+  /* The command changes at half the flight, on a hyperperiod */
+  nb_ticks -= nb_ticks % 8;
+
+  if (!nb_ticks || (argc > 2)) {
+    fprintf(stderr, "Usage: %s [duration (s)]\n", argv[0]);
+    goto out;
+  }
+
+  memset(&fixed, 0, sizeof(fixed));
+  memset(&variable, 0, sizeof(variable));
+
+  if ((run_fixed(nb_ticks, &fixed, &h_fixed) == EXIT_FAILURE) ||
+      (run_variable(nb_ticks, &variable, &h_variable) == EXIT_FAILURE)) {
+    fprintf(stderr, "Simulation failed.\n");
+    goto out;
+  }
+
+  printf("flight of %.1f s, climb to %.0f m then back to %.0f m\n",
+         (double)nb_ticks / RROSACE_DEFAULT_PHYSICAL_FREQ, H_C, RROSACE_H_EQ);
+  printf("%-22s %14s %14s %12s\n", "event", "fixed (s)", "variable (s)",
+         "delta (s)");
+
+  for (i = 0; ((i < fixed.nb_events) || (i < variable.nb_events)) &&
+              (i < MAX_EVENTS);
+       ++i) {
+    const struct event *p_fixed =
+        (i < fixed.nb_events) ? &fixed.events[i] : NULL;
+    const struct event *p_variable =
+        (i < variable.nb_events) ? &variable.events[i] : NULL;
+
+    if (p_fixed && p_variable && (p_fixed->kind == p_variable->kind)) {
+      printf("%-22s %14.6f %14.6f %12.6f\n", event_names[p_fixed->kind],
+             p_fixed->time, p_variable->time,
+             p_variable->time - p_fixed->time);
+    } else {
+      printf("%-22s %14.6f %14s %12s\n",
+             p_fixed ? event_names[p_fixed->kind] : "-",
+             p_fixed ? p_fixed->time : 0., p_variable ? "mismatch" : "-",
+             "-");
+    }
+  }
+
+  printf("physical evaluations: fixed %lu, variable %lu (%.2f)\n",
+         (unsigned long)fixed.nb_evaluations,
+         (unsigned long)variable.nb_evaluations,
+         (double)variable.nb_evaluations / (double)fixed.nb_evaluations);
+  printf("final altitude: fixed %.6f m, variable %.6f m\n", h_fixed,
+         h_variable);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
@@ -0,0 +1,195 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE exploration of the orders of the FCCs and cables, the
+ * equivalent schedules merged.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The COM FCCs, MON FCCs and cables run in every order at each tick, with and
+ * without the COM FCCs before the MON ones. Orders reaching a same state are
+ * merged, so that the distinct trajectories are far fewer than the
+ * schedules.
+ *
+ * Usage: example_explore [horizon (ticks) [threads]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define HORIZON (20)
+#define NB_THREADS (3)
+#define MAX_STATES (1000000)
+
+/* Descent at 2.5 m/s */
+#define H_C (RROSACE_H_EQ)
+#define VZ_C (2.5)
+#define VA_C (RROSACE_VA_EQ)
+
+#define NB_EXPLORED (3)
+
+static const rrosace_sim_task_t explored[NB_EXPLORED] = {
+    RROSACE_SIM_TASK_FCCS_COM, RROSACE_SIM_TASK_FCCS_MON,
+    RROSACE_SIM_TASK_CABLES};
+
+static const char *const task_names[RROSACE_SIM_NB_TASKS] = {
+    "elevator", "engine", "fd",  "h_f",  "vz_f",     "va_f",  "q_f",
+    "az_f",     "mode",   "fcu", "com",  "mon",      "cables"};
+
+static double now(void);
+
+static void print_order(const rrosace_sim_task_t * /* order */);
+
+static int print_orders(const rrosace_explore_t * /* p_explore */,
+                        size_t /* trajectory */, size_t /* horizon */,
+                        size_t /* period */);
+
+static int explore(const rrosace_sim_t * /* p_sim */, size_t /* horizon */,
+                   size_t /* nb_threads */, int /* com_first */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Print the explored tasks of an order, in execution order
+ */
+static void print_order(const rrosace_sim_task_t *order) {
+  size_t i;
+  size_t k;
+
+  for (i = 0; i < RROSACE_SIM_NB_TASKS; ++i) {
+    for (k = 0; k < NB_EXPLORED; ++k) {
+      if (order[i] == explored[k]) {
+        printf(" %s", task_names[order[i]]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Print the orders of the ticks releasing the FCCs in a trajectory
+ */
+static int print_orders(const rrosace_explore_t *p_explore, size_t trajectory,
+                        size_t horizon, size_t period) {
+  size_t tick;
+
+  for (tick = 0; tick < horizon; tick += period) {
+    rrosace_sim_task_t order[RROSACE_SIM_NB_TASKS];
+
+    if (rrosace_explore_get_order(p_explore, trajectory, tick, order) ==
+        EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+    printf(tick ? " |" : "   ");
+    print_order(order);
+  }
+  printf("\n");
+
+  return (EXIT_SUCCESS);
+}
+
+static int explore(const rrosace_sim_t *p_sim, size_t horizon,
+                   size_t nb_threads, int com_first) {
+  int ret = EXIT_FAILURE;
+  rrosace_explore_t *p_explore;
+  const double start = now();
+  double nb_schedules = 0.;
+  size_t nb_simulated;
+  size_t nb_distinct;
+  size_t nb_trajectories;
+  size_t trajectory;
+
+  p_explore = rrosace_explore_new(p_sim, explored, NB_EXPLORED, nb_threads,
+                                  MAX_STATES);
+  if (!p_explore ||
+      (com_first && (rrosace_explore_add_precedence(
+                         p_explore, RROSACE_SIM_TASK_FCCS_COM,
+                         RROSACE_SIM_TASK_FCCS_MON) == EXIT_FAILURE)) ||
+      (rrosace_explore_run(p_explore, horizon) == EXIT_FAILURE) ||
+      (rrosace_explore_get_nb_states(p_explore, &nb_simulated,
+                                     &nb_distinct) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  nb_trajectories = rrosace_explore_get_nb_trajectories(p_explore);
+  for (trajectory = 0; trajectory < nb_trajectories; ++trajectory) {
+    nb_schedules += rrosace_explore_get_nb_schedules(p_explore, trajectory);
+  }
+
+  printf("%s: %.0f schedules, %lu ticks simulated, %lu distinct states, "
+         "%lu trajectories in %.3f s\n",
+         com_first ? "com before mon" : "any order", nb_schedules,
+         (unsigned long)nb_simulated, (unsigned long)nb_distinct,
+         (unsigned long)nb_trajectories, now() - start);
+
+  for (trajectory = 0; (trajectory < nb_trajectories) && (trajectory < 4);
+       ++trajectory) {
+    const rrosace_sim_values_t *p_values =
+        rrosace_sim_get_values(rrosace_explore_get_sim(p_explore, trajectory));
+
+    printf("  %.0f schedules, h %.9f m, delta_e_c %.12f, orders:\n",
+           rrosace_explore_get_nb_schedules(p_explore, trajectory), p_values->h,
+           p_values->delta_e_c);
+    if (print_orders(p_explore, trajectory, horizon,
+                     rrosace_sim_get_task_period(
+                         p_sim, RROSACE_SIM_TASK_FCCS_COM)) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_explore_del(p_explore);
+
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_SUCCESS;
+  size_t horizon = HORIZON;
+  size_t nb_threads = NB_THREADS;
+  rrosace_sim_t *p_sim;
+
+  if (argc > 1) {
+    horizon = (size_t)atol(argv[1]);
+  }
+  if (argc > 2) {
+    nb_threads = (size_t)atol(argv[2]);
+  }
+
+  if (!horizon || (nb_threads > RROSACE_EXPLORE_MAX_THREADS) || (argc > 3)) {
+    fprintf(stderr, "Usage: %s [horizon (ticks) [threads]]\n", argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  p_sim = rrosace_sim_new(RROSACE_COMMANDED, H_C, VZ_C, VA_C);
+  if (!p_sim) {
+    fprintf(stderr, "Simulation creation failed.\n");
+    return (EXIT_FAILURE);
+  }
+
+  printf("Orders of the COM FCCs, MON FCCs and cables over %lu ticks, %lu "
+         "threads\n",
+         (unsigned long)horizon, (unsigned long)nb_threads);
+
+  if ((explore(p_sim, horizon, nb_threads, 0) == EXIT_FAILURE) ||
+      (explore(p_sim, horizon, nb_threads, 1) == EXIT_FAILURE)) {
+    fprintf(stderr, "Exploration failed.\n");
+    ret = EXIT_FAILURE;
+  }
+
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
@@ -0,0 +1,209 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE release-jitter Monte Carlo of the COM and MON FCCs and the
+ * cables, reporting the jitter ranges opening the relays.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Each run speeds up by 5 m/s from trim, so that the throttle commands move
+ * fast. The COM and MON FCCs draw their first release offset, and the FCCs
+ * and the cables the largest release jitter and execution time of the run.
+ * A MON FCC released before its COM FCC checks the previous command, and
+ * opens its relays. The runs are binned by each jitter, the share of them
+ * opening a relay or changing a master in law printed by range, then the
+ * batch is timed.
+ *
+ * Usage: example_jitter [runs [duration (s)]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define NB_RUNS (2000)
+#define DURATION (2.0)
+#define NB_WORKERS (4)
+#define NB_RANGES (4)
+#define VZ_C (0.0)
+#define VA_STEP (5.0)
+#define SEED (2016UL)
+
+struct jitter_task {
+  const char *name;
+  rrosace_sim_task_t task;
+  rrosace_jitter_distribution_t offset;
+  rrosace_jitter_distribution_t release;
+  rrosace_jitter_distribution_t execution;
+};
+
+static const struct jitter_task jitter_tasks[] = {
+    {"COM FCCs",
+     RROSACE_SIM_TASK_FCCS_COM,
+     {RROSACE_JITTER_UNIFORM, 0UL, 4000000UL},
+     {RROSACE_JITTER_NORMAL, 0UL, 1000000UL},
+     {RROSACE_JITTER_UNIFORM, 200000UL, 2000000UL}},
+    {"MON FCCs",
+     RROSACE_SIM_TASK_FCCS_MON,
+     {RROSACE_JITTER_UNIFORM, 0UL, 4000000UL},
+     {RROSACE_JITTER_NORMAL, 0UL, 1000000UL},
+     {RROSACE_JITTER_UNIFORM, 200000UL, 2000000UL}},
+    {"cables",
+     RROSACE_SIM_TASK_CABLES,
+     {RROSACE_JITTER_NONE, 0UL, 0UL},
+     {RROSACE_JITTER_EXTREMES, 0UL, 500000UL},
+     {RROSACE_JITTER_UNIFORM, 0UL, 1000000UL}},
+    {NULL, RROSACE_SIM_NB_TASKS, {RROSACE_JITTER_NONE, 0UL, 0UL},
+     {RROSACE_JITTER_NONE, 0UL, 0UL},
+     {RROSACE_JITTER_NONE, 0UL, 0UL}}};
+
+static const char *feature_names[RROSACE_JITTER_NB_FEATURES] = {
+    "offset", "release", "execution"};
+
+static double now(void);
+
+static int report(const rrosace_jitter_t * /* p_jitter */,
+                  size_t /* nb_runs */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Print the runs opening a relay or changing a master in law, by
+ * jitter range
+ */
+static int report(const rrosace_jitter_t *p_jitter, size_t nb_runs) {
+  int ret = EXIT_FAILURE;
+  const struct jitter_task *p_task;
+  size_t nb_openings = 0;
+  size_t nb_changes = 0;
+  size_t run;
+
+  for (run = 0; run < nb_runs; ++run) {
+    rrosace_jitter_outcome_t outcome;
+
+    if (rrosace_jitter_get_outcome(p_jitter, run, &outcome) == EXIT_FAILURE) {
+      goto out;
+    }
+    nb_openings += (outcome.nb_openings > 0);
+    nb_changes += (outcome.nb_changes > 0);
+  }
+  printf("%lu runs, %lu opening a relay, %lu changing a master in law\n",
+         (unsigned long)nb_runs, (unsigned long)nb_openings,
+         (unsigned long)nb_changes);
+
+  printf("task,jitter,range (us),runs,openings (%%),changes (%%)\n");
+  for (p_task = jitter_tasks; p_task->name; ++p_task) {
+    const rrosace_jitter_distribution_t *laws[RROSACE_JITTER_NB_FEATURES];
+    size_t feature;
+
+    laws[RROSACE_JITTER_OFFSET] = &p_task->offset;
+    laws[RROSACE_JITTER_RELEASE] = &p_task->release;
+    laws[RROSACE_JITTER_EXECUTION] = &p_task->execution;
+
+    for (feature = 0; feature < RROSACE_JITTER_NB_FEATURES; ++feature) {
+      const double width =
+          (double)(laws[feature]->max - laws[feature]->min) / NB_RANGES;
+      size_t range;
+
+      if (laws[feature]->law == RROSACE_JITTER_NONE) {
+        continue;
+      }
+      for (range = 0; range < NB_RANGES; ++range) {
+        size_t nb_range_runs;
+        size_t nb_range_openings;
+        size_t nb_range_changes;
+
+        if (rrosace_jitter_get_range(
+                p_jitter, p_task->task, (rrosace_jitter_feature_t)feature,
+                NB_RANGES, range, &nb_range_runs, &nb_range_openings,
+                &nb_range_changes) == EXIT_FAILURE) {
+          goto out;
+        }
+        if (!nb_range_runs) {
+          continue;
+        }
+        printf("%s,%s,%.0f-%.0f,%lu,%.1f,%.1f\n", p_task->name,
+               feature_names[feature],
+               ((double)laws[feature]->min + (double)range * width) / 1e3,
+               ((double)laws[feature]->min + (double)(range + 1) * width) /
+                   1e3,
+               (unsigned long)nb_range_runs,
+               100. * (double)nb_range_openings / (double)nb_range_runs,
+               100. * (double)nb_range_changes / (double)nb_range_runs);
+      }
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  size_t nb_runs = NB_RUNS;
+  double duration = DURATION;
+  rrosace_sim_t *p_sim = NULL;
+  rrosace_jitter_t *p_jitter = NULL;
+  const struct jitter_task *p_task;
+  double start;
+  double elapsed;
+
+  if (argc > 1) {
+    nb_runs = (size_t)strtoul(argv[1], NULL, 10);
+  }
+  if (argc > 2) {
+    duration = strtod(argv[2], NULL);
+  }
+
+  p_sim = rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C,
+                          RROSACE_VA_EQ + VA_STEP);
+  p_jitter = rrosace_jitter_new(p_sim, NB_WORKERS);
+  if (!p_jitter) {
+    fprintf(stderr, "Release-jitter Monte Carlo creation failed.\n");
+    goto out;
+  }
+
+  for (p_task = jitter_tasks; p_task->name; ++p_task) {
+    if (rrosace_jitter_set_task(p_jitter, p_task->task, &p_task->offset,
+                                &p_task->release,
+                                &p_task->execution) == EXIT_FAILURE) {
+      fprintf(stderr, "Invalid jitters of the %s.\n", p_task->name);
+      goto out;
+    }
+  }
+
+  start = now();
+  if (rrosace_jitter_run(p_jitter, nb_runs, duration, SEED) == EXIT_FAILURE) {
+    fprintf(stderr, "Release-jitter Monte Carlo failed.\n");
+    goto out;
+  }
+  elapsed = now() - start;
+
+  if (report(p_jitter, nb_runs) == EXIT_FAILURE) {
+    fprintf(stderr, "Report failed.\n");
+    goto out;
+  }
+  printf("%lu schedules of %.1f s in %.3f s, %.0f schedules/s\n",
+         (unsigned long)nb_runs, duration, elapsed,
+         (double)nb_runs / elapsed);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_jitter_del(p_jitter);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
@@ -0,0 +1,284 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE FCCs run as lanes in their own processes, connected to
+ * the host by shared memory rings, and their exchange latency.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The COM and MON FCCs of each couple run in a lane process, pinned to its
+ * own core when there are enough. The host follows a descent, steps the four
+ * lanes at the FCC rate, posting the steps of a kind to all the lanes before
+ * waiting for them, and checks them against FCCs of its own. Then a lane is
+ * stepped back to back to measure the round trip of an exchange.
+ *
+ * Usage: example_lanes [exchanges]
+ */
+
+#ifdef __linux__
+/* Pinning of the lanes */
+#define _GNU_SOURCE
+#else
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rrosace.h>
+
+#define NB_EXCHANGES (100000)
+#define NB_COUPLES (2)
+#define NB_LANES (2 * NB_COUPLES)
+
+/* Descent at 2.5 m/s for 20 s */
+#define H_C (RROSACE_H_EQ)
+#define VZ_C (2.5)
+#define VA_C (RROSACE_VA_EQ)
+#define NB_TICKS (20 * RROSACE_DEFAULT_PHYSICAL_FREQ)
+
+/* Lanes of a couple, the COM one then the MON one */
+#define COM_LANE(couple) (2 * (couple))
+#define MON_LANE(couple) (2 * (couple) + 1)
+
+static double now(void);
+
+static void pin(size_t /* core */);
+
+static pid_t start_lane(rrosace_lane_t * /* p_lane */, size_t /* core */);
+
+static int follow(rrosace_lane_t ** /* p_lanes */);
+
+static int measure(rrosace_lane_t * /* p_lane */, size_t /* nb_exchanges */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+static void pin(size_t core) {
+#ifdef __linux__
+  const long nb_cores = sysconf(_SC_NPROCESSORS_ONLN);
+  cpu_set_t cores;
+
+  if (nb_cores > 0) {
+    CPU_ZERO(&cores);
+    CPU_SET((int)(core % (size_t)nb_cores), &cores);
+    sched_setaffinity(0, sizeof(cores), &cores);
+  }
+#else
+  (void)core;
+#endif
+}
+
+static pid_t start_lane(rrosace_lane_t *p_lane, size_t core) {
+  const pid_t pid = fork();
+
+  if (!pid) {
+    rrosace_fcc_t *p_fcc = rrosace_fcc_new();
+    int ret;
+
+    pin(core);
+    ret = p_fcc ? rrosace_lane_serve(p_lane, p_fcc) : EXIT_FAILURE;
+    rrosace_fcc_del(p_fcc);
+    _exit(ret);
+  }
+
+  return (pid);
+}
+
+/**
+ * @brief Step the lanes along a descent, against FCCs of the host
+ */
+static int follow(rrosace_lane_t **p_lanes) {
+  int ret = EXIT_FAILURE;
+  const double dt = 1. / RROSACE_FCC_DEFAULT_FREQ;
+  rrosace_sim_t *p_sim = rrosace_sim_new(RROSACE_COMMANDED, H_C, VZ_C, VA_C);
+  rrosace_fcc_t *p_fccs[NB_LANES];
+  size_t nb_steps = 0;
+  size_t nb_differences = 0;
+  const double start = now();
+  size_t tick;
+  size_t couple;
+  size_t lane;
+
+  for (lane = 0; lane < NB_LANES; ++lane) {
+    p_fccs[lane] = rrosace_fcc_new();
+  }
+
+  for (tick = 0; p_sim && (tick < NB_TICKS);
+       tick += RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_FCC_DEFAULT_FREQ) {
+    const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+    double delta_e_c[NB_COUPLES][2];
+    double delta_th_c[NB_COUPLES][2];
+    rrosace_relay_state_t relays[NB_COUPLES][2][2];
+    rrosace_master_in_law_t master_in_laws[NB_COUPLES][2];
+
+    if (rrosace_sim_run(p_sim, RROSACE_DEFAULT_PHYSICAL_FREQ /
+                                   RROSACE_FCC_DEFAULT_FREQ) == EXIT_FAILURE) {
+      goto out;
+    }
+
+    /* COM lanes stepped together, then the MON ones */
+    for (couple = 0; couple < NB_COUPLES; ++couple) {
+      if (!p_fccs[COM_LANE(couple)] ||
+          (rrosace_lane_post_com(p_lanes[COM_LANE(couple)], p_values->mode,
+                                 p_values->h_f, p_values->vz_f, p_values->va_f,
+                                 p_values->q_f, p_values->az_f, p_values->h_c,
+                                 p_values->vz_c, p_values->va_c,
+                                 dt) == EXIT_FAILURE) ||
+          (rrosace_fcc_com_step(p_fccs[COM_LANE(couple)], p_values->mode,
+                                p_values->h_f, p_values->vz_f, p_values->va_f,
+                                p_values->q_f, p_values->az_f, p_values->h_c,
+                                p_values->vz_c, p_values->va_c,
+                                &delta_e_c[couple][0], &delta_th_c[couple][0],
+                                dt) == EXIT_FAILURE)) {
+        goto out;
+      }
+    }
+    for (couple = 0; couple < NB_COUPLES; ++couple) {
+      if (rrosace_lane_wait_com(p_lanes[COM_LANE(couple)],
+                                &delta_e_c[couple][1],
+                                &delta_th_c[couple][1]) == EXIT_FAILURE) {
+        goto out;
+      }
+      nb_differences += (delta_e_c[couple][0] != delta_e_c[couple][1]) ||
+                        (delta_th_c[couple][0] != delta_th_c[couple][1]);
+    }
+
+    for (couple = 0; couple < NB_COUPLES; ++couple) {
+      if (!p_fccs[MON_LANE(couple)] ||
+          (rrosace_lane_post_mon(
+               p_lanes[MON_LANE(couple)], p_values->mode, p_values->h_f,
+               p_values->vz_f, p_values->va_f, p_values->q_f, p_values->az_f,
+               p_values->h_c, p_values->vz_c, p_values->va_c,
+               delta_e_c[couple][1], delta_th_c[couple][1],
+               p_values->other_master_in_laws[couple], dt) == EXIT_FAILURE) ||
+          (rrosace_fcc_mon_step(
+               p_fccs[MON_LANE(couple)], p_values->mode, p_values->h_f,
+               p_values->vz_f, p_values->va_f, p_values->q_f, p_values->az_f,
+               p_values->h_c, p_values->vz_c, p_values->va_c,
+               delta_e_c[couple][0], delta_th_c[couple][0],
+               p_values->other_master_in_laws[couple], &relays[couple][0][0],
+               &relays[couple][1][0], &master_in_laws[couple][0],
+               dt) == EXIT_FAILURE)) {
+        goto out;
+      }
+    }
+    for (couple = 0; couple < NB_COUPLES; ++couple) {
+      if (rrosace_lane_wait_mon(p_lanes[MON_LANE(couple)],
+                                &relays[couple][0][1], &relays[couple][1][1],
+                                &master_in_laws[couple][1]) == EXIT_FAILURE) {
+        goto out;
+      }
+      nb_differences +=
+          (relays[couple][0][0] != relays[couple][0][1]) ||
+          (relays[couple][1][0] != relays[couple][1][1]) ||
+          (master_in_laws[couple][0] != master_in_laws[couple][1]);
+    }
+    nb_steps += NB_LANES;
+  }
+
+  printf("%lu lane steps along %.0f s of descent in %.3f s, %lu differing "
+         "from the host FCCs\n",
+         (unsigned long)nb_steps,
+         (double)NB_TICKS / RROSACE_DEFAULT_PHYSICAL_FREQ, now() - start,
+         (unsigned long)nb_differences);
+
+  ret = nb_differences ? EXIT_FAILURE : EXIT_SUCCESS;
+
+out:
+  for (lane = 0; lane < NB_LANES; ++lane) {
+    rrosace_fcc_del(p_fccs[lane]);
+  }
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Step a lane back to back, and print the round trip of an exchange
+ */
+static int measure(rrosace_lane_t *p_lane, size_t nb_exchanges) {
+  const double dt = 1. / RROSACE_FCC_DEFAULT_FREQ;
+  double delta_e_c;
+  double delta_th_c;
+  double start;
+  size_t exchange;
+
+  /* Warm up, the lane spinning */
+  for (exchange = 0; exchange < nb_exchanges / 10 + 1; ++exchange) {
+    if (rrosace_lane_com_step(p_lane, RROSACE_COMMANDED, RROSACE_H_F_EQ,
+                              RROSACE_VZ_F_EQ, RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                              RROSACE_AZ_F_EQ, H_C, VZ_C, VA_C, &delta_e_c,
+                              &delta_th_c, dt) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+  }
+
+  start = now();
+  for (exchange = 0; exchange < nb_exchanges; ++exchange) {
+    if (rrosace_lane_com_step(p_lane, RROSACE_COMMANDED, RROSACE_H_F_EQ,
+                              RROSACE_VZ_F_EQ, RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                              RROSACE_AZ_F_EQ, H_C, VZ_C, VA_C, &delta_e_c,
+                              &delta_th_c, dt) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+  }
+
+  printf("%lu COM steps of a lane: %.0f ns per round trip, step included\n",
+         (unsigned long)nb_exchanges,
+         (now() - start) * 1e9 / (double)nb_exchanges);
+
+  return (EXIT_SUCCESS);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_SUCCESS;
+  const size_t nb_exchanges =
+      (argc > 1) ? (size_t)atol(argv[1]) : NB_EXCHANGES;
+  rrosace_lane_t *p_lanes[NB_LANES];
+  pid_t pids[NB_LANES];
+  size_t lane;
+
+  if ((argc > 2) || !nb_exchanges) {
+    fprintf(stderr, "Usage: %s [exchanges]\n", argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  /* Host on the first core, lanes on the next ones */
+  pin(0);
+  for (lane = 0; lane < NB_LANES; ++lane) {
+    p_lanes[lane] = rrosace_lane_new();
+    pids[lane] = p_lanes[lane] ? start_lane(p_lanes[lane], lane + 1) : -1;
+    if (pids[lane] < 0) {
+      fprintf(stderr, "Lane creation failed.\n");
+      ret = EXIT_FAILURE;
+    }
+  }
+
+  if ((ret == EXIT_SUCCESS) &&
+      ((follow(p_lanes) == EXIT_FAILURE) ||
+       (measure(p_lanes[COM_LANE(0)], nb_exchanges) == EXIT_FAILURE))) {
+    fprintf(stderr, "Lanes failed.\n");
+    ret = EXIT_FAILURE;
+  }
+
+  for (lane = 0; lane < NB_LANES; ++lane) {
+    if (pids[lane] > 0) {
+      rrosace_lane_stop(p_lanes[lane]);
+      waitpid(pids[lane], NULL, 0);
+    }
+    rrosace_lane_del(p_lanes[lane]);
+  }
+
+  return (ret);
+}
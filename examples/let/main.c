@@ -0,0 +1,155 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE Logical Execution Time semantics, serial, with the
+ * cyber partition on its own thread and with a thread per rate group, against
+ * the immediate one.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * With LET, every model reads its inputs at its release and publishes its
+ * outputs at its deadline, so the cyber and physical partitions exchange data
+ * only at these instants. The concurrent runs give the same trajectory as the
+ * serial one; all lag the immediate semantics by the added delays.
+ *
+ * Usage: example_let [duration (s)]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define DURATION (50.0)
+#define VZ_C (2.5)
+
+enum run_index { IMMEDIATE, LET, LET_CONCURRENT, LET_RATE_GROUPS, NB_RUNS };
+
+static const char *const run_names[NB_RUNS] = {
+    "immediate", "LET", "concurrent LET", "rate groups LET"};
+
+static const rrosace_sim_semantics_t run_semantics[NB_RUNS] = {
+    RROSACE_SIM_IMMEDIATE, RROSACE_SIM_LET, RROSACE_SIM_LET_CONCURRENT,
+    RROSACE_SIM_LET_RATE_GROUPS};
+
+static rrosace_sim_t *new_sim(enum run_index /* run */);
+
+static double now(void);
+
+static rrosace_sim_t *new_sim(enum run_index run) {
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+
+  if (p_sim &&
+      (rrosace_sim_set_semantics(p_sim, run_semantics[run]) == EXIT_FAILURE)) {
+    rrosace_sim_del(p_sim);
+    p_sim = NULL;
+  }
+
+  return (p_sim);
+}
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  double duration = DURATION;
+  size_t nb_ticks;
+  rrosace_sim_t *p_sims[NB_RUNS] = {NULL, NULL, NULL, NULL};
+  double times[NB_RUNS] = {0., 0., 0., 0.};
+  double deviation = 0.;
+  int identical = 1;
+  size_t tick;
+  size_t run;
+
+  if (argc > 1) {
+    duration = atof(argv[1]);
+  }
+
+  nb_ticks = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ);
+
+  if (!nb_ticks || (argc > 2)) {
+    fprintf(stderr, "Usage: %s [duration (s)]\n", argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  /* Whole runs, timed */
+  for (run = 0; run < NB_RUNS; ++run) {
+    double start;
+
+    p_sims[run] = new_sim((enum run_index)run);
+    if (!p_sims[run]) {
+      goto out;
+    }
+
+    start = now();
+
+    if (rrosace_sim_run(p_sims[run], nb_ticks) == EXIT_FAILURE) {
+      goto out;
+    }
+    times[run] = now() - start;
+    rrosace_sim_del(p_sims[run]);
+    p_sims[run] = NULL;
+  }
+
+  /* Tick by tick runs, compared */
+  for (run = 0; run < NB_RUNS; ++run) {
+    p_sims[run] = new_sim((enum run_index)run);
+    if (!p_sims[run]) {
+      goto out;
+    }
+  }
+
+  for (tick = 0; tick < nb_ticks; ++tick) {
+    const rrosace_sim_values_t *p_values[NB_RUNS];
+
+    for (run = 0; run < NB_RUNS; ++run) {
+      if (rrosace_sim_run(p_sims[run], 1) == EXIT_FAILURE) {
+        goto out;
+      }
+      p_values[run] = rrosace_sim_get_values(p_sims[run]);
+    }
+
+    for (run = LET_CONCURRENT; run < NB_RUNS; ++run) {
+      if ((p_values[LET]->h != p_values[run]->h) ||
+          (p_values[LET]->vz != p_values[run]->vz) ||
+          (p_values[LET]->va != p_values[run]->va)) {
+        identical = 0;
+      }
+    }
+    if (fabs(p_values[LET]->h - p_values[IMMEDIATE]->h) > deviation) {
+      deviation = fabs(p_values[LET]->h - p_values[IMMEDIATE]->h);
+    }
+  }
+
+  printf("semantics,time (s),altitude (m),vertical speed (m/s),airspeed "
+         "(m/s)\n");
+  for (run = 0; run < NB_RUNS; ++run) {
+    const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sims[run]);
+
+    printf("%s,%.4f,%5.6f,%5.6f,%5.6f\n", run_names[run], times[run],
+           p_values->h, p_values->vz, p_values->va);
+  }
+  printf("LET largest altitude deviation from immediate: %.6f m\n", deviation);
+  printf("Concurrent LETs identical to serial LET: %s\n",
+         identical ? "yes" : "no");
+
+  ret = identical ? EXIT_SUCCESS : EXIT_FAILURE;
+
+out:
+  for (run = 0; run < NB_RUNS; ++run) {
+    rrosace_sim_del(p_sims[run]);
+  }
+
+  return (ret);
+}
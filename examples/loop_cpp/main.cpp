@@ -1,3 +1,4 @@
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <limits>
@@ -132,20 +133,23 @@ private:
   Values m_values;
   Models m_models;
   double m_time;
-  size_t m_logical_time;
   double m_limit;
+  /* Producer/consumer graph of the models, and its schedule */
+  Dataflow m_dataflow;
+  ParallelExecutor m_executor;
 
   void step();
   void print() const;
 
 public:
-  Simulation(Values values, double limit);
+  Simulation(Values values, double limit, size_t nb_threads);
   void loop();
 };
 
-Simulation::Simulation(Values values, double limit)
-    : m_values(values), m_models(m_values), m_time(0.), m_logical_time(0),
-      m_limit(limit) {}
+Simulation::Simulation(Values values, double limit, size_t nb_threads)
+    : m_values(values), m_models(m_values), m_time(0.), m_limit(limit),
+      m_dataflow(m_models.get_access_vector()),
+      m_executor(m_dataflow, nb_threads) {}
 
 void Simulation::loop() {
   for (m_time = 0.; m_time < m_limit;) {
@@ -155,27 +159,18 @@ void Simulation::loop() {
 }
 
 void Simulation::step() {
-  static std::vector<Model *> models_access_vector =
-      m_models.get_access_vector();
-
-  for (std::vector<Model *>::iterator model_access_it =
-           models_access_vector.begin();
-       model_access_it != models_access_vector.end(); ++model_access_it) {
-    Model *const model_access = *model_access_it;
-    const size_t model_period =
-        static_cast<size_t>(DEFAULT_PHYSICAL_FREQ * model_access->get_dt());
-    if (m_logical_time % model_period == 0) {
-      model_access->step();
-    }
-  }
+  m_executor.step();
 
-  m_time = (++m_logical_time) * (1. / DEFAULT_PHYSICAL_FREQ);
+  m_time = m_executor.get_logical_time() * (1. / DEFAULT_PHYSICAL_FREQ);
 }
 
 void Simulation::print() const { m_values.print(m_time); }
 
-int main() {
+int main(int argc, char *argv[]) {
   const double limit = 50.0;
+  /* Threads helping the main one, serial by default */
+  const size_t nb_threads =
+      argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 0;
 
   const Simulation::Values values = {RROSACE_COMMANDED,
                                      DELTA_E_EQ,
@@ -211,7 +206,7 @@ int main() {
   std::cout << "time (s),altitude (m),vertical speed (m/s),airspeed (m/s)"
             << std::endl;
 
-  Simulation(values, limit).loop();
+  Simulation(values, limit, nb_threads).loop();
 
   return (EXIT_SUCCESS);
 }
@@ -0,0 +1,236 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE real-time run under load spikes of the flight dynamics,
+ * with each policy on overrun.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The flight dynamics have a budget, and for a burst in the middle of the
+ * run their steps take most of the period. An optional observer, formatting
+ * the values as a log would, takes another part of it. Each policy is run on
+ * the same spikes: the deadline overruns of the ticks, the steps over budget
+ * and the events recorded are printed for each one, and the first events of
+ * the degraded run.
+ *
+ * Usage: example_overruns [duration (s)]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define DURATION (2.0)
+#define VZ_C (2.5)
+#define US (1e6)
+
+/* Spikes of the flight dynamics, over the second quarter of the run */
+#define SPIKE (4e-3)
+#define BUDGET (1e-3)
+/* Cost of the optional observer */
+#define LOGGING (1.5e-3)
+
+#define NB_RECOVERY (20)
+#define NB_EVENTS (4096)
+#define NB_PRINTED (8)
+
+struct load {
+  size_t burst_start;
+  size_t burst_end;
+};
+
+static const char *const policies[RROSACE_RT_NB_POLICIES] = {
+    "record", "skip", "hold", "degrade", "shed"};
+
+static const char *const kinds[] = {"overrun", "skipped", "held", "degraded",
+                                    "shed"};
+
+static double now(void);
+
+static void busy_wait(double /* duration */);
+
+static int spiking_step(rrosace_sim_t * /* p_sim */,
+                        rrosace_sim_task_t /* task */, double /* dt */,
+                        void * /* p_arg */);
+
+static int fast_step(rrosace_sim_t * /* p_sim */, rrosace_sim_task_t /* task */,
+                     double /* dt */, void * /* p_arg */);
+
+static void log_values(const rrosace_sim_t * /* p_sim */, void * /* p_arg */);
+
+static int run(rrosace_rt_policy_t /* policy */, size_t /* nb_ticks */,
+               rrosace_rt_event_t /* first */[], size_t * /* p_nb_first */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+static void busy_wait(double duration) {
+  const double end = now() + duration;
+
+  while (now() < end) {
+  }
+}
+
+/**
+ * @brief Nominal step of the flight dynamics, spiking during the burst
+ */
+static int spiking_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                        double dt, void *p_arg) {
+  const struct load *p_load = (const struct load *)p_arg;
+  const size_t tick = rrosace_sim_get_logical_time(p_sim);
+
+  if ((tick >= p_load->burst_start) && (tick < p_load->burst_end)) {
+    busy_wait(SPIKE);
+  }
+
+  return (rrosace_sim_step_task(p_sim, task, dt));
+}
+
+/**
+ * @brief Cheaper step of the flight dynamics, without the spikes
+ */
+static int fast_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task, double dt,
+                     void *p_arg) {
+  (void)p_arg;
+
+  return (rrosace_sim_step_task(p_sim, task, dt));
+}
+
+/**
+ * @brief Optional observer, formatting the values
+ */
+static void log_values(const rrosace_sim_t *p_sim, void *p_arg) {
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+
+  sprintf((char *)p_arg, "%.6f,%.6f,%.6f,%.6f", rrosace_sim_get_time(p_sim),
+          p_values->h, p_values->vz, p_values->va);
+  busy_wait(LOGGING);
+}
+
+/**
+ * @brief Run a policy, print its line, and keep its first events
+ */
+static int run(rrosace_rt_policy_t policy, size_t nb_ticks,
+               rrosace_rt_event_t first[], size_t *p_nb_first) {
+  int ret = EXIT_FAILURE;
+  rrosace_rt_config_t config;
+  rrosace_rt_budget_t budget;
+  rrosace_rt_t *p_rt = NULL;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_rt_stats_t stats;
+  rrosace_rt_event_t events[NB_EVENTS];
+  size_t nb_kinds[sizeof(kinds) / sizeof(kinds[0])];
+  struct load load;
+  char line[128];
+  size_t nb_events;
+  size_t i;
+
+  load.burst_start = nb_ticks / 4;
+  load.burst_end = nb_ticks / 2;
+
+  rrosace_rt_default_config(&config);
+  config.nb_events = NB_EVENTS;
+  p_rt = rrosace_rt_new(&config);
+  if (!p_rt || !p_sim) {
+    fprintf(stderr, "Executor or simulation creation failed.\n");
+    goto out;
+  }
+
+  memset(&budget, 0, sizeof(budget));
+  budget.budget = BUDGET;
+  budget.policy = policy;
+  budget.nb_recovery = NB_RECOVERY;
+  budget.step = spiking_step;
+  budget.degraded = fast_step;
+  budget.p_arg = &load;
+  if ((rrosace_rt_set_budget(p_rt, RROSACE_SIM_TASK_FLIGHT_DYNAMICS,
+                             &budget) == EXIT_FAILURE) ||
+      (rrosace_rt_add_observer(p_rt, log_values, line, 1) == EXIT_FAILURE)) {
+    fprintf(stderr, "Budget or observer refused.\n");
+    goto out;
+  }
+
+  if (rrosace_rt_run(p_rt, p_sim, nb_ticks) == EXIT_FAILURE) {
+    fprintf(stderr, "Run failed.\n");
+    goto out;
+  }
+
+  rrosace_rt_get_stats(p_rt, &stats);
+  nb_events = rrosace_rt_get_events(p_rt, 0, NB_EVENTS, events);
+
+  memset(nb_kinds, 0, sizeof(nb_kinds));
+  for (i = 0; i < nb_events; ++i) {
+    ++nb_kinds[events[i].kind];
+  }
+
+  printf("%-8s %9lu %8lu %8lu %8lu %8lu %8lu %8.0f %11.3f\n", policies[policy],
+         (unsigned long)stats.nb_overruns,
+         (unsigned long)
+             stats.nb_task_overruns[RROSACE_SIM_TASK_FLIGHT_DYNAMICS],
+         (unsigned long)nb_kinds[RROSACE_RT_EVENT_SKIPPED],
+         (unsigned long)nb_kinds[RROSACE_RT_EVENT_HELD],
+         (unsigned long)nb_kinds[RROSACE_RT_EVENT_DEGRADED],
+         (unsigned long)nb_kinds[RROSACE_RT_EVENT_SHED], stats.exec_max * US,
+         rrosace_sim_get_values(p_sim)->h);
+
+  for (i = 0; (i < nb_events) && (i < NB_PRINTED); ++i) {
+    first[i] = events[i];
+  }
+  *p_nb_first = i;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_rt_del(p_rt);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_SUCCESS;
+  double duration = DURATION;
+  rrosace_rt_event_t first[RROSACE_RT_NB_POLICIES][NB_PRINTED];
+  size_t nb_first[RROSACE_RT_NB_POLICIES];
+  size_t nb_ticks;
+  size_t policy;
+  size_t i;
+
+  if (argc > 1) {
+    duration = strtod(argv[1], NULL);
+  }
+  nb_ticks = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ);
+
+  printf("Spikes of %.0f us on a budget of %.0f us, period of %.0f us\n\n",
+         SPIKE * US, BUDGET * US, US / RROSACE_DEFAULT_PHYSICAL_FREQ);
+  printf("policy   deadlines  budgets  skipped     held degraded     shed "
+         "exec max altitude (m)\n");
+  for (policy = 0; (policy < RROSACE_RT_NB_POLICIES) && (ret == EXIT_SUCCESS);
+       ++policy) {
+    ret = run((rrosace_rt_policy_t)policy, nb_ticks, first[policy],
+              &nb_first[policy]);
+  }
+
+  if (ret == EXIT_SUCCESS) {
+    printf("\nFirst events of the %s run\n", policies[RROSACE_RT_DEGRADE]);
+    for (i = 0; i < nb_first[RROSACE_RT_DEGRADE]; ++i) {
+      const rrosace_rt_event_t *p_event = &first[RROSACE_RT_DEGRADE][i];
+
+      printf("  tick %5lu %-8s %8.0f us\n", (unsigned long)p_event->tick,
+             kinds[p_event->kind], p_event->exec * US);
+    }
+  }
+
+  return (ret);
+}
@@ -0,0 +1,338 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE long flight simulated with the Parareal time-parallel
+ * driver, compared with the serial loop.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The fine propagator is the 200 Hz schedule of the closed loop. The coarse
+ * propagator executes the cyber part once per hyperperiod (4 physical ticks,
+ * 50 Hz) with 50 Hz filters instead of the 100 Hz ones, and the flight
+ * dynamics and the actuators with large steps, every two hyperperiods. Coarser
+ * controllers do not converge, their gains are tuned for 50 Hz.
+ *
+ * Usage: example_parareal [duration (s) [nb_slices [nb_threads]]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rrosace.h>
+
+/* Flight, altitude hold to 1000 m above trim with a faster airspeed */
+#define DURATION (3600.0)
+#define H_C (RROSACE_H_EQ + 1000.0)
+#define VZ_C (-2.5)
+#define VA_C (RROSACE_VA_EQ + 5.0)
+
+#define NB_SLICES (64)
+#define TOLERANCE (1e-9)
+
+/* Coarse steps of the cyber part and of the physical part, in physical ticks */
+#define COARSE_TICKS                                                           \
+  ((size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_DEFAULT_CYBER_FREQ))
+#define COARSE_PHYSICAL_TICKS (2 * COARSE_TICKS)
+#define COARSE_PHYSICAL_DT                                                     \
+  ((double)COARSE_PHYSICAL_TICKS / RROSACE_DEFAULT_PHYSICAL_FREQ)
+
+/** Simulations of the propagators, one per slice for the concurrent fine
+ * ones */
+struct propagators {
+  rrosace_sim_t **p_fine_sims;
+  rrosace_sim_t *p_coarse_sim;
+  size_t slice_ticks;
+};
+typedef struct propagators propagators_t;
+
+static double now(void);
+
+static int propagators_init(propagators_t * /* p_propagators */,
+                            size_t /* nb_slices */, size_t /* slice_ticks */);
+
+static void propagators_fini(propagators_t * /* p_propagators */,
+                             size_t /* nb_slices */);
+
+static int coarse_step(rrosace_sim_t * /* p_sim */, size_t /* tick */);
+
+static int fine(void * /* p_context */, size_t /* slice */,
+                const double * /* state_in */, double * /* state_out */);
+
+static int coarse(void * /* p_context */, size_t /* slice */,
+                  const double * /* state_in */, double * /* state_out */);
+
+static double now(void) {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return ((double)time.tv_sec + (double)time.tv_nsec * 1e-9);
+}
+
+static int propagators_init(propagators_t *p_propagators, size_t nb_slices,
+                            size_t slice_ticks) {
+  int ret = EXIT_FAILURE;
+  size_t i;
+
+  p_propagators->slice_ticks = slice_ticks;
+  p_propagators->p_coarse_sim = NULL;
+  p_propagators->p_fine_sims =
+      (rrosace_sim_t **)calloc(nb_slices, sizeof(rrosace_sim_t *));
+  if (!p_propagators->p_fine_sims) {
+    goto out;
+  }
+
+  for (i = 0; i < nb_slices; ++i) {
+    p_propagators->p_fine_sims[i] =
+        rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+    if (!p_propagators->p_fine_sims[i]) {
+      goto fini;
+    }
+  }
+
+  /* The 100 Hz filters of the coarse simulation are executed at 50 Hz */
+  p_propagators->p_coarse_sim =
+      rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+  ret = rrosace_sim_set_filters_frequency(p_propagators->p_coarse_sim,
+                                          RROSACE_FILTER_FREQ_50HZ);
+
+fini:
+  if (ret == EXIT_FAILURE) {
+    propagators_fini(p_propagators, nb_slices);
+  }
+
+out:
+  return (ret);
+}
+
+static void propagators_fini(propagators_t *p_propagators, size_t nb_slices) {
+  size_t i;
+
+  if (p_propagators->p_fine_sims) {
+    for (i = 0; i < nb_slices; ++i) {
+      rrosace_sim_del(p_propagators->p_fine_sims[i]);
+    }
+  }
+  free(p_propagators->p_fine_sims);
+  p_propagators->p_fine_sims = NULL;
+  rrosace_sim_del(p_propagators->p_coarse_sim);
+  p_propagators->p_coarse_sim = NULL;
+}
+
+/**
+ * @brief Execute one hyperperiod of the closed loop as a single step, in the
+ * order of the 200 Hz schedule, the physical part every COARSE_PHYSICAL_TICKS
+ */
+static int coarse_step(rrosace_sim_t *p_sim, size_t tick) {
+  int ret = EXIT_SUCCESS;
+  const double dt = 1. / RROSACE_FCC_DEFAULT_FREQ;
+  size_t task = RROSACE_SIM_TASK_ELEVATOR;
+
+  if (tick % COARSE_PHYSICAL_TICKS == 0) {
+    for (; (task <= RROSACE_SIM_TASK_FLIGHT_DYNAMICS) && (ret == EXIT_SUCCESS);
+         ++task) {
+      ret = rrosace_sim_step_task(p_sim, (rrosace_sim_task_t)task,
+                                  COARSE_PHYSICAL_DT);
+    }
+  }
+
+  for (task = RROSACE_SIM_TASK_H_FILTER;
+       (task < RROSACE_SIM_NB_TASKS) && (ret == EXIT_SUCCESS); ++task) {
+    ret = rrosace_sim_step_task(p_sim, (rrosace_sim_task_t)task, dt);
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Fine propagator, the 200 Hz closed loop of the slice
+ */
+static int fine(void *p_context, size_t slice, const double *state_in,
+                double *state_out) {
+  int ret = EXIT_FAILURE;
+  propagators_t *p_propagators = (propagators_t *)p_context;
+  rrosace_sim_t *p_sim = p_propagators->p_fine_sims[slice];
+
+  /* Slices of whole hyperperiods, the state restored at its phase */
+  if ((rrosace_sim_set_state(p_sim, state_in) == EXIT_FAILURE) ||
+      (rrosace_sim_run(p_sim, p_propagators->slice_ticks) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  ret = rrosace_sim_get_state(p_sim, state_out);
+
+out:
+  return (ret);
+}
+
+/**
+ * @brief Coarse propagator, one step per hyperperiod
+ */
+static int coarse(void *p_context, size_t slice, const double *state_in,
+                  double *state_out) {
+  int ret = EXIT_FAILURE;
+  propagators_t *p_propagators = (propagators_t *)p_context;
+  rrosace_sim_t *p_sim = p_propagators->p_coarse_sim;
+  size_t tick;
+
+  (void)slice;
+
+  if (rrosace_sim_set_state(p_sim, state_in) == EXIT_FAILURE) {
+    goto out;
+  }
+
+  for (tick = 0, ret = EXIT_SUCCESS;
+       (tick < p_propagators->slice_ticks) && (ret == EXIT_SUCCESS);
+       tick += COARSE_TICKS) {
+    ret = coarse_step(p_sim, tick);
+  }
+
+  if (ret == EXIT_SUCCESS) {
+    ret = rrosace_sim_get_state(p_sim, state_out);
+  }
+
+out:
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  double duration = DURATION;
+  size_t nb_slices = NB_SLICES;
+  long nb_threads = sysconf(_SC_NPROCESSORS_ONLN);
+  size_t slice_ticks;
+  propagators_t propagators = {NULL, NULL, 0};
+  rrosace_sim_t *p_serial = NULL;
+  rrosace_parareal_t *p_parareal = NULL;
+  double state[RROSACE_SIM_STATE_SIZE];
+  double parallel[RROSACE_SIM_STATE_SIZE];
+  double serial_time;
+  double fine_time;
+  double coarse_time;
+  double parareal_time;
+  double h_error = 0.;
+  size_t iterations = 0;
+  size_t slice;
+  size_t i;
+
+  if (argc > 1) {
+    duration = atof(argv[1]);
+  }
+  if (argc > 2) {
+    nb_slices = (size_t)atol(argv[2]);
+  }
+  if (argc > 3) {
+    nb_threads = atol(argv[3]);
+  }
+  if ((duration <= 0.) || !nb_slices || (nb_threads < 1)) {
+    fprintf(stderr, "Usage: %s [duration (s) [nb_slices [nb_threads]]]\n",
+            argv[0]);
+    goto out;
+  }
+
+  /* Slices of whole coarse physical steps */
+  slice_ticks = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ /
+                         (double)nb_slices / COARSE_PHYSICAL_TICKS) *
+                COARSE_PHYSICAL_TICKS;
+  if (!slice_ticks) {
+    fprintf(stderr, "Slices shorter than a coarse step.\n");
+    goto out;
+  }
+
+  ret = propagators_init(&propagators, nb_slices, slice_ticks);
+  if (ret == EXIT_FAILURE) {
+    goto out;
+  }
+
+  p_parareal = rrosace_parareal_new(RROSACE_SIM_STATE_SIZE, nb_slices, fine,
+                                    coarse, &propagators);
+  if (!p_parareal) {
+    ret = EXIT_FAILURE;
+    goto fini;
+  }
+  for (i = 0; (i < RROSACE_SIM_STATE_SIZE) && (ret == EXIT_SUCCESS); ++i) {
+    if (rrosace_sim_is_discrete(i)) {
+      ret = rrosace_parareal_set_discrete(p_parareal, i);
+    }
+  }
+
+  /* Serial reference */
+  p_serial = rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+  if ((ret == EXIT_FAILURE) || !p_serial ||
+      (rrosace_sim_get_state(p_serial, state) == EXIT_FAILURE)) {
+    ret = EXIT_FAILURE;
+    goto serial_del;
+  }
+
+  serial_time = now();
+  ret = rrosace_sim_run(p_serial, nb_slices * slice_ticks);
+  serial_time = now() - serial_time;
+
+  if (ret == EXIT_FAILURE) {
+    goto serial_del;
+  }
+
+  /* Costs of the propagators, for the speedup with one core per slice */
+  fine_time = now();
+  ret = fine(&propagators, 0, state, parallel);
+  fine_time = now() - fine_time;
+  coarse_time = now();
+  for (slice = 0; (slice < nb_slices) && (ret == EXIT_SUCCESS); ++slice) {
+    ret = coarse(&propagators, slice, state, parallel);
+  }
+  coarse_time = now() - coarse_time;
+
+  if (ret == EXIT_FAILURE) {
+    goto serial_del;
+  }
+
+  parareal_time = now();
+  ret = rrosace_parareal_run(p_parareal, state, TOLERANCE, nb_slices,
+                             (size_t)nb_threads, &iterations);
+  parareal_time = now() - parareal_time;
+
+  if (ret == EXIT_FAILURE) {
+    fprintf(stderr, "Parareal did not converge in %lu iterations.\n",
+            (unsigned long)iterations);
+    goto serial_del;
+  }
+
+  if ((rrosace_parareal_get_state(p_parareal, nb_slices, parallel) ==
+       EXIT_FAILURE) ||
+      (rrosace_sim_get_state(p_serial, state) == EXIT_FAILURE)) {
+    ret = EXIT_FAILURE;
+    goto serial_del;
+  }
+  /* Altitude, last of the flight dynamics state */
+  i = RROSACE_SIM_PHYSICAL_STATE_OFFSET + RROSACE_SIM_PHYSICAL_STATE_SIZE - 1;
+  h_error = fabs(parallel[i] - state[i]);
+
+  printf("flight of %.1f s in %lu slices of %.2f s, %ld threads\n",
+         (double)(nb_slices * slice_ticks) / RROSACE_DEFAULT_PHYSICAL_FREQ,
+         (unsigned long)nb_slices,
+         (double)slice_ticks / RROSACE_DEFAULT_PHYSICAL_FREQ, nb_threads);
+  printf("final altitude: serial %.6f m, parareal %.6f m, error %.3e m\n",
+         state[i], parallel[i], h_error);
+  printf("parareal iterations: %lu, coarse/fine cost ratio: %.3f\n",
+         (unsigned long)iterations,
+         coarse_time / nb_slices / (fine_time > 0. ? fine_time : 1e-9));
+  printf("wall-clock: serial %.3f s, parareal %.3f s, speedup %.2f\n",
+         serial_time, parareal_time, serial_time / parareal_time);
+  printf("estimated speedup with one core per slice: %.2f\n",
+         serial_time / (coarse_time + iterations * (fine_time + coarse_time)));
+
+serial_del:
+  rrosace_sim_del(p_serial);
+  rrosace_parareal_del(p_parareal);
+
+fini:
+  propagators_fini(&propagators, nb_slices);
+
+out:
+  return (ret);
+}
@@ -0,0 +1,226 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE ensemble scaling with the workers placed on their NUMA
+ * node, and their arenas on huge pages.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Each run records the signals of a short closed loop in the arena of its
+ * worker, as structure of arrays slots, then averages them over all the slots
+ * tick by tick, striding over the whole arena as an ensemble statistic would.
+ * The same runs are timed with the workers allocated by the main thread, on
+ * their own node, then on their own node with huge pages, for numbers of
+ * workers doubling up to the cores.
+ *
+ * Usage: example_placement [arena (MiB) [runs [workers]]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rrosace.h>
+
+#define ARENA_MIB (16)
+#define NB_RUNS (64)
+#define RUN_TICKS (RROSACE_DEFAULT_PHYSICAL_FREQ)
+#define VZ_C (2.5)
+
+enum signal { H, VZ, Q, AZ, NB_SIGNALS };
+
+enum result { H_MEAN, VZ_MEAN, NB_RESULTS };
+
+enum setup { REMOTE, LOCAL, LOCAL_HUGE, NB_SETUPS };
+
+struct bench {
+  const rrosace_ensemble_t *p_ensemble;
+  /* Slots of a signal in an arena */
+  size_t nb_slots;
+};
+
+static const char *const setups[NB_SETUPS] = {"main thread", "local",
+                                              "local, huge pages"};
+
+static double now(void);
+
+static int record_run(rrosace_sim_t * /* p_sim */, size_t /* run */,
+                      void * /* p_arg */, double /* results */[]);
+
+static int time_runs(enum setup /* setup */, size_t /* arena_size */,
+                     size_t /* nb_workers */, size_t /* nb_runs */,
+                     double * /* p_rate */, size_t * /* p_nb_huge */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Record a run in a slot of the arena, then average all the slots
+ */
+static int record_run(rrosace_sim_t *p_sim, size_t run, void *p_arg,
+                      double results[]) {
+  const struct bench *p_bench = (const struct bench *)p_arg;
+  double *p_arena =
+      (double *)rrosace_ensemble_get_arena(p_bench->p_ensemble, p_sim);
+  const size_t nb_slots = p_bench->nb_slots;
+  const size_t slot = run % nb_slots;
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+  double sums[NB_SIGNALS];
+  size_t tick;
+  size_t i;
+
+  if (!p_arena ||
+      (rrosace_sim_set_commands(p_sim, RROSACE_H_EQ,
+                                VZ_C - 0.1 * (double)(run % 50),
+                                RROSACE_VA_EQ) == EXIT_FAILURE)) {
+    return (EXIT_FAILURE);
+  }
+
+  for (tick = 0; tick < RUN_TICKS; ++tick) {
+    if (rrosace_sim_run(p_sim, 1) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+    p_arena[(H * nb_slots + slot) * RUN_TICKS + tick] = p_values->h;
+    p_arena[(VZ * nb_slots + slot) * RUN_TICKS + tick] = p_values->vz;
+    p_arena[(Q * nb_slots + slot) * RUN_TICKS + tick] = p_values->q;
+    p_arena[(AZ * nb_slots + slot) * RUN_TICKS + tick] = p_values->az;
+  }
+
+  /* Slots averaged tick by tick, a stride of a slot between reads */
+  for (tick = 0; tick < RUN_TICKS; ++tick) {
+    size_t signal;
+
+    for (signal = 0; signal < NB_SIGNALS; ++signal) {
+      const double *p_signal = p_arena + signal * nb_slots * RUN_TICKS + tick;
+
+      sums[signal] = 0.;
+      for (i = 0; i < nb_slots; ++i) {
+        sums[signal] += p_signal[i * RUN_TICKS];
+      }
+    }
+  }
+
+  results[H_MEAN] = sums[H] / (double)nb_slots;
+  results[VZ_MEAN] = sums[VZ] / (double)nb_slots;
+
+  return (EXIT_SUCCESS);
+}
+
+static int time_runs(enum setup setup, size_t arena_size, size_t nb_workers,
+                     size_t nb_runs, double *p_rate, size_t *p_nb_huge) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_ensemble_t *p_ensemble = NULL;
+  rrosace_ensemble_placement_t placement;
+  struct bench bench;
+  double start;
+
+  rrosace_ensemble_default_placement(&placement);
+  placement.local = (setup != REMOTE);
+  placement.arena_size = arena_size;
+  placement.huge_pages = (setup == LOCAL_HUGE);
+
+  if (!p_sim) {
+    goto out;
+  }
+  p_ensemble =
+      rrosace_ensemble_new_placed(p_sim, nb_workers, NB_RESULTS, &placement);
+  if (!p_ensemble) {
+    goto out;
+  }
+
+  bench.p_ensemble = p_ensemble;
+  bench.nb_slots = arena_size / (NB_SIGNALS * RUN_TICKS * sizeof(double));
+
+  start = now();
+  if ((rrosace_ensemble_start(p_ensemble, nb_runs, record_run, &bench) ==
+       EXIT_FAILURE) ||
+      (rrosace_ensemble_wait(p_ensemble) == EXIT_FAILURE)) {
+    goto out;
+  }
+  *p_rate = (double)nb_runs / (now() - start);
+  *p_nb_huge = rrosace_ensemble_get_nb_huge(p_ensemble);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_ensemble_del(p_ensemble);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_SUCCESS;
+  size_t arena_mib = ARENA_MIB;
+  size_t nb_runs = NB_RUNS;
+  long nb_cores = sysconf(_SC_NPROCESSORS_ONLN);
+  size_t max_workers;
+  size_t nb_workers;
+  double rates[NB_SETUPS];
+  double first_rates[NB_SETUPS];
+  size_t nb_huge = 0;
+
+  if (argc > 1) {
+    arena_mib = (size_t)strtoul(argv[1], NULL, 10);
+  }
+  if (argc > 2) {
+    nb_runs = (size_t)strtoul(argv[2], NULL, 10);
+  }
+  max_workers = (nb_cores > 0) ? (size_t)nb_cores : 1;
+  if (argc > 3) {
+    max_workers = (size_t)strtoul(argv[3], NULL, 10);
+  }
+  if (!arena_mib || !max_workers ||
+      (max_workers > RROSACE_ENSEMBLE_MAX_WORKERS)) {
+    fprintf(stderr, "Invalid arena size or number of workers.\n");
+    return (EXIT_FAILURE);
+  }
+
+  printf("Arenas of %lu MiB, %lu runs of %d ticks, in runs/s (speedup)\n\n",
+         (unsigned long)arena_mib, (unsigned long)nb_runs, RUN_TICKS);
+  printf("workers,%s,%s,%s\n", setups[REMOTE], setups[LOCAL],
+         setups[LOCAL_HUGE]);
+
+  for (nb_workers = 1; (nb_workers <= max_workers) && (ret == EXIT_SUCCESS);
+       nb_workers = (nb_workers < max_workers) && (2 * nb_workers > max_workers)
+                        ? max_workers
+                        : 2 * nb_workers) {
+    size_t setup;
+
+    for (setup = 0; (setup < NB_SETUPS) && (ret == EXIT_SUCCESS); ++setup) {
+      ret = time_runs((enum setup)setup, arena_mib * 1024 * 1024, nb_workers,
+                      nb_runs, &rates[setup], &nb_huge);
+      if (ret == EXIT_FAILURE) {
+        fprintf(stderr, "Runs with %s placement failed.\n", setups[setup]);
+      } else if (nb_workers == 1) {
+        first_rates[setup] = rates[setup];
+      }
+    }
+
+    if (ret == EXIT_SUCCESS) {
+      printf("%lu,%.1f (%.2f),%.1f (%.2f),%.1f (%.2f)\n",
+             (unsigned long)nb_workers, rates[REMOTE],
+             rates[REMOTE] / first_rates[REMOTE], rates[LOCAL],
+             rates[LOCAL] / first_rates[LOCAL], rates[LOCAL_HUGE],
+             rates[LOCAL_HUGE] / first_rates[LOCAL_HUGE]);
+    }
+  }
+
+  if (ret == EXIT_SUCCESS) {
+    printf("\n%lu arenas on reserved huge pages, the others on transparent "
+           "ones if enabled\n",
+           (unsigned long)nb_huge);
+  }
+
+  return (ret);
+}
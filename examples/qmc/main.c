@@ -0,0 +1,245 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE uncertainty campaign over the aircraft, actuators and
+ * sensors parameters, with pseudo-random, Halton and Sobol sampling.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Each run climbs from trim with sampled parameters. The campaigns stop when
+ * the means and deviations of the final altitude and airspeed are known
+ * within the tolerances, checked after each power of two runs per replicate,
+ * where the Sobol points form complete nets.
+ *
+ * Usage: example_qmc [max runs [duration (s)]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define MAX_RUNS (16384)
+#define DURATION (20.0)
+#define NB_REPLICATES (8)
+#define SEED (2016UL)
+
+/* Climb of 100 m */
+#define H_C (RROSACE_H_EQ + 100.0)
+#define VZ_C (-2.5)
+#define VA_C (RROSACE_VA_EQ)
+
+#define NB_PARAMETERS (10)
+
+enum output_index { ALTITUDE, AIRSPEED, NB_OUTPUTS };
+
+static const char *const output_names[NB_OUTPUTS] = {"altitude (m)",
+                                                     "airspeed (m/s)"};
+
+/* Largest half widths of the 95 % confidence intervals */
+static const double tolerances[NB_OUTPUTS] = {0.02, 0.002};
+
+static const rrosace_qmc_parameter_t parameters[NB_PARAMETERS] = {
+    {"MASSE", RROSACE_QMC_UNIFORM, 0.9 * RROSACE_MASSE, 1.1 * RROSACE_MASSE},
+    {"I_Y", RROSACE_QMC_UNIFORM, 0.9 * RROSACE_I_Y, 1.1 * RROSACE_I_Y},
+    {"RROSACE_TAU", RROSACE_QMC_UNIFORM, 0.8 * RROSACE_TAU, 1.2 * RROSACE_TAU},
+    {"RROSACE_OMEGA", RROSACE_QMC_UNIFORM, 0.9 * RROSACE_OMEGA,
+     1.1 * RROSACE_OMEGA},
+    {"RROSACE_XI", RROSACE_QMC_UNIFORM, 0.9 * RROSACE_XI, 1.1 * RROSACE_XI},
+    {"h_bias", RROSACE_QMC_NORMAL, 0., 2.},
+    {"vz_bias", RROSACE_QMC_NORMAL, 0., 0.05},
+    {"va_bias", RROSACE_QMC_NORMAL, 0., 0.1},
+    {"q_bias", RROSACE_QMC_NORMAL, 0., 1e-4},
+    {"az_bias", RROSACE_QMC_NORMAL, 0., 0.01}};
+
+static const char *const sequence_names[] = {"random", "halton", "sobol"};
+
+static double now(void);
+
+static int map_parameters(const rrosace_qmc_campaign_t * /* p_campaign */,
+                          const double * /* values */,
+                          rrosace_sim_parameters_t * /* p_parameters */);
+
+static int run(const rrosace_sim_parameters_t * /* p_parameters */,
+               size_t /* nb_ticks */, double * /* outputs */);
+
+static int campaign(rrosace_qmc_sequence_t /* sequence */,
+                    size_t /* max_runs */, size_t /* nb_ticks */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Map the sampled values onto the simulation parameters, by name
+ */
+static int map_parameters(const rrosace_qmc_campaign_t *p_campaign,
+                          const double *values,
+                          rrosace_sim_parameters_t *p_parameters) {
+  double *fields[NB_PARAMETERS];
+  size_t parameter;
+
+  fields[0] = &p_parameters->masse;
+  fields[1] = &p_parameters->i_y;
+  fields[2] = &p_parameters->tau;
+  fields[3] = &p_parameters->omega;
+  fields[4] = &p_parameters->xi;
+  fields[5] = &p_parameters->h_bias;
+  fields[6] = &p_parameters->vz_bias;
+  fields[7] = &p_parameters->va_bias;
+  fields[8] = &p_parameters->q_bias;
+  fields[9] = &p_parameters->az_bias;
+
+  for (parameter = 0; parameter < NB_PARAMETERS; ++parameter) {
+    const size_t index =
+        rrosace_qmc_campaign_find(p_campaign, parameters[parameter].name);
+
+    if (index == NB_PARAMETERS) {
+      return (EXIT_FAILURE);
+    }
+    *fields[parameter] = values[index];
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+static int run(const rrosace_sim_parameters_t *p_parameters, size_t nb_ticks,
+               double *outputs) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+
+  if ((rrosace_sim_set_parameters(p_sim, p_parameters) == EXIT_FAILURE) ||
+      (rrosace_sim_run(p_sim, nb_ticks) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  outputs[ALTITUDE] = rrosace_sim_get_values(p_sim)->h;
+  outputs[AIRSPEED] = rrosace_sim_get_values(p_sim)->va;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+static int campaign(rrosace_qmc_sequence_t sequence, size_t max_runs,
+                    size_t nb_ticks) {
+  int ret = EXIT_FAILURE;
+  rrosace_qmc_campaign_t *p_campaign;
+  rrosace_sim_parameters_t sim_parameters;
+  double values[NB_PARAMETERS];
+  double outputs[NB_OUTPUTS];
+  const double start = now();
+  size_t next_check = 2 * NB_REPLICATES;
+  int converged = 0;
+  size_t output;
+
+  p_campaign = rrosace_qmc_campaign_new(sequence, parameters, NB_PARAMETERS,
+                                        NB_OUTPUTS, NB_REPLICATES, SEED);
+  if (!p_campaign) {
+    goto out;
+  }
+
+  rrosace_sim_nominal_parameters(&sim_parameters);
+
+  while (!converged && (rrosace_qmc_campaign_get_runs(p_campaign) < max_runs)) {
+    if ((rrosace_qmc_campaign_sample(p_campaign, values) == EXIT_FAILURE) ||
+        (map_parameters(p_campaign, values, &sim_parameters) ==
+         EXIT_FAILURE) ||
+        (run(&sim_parameters, nb_ticks, outputs) == EXIT_FAILURE) ||
+        (rrosace_qmc_campaign_record(p_campaign, outputs) == EXIT_FAILURE)) {
+      goto out;
+    }
+
+    if (rrosace_qmc_campaign_get_runs(p_campaign) == next_check) {
+      converged = rrosace_qmc_campaign_converged(p_campaign, tolerances);
+      next_check *= 2;
+    }
+  }
+
+  printf("%s: %lu runs in %.2f s, %s\n", sequence_names[sequence],
+         (unsigned long)rrosace_qmc_campaign_get_runs(p_campaign),
+         now() - start, converged ? "converged" : "not converged");
+
+  for (output = 0; output < NB_OUTPUTS; ++output) {
+    double mean;
+    double mean_half_width;
+    double deviation;
+    double deviation_half_width;
+    double worst;
+
+    if ((rrosace_qmc_campaign_get_mean(p_campaign, output, &mean,
+                                       &mean_half_width) == EXIT_FAILURE) ||
+        (rrosace_qmc_campaign_get_deviation(p_campaign, output, &deviation,
+                                            &deviation_half_width) ==
+         EXIT_FAILURE)) {
+      goto out;
+    }
+
+    printf("  %-15s mean %.4f +/- %.4f, deviation %.4f +/- %.4f\n",
+           output_names[output], mean, mean_half_width, deviation,
+           deviation_half_width);
+
+    /* Plain Monte Carlo intervals shrink as the square root of the runs */
+    worst = mean_half_width > deviation_half_width ? mean_half_width
+                                                   : deviation_half_width;
+    if (!converged && (worst > tolerances[output])) {
+      printf("  %-15s about %.0f runs needed at a square root rate\n", "",
+             (double)rrosace_qmc_campaign_get_runs(p_campaign) *
+                 (worst / tolerances[output]) * (worst / tolerances[output]));
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_qmc_campaign_del(p_campaign);
+
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_SUCCESS;
+  size_t max_runs = MAX_RUNS;
+  double duration = DURATION;
+  size_t nb_ticks;
+
+  if (argc > 1) {
+    max_runs = (size_t)atol(argv[1]);
+  }
+  if (argc > 2) {
+    duration = atof(argv[2]);
+  }
+
+  nb_ticks = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ);
+
+  if (!max_runs || !nb_ticks || (argc > 3)) {
+    fprintf(stderr, "Usage: %s [max runs [duration (s)]]\n", argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  printf("%d parameters, %lu replicates, flight of %.1f s, tolerances %g m "
+         "and %g m/s\n",
+         NB_PARAMETERS, (unsigned long)NB_REPLICATES, duration,
+         tolerances[ALTITUDE], tolerances[AIRSPEED]);
+
+  if ((campaign(RROSACE_QMC_RANDOM, max_runs, nb_ticks) == EXIT_FAILURE) ||
+      (campaign(RROSACE_QMC_HALTON, max_runs, nb_ticks) == EXIT_FAILURE) ||
+      (campaign(RROSACE_QMC_SOBOL, max_runs, nb_ticks) == EXIT_FAILURE)) {
+    fprintf(stderr, "Campaign failed.\n");
+    ret = EXIT_FAILURE;
+  }
+
+  return (ret);
+}
@@ -0,0 +1,411 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE co-simulation of the physical and cyber partitions of the
+ * closed loop by Gauss-Jacobi waveform relaxation, compared with the serial
+ * loop.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The physical partition (engine, elevator and flight dynamics) and the cyber
+ * partition (filters, flight mode, FCU, FCCs and cables) each simulate whole
+ * windows, exchanging the waveforms of the commands and of the measures.
+ *
+ * Usage: example_relaxation [duration (s) [window (s) [tolerance]]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define DURATION (600.0)
+#define WINDOW (1.0)
+#define TOLERANCE (0.0)
+#define MAX_ITERATIONS (1000)
+
+/* Climb of 1000 m then altitude hold */
+#define H_C (RROSACE_H_EQ + 1000.0)
+#define VZ_C (-2.5)
+#define VA_C (RROSACE_VA_EQ + 5.0)
+
+/* Physical outputs, h, vz, va, q and az, cyber outputs, delta_e_c and
+ * delta_th_c */
+#define NB_PHYSICAL_OUTPUTS (5)
+#define NB_CYBER_OUTPUTS (2)
+
+enum partition_index { PHYSICAL, CYBER };
+
+/** Partition of the closed loop, restarted from its committed state */
+struct partition {
+  rrosace_sim_t *p_sim;
+  /* Tasks of the partition, stepped alone at each tick */
+  int cyber;
+  double committed_state[RROSACE_SIM_STATE_SIZE];
+  size_t committed_time;
+  /* Committed altitudes, for the physical partition */
+  double *altitudes;
+};
+typedef struct partition partition_t;
+
+static double now(void);
+
+static int partition_init(partition_t * /* p_partition */, int /* cyber */,
+                          size_t /* nb_ticks */);
+
+static void partition_fini(partition_t * /* p_partition */);
+
+static int partition_step(rrosace_sim_t * /* p_sim */,
+                          rrosace_sim_task_t /* task */, double /* dt */,
+                          void * /* p_arg */);
+
+static int physical_simulate(void * /* p_context */, size_t /* nb_ticks */,
+                             const double * /* inputs */,
+                             double * /* outputs */);
+
+static int cyber_simulate(void * /* p_context */, size_t /* nb_ticks */,
+                          const double * /* inputs */, double * /* outputs */);
+
+static int physical_commit(void * /* p_context */, size_t /* nb_ticks */,
+                           const double * /* outputs */);
+
+static int cyber_commit(void * /* p_context */, size_t /* nb_ticks */,
+                        const double * /* outputs */);
+
+static int relax(size_t /* nb_ticks */, size_t /* window_ticks */,
+                 double /* tolerance */, size_t /* nb_threads */,
+                 const double * /* reference */);
+
+static double now(void) {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return ((double)time.tv_sec + (double)time.tv_nsec * 1e-9);
+}
+
+static int partition_init(partition_t *p_partition, int cyber,
+                           size_t nb_ticks) {
+  int ret = EXIT_FAILURE;
+
+  p_partition->p_sim = rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+  p_partition->cyber = cyber;
+  p_partition->committed_time = 0;
+  p_partition->altitudes = (double *)malloc(nb_ticks * sizeof(double));
+
+  if (!p_partition->p_sim || !p_partition->altitudes) {
+    goto out;
+  }
+
+  ret = rrosace_sim_get_state(p_partition->p_sim,
+                              p_partition->committed_state);
+
+out:
+  if (ret == EXIT_FAILURE) {
+    partition_fini(p_partition);
+  }
+
+  return (ret);
+}
+
+static void partition_fini(partition_t *p_partition) {
+  rrosace_sim_del(p_partition->p_sim);
+  free(p_partition->altitudes);
+}
+
+/**
+ * @brief Step the tasks of the partition released, the others being left to
+ * the other partition
+ */
+static int partition_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                          double dt, void *p_arg) {
+  const partition_t *p_partition = (const partition_t *)p_arg;
+  const int cyber = (task > RROSACE_SIM_TASK_FLIGHT_DYNAMICS);
+
+  return ((cyber == p_partition->cyber) ? rrosace_sim_step_task(p_sim, task, dt)
+                                        : EXIT_SUCCESS);
+}
+
+/**
+ * @brief Physical partition, the commands computed at a tick are applied at
+ * the next one
+ */
+static int physical_simulate(void *p_context, size_t nb_ticks,
+                             const double *inputs, double *outputs) {
+  int ret;
+  partition_t *p_partition = (partition_t *)p_context;
+  rrosace_sim_t *p_sim = p_partition->p_sim;
+  rrosace_sim_values_t values;
+  size_t tick;
+
+  ret = rrosace_sim_set_state(p_sim, p_partition->committed_state);
+
+  for (tick = 0; (tick < nb_ticks) && (ret == EXIT_SUCCESS); ++tick) {
+    values = *rrosace_sim_get_values(p_sim);
+    if (tick > 0) {
+      values.delta_e_c = inputs[(tick - 1) * NB_CYBER_OUTPUTS];
+      values.delta_th_c = inputs[(tick - 1) * NB_CYBER_OUTPUTS + 1];
+    }
+
+    if ((rrosace_sim_set_values(p_sim, &values) == EXIT_FAILURE) ||
+        (rrosace_sim_run_delegated(p_sim, partition_step, p_partition) ==
+         EXIT_FAILURE)) {
+      ret = EXIT_FAILURE;
+      break;
+    }
+
+    values = *rrosace_sim_get_values(p_sim);
+    outputs[tick * NB_PHYSICAL_OUTPUTS] = values.h;
+    outputs[tick * NB_PHYSICAL_OUTPUTS + 1] = values.vz;
+    outputs[tick * NB_PHYSICAL_OUTPUTS + 2] = values.va;
+    outputs[tick * NB_PHYSICAL_OUTPUTS + 3] = values.q;
+    outputs[tick * NB_PHYSICAL_OUTPUTS + 4] = values.az;
+  }
+
+  /* Commands of the last tick, for the first tick of the next window */
+  if (ret == EXIT_SUCCESS) {
+    values = *rrosace_sim_get_values(p_sim);
+    values.delta_e_c = inputs[(nb_ticks - 1) * NB_CYBER_OUTPUTS];
+    values.delta_th_c = inputs[(nb_ticks - 1) * NB_CYBER_OUTPUTS + 1];
+    ret = rrosace_sim_set_values(p_sim, &values);
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Cyber partition, the measures of a tick are filtered at the same tick
+ */
+static int cyber_simulate(void *p_context, size_t nb_ticks,
+                          const double *inputs, double *outputs) {
+  int ret;
+  partition_t *p_partition = (partition_t *)p_context;
+  rrosace_sim_t *p_sim = p_partition->p_sim;
+  rrosace_sim_values_t values;
+  size_t tick;
+
+  ret = rrosace_sim_set_state(p_sim, p_partition->committed_state);
+
+  for (tick = 0; (tick < nb_ticks) && (ret == EXIT_SUCCESS); ++tick) {
+    values = *rrosace_sim_get_values(p_sim);
+    values.h = inputs[tick * NB_PHYSICAL_OUTPUTS];
+    values.vz = inputs[tick * NB_PHYSICAL_OUTPUTS + 1];
+    values.va = inputs[tick * NB_PHYSICAL_OUTPUTS + 2];
+    values.q = inputs[tick * NB_PHYSICAL_OUTPUTS + 3];
+    values.az = inputs[tick * NB_PHYSICAL_OUTPUTS + 4];
+
+    if ((rrosace_sim_set_values(p_sim, &values) == EXIT_FAILURE) ||
+        (rrosace_sim_run_delegated(p_sim, partition_step, p_partition) ==
+         EXIT_FAILURE)) {
+      ret = EXIT_FAILURE;
+      break;
+    }
+
+    outputs[tick * NB_CYBER_OUTPUTS] = rrosace_sim_get_values(p_sim)->delta_e_c;
+    outputs[tick * NB_CYBER_OUTPUTS + 1] =
+        rrosace_sim_get_values(p_sim)->delta_th_c;
+  }
+
+  return (ret);
+}
+
+static int physical_commit(void *p_context, size_t nb_ticks,
+                           const double *outputs) {
+  partition_t *p_partition = (partition_t *)p_context;
+  size_t tick;
+
+  for (tick = 0; tick < nb_ticks; ++tick) {
+    p_partition->altitudes[p_partition->committed_time + tick] =
+        outputs[tick * NB_PHYSICAL_OUTPUTS];
+  }
+
+  p_partition->committed_time += nb_ticks;
+
+  return (rrosace_sim_get_state(p_partition->p_sim,
+                                p_partition->committed_state));
+}
+
+static int cyber_commit(void *p_context, size_t nb_ticks,
+                        const double *outputs) {
+  partition_t *p_partition = (partition_t *)p_context;
+
+  (void)outputs;
+
+  p_partition->committed_time += nb_ticks;
+
+  return (rrosace_sim_get_state(p_partition->p_sim,
+                                p_partition->committed_state));
+}
+
+/**
+ * @brief Co-simulate the closed loop by waveform relaxation, and compare the
+ * altitudes with the serial reference
+ */
+static int relax(size_t nb_ticks, size_t window_ticks, double tolerance,
+                 size_t nb_threads, const double *reference) {
+  int ret = EXIT_FAILURE;
+  partition_t partitions[RROSACE_RELAXATION_NB_PARTITIONS];
+  rrosace_relaxation_partition_t relaxation_partitions
+      [RROSACE_RELAXATION_NB_PARTITIONS];
+  double physical_outputs0[NB_PHYSICAL_OUTPUTS];
+  double cyber_outputs0[NB_CYBER_OUTPUTS];
+  const double *outputs0[RROSACE_RELAXATION_NB_PARTITIONS];
+  rrosace_relaxation_t *p_relaxation = NULL;
+  const rrosace_sim_values_t *p_values;
+  size_t total_iterations = 0;
+  size_t max_iterations = 0;
+  size_t nb_windows;
+  size_t window;
+  double error = 0.;
+  double duration;
+  size_t tick;
+
+  if (partition_init(&partitions[PHYSICAL], 0, nb_ticks) == EXIT_FAILURE) {
+    goto out;
+  }
+  if (partition_init(&partitions[CYBER], 1, nb_ticks) == EXIT_FAILURE) {
+    partition_fini(&partitions[PHYSICAL]);
+    goto out;
+  }
+
+  relaxation_partitions[PHYSICAL].nb_outputs = NB_PHYSICAL_OUTPUTS;
+  relaxation_partitions[PHYSICAL].simulate = physical_simulate;
+  relaxation_partitions[PHYSICAL].commit = physical_commit;
+  relaxation_partitions[PHYSICAL].p_context = &partitions[PHYSICAL];
+  relaxation_partitions[CYBER].nb_outputs = NB_CYBER_OUTPUTS;
+  relaxation_partitions[CYBER].simulate = cyber_simulate;
+  relaxation_partitions[CYBER].commit = cyber_commit;
+  relaxation_partitions[CYBER].p_context = &partitions[CYBER];
+
+  p_values = rrosace_sim_get_values(partitions[PHYSICAL].p_sim);
+  physical_outputs0[0] = p_values->h;
+  physical_outputs0[1] = p_values->vz;
+  physical_outputs0[2] = p_values->va;
+  physical_outputs0[3] = p_values->q;
+  physical_outputs0[4] = p_values->az;
+  cyber_outputs0[0] = p_values->delta_e_c;
+  cyber_outputs0[1] = p_values->delta_th_c;
+  outputs0[PHYSICAL] = physical_outputs0;
+  outputs0[CYBER] = cyber_outputs0;
+
+  p_relaxation = rrosace_relaxation_new(relaxation_partitions, window_ticks,
+                                        outputs0, nb_threads);
+  if (!p_relaxation) {
+    goto fini;
+  }
+
+  nb_windows = nb_ticks / window_ticks;
+
+  duration = now();
+  for (window = 0, ret = EXIT_SUCCESS;
+       (window < nb_windows) && (ret == EXIT_SUCCESS); ++window) {
+    size_t iterations;
+
+    ret = rrosace_relaxation_window(p_relaxation, tolerance, MAX_ITERATIONS,
+                                    &iterations);
+    total_iterations += iterations;
+    if (iterations > max_iterations) {
+      max_iterations = iterations;
+    }
+  }
+  duration = now() - duration;
+
+  if (ret == EXIT_FAILURE) {
+    fprintf(stderr, "Window %lu did not converge.\n", (unsigned long)window);
+    goto del;
+  }
+
+  for (tick = 0; tick < nb_windows * window_ticks; ++tick) {
+    const double diff = fabs(partitions[PHYSICAL].altitudes[tick] -
+                             reference[tick]);
+    if (diff > error) {
+      error = diff;
+    }
+  }
+
+  printf("%lu thread(s): %.3f s, iterations per window %.2f (max %lu), "
+         "altitude error %.3e m\n",
+         (unsigned long)nb_threads, duration,
+         (double)total_iterations / nb_windows, (unsigned long)max_iterations,
+         error);
+
+del:
+  rrosace_relaxation_del(p_relaxation);
+
+fini:
+  partition_fini(&partitions[PHYSICAL]);
+  partition_fini(&partitions[CYBER]);
+
+out:
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  double duration = DURATION;
+  double window = WINDOW;
+  double tolerance = TOLERANCE;
+  size_t window_ticks;
+  size_t nb_ticks;
+  rrosace_sim_t *p_serial = NULL;
+  double *reference = NULL;
+  double serial_duration;
+  size_t tick;
+
+  if (argc > 1) {
+    duration = atof(argv[1]);
+  }
+  if (argc > 2) {
+    window = atof(argv[2]);
+  }
+  if (argc > 3) {
+    tolerance = atof(argv[3]);
+  }
+
+  window_ticks = (size_t)(window * RROSACE_DEFAULT_PHYSICAL_FREQ);
+  nb_ticks = (size_t)(duration / window) * window_ticks;
+  if (!window_ticks || !nb_ticks || (tolerance < 0.)) {
+    fprintf(stderr, "Usage: %s [duration (s) [window (s) [tolerance]]]\n",
+            argv[0]);
+    goto out;
+  }
+
+  reference = (double *)malloc(nb_ticks * sizeof(double));
+  p_serial = rrosace_sim_new(RROSACE_ALTITUDE_HOLD, H_C, VZ_C, VA_C);
+  if (!reference || !p_serial) {
+    goto out;
+  }
+
+  serial_duration = now();
+  for (tick = 0, ret = EXIT_SUCCESS; (tick < nb_ticks) && (ret == EXIT_SUCCESS);
+       ++tick) {
+    ret = rrosace_sim_run(p_serial, 1);
+    reference[tick] = rrosace_sim_get_values(p_serial)->h;
+  }
+  serial_duration = now() - serial_duration;
+
+  if (ret == EXIT_FAILURE) {
+    goto out;
+  }
+
+  printf("%.1f s in windows of %.3f s, tolerance %g\n",
+         (double)nb_ticks / RROSACE_DEFAULT_PHYSICAL_FREQ,
+         (double)window_ticks / RROSACE_DEFAULT_PHYSICAL_FREQ, tolerance);
+  printf("serial: %.3f s\n", serial_duration);
+
+  ret = relax(nb_ticks, window_ticks, tolerance, 1, reference);
+  if (ret == EXIT_SUCCESS) {
+    ret = relax(nb_ticks, window_ticks, tolerance, 2, reference);
+  }
+
+out:
+  rrosace_sim_del(p_serial);
+  free(reference);
+
+  return (ret);
+}
@@ -0,0 +1,187 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE real-time paced simulation, as a plant model of a
+ * hardware-in-the-loop bench, with live and final statistics.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The ticks are released at the physical rate. A monitor thread prints the
+ * statistics every second; the release jitter and execution time histograms
+ * are printed at the end. A priority above 0 runs the ticks with SCHED_FIFO
+ * and locked memory, which needs the privileges for it.
+ *
+ * Usage: example_rt [duration (s) [priority [cpu [spin (us)]]]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define DURATION (5.0)
+#define VZ_C (2.5)
+#define US (1e6)
+
+struct monitor {
+  const rrosace_rt_t *p_rt;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  int done;
+};
+
+static void print_stats(const char * /* title */,
+                        const rrosace_rt_stats_t * /* p_stats */);
+
+static void print_histogram(const char * /* title */,
+                            const size_t /* histogram */[],
+                            double /* bucket_width */);
+
+static void *monitor_main(void * /* p_arg */);
+
+static void print_stats(const char *title, const rrosace_rt_stats_t *p_stats) {
+  printf("%s: %lu ticks, %lu overruns, jitter %.1f/%.1f/%.1f us, execution "
+         "%.1f/%.1f/%.1f us (min/mean/max)\n",
+         title, (unsigned long)p_stats->nb_ticks,
+         (unsigned long)p_stats->nb_overruns, p_stats->jitter_min * US,
+         p_stats->jitter_mean * US, p_stats->jitter_max * US,
+         p_stats->exec_min * US, p_stats->exec_mean * US,
+         p_stats->exec_max * US);
+}
+
+static void print_histogram(const char *title, const size_t histogram[],
+                            double bucket_width) {
+  size_t i;
+
+  printf("%s\n", title);
+  for (i = 0; i < RROSACE_RT_NB_BUCKETS; ++i) {
+    if (!histogram[i]) {
+      continue;
+    }
+    if (i == RROSACE_RT_NB_BUCKETS - 1) {
+      printf("  >= %6.1f us: %lu\n", (double)i * bucket_width * US,
+             (unsigned long)histogram[i]);
+    } else {
+      printf("  %6.1f us: %lu\n", (double)i * bucket_width * US,
+             (unsigned long)histogram[i]);
+    }
+  }
+}
+
+/**
+ * @brief Print the statistics every second, until the run is done
+ */
+static void *monitor_main(void *p_arg) {
+  struct monitor *p_monitor = (struct monitor *)p_arg;
+  struct timespec next;
+
+  clock_gettime(CLOCK_REALTIME, &next);
+
+  pthread_mutex_lock(&p_monitor->mutex);
+  while (!p_monitor->done) {
+    rrosace_rt_stats_t stats;
+
+    ++next.tv_sec;
+    pthread_cond_timedwait(&p_monitor->cond, &p_monitor->mutex, &next);
+    if (p_monitor->done) {
+      break;
+    }
+    rrosace_rt_get_stats(p_monitor->p_rt, &stats);
+    print_stats("live", &stats);
+    fflush(stdout);
+  }
+  pthread_mutex_unlock(&p_monitor->mutex);
+
+  return (NULL);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  double duration = DURATION;
+  size_t nb_ticks;
+  rrosace_rt_config_t config;
+  rrosace_rt_t *p_rt = NULL;
+  rrosace_sim_t *p_sim = NULL;
+  rrosace_rt_stats_t stats;
+  struct monitor monitor;
+  pthread_t monitor_thread;
+
+  rrosace_rt_default_config(&config);
+
+  if (argc > 1) {
+    duration = atof(argv[1]);
+  }
+  if (argc > 2) {
+    config.priority = atoi(argv[2]);
+    config.lock_memory = config.priority > 0;
+  }
+  if (argc > 3) {
+    config.cpu = atoi(argv[3]);
+  }
+  if (argc > 4) {
+    config.spin = atof(argv[4]) / US;
+  }
+
+  nb_ticks = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ);
+
+  if (!nb_ticks || (argc > 5)) {
+    fprintf(stderr,
+            "Usage: %s [duration (s) [priority [cpu [spin (us)]]]]\n",
+            argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  p_rt = rrosace_rt_new(&config);
+  p_sim = rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C,
+                          RROSACE_VA_EQ);
+  if (!p_rt || !p_sim) {
+    fprintf(stderr, "Invalid configuration.\n");
+    goto out;
+  }
+
+  monitor.p_rt = p_rt;
+  monitor.done = 0;
+  pthread_mutex_init(&monitor.mutex, NULL);
+  pthread_cond_init(&monitor.cond, NULL);
+  if (pthread_create(&monitor_thread, NULL, monitor_main, &monitor)) {
+    goto destroy;
+  }
+
+  ret = rrosace_rt_run(p_rt, p_sim, nb_ticks);
+
+  pthread_mutex_lock(&monitor.mutex);
+  monitor.done = 1;
+  pthread_cond_signal(&monitor.cond);
+  pthread_mutex_unlock(&monitor.mutex);
+  pthread_join(monitor_thread, NULL);
+
+  if (ret == EXIT_FAILURE) {
+    fprintf(stderr, "Paced run failed, check the privileges for the "
+                    "priority, pinning and memory locking.\n");
+    goto destroy;
+  }
+
+  rrosace_rt_get_stats(p_rt, &stats);
+  printf("\nPeriod %.1f us, spin %.1f us, priority %d, cpu %d\n",
+         config.period * US, config.spin * US, config.priority, config.cpu);
+  print_stats("final", &stats);
+  print_histogram("Release jitter", stats.jitter_histogram,
+                  config.bucket_width);
+  print_histogram("Execution time", stats.exec_histogram, config.bucket_width);
+  printf("Altitude %.6f m after %.1f s\n", rrosace_sim_get_values(p_sim)->h,
+         rrosace_sim_get_time(p_sim));
+
+destroy:
+  pthread_cond_destroy(&monitor.cond);
+  pthread_mutex_destroy(&monitor.mutex);
+
+out:
+  rrosace_sim_del(p_sim);
+  rrosace_rt_del(p_rt);
+
+  return (ret);
+}
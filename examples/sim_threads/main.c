@@ -0,0 +1,161 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE simulations, one per thread, in a single process.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Each thread owns its simulation, with its own vertical speed command. As a
+ * simulation holds no global state, the threaded results are the same, bit
+ * for bit, as the ones of a serial run.
+ *
+ * Usage: example_sim_threads [threads [duration (s)]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+#define NB_THREADS (4)
+#define MAX_THREADS (64)
+#define DURATION (50.0)
+
+struct job {
+  double vz_c;
+  size_t nb_ticks;
+  rrosace_sim_values_t values;
+  int ret;
+};
+typedef struct job job_t;
+
+static double now(void);
+
+static void *run(void * /* p_arg */);
+
+static int same_values(const rrosace_sim_values_t * /* p_a */,
+                       const rrosace_sim_values_t * /* p_b */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Run one simulation for the job, keep its final values
+ */
+static void *run(void *p_arg) {
+  job_t *p_job = (job_t *)p_arg;
+  rrosace_sim_t *p_sim = rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ,
+                                         p_job->vz_c, RROSACE_VA_EQ);
+
+  p_job->ret = rrosace_sim_run(p_sim, p_job->nb_ticks);
+  if (p_job->ret == EXIT_SUCCESS) {
+    p_job->values = *rrosace_sim_get_values(p_sim);
+  }
+
+  rrosace_sim_del(p_sim);
+
+  return (NULL);
+}
+
+static int same_values(const rrosace_sim_values_t *p_a,
+                       const rrosace_sim_values_t *p_b) {
+  return ((p_a->delta_e == p_b->delta_e) && (p_a->t == p_b->t) &&
+          (p_a->h == p_b->h) && (p_a->vz == p_b->vz) && (p_a->va == p_b->va) &&
+          (p_a->q == p_b->q) && (p_a->az == p_b->az) &&
+          (p_a->delta_e_c == p_b->delta_e_c) &&
+          (p_a->delta_th_c == p_b->delta_th_c));
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  size_t nb_threads = NB_THREADS;
+  double duration = DURATION;
+  size_t nb_ticks;
+  job_t serial[MAX_THREADS];
+  job_t threaded[MAX_THREADS];
+  pthread_t threads[MAX_THREADS];
+  size_t nb_started = 0;
+  double start;
+  double serial_time;
+  double threaded_time;
+  size_t i;
+
+  if (argc > 1) {
+    nb_threads = (size_t)atol(argv[1]);
+  }
+  if (argc > 2) {
+    duration = atof(argv[2]);
+  }
+
+  nb_ticks = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ);
+
+  if (!nb_threads || (nb_threads > MAX_THREADS) || !nb_ticks || (argc > 3)) {
+    fprintf(stderr, "Usage: %s [threads (1-%d) [duration (s)]]\n", argv[0],
+            MAX_THREADS);
+    return (EXIT_FAILURE);
+  }
+
+  for (i = 0; i < nb_threads; ++i) {
+    memset(&serial[i], 0, sizeof(job_t));
+    serial[i].vz_c = 2.5 * (double)(i + 1) / (double)nb_threads;
+    serial[i].nb_ticks = nb_ticks;
+    serial[i].ret = EXIT_FAILURE;
+    threaded[i] = serial[i];
+  }
+
+  start = now();
+  for (i = 0; i < nb_threads; ++i) {
+    run(&serial[i]);
+  }
+  serial_time = now() - start;
+
+  start = now();
+  for (; nb_started < nb_threads; ++nb_started) {
+    if (pthread_create(&threads[nb_started], NULL, run,
+                       &threaded[nb_started])) {
+      fprintf(stderr, "Thread creation failed.\n");
+      break;
+    }
+  }
+  for (i = 0; i < nb_started; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  threaded_time = now() - start;
+
+  if (nb_started < nb_threads) {
+    goto out;
+  }
+
+  printf("vz_c (m/s),altitude (m),vertical speed (m/s),airspeed (m/s),"
+         "identical\n");
+
+  for (i = 0, ret = EXIT_SUCCESS; i < nb_threads; ++i) {
+    const rrosace_sim_values_t *p_values = &threaded[i].values;
+    const int identical =
+        (serial[i].ret == EXIT_SUCCESS) && (threaded[i].ret == EXIT_SUCCESS) &&
+        same_values(&serial[i].values, p_values);
+
+    printf("%5.3f,%5.6f,%5.6f,%5.6f,%s\n", threaded[i].vz_c, p_values->h,
+           p_values->vz, p_values->va, identical ? "yes" : "no");
+
+    if (!identical) {
+      ret = EXIT_FAILURE;
+    }
+  }
+
+  printf("%lu simulations of %.1f s: serial %.3f s, threaded %.3f s\n",
+         (unsigned long)nb_threads, duration, serial_time, threaded_time);
+
+out:
+  return (ret);
+}
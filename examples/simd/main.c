@@ -0,0 +1,248 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE simulation daemon client, streaming a scenario and
+ * measuring the throughput of short ones.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Connects to a running rrosace-simd. A descent is streamed sample by sample,
+ * then short scenarios are pipelined to measure the jobs per second, then a
+ * high priority job is submitted behind a backlog of low priority ones.
+ *
+ * Usage: example_simd [socket [jobs [ticks]]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rrosace.h>
+
+#include "protocol.h"
+
+#define NB_JOBS (2000)
+#define NB_TICKS (RROSACE_DEFAULT_PHYSICAL_FREQ)
+#define NB_BACKLOG (200)
+
+/* Descent at 2.5 m/s streamed every second for 5 s */
+#define VZ_C (2.5)
+#define STREAM_TICKS (5 * RROSACE_DEFAULT_PHYSICAL_FREQ)
+#define STREAM_STRIDE (RROSACE_DEFAULT_PHYSICAL_FREQ)
+
+static double now(void);
+
+static int send_request(int /* fd */, unsigned long /* id */,
+                        long /* priority */, double /* vz_c */,
+                        unsigned long /* nb_ticks */,
+                        unsigned long /* stride */);
+
+static int receive_frame(int /* fd */, struct simd_frame * /* p_frame */);
+
+static int stream(int /* fd */);
+
+static int throughput(int /* fd */, unsigned long /* nb_jobs */,
+                      unsigned long /* nb_ticks */);
+
+static int priority(int /* fd */, unsigned long /* nb_ticks */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+static int send_request(int fd, unsigned long id, long priority, double vz_c,
+                        unsigned long nb_ticks, unsigned long stride) {
+  struct simd_request request;
+  const char *p_bytes = (const char *)&request;
+  size_t nb_sent = 0;
+
+  memset(&request, 0, sizeof(request));
+  request.id = id;
+  request.priority = priority;
+  request.h_c = RROSACE_H_EQ;
+  request.vz_c = vz_c;
+  request.va_c = RROSACE_VA_EQ;
+  request.nb_ticks = nb_ticks;
+  request.stride = stride;
+
+  while (nb_sent < sizeof(request)) {
+    const ssize_t nb_written =
+        write(fd, p_bytes + nb_sent, sizeof(request) - nb_sent);
+
+    if (nb_written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return (EXIT_FAILURE);
+    }
+    nb_sent += (size_t)nb_written;
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+static int receive_frame(int fd, struct simd_frame *p_frame) {
+  char *p_bytes = (char *)p_frame;
+  size_t nb_received = 0;
+
+  while (nb_received < sizeof(*p_frame)) {
+    const ssize_t nb_read =
+        read(fd, p_bytes + nb_received, sizeof(*p_frame) - nb_received);
+
+    if (nb_read <= 0) {
+      if ((nb_read < 0) && (errno == EINTR)) {
+        continue;
+      }
+      return (EXIT_FAILURE);
+    }
+    nb_received += (size_t)nb_read;
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+static int stream(int fd) {
+  struct simd_frame frame;
+
+  if (send_request(fd, 0, 0, VZ_C, STREAM_TICKS, STREAM_STRIDE) ==
+      EXIT_FAILURE) {
+    return (EXIT_FAILURE);
+  }
+
+  printf("Descent streamed:\n");
+  do {
+    if (receive_frame(fd, &frame) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+    if (frame.type == SIMD_SAMPLE) {
+      printf("  t %4.1f s: h %.6f m, vz %.6f m/s, delta_e_c %.9f\n",
+             (double)frame.tick / RROSACE_DEFAULT_PHYSICAL_FREQ, frame.h,
+             frame.vz, frame.delta_e_c);
+    }
+  } while (frame.type == SIMD_SAMPLE);
+
+  return ((frame.type == SIMD_DONE) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * @brief Pipeline short jobs, their last sample only, until all are done
+ */
+static int throughput(int fd, unsigned long nb_jobs, unsigned long nb_ticks) {
+  const double start = now();
+  struct simd_frame frame;
+  unsigned long nb_done = 0;
+  unsigned long job;
+  double duration;
+
+  for (job = 0; job < nb_jobs; ++job) {
+    if (send_request(fd, job, 0, VZ_C * (double)(job % 3), nb_ticks, 0) ==
+        EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+  }
+
+  while (nb_done < nb_jobs) {
+    if ((receive_frame(fd, &frame) == EXIT_FAILURE) ||
+        (frame.type == SIMD_FAILED)) {
+      return (EXIT_FAILURE);
+    }
+    nb_done += (frame.type == SIMD_DONE);
+  }
+  duration = now() - start;
+
+  printf("%lu jobs of %lu ticks in %.3f s: %.0f jobs/s\n", nb_jobs, nb_ticks,
+         duration, (double)nb_jobs / duration);
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Submit a high priority job behind a backlog, and tell when it ends
+ */
+static int priority(int fd, unsigned long nb_ticks) {
+  struct simd_frame frame;
+  unsigned long nb_done = 0;
+  unsigned long rank = 0;
+  unsigned long job;
+
+  for (job = 0; job <= NB_BACKLOG; ++job) {
+    if (send_request(fd, job, (job == NB_BACKLOG) ? 1 : 0, VZ_C, nb_ticks,
+                     0) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+  }
+
+  while (nb_done <= NB_BACKLOG) {
+    if ((receive_frame(fd, &frame) == EXIT_FAILURE) ||
+        (frame.type == SIMD_FAILED)) {
+      return (EXIT_FAILURE);
+    }
+    if (frame.type == SIMD_DONE) {
+      if (frame.id == NB_BACKLOG) {
+        rank = nb_done;
+      }
+      ++nb_done;
+    }
+  }
+
+  printf("High priority job submitted after %d, done after %lu\n", NB_BACKLOG,
+         rank);
+
+  return (EXIT_SUCCESS);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  const char *path = (argc > 1) ? argv[1] : SIMD_SOCKET;
+  const unsigned long nb_jobs =
+      (argc > 2) ? (unsigned long)atol(argv[2]) : NB_JOBS;
+  const unsigned long nb_ticks =
+      (argc > 3) ? (unsigned long)atol(argv[3]) : NB_TICKS;
+  struct sockaddr_un address;
+  int fd;
+
+  if ((argc > 4) || !nb_jobs || !nb_ticks ||
+      (strlen(path) >= sizeof(address.sun_path))) {
+    fprintf(stderr, "Usage: %s [socket [jobs [ticks]]]\n", argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path, path);
+
+  fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if ((fd < 0) ||
+      connect(fd, (struct sockaddr *)&address, sizeof(address))) {
+    fprintf(stderr, "Connecting to %s failed, is rrosace-simd running?\n",
+            path);
+    goto out;
+  }
+
+  if ((stream(fd) == EXIT_FAILURE) ||
+      (throughput(fd, nb_jobs, nb_ticks) == EXIT_FAILURE) ||
+      (priority(fd, nb_ticks) == EXIT_FAILURE)) {
+    fprintf(stderr, "Jobs failed.\n");
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  if (fd >= 0) {
+    close(fd);
+  }
+
+  return (ret);
+}
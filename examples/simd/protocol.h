@@ -0,0 +1,52 @@
+/**
+ * @file protocol.h
+ * @brief RROSACE simulation daemon protocol, shared by the daemon and its
+ * clients.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Clients send fixed size requests on a Unix domain stream socket, and
+ * receive fixed size frames: the samples of each job, then its end. Both ends
+ * run on the same host, so that the structures are sent as they are.
+ */
+
+#ifndef SIMD_PROTOCOL_H
+#define SIMD_PROTOCOL_H
+
+/** Default socket of the daemon */
+#define SIMD_SOCKET "/tmp/rrosace-simd.sock"
+
+/** Scenario job request */
+struct simd_request {
+  unsigned long id;       /**< identifier, chosen by the client */
+  long priority;          /**< priority, the highest first */
+  double h_c;             /**< altitude command */
+  double vz_c;            /**< vertical speed command */
+  double va_c;            /**< true airspeed command */
+  unsigned long nb_ticks; /**< duration, in physical ticks */
+  unsigned long stride;   /**< ticks between samples, 0 for the last only */
+};
+
+/** Type of a frame */
+enum simd_frame_type {
+  SIMD_SAMPLE, /**< sample of a job */
+  SIMD_DONE,   /**< job run to its end */
+  SIMD_FAILED  /**< job ended early, the ticks run given */
+};
+
+/** Result frame */
+struct simd_frame {
+  unsigned long id;   /**< identifier of the job */
+  unsigned long type; /**< type of the frame */
+  unsigned long tick; /**< ticks run */
+  double h;           /**< altitude */
+  double vz;          /**< vertical speed */
+  double va;          /**< true airspeed */
+  double q;           /**< pitch rate */
+  double az;          /**< vertical acceleration */
+  double delta_e_c;   /**< elevator deflection command */
+  double delta_th_c;  /**< throttle command */
+};
+
+#endif /* SIMD_PROTOCOL_H */
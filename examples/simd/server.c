@@ -0,0 +1,331 @@
+/**
+ * @file server.c
+ * @Synopsis RROSACE simulation daemon, running scenario jobs submitted on a
+ * Unix domain socket.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The daemon keeps a job server with one warm simulation per worker, and
+ * queues the requests of its clients by priority. The samples of a job are
+ * written back to its client as frames by the worker running it, and the jobs
+ * of a client that left are cancelled. A client that does not read its frames
+ * within SEND_TIMEOUT_US is dropped as if it left, so that it never holds a
+ * worker for longer. Stops on SIGINT or SIGTERM.
+ *
+ * Usage: rrosace-simd [socket [workers]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <rrosace.h>
+
+#include "protocol.h"
+
+#define NB_WORKERS (4)
+#define MAX_CLIENTS (64)
+#define BACKLOG (16)
+/* Time a worker waits for a client to make room for a frame, in us */
+#define SEND_TIMEOUT_US (500000)
+
+/* Client, shared by its connection and its jobs */
+struct client {
+  int fd;
+  /* Frames written whole, the workers blocking each other for at most the
+   * send timeout */
+  pthread_mutex_t mutex;
+  size_t nb_refs;
+  int closed;
+  struct simd_request request;
+  size_t nb_bytes;
+};
+
+static volatile sig_atomic_t stop = 0;
+
+static void on_signal(int /* signal */);
+
+static void release(struct client * /* p_client */);
+
+static int send_frame(struct client * /* p_client */,
+                      const struct simd_frame * /* p_frame */);
+
+static int sink_func(void * /* p_sink */,
+                     const rrosace_server_job_t * /* p_job */,
+                     size_t /* tick */,
+                     const rrosace_sim_values_t * /* p_values */);
+
+static int receive(rrosace_server_t * /* p_server */,
+                   struct client * /* p_client */);
+
+static int serve(rrosace_server_t * /* p_server */, int /* listener */);
+
+static void on_signal(int signal) {
+  (void)signal;
+  stop = 1;
+}
+
+/**
+ * @brief Drop a reference to a client, closing it with the last one
+ */
+static void release(struct client *p_client) {
+  if (!__atomic_sub_fetch(&p_client->nb_refs, 1, __ATOMIC_ACQ_REL)) {
+    close(p_client->fd);
+    pthread_mutex_destroy(&p_client->mutex);
+    free(p_client);
+  }
+}
+
+/**
+ * @brief Write a frame whole, the client being locked, or drop the client
+ * once it left or let a write time out, its stream being cut mid-frame
+ */
+static int send_frame(struct client *p_client,
+                      const struct simd_frame *p_frame) {
+  int ret = EXIT_SUCCESS;
+  const char *p_bytes = (const char *)p_frame;
+  size_t nb_sent = 0;
+
+  while (nb_sent < sizeof(*p_frame)) {
+    const ssize_t nb_written =
+        write(p_client->fd, p_bytes + nb_sent, sizeof(*p_frame) - nb_sent);
+
+    if (nb_written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      /* Seen by the poll of the connection, which removes the client */
+      shutdown(p_client->fd, SHUT_RDWR);
+      __atomic_store_n(&p_client->closed, 1, __ATOMIC_RELAXED);
+      ret = EXIT_FAILURE;
+      break;
+    }
+    nb_sent += (size_t)nb_written;
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Stream the samples of a job to its client, cancelling it once the
+ * client left
+ */
+static int sink_func(void *p_sink, const rrosace_server_job_t *p_job,
+                     size_t tick, const rrosace_sim_values_t *p_values) {
+  struct client *p_client = (struct client *)p_sink;
+  struct simd_frame frame;
+  int ret = EXIT_FAILURE;
+
+  memset(&frame, 0, sizeof(frame));
+  frame.id = p_job->id;
+  frame.tick = (unsigned long)tick;
+  if (p_values) {
+    frame.type = SIMD_SAMPLE;
+    frame.h = p_values->h;
+    frame.vz = p_values->vz;
+    frame.va = p_values->va;
+    frame.q = p_values->q;
+    frame.az = p_values->az;
+    frame.delta_e_c = p_values->delta_e_c;
+    frame.delta_th_c = p_values->delta_th_c;
+  } else {
+    frame.type = (tick == p_job->nb_ticks) ? SIMD_DONE : SIMD_FAILED;
+  }
+
+  pthread_mutex_lock(&p_client->mutex);
+  if (!__atomic_load_n(&p_client->closed, __ATOMIC_RELAXED)) {
+    ret = send_frame(p_client, &frame);
+  }
+  pthread_mutex_unlock(&p_client->mutex);
+
+  /* The job holds its client until its end */
+  if (!p_values) {
+    release(p_client);
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Read the requests of a client, queuing the complete ones
+ * @return EXIT_SUCCESS while the client is connected, else EXIT_FAILURE
+ */
+static int receive(rrosace_server_t *p_server, struct client *p_client) {
+  char *p_bytes = (char *)&p_client->request;
+  const ssize_t nb_read =
+      read(p_client->fd, p_bytes + p_client->nb_bytes,
+           sizeof(p_client->request) - p_client->nb_bytes);
+  rrosace_server_job_t job;
+
+  if (nb_read <= 0) {
+    return (((nb_read < 0) && (errno == EINTR)) ? EXIT_SUCCESS
+                                                 : EXIT_FAILURE);
+  }
+
+  p_client->nb_bytes += (size_t)nb_read;
+  if (p_client->nb_bytes < sizeof(p_client->request)) {
+    return (EXIT_SUCCESS);
+  }
+  p_client->nb_bytes = 0;
+
+  job.id = p_client->request.id;
+  job.priority = (int)p_client->request.priority;
+  job.h_c = p_client->request.h_c;
+  job.vz_c = p_client->request.vz_c;
+  job.va_c = p_client->request.va_c;
+  job.nb_ticks = (size_t)p_client->request.nb_ticks;
+  job.stride = (size_t)p_client->request.stride;
+
+  __atomic_add_fetch(&p_client->nb_refs, 1, __ATOMIC_RELAXED);
+
+  if (rrosace_server_submit(p_server, &job, sink_func, p_client) ==
+      EXIT_FAILURE) {
+    /* Ended at once */
+    sink_func(p_client, &job, 0, NULL);
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Accept clients and read their requests until stopped, then close
+ * them
+ */
+static int serve(rrosace_server_t *p_server, int listener) {
+  struct pollfd fds[MAX_CLIENTS + 1];
+  struct client *p_clients[MAX_CLIENTS + 1];
+  size_t nb_fds = 1;
+  size_t i;
+
+  fds[0].fd = listener;
+  fds[0].events = POLLIN;
+  p_clients[0] = NULL;
+
+  while (!stop) {
+    if (poll(fds, (nfds_t)nb_fds, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+
+    /* Clients read, those gone removed */
+    for (i = nb_fds - 1; i > 0; --i) {
+      if (fds[i].revents &&
+          (receive(p_server, p_clients[i]) == EXIT_FAILURE)) {
+        __atomic_store_n(&p_clients[i]->closed, 1, __ATOMIC_RELAXED);
+        release(p_clients[i]);
+        fds[i] = fds[--nb_fds];
+        p_clients[i] = p_clients[nb_fds];
+      }
+    }
+
+    if (fds[0].revents & POLLIN) {
+      const int fd = accept(listener, NULL, NULL);
+      struct client *p_client;
+      struct timeval timeout;
+
+      if (fd < 0) {
+        continue;
+      }
+      p_client = (struct client *)calloc(1, sizeof(struct client));
+      timeout.tv_sec = SEND_TIMEOUT_US / 1000000;
+      timeout.tv_usec = SEND_TIMEOUT_US % 1000000;
+      if (!p_client || (nb_fds > MAX_CLIENTS) ||
+          setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout))) {
+        free(p_client);
+        close(fd);
+        continue;
+      }
+      p_client->fd = fd;
+      p_client->nb_refs = 1;
+      pthread_mutex_init(&p_client->mutex, NULL);
+      fds[nb_fds].fd = fd;
+      fds[nb_fds].events = POLLIN;
+      p_clients[nb_fds++] = p_client;
+    }
+  }
+
+  /* Running jobs cancelled by their sinks */
+  for (i = 1; i < nb_fds; ++i) {
+    __atomic_store_n(&p_clients[i]->closed, 1, __ATOMIC_RELAXED);
+    release(p_clients[i]);
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  const char *path = (argc > 1) ? argv[1] : SIMD_SOCKET;
+  const size_t nb_workers = (argc > 2) ? (size_t)atol(argv[2]) : NB_WORKERS;
+  struct sockaddr_un address;
+  struct sigaction action;
+  rrosace_sim_t *p_sim = NULL;
+  rrosace_server_t *p_server = NULL;
+  int listener = -1;
+
+  if ((argc > 3) || !nb_workers ||
+      (nb_workers > RROSACE_SERVER_MAX_WORKERS) ||
+      (strlen(path) >= sizeof(address.sun_path))) {
+    fprintf(stderr, "Usage: %s [socket [workers]]\n", argv[0]);
+    return (EXIT_FAILURE);
+  }
+
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = on_signal;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGINT, &action, NULL);
+  sigaction(SIGTERM, &action, NULL);
+  /* Clients gone are seen by write */
+  action.sa_handler = SIG_IGN;
+  sigaction(SIGPIPE, &action, NULL);
+
+  p_sim = rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, 0., RROSACE_VA_EQ);
+  p_server = p_sim ? rrosace_server_new(p_sim, nb_workers) : NULL;
+  if (!p_server) {
+    fprintf(stderr, "Job server creation failed.\n");
+    goto out;
+  }
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path, path);
+  unlink(path);
+
+  listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if ((listener < 0) ||
+      bind(listener, (struct sockaddr *)&address, sizeof(address)) ||
+      listen(listener, BACKLOG)) {
+    fprintf(stderr, "Listening on %s failed.\n", path);
+    goto out;
+  }
+
+  printf("Serving on %s with %lu workers\n", path, (unsigned long)nb_workers);
+  fflush(stdout);
+
+  ret = serve(p_server, listener);
+  printf("%lu jobs done\n",
+         (unsigned long)rrosace_server_get_nb_done(p_server));
+  unlink(path);
+
+out:
+  if (listener >= 0) {
+    close(listener);
+  }
+  rrosace_server_del(p_server);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
@@ -0,0 +1,282 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE what-if queries on a surrogate of the closed loop,
+ * identified from batch simulations around trim, with fallback to the full
+ * simulation outside of the surrogate trust region.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Usage: example_surrogate [vz_c (m/s) [va_c (m/s) [horizon (s)]]]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rrosace.h>
+
+/* Surrogate inputs, vertical speed and airspeed commands */
+#define NB_INPUTS (2)
+/* Surrogate outputs, altitude and airspeed */
+#define NB_OUTPUTS (2)
+#define ORDER (8)
+
+/* Sampling of the surrogate, in physical ticks */
+#define SAMPLE_TICKS (20)
+#define SAMPLE_PERIOD ((double)SAMPLE_TICKS / RROSACE_DEFAULT_PHYSICAL_FREQ)
+
+/* Identification campaign */
+#define NB_RECORDS (48)
+#define RECORD_DURATION (60.0)
+#define MIN_HOLD_DURATION (2.0)
+#define MAX_HOLD_DURATION (8.0)
+#define VZ_C_AMPLITUDE (3.0)
+#define VA_C_AMPLITUDE (5.0)
+#define SEED (26)
+
+/* Default query */
+#define QUERY_VZ_C (2.5)
+#define QUERY_VA_C (RROSACE_VA_EQ)
+#define QUERY_HORIZON (50.0)
+
+#define NB_TIMED_PREDICTIONS (10000)
+
+static double uniform(double /* low */, double /* high */);
+
+static size_t to_samples(double /* duration */);
+
+static int identify(rrosace_surrogate_t * /* p_surrogate */);
+
+static int simulate(const double * /* u */, size_t /* nb_samples */,
+                    double * /* y */);
+
+static int validate(const rrosace_surrogate_t * /* p_surrogate */);
+
+static int query(const rrosace_surrogate_t * /* p_surrogate */,
+                 const double * /* u */, double /* horizon */);
+
+static double uniform(double low, double high) {
+  return (low + (high - low) * ((double)rand() / RAND_MAX));
+}
+
+static size_t to_samples(double duration) {
+  return ((size_t)floor(duration / SAMPLE_PERIOD + 0.5));
+}
+
+/**
+ * @brief Identify the surrogate on closed loops excited by random steps of
+ * the FCU commands around trim.
+ */
+static int identify(rrosace_surrogate_t *p_surrogate) {
+  int ret = EXIT_FAILURE;
+  const size_t record_length = to_samples(RECORD_DURATION);
+  size_t record;
+
+  srand(SEED);
+
+  for (record = 0; record < NB_RECORDS; ++record) {
+    double u[NB_INPUTS] = {RROSACE_VZ_EQ, RROSACE_VA_EQ};
+    rrosace_sim_t *p_sim =
+        rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, u[0], u[1]);
+    const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+    size_t next_change = 0;
+    size_t sample;
+
+    if (!p_sim) {
+      ret = EXIT_FAILURE;
+      goto out;
+    }
+
+    ret = EXIT_SUCCESS;
+    rrosace_surrogate_begin_record(p_surrogate);
+
+    for (sample = 0; (sample < record_length) && (ret == EXIT_SUCCESS);
+         ++sample) {
+      double y[NB_OUTPUTS];
+
+      if (sample == next_change) {
+        u[0] = RROSACE_VZ_EQ + uniform(-VZ_C_AMPLITUDE, VZ_C_AMPLITUDE);
+        u[1] = RROSACE_VA_EQ + uniform(-VA_C_AMPLITUDE, VA_C_AMPLITUDE);
+        /* Half of the records are step responses, covering long holds */
+        next_change += record % 2 ? to_samples(uniform(MIN_HOLD_DURATION,
+                                                      MAX_HOLD_DURATION))
+                                  : record_length;
+        ret = rrosace_sim_set_commands(p_sim, RROSACE_H_EQ, u[0], u[1]);
+      }
+
+      y[0] = p_values->h;
+      y[1] = p_values->va;
+      rrosace_surrogate_add_sample(p_surrogate, u, y);
+
+      if (ret == EXIT_SUCCESS) {
+        ret = rrosace_sim_run(p_sim, SAMPLE_TICKS);
+      }
+    }
+
+    rrosace_sim_del(p_sim);
+
+    if (ret == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  ret = rrosace_surrogate_identify(p_surrogate);
+
+out:
+  return (ret);
+}
+
+/**
+ * @brief Full simulation of constant FCU commands applied from trim
+ */
+static int simulate(const double *u, size_t nb_samples, double *y) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, u[0], u[1]);
+
+  if (!p_sim) {
+    goto out;
+  }
+
+  ret = rrosace_sim_run(p_sim, nb_samples * SAMPLE_TICKS);
+
+  y[0] = rrosace_sim_get_values(p_sim)->h;
+  y[1] = rrosace_sim_get_values(p_sim)->va;
+
+out:
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+static int validate(const rrosace_surrogate_t *p_surrogate) {
+  int ret = EXIT_SUCCESS;
+  static const double vzs_c[] = {-2.0, -1.0, 0.5, 1.5, 2.5};
+  static const double vas_c[] = {RROSACE_VA_EQ - 2.0, RROSACE_VA_EQ,
+                                 RROSACE_VA_EQ + 3.0};
+  const size_t nb_samples = to_samples(30.0);
+  size_t i;
+  size_t j;
+
+  printf("validation at %.1f s: vz_c, va_c, h error (m), va error (m/s), "
+         "trusted\n",
+         nb_samples * SAMPLE_PERIOD);
+
+  for (i = 0; (i < sizeof(vzs_c) / sizeof(*vzs_c)) && (ret == EXIT_SUCCESS);
+       ++i) {
+    for (j = 0; (j < sizeof(vas_c) / sizeof(*vas_c)) && (ret == EXIT_SUCCESS);
+         ++j) {
+      double u[NB_INPUTS];
+      double y_surrogate[NB_OUTPUTS];
+      double y_simulation[NB_OUTPUTS] = {0., 0.};
+      rrosace_surrogate_validity_t validity;
+
+      u[0] = vzs_c[i];
+      u[1] = vas_c[j];
+
+      ret = rrosace_surrogate_predict(p_surrogate, u, nb_samples, y_surrogate,
+                                      &validity);
+      if (ret == EXIT_SUCCESS) {
+        ret = simulate(u, nb_samples, y_simulation);
+      }
+
+      if (ret == EXIT_FAILURE) {
+        break;
+      }
+
+      printf("%5.2f,%7.2f,%9.4f,%9.4f,%s\n", u[0], u[1],
+             y_surrogate[0] - y_simulation[0],
+             y_surrogate[1] - y_simulation[1],
+             validity == RROSACE_SURROGATE_TRUSTED ? "yes" : "no");
+    }
+  }
+
+  return (ret);
+}
+
+static int query(const rrosace_surrogate_t *p_surrogate, const double *u,
+                 double horizon) {
+  int ret;
+  const size_t nb_samples = to_samples(horizon);
+  double y[NB_OUTPUTS];
+  rrosace_surrogate_validity_t validity;
+  clock_t start;
+  double latency;
+  size_t i;
+
+  start = clock();
+  for (i = 0, ret = EXIT_SUCCESS;
+       (i < NB_TIMED_PREDICTIONS) && (ret == EXIT_SUCCESS); ++i) {
+    ret = rrosace_surrogate_predict(p_surrogate, u, nb_samples, y, &validity);
+  }
+  latency = (double)(clock() - start) / CLOCKS_PER_SEC / NB_TIMED_PREDICTIONS;
+
+  if (ret == EXIT_FAILURE) {
+    goto out;
+  }
+
+  if (validity == RROSACE_SURROGATE_TRUSTED) {
+    printf("surrogate (%.2f us)", latency * 1e6);
+  } else {
+    /* Outside of the trust region, the full simulation answers */
+    start = clock();
+    ret = simulate(u, nb_samples, y);
+    latency = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("full simulation, out of trust region (%.2f us)", latency * 1e6);
+  }
+
+  printf(": vz_c %.3f m/s, va_c %.3f m/s during %.1f s -> h %.6f m, va "
+         "%.6f m/s\n",
+         u[0], u[1], nb_samples * SAMPLE_PERIOD, y[0], y[1]);
+
+out:
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  const double u_eq[NB_INPUTS] = {RROSACE_VZ_EQ, RROSACE_VA_EQ};
+  const double y_eq[NB_OUTPUTS] = {RROSACE_H_EQ, RROSACE_VA_EQ};
+  double u[NB_INPUTS] = {QUERY_VZ_C, QUERY_VA_C};
+  double horizon = QUERY_HORIZON;
+  rrosace_surrogate_t *p_surrogate;
+
+  if (argc > 1) {
+    u[0] = atof(argv[1]);
+  }
+  if (argc > 2) {
+    u[1] = atof(argv[2]);
+  }
+  if (argc > 3) {
+    horizon = atof(argv[3]);
+  }
+
+  p_surrogate = rrosace_surrogate_new(NB_INPUTS, NB_OUTPUTS, ORDER, u_eq, y_eq);
+  if (!p_surrogate) {
+    goto out;
+  }
+
+  ret = identify(p_surrogate);
+  if (ret == EXIT_FAILURE) {
+    fprintf(stderr, "Surrogate identification failed.\n");
+    goto out;
+  }
+
+  printf("surrogate fit: h %.6f, va %.6f\n",
+         rrosace_surrogate_get_fit(p_surrogate, 0),
+         rrosace_surrogate_get_fit(p_surrogate, 1));
+
+  ret = validate(p_surrogate);
+  if (ret == EXIT_FAILURE) {
+    goto out;
+  }
+
+  ret = query(p_surrogate, u, horizon);
+
+out:
+  rrosace_surrogate_del(p_surrogate);
+
+  return (ret);
+}
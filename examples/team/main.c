@@ -0,0 +1,218 @@
+/**
+ * @file main.c
+ * @Synopsis RROSACE tick latency with the filters and the FCCs stepped in
+ * parallel by a spinning team, and the break-even cost of a model.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The same climb is run serially, then on teams of a growing number of
+ * threads: first with both stages forked, then with the stages the team
+ * tuning found faster. The latencies of the 50 Hz ticks, which release the
+ * FCCs, are printed apart from the other ones, with the costs measured by the
+ * tuning: a stage pays once the step of its models costs more than its
+ * break-even.
+ *
+ * Usage: example_team [duration (s) [repetitions]]
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rrosace.h>
+
+#define DURATION (20.0)
+#define NB_REPS (10000)
+#define VZ_C (2.5)
+#define US (1e6)
+
+/* Both stages */
+#define ALL_STAGES                                                             \
+  (RROSACE_SIM_STAGE(RROSACE_SIM_STAGE_FILTERS) |                              \
+   RROSACE_SIM_STAGE(RROSACE_SIM_STAGE_FCCS))
+
+struct latency {
+  /* Mean of the ticks releasing the FCCs */
+  double fccs;
+  /* Mean of the other ticks */
+  double others;
+};
+
+static double now(void);
+
+static int run(rrosace_sim_t * /* p_sim */, size_t /* nb_ticks */,
+               struct latency * /* p_latency */, double /* state */[]);
+
+static int run_team(size_t /* nb_threads */, size_t /* nb_ticks */,
+                    size_t /* nb_reps */, const double /* serial */[]);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Run a climb a tick at a time, timing each one
+ */
+static int run(rrosace_sim_t *p_sim, size_t nb_ticks,
+               struct latency *p_latency, double state[]) {
+  const size_t period =
+      rrosace_sim_get_task_period(p_sim, RROSACE_SIM_TASK_FCCS_COM);
+  size_t nb_fccs = 0;
+  size_t tick;
+
+  p_latency->fccs = 0.;
+  p_latency->others = 0.;
+
+  for (tick = 0; tick < nb_ticks; ++tick) {
+    const int fccs = !(rrosace_sim_get_logical_time(p_sim) % period);
+    const double start = now();
+    double elapsed;
+
+    if (rrosace_sim_run(p_sim, 1) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+    elapsed = now() - start;
+
+    if (fccs) {
+      p_latency->fccs += elapsed;
+      ++nb_fccs;
+    } else {
+      p_latency->others += elapsed;
+    }
+  }
+
+  p_latency->fccs /= (double)(nb_fccs ? nb_fccs : 1);
+  p_latency->others /=
+      (double)((nb_ticks > nb_fccs) ? (nb_ticks - nb_fccs) : 1);
+
+  return (rrosace_sim_get_state(p_sim, state));
+}
+
+/**
+ * @brief Run a climb on a team with both stages, then with the tuned ones,
+ * and check their states against the serial one
+ */
+static int run_team(size_t nb_threads, size_t nb_ticks, size_t nb_reps,
+                    const double serial[]) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sims[2] = {NULL, NULL};
+  rrosace_sim_team_costs_t costs;
+  struct latency latencies[2];
+  double state[RROSACE_SIM_STATE_SIZE];
+  size_t i;
+
+  for (i = 0; i < 2; ++i) {
+    p_sims[i] =
+        rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+    if (!p_sims[i] ||
+        (rrosace_sim_set_team(p_sims[i], nb_threads, ALL_STAGES) ==
+         EXIT_FAILURE)) {
+      fprintf(stderr, "Team of %lu threads refused.\n",
+              (unsigned long)nb_threads);
+      goto out;
+    }
+  }
+
+  if (rrosace_sim_tune_team(p_sims[1], nb_reps, &costs) == EXIT_FAILURE) {
+    fprintf(stderr, "Tuning failed.\n");
+    goto out;
+  }
+
+  for (i = 0; i < 2; ++i) {
+    if ((run(p_sims[i], nb_ticks, &latencies[i], state) == EXIT_FAILURE) ||
+        memcmp(state, serial, sizeof(state))) {
+      fprintf(stderr, "Run on the team differs from the serial one.\n");
+      goto out;
+    }
+  }
+
+  printf("%lu,%s,%.3f,%.3f\n", (unsigned long)nb_threads, "both",
+         latencies[0].fccs * US, latencies[0].others * US);
+  printf("%lu,%s%s%s,%.3f,%.3f\n", (unsigned long)nb_threads,
+         (rrosace_sim_get_team_stages(p_sims[1]) &
+          RROSACE_SIM_STAGE(RROSACE_SIM_STAGE_FILTERS))
+             ? "filters "
+             : "",
+         (rrosace_sim_get_team_stages(p_sims[1]) &
+          RROSACE_SIM_STAGE(RROSACE_SIM_STAGE_FCCS))
+             ? "FCCs "
+             : "",
+         rrosace_sim_get_team_stages(p_sims[1]) ? "tuned" : "none tuned",
+         latencies[1].fccs * US, latencies[1].others * US);
+  printf("  fork and join %.3f us; filter %.3f us, break-even %.3f us; "
+         "FCC couple %.3f us, break-even %.3f us\n",
+         costs.fork_join * US, costs.model[RROSACE_SIM_STAGE_FILTERS] * US,
+         costs.break_even[RROSACE_SIM_STAGE_FILTERS] * US,
+         costs.model[RROSACE_SIM_STAGE_FCCS] * US,
+         costs.break_even[RROSACE_SIM_STAGE_FCCS] * US);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (i = 0; i < 2; ++i) {
+    rrosace_sim_del(p_sims[i]);
+  }
+
+  return (ret);
+}
+
+int main(int argc, char *argv[]) {
+  int ret = EXIT_FAILURE;
+  double duration = DURATION;
+  size_t nb_reps = NB_REPS;
+  const long nb_cores = sysconf(_SC_NPROCESSORS_ONLN);
+  size_t max_threads = RROSACE_SIM_MAX_TEAM_THREADS;
+  rrosace_sim_t *p_sim = NULL;
+  struct latency latency;
+  double serial[RROSACE_SIM_STATE_SIZE];
+  size_t nb_ticks;
+  size_t nb_threads;
+
+  if (argc > 1) {
+    duration = strtod(argv[1], NULL);
+  }
+  if (argc > 2) {
+    nb_reps = (size_t)strtoul(argv[2], NULL, 10);
+  }
+  nb_ticks = (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ);
+
+  /* A thread spinning on each core but the caller's */
+  if ((nb_cores > 1) && ((size_t)nb_cores - 1 < max_threads)) {
+    max_threads = (size_t)nb_cores - 1;
+  } else if (nb_cores <= 1) {
+    max_threads = 1;
+  }
+
+  p_sim = rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  if (!p_sim || (run(p_sim, nb_ticks, &latency, serial) == EXIT_FAILURE)) {
+    fprintf(stderr, "Serial run failed.\n");
+    goto out;
+  }
+
+  printf("%lu ticks, mean latencies\n\n", (unsigned long)nb_ticks);
+  printf("threads,stages,50 Hz tick (us),other tick (us)\n");
+  printf("0,serial,%.3f,%.3f\n", latency.fccs * US, latency.others * US);
+
+  for (nb_threads = 1; nb_threads <= max_threads; ++nb_threads) {
+    if (run_team(nb_threads, nb_ticks, nb_reps ? nb_reps : 1, serial) ==
+        EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
@@ -27,5 +27,24 @@
 #include <rrosace_filters.h>
 #include <rrosace_flight_dynamics.h>
 #include <rrosace_flight_mode.h>
+#include <rrosace_surrogate.h>
+#include <rrosace_parareal.h>
+#include <rrosace_relaxation.h>
+#include <rrosace_events.h>
+#include <rrosace_qmc.h>
+#include <rrosace_sim.h>
+#include <rrosace_pool.h>
+#include <rrosace_dataflow.h>
+#include <rrosace_allocation.h>
+#include <rrosace_coroutine.h>
+#include <rrosace_rt.h>
+#include <rrosace_des.h>
+#include <rrosace_explore.h>
+#include <rrosace_ensemble.h>
+#include <rrosace_campaign.h>
+#include <rrosace_server.h>
+#include <rrosace_lane.h>
+#include <rrosace_jitter.h>
+#include <rrosace_delay_line.h>
 
 #endif /* RROSACE_H */
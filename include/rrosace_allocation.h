@@ -0,0 +1,751 @@
+/**
+ * @file rrosace_allocation.h
+ * @brief RROSACE Scheduling of cyber-physical system library allocation of
+ * the models to cores header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * An allocation maps each model of a dataflow to a core from the measured
+ * costs of their steps, and orders the jobs of a hyperperiod on each core, so
+ * as to minimize the makespan of a hyperperiod. The static executor runs an
+ * allocation, a thread per core, each job waiting only for the conflicting
+ * jobs before it in the serial order, so that the results are the serial
+ * ones. Its threads are created with it and wait between runs.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_ALLOCATION_H
+#define RROSACE_ALLOCATION_H
+
+#include <rrosace_dataflow.h>
+
+#ifdef __cplusplus
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace RROSACE {
+
+/** @class Allocation
+ *  @brief Mapping of the models of a dataflow to cores, and static schedule
+ * of the jobs of a hyperperiod on each core
+ */
+class Allocation {
+public:
+  /** Mean cost of a step of each model, in s */
+  typedef std::vector<double> Costs;
+  /** Indices of jobs */
+  typedef std::vector<size_t> Jobs;
+
+  /** @struct Step of a model at a tick of the hyperperiod */
+  struct Job {
+    size_t phase; /**< tick in the hyperperiod */
+    size_t model; /**< index of the model */
+    double start;  /**< predicted start, in s from the hyperperiod start */
+    double finish; /**< predicted finish, in s from the hyperperiod start */
+    /** Conflicting jobs before it in the hyperperiod */
+    Jobs predecessors;
+    /** Conflicting jobs after it, in the previous hyperperiod */
+    Jobs carried;
+
+    Job(size_t job_phase, size_t job_model)
+        : phase(job_phase), model(job_model), start(0.), finish(0.),
+          predecessors(), carried() {}
+  };
+
+  /**
+   * @brief Measure the costs of the models, running the dataflow serially
+   * @param[in] dataflow The dataflow, whose models advance
+   * @param[in] nb_hyperperiods The number of hyperperiods run
+   * @return The mean cost of a step of each model
+   */
+  static Costs measure(const Dataflow &dataflow, size_t nb_hyperperiods) {
+    const Dataflow::Models &models = dataflow.get_models();
+    Costs costs(models.size(), 0.);
+    std::vector<size_t> nb_steps(models.size(), 0);
+
+    for (size_t hyperperiod = 0; hyperperiod < nb_hyperperiods;
+         ++hyperperiod) {
+      for (size_t phase = 0; phase < dataflow.get_hyperperiod(); ++phase) {
+        for (size_t model = 0; model < models.size(); ++model) {
+          if (!released(dataflow, phase, model)) {
+            continue;
+          }
+          const double start = now();
+          models[model]->step();
+          costs[model] += now() - start;
+          ++nb_steps[model];
+        }
+      }
+    }
+
+    for (size_t model = 0; model < models.size(); ++model) {
+      if (nb_steps[model]) {
+        costs[model] /= static_cast<double>(nb_steps[model]);
+      }
+    }
+
+    return costs;
+  }
+
+  /**
+   * @brief Allocation constructor
+   *
+   * The models are first mapped by decreasing load to the least loaded
+   * core, then moved or swapped between cores while the makespan of the
+   * list schedule decreases. A list schedule starts the ready job of
+   * highest bottom level first.
+   *
+   * @param[in] dataflow The dataflow, which must outlive the allocation
+   * @param[in] costs The mean cost of a step of each model, in s
+   * @param[in] nb_cores The number of cores
+   */
+  Allocation(const Dataflow &dataflow, const Costs &costs, size_t nb_cores)
+      : r_dataflow(dataflow), m_costs(costs), m_nb_cores(nb_cores), m_jobs(),
+        m_priorities(), m_cores(), m_schedules(), m_makespan(0.) {
+    const size_t nb_models = dataflow.get_models().size();
+
+    if (!nb_cores) {
+      throw(std::invalid_argument("Allocation without cores."));
+    }
+    if (costs.size() != nb_models) {
+      throw(std::invalid_argument("Allocation costs mismatch the models."));
+    }
+
+    init_jobs();
+    init_priorities();
+
+    /* Largest loads first, on the least loaded core */
+    std::vector<double> loads(nb_models, 0.);
+    std::vector<double> core_loads(nb_cores, 0.);
+    std::vector<size_t> order(nb_models);
+
+    for (size_t job = 0; job < m_jobs.size(); ++job) {
+      loads[m_jobs[job].model] += m_costs[m_jobs[job].model];
+    }
+    for (size_t model = 0; model < nb_models; ++model) {
+      order[model] = model;
+    }
+    for (size_t i = 1; i < nb_models; ++i) {
+      for (size_t j = i; j && (loads[order[j]] > loads[order[j - 1]]); --j) {
+        std::swap(order[j], order[j - 1]);
+      }
+    }
+
+    m_cores.assign(nb_models, 0);
+    for (size_t i = 0; i < nb_models; ++i) {
+      const size_t core = static_cast<size_t>(
+          std::min_element(core_loads.begin(), core_loads.end()) -
+          core_loads.begin());
+
+      m_cores[order[i]] = core;
+      core_loads[core] += loads[order[i]];
+    }
+
+    improve();
+    m_makespan = list_schedule(m_cores, true);
+  }
+
+  /**
+   * @brief Get the dataflow
+   * @return The dataflow
+   */
+  const Dataflow &get_dataflow() const { return r_dataflow; }
+
+  /**
+   * @brief Get the number of cores
+   * @return The number of cores
+   */
+  size_t get_nb_cores() const { return m_nb_cores; }
+
+  /**
+   * @brief Get the core of a model
+   * @param[in] model The index of the model
+   * @return The core
+   */
+  size_t get_core(size_t model) const { return m_cores[model]; }
+
+  /**
+   * @brief Get the jobs of a hyperperiod
+   * @return The jobs, in serial order
+   */
+  const std::vector<Job> &get_jobs() const { return m_jobs; }
+
+  /**
+   * @brief Get the static schedule of a core
+   * @param[in] core The core
+   * @return The jobs of the core, in execution order
+   */
+  const Jobs &get_schedule(size_t core) const { return m_schedules[core]; }
+
+  /**
+   * @brief Get the predicted makespan of a hyperperiod
+   * @return The makespan, in s
+   */
+  double get_makespan() const { return m_makespan; }
+
+  /**
+   * @brief Get the cost of a serial hyperperiod
+   * @return The cost, in s
+   */
+  double get_serial_cost() const {
+    double cost = 0.;
+
+    for (size_t job = 0; job < m_jobs.size(); ++job) {
+      cost += m_costs[m_jobs[job].model];
+    }
+
+    return cost;
+  }
+
+  /**
+   * @brief Get the lower bound of the makespan of a hyperperiod, the longest
+   * of the critical path and the mean load of a core
+   * @return The lower bound, in s
+   */
+  double get_lower_bound() const {
+    const double critical_path =
+        m_priorities.empty()
+            ? 0.
+            : *std::max_element(m_priorities.begin(), m_priorities.end());
+
+    return std::max(critical_path,
+                    get_serial_cost() / static_cast<double>(m_nb_cores));
+  }
+
+  /**
+   * @brief Is a model released at a tick of the hyperperiod
+   * @param[in] dataflow The dataflow
+   * @param[in] phase The tick in the hyperperiod
+   * @param[in] model The index of the model
+   * @return true if released
+   */
+  static bool released(const Dataflow &dataflow, size_t phase, size_t model) {
+    const Dataflow::Levels &levels = dataflow.get_levels(phase);
+    const Model *const p_model = dataflow.get_models()[model];
+
+    for (Dataflow::Levels::const_iterator level_it = levels.begin();
+         level_it != levels.end(); ++level_it) {
+      if (std::find(level_it->begin(), level_it->end(), p_model) !=
+          level_it->end()) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+private:
+  const Dataflow &r_dataflow;
+  Costs m_costs;
+  size_t m_nb_cores;
+  std::vector<Job> m_jobs;
+  /** Bottom level of each job, in s */
+  std::vector<double> m_priorities;
+  std::vector<size_t> m_cores;
+  std::vector<Jobs> m_schedules;
+  double m_makespan;
+
+  static double now() {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return static_cast<double>(ts.tv_sec) +
+           static_cast<double>(ts.tv_nsec) * 1e-9;
+  }
+
+  bool conflict(size_t model, size_t other) const {
+    return (model == other) || r_dataflow.depends(model, other) ||
+           r_dataflow.depends(other, model);
+  }
+
+  void init_jobs() {
+    const size_t nb_models = r_dataflow.get_models().size();
+
+    for (size_t phase = 0; phase < r_dataflow.get_hyperperiod(); ++phase) {
+      for (size_t model = 0; model < nb_models; ++model) {
+        if (released(r_dataflow, phase, model)) {
+          m_jobs.push_back(Job(phase, model));
+        }
+      }
+    }
+
+    for (size_t job = 0; job < m_jobs.size(); ++job) {
+      for (size_t other = 0; other < m_jobs.size(); ++other) {
+        if ((other != job) &&
+            conflict(m_jobs[job].model, m_jobs[other].model)) {
+          (other < job ? m_jobs[job].predecessors : m_jobs[job].carried)
+              .push_back(other);
+        }
+      }
+    }
+  }
+
+  void init_priorities() {
+    m_priorities.assign(m_jobs.size(), 0.);
+
+    for (size_t job = m_jobs.size(); job-- > 0;) {
+      m_priorities[job] += m_costs[m_jobs[job].model];
+      for (Jobs::const_iterator it = m_jobs[job].predecessors.begin();
+           it != m_jobs[job].predecessors.end(); ++it) {
+        m_priorities[*it] = std::max(m_priorities[*it], m_priorities[job]);
+      }
+    }
+  }
+
+  /**
+   * @brief List schedule a hyperperiod on a mapping
+   * @param[in] cores The core of each model
+   * @param[in] keep Keep the schedules and the predicted times
+   * @return The makespan, in s
+   */
+  double list_schedule(const std::vector<size_t> &cores, bool keep) {
+    std::vector<double> core_free(m_nb_cores, 0.);
+    std::vector<double> finishes(m_jobs.size(), 0.);
+    std::vector<size_t> nb_waited(m_jobs.size());
+    std::vector<bool> scheduled(m_jobs.size(), false);
+    double makespan = 0.;
+
+    if (keep) {
+      m_schedules.assign(m_nb_cores, Jobs());
+    }
+    for (size_t job = 0; job < m_jobs.size(); ++job) {
+      nb_waited[job] = m_jobs[job].predecessors.size();
+    }
+
+    for (size_t nb_scheduled = 0; nb_scheduled < m_jobs.size();
+         ++nb_scheduled) {
+      size_t best = m_jobs.size();
+      double best_start = 0.;
+
+      /* Highest bottom level first, then earliest start, then serial */
+      for (size_t job = 0; job < m_jobs.size(); ++job) {
+        if (scheduled[job] || nb_waited[job]) {
+          continue;
+        }
+
+        double start = core_free[cores[m_jobs[job].model]];
+        for (Jobs::const_iterator it = m_jobs[job].predecessors.begin();
+             it != m_jobs[job].predecessors.end(); ++it) {
+          start = std::max(start, finishes[*it]);
+        }
+
+        if ((best == m_jobs.size()) ||
+            (m_priorities[job] > m_priorities[best]) ||
+            ((m_priorities[job] == m_priorities[best]) &&
+             (start < best_start))) {
+          best = job;
+          best_start = start;
+        }
+      }
+
+      const size_t core = cores[m_jobs[best].model];
+
+      scheduled[best] = true;
+      finishes[best] = best_start + m_costs[m_jobs[best].model];
+      core_free[core] = finishes[best];
+      makespan = std::max(makespan, finishes[best]);
+      for (size_t job = best + 1; job < m_jobs.size(); ++job) {
+        if (std::find(m_jobs[job].predecessors.begin(),
+                      m_jobs[job].predecessors.end(),
+                      best) != m_jobs[job].predecessors.end()) {
+          --nb_waited[job];
+        }
+      }
+
+      if (keep) {
+        m_jobs[best].start = best_start;
+        m_jobs[best].finish = finishes[best];
+        m_schedules[core].push_back(best);
+      }
+    }
+
+    return makespan;
+  }
+
+  /**
+   * @brief Move and swap models between cores while the makespan decreases
+   */
+  void improve() {
+    const size_t nb_models = m_cores.size();
+    double makespan = list_schedule(m_cores, false);
+    bool improved = true;
+
+    while (improved) {
+      improved = false;
+
+      for (size_t model = 0; model < nb_models; ++model) {
+        for (size_t core = 0; core < m_nb_cores; ++core) {
+          std::vector<size_t> cores = m_cores;
+          double candidate;
+
+          if (core == m_cores[model]) {
+            continue;
+          }
+          cores[model] = core;
+          candidate = list_schedule(cores, false);
+          if (candidate < makespan) {
+            m_cores = cores;
+            makespan = candidate;
+            improved = true;
+          }
+        }
+      }
+
+      for (size_t model = 0; model < nb_models; ++model) {
+        for (size_t other = model + 1; other < nb_models; ++other) {
+          std::vector<size_t> cores = m_cores;
+          double candidate;
+
+          if (cores[model] == cores[other]) {
+            continue;
+          }
+          std::swap(cores[model], cores[other]);
+          candidate = list_schedule(cores, false);
+          if (candidate < makespan) {
+            m_cores = cores;
+            makespan = candidate;
+            improved = true;
+          }
+        }
+      }
+    }
+  }
+};
+
+/** @class Static executor
+ *  @brief Runs an allocation hyperperiod after hyperperiod, a thread per
+ * core following its static schedule
+ */
+class StaticExecutor {
+public:
+  /**
+   * @brief Static executor constructor
+   * @param[in] allocation The allocation to run, which must outlive the
+   * executor
+   * @param[in] pin Pin the thread of each core to a processor of the
+   * affinity mask of the constructing thread, from the one it runs on
+   */
+  explicit StaticExecutor(const Allocation &allocation, bool pin = false)
+      : r_allocation(allocation), m_done(allocation.get_jobs().size(), 0),
+        m_hyperperiod(0), m_target(0), m_failed(false), m_mutex(), m_start(),
+        m_finished(), m_threads(), m_cores(allocation.get_nb_cores()),
+        m_generation(0), m_nb_finished(0), m_stop(false), m_error() {
+    pthread_mutex_init(&m_mutex, nullptr);
+    pthread_cond_init(&m_start, nullptr);
+    pthread_cond_init(&m_finished, nullptr);
+
+    for (size_t core = 0; core < m_cores.size(); ++core) {
+      m_cores[core].p_executor = this;
+      m_cores[core].index = core;
+      m_cores[core].processor = pin ? spread_processor(core) : -1;
+    }
+
+    for (size_t core = 1; core < m_cores.size(); ++core) {
+      pthread_t id;
+
+      if (pthread_create(&id, nullptr, core_main, &m_cores[core])) {
+        fail_creation("Executor thread creation failed.");
+      }
+      m_threads.push_back(id);
+      if (!pin_thread(id, m_cores[core].processor)) {
+        fail_creation("Executor thread pinning failed.");
+      }
+    }
+  }
+
+  /**
+   * @brief Static executor destructor
+   */
+  ~StaticExecutor() {
+    stop();
+    pthread_cond_destroy(&m_finished);
+    pthread_cond_destroy(&m_start);
+    pthread_mutex_destroy(&m_mutex);
+  }
+
+  /**
+   * @brief Execute hyperperiods, the calling thread running the first core,
+   * pinned for the run only. After a failed run, each job resumes from the
+   * last hyperperiod it completed, the logical time counting the
+   * hyperperiods all of them completed.
+   * @param[in] nb_hyperperiods The number of hyperperiods
+   */
+  void run(size_t nb_hyperperiods) {
+#ifdef __linux__
+    cpu_set_t saved;
+
+    if (pthread_getaffinity_np(pthread_self(), sizeof(saved), &saved) ||
+        !pin_thread(pthread_self(), m_cores[0].processor)) {
+      throw(std::runtime_error("Executor thread pinning failed."));
+    }
+#endif /* __linux__ */
+
+    m_failed = false;
+    m_error.clear();
+
+    pthread_mutex_lock(&m_mutex);
+    m_target = m_hyperperiod + nb_hyperperiods;
+    m_nb_finished = 0;
+    ++m_generation;
+    pthread_cond_broadcast(&m_start);
+    pthread_mutex_unlock(&m_mutex);
+
+    run_core(0);
+
+    pthread_mutex_lock(&m_mutex);
+    while (m_nb_finished < m_threads.size()) {
+      pthread_cond_wait(&m_finished, &m_mutex);
+    }
+    pthread_mutex_unlock(&m_mutex);
+
+#ifdef __linux__
+    if (m_cores[0].processor >= 0) {
+      pthread_setaffinity_np(pthread_self(), sizeof(saved), &saved);
+    }
+#endif /* __linux__ */
+
+    if (m_failed) {
+      m_hyperperiod = *std::min_element(m_done.begin(), m_done.end());
+      throw(std::runtime_error(m_error));
+    }
+    m_hyperperiod = m_target;
+  }
+
+  /**
+   * @brief Get the logical time
+   * @return The number of physical ticks executed
+   */
+  size_t get_logical_time() const {
+    return m_hyperperiod * r_allocation.get_dataflow().get_hyperperiod();
+  }
+
+private:
+  /* Polls of a job waiting for another before yielding its core */
+  enum { SPINS = 64 };
+
+  /** Core run by a thread */
+  struct Core {
+    StaticExecutor *p_executor;
+    size_t index;
+    /** Processor the thread is pinned to, -1 if not pinned */
+    int processor;
+  };
+
+  const Allocation &r_allocation;
+  /** Number of hyperperiods done by each job */
+  std::vector<size_t> m_done;
+  size_t m_hyperperiod;
+  size_t m_target;
+  bool m_failed;
+  pthread_mutex_t m_mutex;
+  /** Signaled when a run starts */
+  pthread_cond_t m_start;
+  /** Signaled when the last thread finishes a run */
+  pthread_cond_t m_finished;
+  /** Threads of the cores but the first one */
+  std::vector<pthread_t> m_threads;
+  std::vector<Core> m_cores;
+  unsigned long m_generation;
+  size_t m_nb_finished;
+  bool m_stop;
+  std::string m_error;
+
+  StaticExecutor(const StaticExecutor &);
+  StaticExecutor &operator=(const StaticExecutor &);
+
+  /**
+   * @brief Stop the threads created and release the executor, then throw
+   */
+  void fail_creation(const std::string &error) {
+    stop();
+    pthread_cond_destroy(&m_finished);
+    pthread_cond_destroy(&m_start);
+    pthread_mutex_destroy(&m_mutex);
+    throw(std::runtime_error(error));
+  }
+
+  void stop() {
+    pthread_mutex_lock(&m_mutex);
+    m_stop = true;
+    pthread_cond_broadcast(&m_start);
+    pthread_mutex_unlock(&m_mutex);
+
+    for (std::vector<pthread_t>::iterator it = m_threads.begin();
+         it != m_threads.end(); ++it) {
+      pthread_join(*it, nullptr);
+    }
+    m_threads.clear();
+  }
+
+  void fail(const std::string &error) {
+    pthread_mutex_lock(&m_mutex);
+    if (!m_failed) {
+      m_error = error;
+    }
+    __atomic_store_n(&m_failed, true, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&m_mutex);
+  }
+
+  /**
+   * @brief Wait for a job to have done a number of hyperperiods
+   * @return false if the run failed meanwhile
+   */
+  bool wait_done(size_t job, size_t nb_hyperperiods) {
+    size_t spins = 0;
+
+    while (__atomic_load_n(&m_done[job], __ATOMIC_ACQUIRE) < nb_hyperperiods) {
+      if (__atomic_load_n(&m_failed, __ATOMIC_ACQUIRE)) {
+        return false;
+      }
+      if (++spins == SPINS) {
+        spins = 0;
+        sched_yield();
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Get the processor of a core, spread over the affinity mask of the
+   * calling thread from the processor it runs on
+   * @return The processor, -1 if none
+   */
+  static int spread_processor(size_t core) {
+    int processor = -1;
+#ifdef __linux__
+    const int current = sched_getcpu();
+    cpu_set_t processors;
+
+    if (!pthread_getaffinity_np(pthread_self(), sizeof(processors),
+                                &processors) &&
+        CPU_COUNT(&processors)) {
+      size_t index = core % static_cast<size_t>(CPU_COUNT(&processors));
+
+      for (int i = 0; (processor < 0) && (i < CPU_SETSIZE); ++i) {
+        const int candidate = ((current > 0) ? current + i : i) % CPU_SETSIZE;
+
+        if (CPU_ISSET(candidate, &processors) && !index--) {
+          processor = candidate;
+        }
+      }
+    }
+#else
+    (void)core;
+#endif /* __linux__ */
+
+    return processor;
+  }
+
+  /**
+   * @brief Pin a thread to a processor
+   * @return false if the processor is refused
+   */
+  static bool pin_thread(pthread_t thread, int processor) {
+#ifdef __linux__
+    cpu_set_t processors;
+
+    if (processor < 0) {
+      return true;
+    }
+    CPU_ZERO(&processors);
+    CPU_SET(processor, &processors);
+
+    return !pthread_setaffinity_np(thread, sizeof(processors), &processors);
+#else
+    (void)thread;
+    (void)processor;
+
+    return true;
+#endif /* __linux__ */
+  }
+
+  void run_core(size_t core) {
+    const std::vector<Allocation::Job> &jobs = r_allocation.get_jobs();
+    const Allocation::Jobs &schedule = r_allocation.get_schedule(core);
+    const Dataflow::Models &models =
+        r_allocation.get_dataflow().get_models();
+
+    for (size_t hyperperiod = m_hyperperiod; hyperperiod < m_target;
+         ++hyperperiod) {
+      for (Allocation::Jobs::const_iterator job_it = schedule.begin();
+           job_it != schedule.end(); ++job_it) {
+        const Allocation::Job &job = jobs[*job_it];
+
+        /* Done before a failed run stopped */
+        if (__atomic_load_n(&m_done[*job_it], __ATOMIC_RELAXED) > hyperperiod) {
+          continue;
+        }
+        for (Allocation::Jobs::const_iterator it = job.predecessors.begin();
+             it != job.predecessors.end(); ++it) {
+          if (!wait_done(*it, hyperperiod + 1)) {
+            return;
+          }
+        }
+        for (Allocation::Jobs::const_iterator it = job.carried.begin();
+             it != job.carried.end(); ++it) {
+          if (!wait_done(*it, hyperperiod)) {
+            return;
+          }
+        }
+
+        try {
+          models[job.model]->step();
+        } catch (const std::exception &e) {
+          fail(e.what());
+          return;
+        }
+
+        __atomic_store_n(&m_done[*job_it], hyperperiod + 1, __ATOMIC_RELEASE);
+      }
+    }
+  }
+
+  static void *core_main(void *p_arg) {
+    Core *const p_core = static_cast<Core *>(p_arg);
+    StaticExecutor *const p_executor = p_core->p_executor;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&p_executor->m_mutex);
+    for (;;) {
+      while (!p_executor->m_stop && (p_executor->m_generation == seen)) {
+        pthread_cond_wait(&p_executor->m_start, &p_executor->m_mutex);
+      }
+      if (p_executor->m_stop) {
+        break;
+      }
+      seen = p_executor->m_generation;
+      pthread_mutex_unlock(&p_executor->m_mutex);
+
+      p_executor->run_core(p_core->index);
+
+      pthread_mutex_lock(&p_executor->m_mutex);
+      if (++p_executor->m_nb_finished == p_executor->m_threads.size()) {
+        pthread_cond_signal(&p_executor->m_finished);
+      }
+    }
+    pthread_mutex_unlock(&p_executor->m_mutex);
+
+    return nullptr;
+  }
+};
+} /* namespace RROSACE */
+#endif /* __cplusplus */
+
+#endif /* RROSACE_ALLOCATION_H */
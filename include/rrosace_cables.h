@@ -244,6 +244,23 @@ public:
   get_dt() const {
     return m_dt;
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_delta_e_c_partial_1);
+    ports.input(&r_delta_th_c_partial_1);
+    ports.input(&r_relay_delta_e_c_1);
+    ports.input(&r_relay_delta_th_c_1);
+    ports.input(&r_delta_e_c_partial_2);
+    ports.input(&r_delta_th_c_partial_2);
+    ports.input(&r_relay_delta_e_c_2);
+    ports.input(&r_relay_delta_th_c_2);
+    ports.output(&r_delta_e_c);
+    ports.output(&r_delta_th_c);
+  }
 };
 } /* namespace RROSACE */
 #endif /* __cplusplus */
@@ -0,0 +1,170 @@
+/**
+ * @file rrosace_campaign.h
+ * @brief RROSACE Scheduling of cyber-physical system library campaign sharding
+ * header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * A campaign of runs is partitioned in shards of consecutive runs, the same
+ * whatever the process or host computing them. The results of a shard are
+ * serialized in a binary buffer, holding the runs it has, and the results of
+ * disjoint shards merge in any order, or in a tree, into the results of the
+ * campaign. Their statistics are computed in run order, so that they do not
+ * depend on the partition nor on the merge order.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_CAMPAIGN_H
+#define RROSACE_CAMPAIGN_H
+
+#include <stddef.h>
+
+#include <rrosace_ensemble.h>
+#include <rrosace_sim.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @struct Campaign results structure */
+struct rrosace_campaign;
+
+/** @typedef Campaign results */
+typedef struct rrosace_campaign rrosace_campaign_t;
+
+/**
+ * @brief Get the runs of a shard of a campaign
+ * @param[in] nb_runs The number of runs of the campaign
+ * @param[in] nb_shards The number of shards
+ * @param[in] shard The shard, from 0
+ * @param[out] p_first The first run of the shard
+ * @param[out] p_nb_runs The number of runs of the shard, differing by at most
+ * one between shards
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_campaign_get_shard(size_t nb_runs, size_t nb_shards, size_t shard,
+                               size_t *p_first, size_t *p_nb_runs);
+
+/**
+ * @brief Create the results of a campaign, without any run
+ * @param[in] nb_runs The number of runs of the campaign
+ * @param[in] nb_results The number of results of a run
+ * @return New campaign results, NULL if failed
+ */
+rrosace_campaign_t *rrosace_campaign_new(size_t nb_runs, size_t nb_results);
+
+/**
+ * @brief Destroy campaign results
+ * @param[in,out] p_campaign The campaign results to destroy
+ */
+void rrosace_campaign_del(rrosace_campaign_t *p_campaign);
+
+/**
+ * @brief Run a shard of a campaign on an ensemble, each run getting its index
+ * in the campaign
+ * @param[in,out] p_campaign The campaign results, without the runs of the
+ * shard
+ * @param[in] p_sim The initial simulation, with the immediate semantics
+ * @param[in] nb_shards The number of shards
+ * @param[in] shard The shard
+ * @param[in] nb_workers The number of workers of the ensemble
+ * @param[in] run The run
+ * @param[in,out] p_arg The argument of the run
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_campaign_run_shard(rrosace_campaign_t *p_campaign,
+                               const rrosace_sim_t *p_sim, size_t nb_shards,
+                               size_t shard, size_t nb_workers,
+                               rrosace_ensemble_run_t run, void *p_arg);
+
+/**
+ * @brief Set the results of a run
+ * @param[in,out] p_campaign The campaign results, without the run
+ * @param[in] run The run
+ * @param[in] results The results of the run
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_campaign_set_results(rrosace_campaign_t *p_campaign, size_t run,
+                                 const double results[]);
+
+/**
+ * @brief Get the results of a run
+ * @param[in] p_campaign The campaign results
+ * @param[in] run The run
+ * @return The results, NULL if the run is missing
+ */
+const double *rrosace_campaign_get_results(const rrosace_campaign_t *p_campaign,
+                                           size_t run);
+
+/**
+ * @brief Get the number of runs with results
+ * @param[in] p_campaign The campaign results
+ * @return The number of runs with results
+ */
+size_t rrosace_campaign_get_nb_done(const rrosace_campaign_t *p_campaign);
+
+/**
+ * @brief Merge the results of disjoint runs of a same campaign
+ * @param[in,out] p_campaign The campaign results merged into
+ * @param[in] p_other The campaign results merged, sharing no run
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_campaign_merge(rrosace_campaign_t *p_campaign,
+                           const rrosace_campaign_t *p_other);
+
+/**
+ * @brief Get the statistics of a result over the runs with results, in run
+ * order
+ * @param[in] p_campaign The campaign results, with at least one run
+ * @param[in] result The index of the result
+ * @param[out] p_mean The mean
+ * @param[out] p_min The minimum
+ * @param[out] p_max The maximum
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_campaign_get_stats(const rrosace_campaign_t *p_campaign,
+                               size_t result, double *p_mean, double *p_min,
+                               double *p_max);
+
+/**
+ * @brief Get the size of the serialized campaign results
+ * @param[in] p_campaign The campaign results
+ * @return The size, in bytes
+ */
+size_t rrosace_campaign_get_size(const rrosace_campaign_t *p_campaign);
+
+/**
+ * @brief Serialize campaign results, the integers in little endian and the
+ * results in the byte order of the host
+ * @param[in] p_campaign The campaign results
+ * @param[out] buffer The buffer
+ * @param[in] size The size of the buffer, at least the serialized size
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_campaign_write(const rrosace_campaign_t *p_campaign,
+                           unsigned char buffer[], size_t size);
+
+/**
+ * @brief Deserialize campaign results, the results written on a host of the
+ * other byte order being converted
+ * @param[in] buffer The buffer
+ * @param[in] size The size of the buffer
+ * @return New campaign results, NULL if the buffer is not valid
+ */
+rrosace_campaign_t *rrosace_campaign_read(const unsigned char buffer[],
+                                          size_t size);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_CAMPAIGN_H */
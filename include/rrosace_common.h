@@ -25,6 +25,7 @@
 #include <cstdlib>
 #include <exception>
 #include <stdexcept>
+#include <vector>
 
 #if __cplusplus <= 199711L
 #ifndef nullptr
@@ -33,6 +34,47 @@
 #endif /* __cplusplus <= 199711L */
 
 namespace RROSACE {
+/** Ports of a model, the addresses of the data it reads and writes */
+class Ports {
+public:
+  /** Addresses of data */
+  typedef std::vector<const void *> Addresses;
+
+  Ports() : m_inputs(), m_outputs(), m_opaque(false) {}
+
+  /**
+   * @brief Register data read by the model
+   * @param[in] p_data The data address
+   */
+  void input(const void *p_data) { m_inputs.push_back(p_data); }
+
+  /**
+   * @brief Register data written by the model
+   * @param[in] p_data The data address
+   */
+  void output(const void *p_data) { m_outputs.push_back(p_data); }
+
+  /**
+   * @brief Mark the model as having unknown ports, so that it is ordered
+   * against every other model
+   */
+  void set_opaque() { m_opaque = true; }
+
+  /** Get the data read */
+  const Addresses &get_inputs() const { return m_inputs; }
+
+  /** Get the data written */
+  const Addresses &get_outputs() const { return m_outputs; }
+
+  /** Are the ports unknown */
+  bool is_opaque() const { return m_opaque; }
+
+private:
+  Addresses m_inputs;
+  Addresses m_outputs;
+  bool m_opaque;
+};
+
 /** Model abstract class */
 class Model {
 public:
@@ -65,6 +107,12 @@ public:
   virtual void step() = 0;
   /** Get model period */
   virtual double get_dt() const = 0;
+  /**
+   * @brief Register the data read and written by the model, unknown unless
+   * overridden
+   * @param[in,out] ports The ports of the model
+   */
+  virtual void register_ports(Ports &ports) const { ports.set_opaque(); }
 };
 } /* namespace RROSACE */
 #endif /* __cplusplus */
@@ -0,0 +1,317 @@
+/**
+ * @file rrosace_coroutine.h
+ * @brief RROSACE Scheduling of cyber-physical system library coroutine
+ * execution of the models header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * With C++20 coroutines, a model runs as a task awaiting the next release of
+ * its period, so that a multi-phase computation keeps its state on the
+ * coroutine frame. A scheduler resumes the tasks of a simulation on its event
+ * queue, in release then spawn order; a scheduler pool advances many
+ * independent schedulers on the threads of a pool.
+ *
+ * Only available when the compiler implements coroutines, in which case
+ * RROSACE_COROUTINES is defined.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_COROUTINE_H
+#define RROSACE_COROUTINE_H
+
+#if defined(__cplusplus) && defined(__cpp_impl_coroutine)
+
+/** Coroutine execution of the models available */
+#define RROSACE_COROUTINES (1)
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <vector>
+
+#include <rrosace_constants.h>
+#include <rrosace_pool.h>
+
+namespace RROSACE {
+
+/** @class Task
+ *  @brief Coroutine of a model, suspended until its first resumption
+ */
+class Task {
+public:
+  /** @struct Promise of a task */
+  struct promise_type {
+    /** Exception escaping the coroutine */
+    std::exception_ptr exception;
+
+    promise_type() : exception() {}
+
+    Task get_return_object() {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept {
+      exception = std::current_exception();
+    }
+  };
+
+  /** Handle of a task coroutine */
+  typedef std::coroutine_handle<promise_type> Handle;
+
+  explicit Task(Handle handle) : m_handle(handle) {}
+
+  Task(Task &&other) noexcept : m_handle(other.m_handle) {
+    other.m_handle = nullptr;
+  }
+
+  Task &operator=(Task &&other) noexcept {
+    if (this != &other) {
+      if (m_handle) {
+        m_handle.destroy();
+      }
+      m_handle = other.m_handle;
+      other.m_handle = nullptr;
+    }
+    return *this;
+  }
+
+  Task(const Task &) = delete;
+  Task &operator=(const Task &) = delete;
+
+  ~Task() {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  /**
+   * @brief Give up the ownership of the coroutine
+   * @return The handle, now owned by the caller
+   */
+  Handle release() {
+    const Handle handle = m_handle;
+
+    m_handle = nullptr;
+
+    return handle;
+  }
+
+private:
+  Handle m_handle;
+};
+
+/** @class Scheduler
+ *  @brief Event queue resuming the tasks of a simulation at their releases
+ */
+class Scheduler {
+public:
+  /** @class Release
+   *  @brief Awaitable suspending a task until its next release
+   */
+  class Release {
+  public:
+    Release(Scheduler &scheduler, size_t period)
+        : r_scheduler(scheduler), m_period(period) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+      r_scheduler.push(r_scheduler.m_release + m_period, r_scheduler.m_task,
+                       handle);
+    }
+
+    void await_resume() const noexcept {}
+
+  private:
+    Scheduler &r_scheduler;
+    size_t m_period;
+  };
+
+  Scheduler()
+      : m_tasks(), m_events(), m_logical_time(0), m_release(0), m_task(0),
+        m_nb_resumes(0) {}
+
+  /**
+   * @brief Scheduler destructor, destroying the tasks
+   */
+  ~Scheduler() {
+    for (std::vector<Task::Handle>::iterator it = m_tasks.begin();
+         it != m_tasks.end(); ++it) {
+      it->destroy();
+    }
+  }
+
+  Scheduler(const Scheduler &) = delete;
+  Scheduler &operator=(const Scheduler &) = delete;
+
+  /**
+   * @brief Take a task, first resumed at the current logical time, after
+   * the tasks spawned before it
+   * @param[in] task The task
+   */
+  void spawn(Task &&task) {
+    const Task::Handle handle = task.release();
+
+    m_tasks.push_back(handle);
+    push(m_logical_time, m_tasks.size() - 1, handle);
+  }
+
+  /**
+   * @brief Awaitable of the next release of the running task
+   * @param[in] period The period of the task, in physical ticks
+   * @return The awaitable
+   */
+  Release release(size_t period) {
+    return Release(*this, period ? period : 1);
+  }
+
+  /**
+   * @brief Resume the tasks released before a physical tick
+   * @param[in] tick The physical tick
+   */
+  void run_until(size_t tick) {
+    while (!m_events.empty() && (m_events.front().release < tick)) {
+      const Event event = m_events.front();
+
+      std::pop_heap(m_events.begin(), m_events.end(), later);
+      m_events.pop_back();
+
+      m_release = event.release;
+      m_task = event.task;
+      event.handle.resume();
+      ++m_nb_resumes;
+
+      if (m_tasks[event.task].done() &&
+          m_tasks[event.task].promise().exception) {
+        std::rethrow_exception(m_tasks[event.task].promise().exception);
+      }
+    }
+
+    m_logical_time = std::max(m_logical_time, tick);
+  }
+
+  /**
+   * @brief Get the logical time
+   * @return The number of physical ticks run
+   */
+  size_t get_logical_time() const { return m_logical_time; }
+
+  /**
+   * @brief Get the number of resumptions
+   * @return The number of tasks resumed
+   */
+  size_t get_nb_resumes() const { return m_nb_resumes; }
+
+private:
+  /** @struct Next release of a task */
+  struct Event {
+    size_t release;
+    size_t task;
+    std::coroutine_handle<> handle;
+  };
+
+  std::vector<Task::Handle> m_tasks;
+  /** Binary heap of the events, earliest release then task first */
+  std::vector<Event> m_events;
+  size_t m_logical_time;
+  /** Release and index of the running task */
+  size_t m_release;
+  size_t m_task;
+  size_t m_nb_resumes;
+
+  static bool later(const Event &a, const Event &b) {
+    return (a.release > b.release) ||
+           ((a.release == b.release) && (a.task > b.task));
+  }
+
+  void push(size_t release, size_t task, std::coroutine_handle<> handle) {
+    m_events.push_back(Event{release, task, handle});
+    std::push_heap(m_events.begin(), m_events.end(), later);
+  }
+};
+
+/**
+ * @brief Run a model as a task stepping at each release of its period, its
+ * step called without virtual dispatch. Called unqualified, it gives way to an
+ * overload for a multi-phase model found in the namespace of the model.
+ * @param[in,out] model The model, of its concrete type, which must outlive
+ * the task
+ * @param[in,out] scheduler The scheduler of the task
+ * @return The task
+ */
+template <class M> Task run(M &model, Scheduler &scheduler) {
+  static_assert(!std::is_abstract<M>::value,
+                "A task runs a model of its concrete type");
+  const size_t period =
+      static_cast<size_t>(DEFAULT_PHYSICAL_FREQ * model.get_dt() + 0.5);
+
+  for (;;) {
+    model.M::step();
+    co_await scheduler.release(period);
+  }
+}
+
+/** @class Scheduler pool
+ *  @brief Advances independent schedulers on a pool of threads
+ */
+class SchedulerPool {
+public:
+  /** Schedulers */
+  typedef std::vector<Scheduler *> Schedulers;
+
+  /**
+   * @brief Scheduler pool constructor
+   * @param[in] nb_threads The number of threads helping the calling one
+   */
+  explicit SchedulerPool(size_t nb_threads) : m_pool(nb_threads) {}
+
+  SchedulerPool(const SchedulerPool &) = delete;
+  SchedulerPool &operator=(const SchedulerPool &) = delete;
+
+  /**
+   * @brief Resume the tasks of schedulers released before a physical tick
+   * @param[in,out] schedulers The schedulers, each run by one thread
+   * @param[in] tick The physical tick
+   */
+  void run_until(const Schedulers &schedulers, size_t tick) {
+    Advance advance(schedulers, tick);
+
+    m_pool.run(advance, schedulers.size());
+  }
+
+private:
+  /** @class Advance
+   *  @brief Schedulers advanced to a tick by the pool
+   */
+  class Advance : public ThreadPool::Job {
+  public:
+    Advance(const Schedulers &schedulers, size_t tick)
+        : r_schedulers(schedulers), m_tick(tick) {}
+
+    void run(size_t item) { r_schedulers[item]->run_until(m_tick); }
+
+  private:
+    const Schedulers &r_schedulers;
+    size_t m_tick;
+  };
+
+  ThreadPool m_pool;
+};
+} /* namespace RROSACE */
+
+#endif /* __cplusplus && __cpp_impl_coroutine */
+
+#endif /* RROSACE_COROUTINE_H */
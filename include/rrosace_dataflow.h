@@ -0,0 +1,236 @@
+/**
+ * @file rrosace_dataflow.h
+ * @brief RROSACE Scheduling of cyber-physical system library dataflow
+ * executor header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The ports registered by the models build the producer/consumer graph of a
+ * model set. Two models conflict when one writes data the other reads or
+ * writes; conflicting models keep their serial order, the others of a tick
+ * run in parallel, so that the results are the serial ones.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_DATAFLOW_H
+#define RROSACE_DATAFLOW_H
+
+#include <rrosace_common.h>
+#include <rrosace_pool.h>
+
+#ifdef __cplusplus
+
+#include <algorithm>
+#include <vector>
+
+namespace RROSACE {
+
+/** @class Dataflow
+ *  @brief Producer/consumer graph of a model set, and the levels of the
+ * models released at each tick of the hyperperiod
+ */
+class Dataflow {
+public:
+  /** Models, in serial order */
+  typedef std::vector<Model *> Models;
+  /** Levels of models, the models of a level being independent */
+  typedef std::vector<Models> Levels;
+
+  /**
+   * @brief Dataflow constructor
+   * @param[in] models The models, in serial order
+   */
+  explicit Dataflow(const Models &models)
+      : m_models(models), m_depends(models.size(),
+                                    std::vector<bool>(models.size(), false)),
+        m_schedule() {
+    std::vector<Ports> ports(models.size());
+    std::vector<size_t> periods(models.size());
+    size_t hyperperiod = 1;
+
+    for (size_t model = 0; model < models.size(); ++model) {
+      models[model]->register_ports(ports[model]);
+      periods[model] = static_cast<size_t>(DEFAULT_PHYSICAL_FREQ *
+                                               models[model]->get_dt() +
+                                           0.5);
+      if (!periods[model]) {
+        throw(std::invalid_argument("Model faster than the physical rate."));
+      }
+      hyperperiod = hyperperiod / gcd(hyperperiod, periods[model]) *
+                    periods[model];
+
+      for (size_t other = 0; other < model; ++other) {
+        m_depends[model][other] = conflict(ports[other], ports[model]);
+      }
+    }
+
+    m_schedule.assign(hyperperiod, Levels());
+    for (size_t phase = 0; phase < hyperperiod; ++phase) {
+      std::vector<size_t> levels(models.size(), 0);
+
+      for (size_t model = 0; model < models.size(); ++model) {
+        if (phase % periods[model]) {
+          continue;
+        }
+        for (size_t other = 0; other < model; ++other) {
+          if (!(phase % periods[other]) && m_depends[model][other]) {
+            levels[model] = std::max(levels[model], levels[other] + 1);
+          }
+        }
+        if (m_schedule[phase].size() <= levels[model]) {
+          m_schedule[phase].resize(levels[model] + 1);
+        }
+        m_schedule[phase][levels[model]].push_back(models[model]);
+      }
+    }
+  }
+
+  /**
+   * @brief Get the models
+   * @return The models, in serial order
+   */
+  const Models &get_models() const { return m_models; }
+
+  /**
+   * @brief Does a model depend on an earlier one
+   * @param[in] model The index of the model
+   * @param[in] other The index of an earlier model
+   * @return true if they conflict on some data
+   */
+  bool depends(size_t model, size_t other) const {
+    return (other < model) && m_depends[model][other];
+  }
+
+  /**
+   * @brief Get the hyperperiod
+   * @return The hyperperiod, in physical ticks
+   */
+  size_t get_hyperperiod() const { return m_schedule.size(); }
+
+  /**
+   * @brief Get the levels of a tick
+   * @param[in] phase The tick in the hyperperiod
+   * @return The levels of the models released, in execution order
+   */
+  const Levels &get_levels(size_t phase) const { return m_schedule[phase]; }
+
+private:
+  Models m_models;
+  std::vector<std::vector<bool> > m_depends;
+  std::vector<Levels> m_schedule;
+
+  static size_t gcd(size_t a, size_t b) {
+    while (b) {
+      const size_t r = a % b;
+      a = b;
+      b = r;
+    }
+
+    return a;
+  }
+
+  static bool intersect(const Ports::Addresses &a, const Ports::Addresses &b) {
+    for (Ports::Addresses::const_iterator it = a.begin(); it != a.end(); ++it) {
+      if (std::find(b.begin(), b.end(), *it) != b.end()) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  static bool conflict(const Ports &producer, const Ports &consumer) {
+    return producer.is_opaque() || consumer.is_opaque() ||
+           intersect(producer.get_outputs(), consumer.get_inputs()) ||
+           intersect(producer.get_inputs(), consumer.get_outputs()) ||
+           intersect(producer.get_outputs(), consumer.get_outputs());
+  }
+};
+
+/** @class Parallel executor
+ *  @brief Runs the levels of a dataflow tick after tick, the models of a
+ * level on a pool of threads
+ */
+class ParallelExecutor {
+public:
+  /**
+   * @brief Parallel executor constructor
+   * @param[in] dataflow The dataflow to run, which must outlive the executor
+   * @param[in] nb_threads The number of threads helping the calling one, 0
+   * to run serially
+   */
+  ParallelExecutor(const Dataflow &dataflow, size_t nb_threads)
+      : r_dataflow(dataflow), m_pool(nb_threads), m_phase(0),
+        m_logical_time(0) {}
+
+  /**
+   * @brief Execute a physical tick
+   */
+  void step() {
+    const Dataflow::Levels &levels = r_dataflow.get_levels(m_phase);
+
+    for (Dataflow::Levels::const_iterator level_it = levels.begin();
+         level_it != levels.end(); ++level_it) {
+      run_level(*level_it);
+    }
+
+    ++m_logical_time;
+    if (++m_phase == r_dataflow.get_hyperperiod()) {
+      m_phase = 0;
+    }
+  }
+
+  /**
+   * @brief Get the logical time
+   * @return The number of physical ticks executed
+   */
+  size_t get_logical_time() const { return m_logical_time; }
+
+private:
+  /** @class Level
+   *  @brief Models of a level, stepped by the pool
+   */
+  class Level : public ThreadPool::Job {
+  public:
+    explicit Level(const Dataflow::Models &models) : r_models(models) {}
+
+    void run(size_t item) { r_models[item]->step(); }
+
+  private:
+    const Dataflow::Models &r_models;
+  };
+
+  const Dataflow &r_dataflow;
+  ThreadPool m_pool;
+  size_t m_phase;
+  size_t m_logical_time;
+
+  ParallelExecutor(const ParallelExecutor &);
+  ParallelExecutor &operator=(const ParallelExecutor &);
+
+  void run_level(const Dataflow::Models &models) {
+    if (!m_pool.get_nb_threads() || (models.size() < 2)) {
+      for (Dataflow::Models::const_iterator it = models.begin();
+           it != models.end(); ++it) {
+        (*it)->step();
+      }
+    } else {
+      Level level(models);
+
+      m_pool.run(level, models.size());
+    }
+  }
+};
+} /* namespace RROSACE */
+#endif /* __cplusplus */
+
+#endif /* RROSACE_DATAFLOW_H */
@@ -0,0 +1,241 @@
+/**
+ * @file rrosace_delay_line.h
+ * @brief RROSACE Scheduling of cyber-physical system library transport delay
+ * line header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * A delay line models the latency of a bus between two models: the value
+ * read at a step is the one written a given number of steps before. The
+ * values are kept in a ring buffer of a power of two size, allocated once
+ * with the line, so that a step writes one value and reads another, without
+ * allocation nor division. A line may be stepped in place, its output being
+ * its input, to delay a value between its writer and its readers.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_DELAY_LINE_H
+#define RROSACE_DELAY_LINE_H
+
+#include <stddef.h>
+
+#include <rrosace_common.h>
+#include <rrosace_constants.h>
+
+/** Largest delay of a delay line, in steps */
+#define RROSACE_DELAY_LINE_MAX_TICKS (65535)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @struct rrosace_delay_line transport delay line */
+struct rrosace_delay_line;
+
+/** @typedef alias for struct rrosace_delay_line */
+typedef struct rrosace_delay_line rrosace_delay_line_t;
+
+/**
+ * @brief Create a delay line
+ * @param[in] nb_ticks The delay, in steps, up to RROSACE_DELAY_LINE_MAX_TICKS
+ * @param[in] initial The value read before the first ones written come out
+ * @return A new delay line, NULL if failed
+ */
+rrosace_delay_line_t *rrosace_delay_line_new(size_t nb_ticks, double initial);
+
+/**
+ * @brief Copy a delay line, with the values in flight, in a new one
+ * @param[in] p_other The delay line to copy
+ * @return A new delay line, NULL if failed
+ */
+rrosace_delay_line_t *
+rrosace_delay_line_copy(const rrosace_delay_line_t *p_other);
+
+/**
+ * @brief Destroy a delay line
+ * @param[in,out] p_delay_line The delay line to destroy
+ */
+void rrosace_delay_line_del(rrosace_delay_line_t *p_delay_line);
+
+/**
+ * @brief Fill a delay line with a value, as if it had been written for the
+ * whole delay
+ * @param[in,out] p_delay_line The delay line
+ * @param[in] value The value
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_delay_line_reset(rrosace_delay_line_t *p_delay_line, double value);
+
+/**
+ * @brief Get the delay of a delay line
+ * @param[in] p_delay_line The delay line
+ * @return The delay, in steps
+ */
+size_t
+rrosace_delay_line_get_nb_ticks(const rrosace_delay_line_t *p_delay_line);
+
+/**
+ * @brief Execute a delay line, writing a value and reading the one written
+ * the delay before, the value itself without delay
+ * @param[in,out] p_delay_line The delay line
+ * @param[in] in The value written
+ * @param[out] p_out The value read, which may be the written one
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_delay_line_step(rrosace_delay_line_t *p_delay_line, double in,
+                            double *p_out);
+
+#ifdef __cplusplus
+}
+namespace RROSACE {
+
+/** Largest delay of a delay line, in steps */
+static const size_t DELAY_LINE_MAX_TICKS = RROSACE_DELAY_LINE_MAX_TICKS;
+
+/** @class DelayLine
+ *  @brief C++ wrapper for C-based delay line, based on Model interface.
+ */
+class DelayLine
+#if __cplusplus > 199711L
+    final
+#endif /* __cplusplus > 199711L */
+    : public Model {
+private:
+  /** Wrapped C-based delay line */
+  rrosace_delay_line_t *p_delay_line;
+
+  /** Value in */
+  const double &r_in;
+
+  /** Value out */
+  double &r_out;
+
+  /** Delay line period */
+  double m_dt;
+
+public:
+  /**
+   * @brief Delay line constructor
+   * @param[in] nb_ticks The delay, in steps
+   * @param[in] in The value written
+   * @param[out] out The value read, initially the written one
+   * @param[in] dt The model instance execution period, 1 /
+   * DEFAULT_PHYSICAL_FREQ by default
+   */
+  DelayLine(size_t nb_ticks, const double &in, double &out,
+            double dt = 1. / DEFAULT_PHYSICAL_FREQ)
+      : Model(), p_delay_line(rrosace_delay_line_new(nb_ticks, in)),
+        r_in(in), r_out(out), m_dt(dt) {
+    if (!p_delay_line) {
+      throw(std::runtime_error("Delay line creation failed."));
+    }
+  }
+
+  /**
+   * @brief Delay line copy constructor
+   * @param[in] other another delay line to construct
+   */
+  DelayLine(const DelayLine &other)
+      : Model(other),
+        p_delay_line(rrosace_delay_line_copy(other.p_delay_line)),
+        r_in(other.r_in), r_out(other.r_out), m_dt(other.m_dt) {}
+
+  /**
+   * @brief Delay line copy assignement
+   * @param[in] other another delay line to construct
+   */
+  DelayLine &operator=(const DelayLine &other) {
+    if (this != &other) {
+      rrosace_delay_line_del(p_delay_line);
+      p_delay_line = rrosace_delay_line_copy(other.p_delay_line);
+    }
+    return *this;
+  }
+
+#if __cplusplus > 199711L
+
+  /**
+   * @brief Delay line move constructor
+   * @param[in] ' ' a delay line to move
+   */
+  DelayLine(DelayLine &&) = default;
+
+  /**
+   * @brief Delay line move assignement
+   * @param[in] ' ' a delay line to move
+   */
+  DelayLine &operator=(DelayLine &&) = delete;
+
+#endif /* __cplusplus > 199711L */
+
+  /**
+   * @brief Delay line destructor
+   */
+  ~DelayLine() { rrosace_delay_line_del(p_delay_line); }
+
+  /**
+   * @brief Execute a delay line model instance
+   */
+  void step() {
+    const int ret = rrosace_delay_line_step(p_delay_line, r_in, &r_out);
+    if (ret == EXIT_FAILURE) {
+      throw(std::runtime_error("Delay line step failed."));
+    }
+  }
+
+  /**
+   * @brief Fill the delay line with a value
+   * @param[in] value The value
+   */
+  void reset(double value) {
+    if (rrosace_delay_line_reset(p_delay_line, value) == EXIT_FAILURE) {
+      throw(std::runtime_error("Delay line reset failed."));
+    }
+  }
+
+/**
+ * @brief Get the delay of the line
+ * @return delay, in steps
+ */
+#if __cplusplus >= 201703L
+  [[nodiscard]]
+#endif
+  size_t
+  get_nb_ticks() const {
+    return rrosace_delay_line_get_nb_ticks(p_delay_line);
+  }
+
+/**
+ * @brief Get period set in model
+ * @return period, in s
+ */
+#if __cplusplus >= 201703L
+  [[nodiscard]]
+#endif
+  double
+  get_dt() const {
+    return m_dt;
+  }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_in);
+    ports.output(&r_out);
+  }
+};
+} /* namespace RROSACE */
+#endif /* __cplusplus */
+
+#endif /* RROSACE_DELAY_LINE_H */
@@ -0,0 +1,130 @@
+/**
+ * @file rrosace_des.h
+ * @brief RROSACE Scheduling of cyber-physical system library discrete-event
+ * executor header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * A discrete-event executor releases the tasks of a simulation at their own
+ * periods and offsets, in integer nanoseconds, with an optional release
+ * jitter. The periods need not divide each other nor the physical one: the
+ * next releases are kept in a binary heap, without a global tick. With the
+ * default periods, the results are the tick ones. A delay function may add a
+ * release jitter and an execution time of its own to each release.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_DES_H
+#define RROSACE_DES_H
+
+#include <stddef.h>
+
+#include <rrosace_sim.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @typedef Delay of a release of a task, in ns
+ * @param[in,out] p_arg The argument given with the delay
+ * @param[in] task The task released
+ * @return The delay of the release
+ */
+typedef unsigned long (*rrosace_des_delay_t)(void *p_arg,
+                                             rrosace_sim_task_t task);
+
+/** @struct Discrete-event executor structure */
+struct rrosace_des;
+
+/** @typedef Discrete-event executor */
+typedef struct rrosace_des rrosace_des_t;
+
+/**
+ * @brief Create a discrete-event executor, the tasks at the periods of the
+ * simulation, without offset nor jitter
+ * @param[in,out] p_sim The simulation, with the immediate semantics, which
+ * must outlive the executor
+ * @param[in] seed The seed of the release jitters
+ * @return A new discrete-event executor, NULL if failed
+ */
+rrosace_des_t *rrosace_des_new(rrosace_sim_t *p_sim, unsigned long seed);
+
+/**
+ * @brief Destroy a discrete-event executor
+ * @param[in,out] p_des The discrete-event executor to destroy
+ */
+void rrosace_des_del(rrosace_des_t *p_des);
+
+/**
+ * @brief Set the timing of a task, before the first run
+ *
+ * The k-th release of the task is at offset + k * period, delayed by a
+ * jitter drawn uniformly up to the largest one. The time step of a task is
+ * the time since its previous release.
+ *
+ * @param[in,out] p_des The discrete-event executor
+ * @param[in] task The task
+ * @param[in] period The period, in ns
+ * @param[in] offset The first release, in ns
+ * @param[in] jitter The largest release jitter, in ns, below the period
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_des_set_timing(rrosace_des_t *p_des, rrosace_sim_task_t task,
+                           unsigned long period, unsigned long offset,
+                           unsigned long jitter);
+
+/**
+ * @brief Set the delay function of a task, before the first run
+ *
+ * Each release of the task is delayed, after the jitter, by the delay drawn
+ * for it, as for a late release or a long execution: the task reads and
+ * writes its values at the end of the delay. A release never precedes the
+ * previous one of its task.
+ *
+ * @param[in,out] p_des The discrete-event executor
+ * @param[in] task The task
+ * @param[in] delay The delay function, NULL for none
+ * @param[in,out] p_arg The argument of the delay function
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_des_set_delay(rrosace_des_t *p_des, rrosace_sim_task_t task,
+                          rrosace_des_delay_t delay, void *p_arg);
+
+/**
+ * @brief Run the tasks released before a time, in release order, the ties in
+ * the tick order
+ * @param[in,out] p_des The discrete-event executor
+ * @param[in] t The time, in s
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_des_run_until(rrosace_des_t *p_des, double t);
+
+/**
+ * @brief Get the time of a discrete-event executor
+ * @param[in] p_des The discrete-event executor
+ * @return The time reached by the last run, in s
+ */
+double rrosace_des_get_time(const rrosace_des_t *p_des);
+
+/**
+ * @brief Get the number of events of a discrete-event executor
+ * @param[in] p_des The discrete-event executor
+ * @return The number of tasks released
+ */
+size_t rrosace_des_get_nb_events(const rrosace_des_t *p_des);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_DES_H */
@@ -30,6 +30,9 @@
 /** Elevator default freq */
 #define RROSACE_ELEVATOR_DEFAULT_FREQ (RROSACE_DEFAULT_PHYSICAL_FREQ)
 
+/** Size of the elevator state, deflection and its rate, in doubles */
+#define RROSACE_ELEVATOR_STATE_SIZE (2)
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -61,6 +64,24 @@ rrosace_elevator_t *rrosace_elevator_copy(const rrosace_elevator_t *p_other);
  */
 void rrosace_elevator_del(rrosace_elevator_t *p_elevator);
 
+/**
+ * @brief Get the state of an elevator
+ * @param[in] p_elevator The elevator
+ * @param[out] state The state, RROSACE_ELEVATOR_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_elevator_get_state(const rrosace_elevator_t *p_elevator,
+                               double state[]);
+
+/**
+ * @brief Set the state of an elevator
+ * @param[in,out] p_elevator The elevator
+ * @param[in] state The state, RROSACE_ELEVATOR_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_elevator_set_state(rrosace_elevator_t *p_elevator,
+                               const double state[]);
+
 /**
  * @brief Execute an elevator model instance
  * @param[in,out] p_elevator The model to execute
@@ -182,6 +203,15 @@ public:
   get_dt() const {
     return m_dt;
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_delta_e_c);
+    ports.output(&r_delta_e);
+  }
 };
 } /* namespace RROSACE */
 #endif /* __cplusplus */
@@ -27,6 +27,9 @@
 /** Engine default freq */
 #define RROSACE_ENGINE_DEFAULT_FREQ (RROSACE_DEFAULT_PHYSICAL_FREQ)
 
+/** Size of the engine state, the throttle lag, in doubles */
+#define RROSACE_ENGINE_STATE_SIZE (1)
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -61,6 +64,22 @@ rrosace_engine_t *rrosace_engine_copy(const rrosace_engine_t *p_other);
  */
 void rrosace_engine_del(rrosace_engine_t *p_engine);
 
+/**
+ * @brief Get the state of an engine
+ * @param[in] p_engine The engine
+ * @param[out] state The state, RROSACE_ENGINE_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_engine_get_state(const rrosace_engine_t *p_engine, double state[]);
+
+/**
+ * @brief Set the state of an engine
+ * @param[in,out] p_engine The engine
+ * @param[in] state The state, RROSACE_ENGINE_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_engine_set_state(rrosace_engine_t *p_engine, const double state[]);
+
 /**
  * @brief  Execute an engine model instance
  * @param[in,out] p_engine The engine model to execute
@@ -175,6 +194,15 @@ public:
   get_dt() const {
     return m_dt;
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_delta_th_c);
+    ports.output(&r_t);
+  }
 };
 } /* namespace RROSACE */
 #endif /* __cplusplus */
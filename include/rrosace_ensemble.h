@@ -0,0 +1,192 @@
+/**
+ * @file rrosace_ensemble.h
+ * @brief RROSACE Scheduling of cyber-physical system library ensemble runner
+ * header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * An ensemble runs many independent closed loops of varying lengths on a pool
+ * of workers. Each worker owns a simulation context, allocated once with its
+ * deque in a cache aligned arena, and reset from the initial state before
+ * each run, so that no allocation happens between runs. The runs are first
+ * split evenly between the workers; a worker out of runs steals from the
+ * others. The finished runs are pushed on a lock-free collector, drained
+ * while the ensemble is running. The workers are pinned on the cores of the
+ * affinity mask of the creating thread, from the one it runs on.
+ *
+ * By default, the simulation of a worker is allocated by its own thread,
+ * once pinned, so that the first touch puts its pages on the NUMA node of its
+ * core. A worker may also own an arena for the large state of its runs,
+ * placed the same way, and backed with 2 MB huge pages on request.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_ENSEMBLE_H
+#define RROSACE_ENSEMBLE_H
+
+#include <stddef.h>
+
+#include <rrosace_sim.h>
+
+/** Largest number of workers of an ensemble */
+#define RROSACE_ENSEMBLE_MAX_WORKERS (256)
+
+/** Size of the huge pages backing the arenas, in bytes */
+#define RROSACE_ENSEMBLE_HUGE_PAGE (2UL * 1024UL * 1024UL)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @typedef Run of an ensemble, on a simulation at the initial state, ending
+ * whenever it sees fit
+ * @param[in,out] p_sim The simulation of the worker
+ * @param[in] run The index of the run
+ * @param[in,out] p_arg The argument given to the ensemble
+ * @param[out] results The results of the run
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+typedef int (*rrosace_ensemble_run_t)(rrosace_sim_t *p_sim, size_t run,
+                                      void *p_arg, double results[]);
+
+/** @struct Placement of the workers of an ensemble */
+struct rrosace_ensemble_placement {
+  /** Simulation and arena of a worker allocated and first touched by its
+   * pinned thread, else by the creating one */
+  int local;
+  size_t arena_size; /**< size of the arena of a worker, in bytes, 0 for none */
+  /** Arenas backed with huge pages, reserved ones if any, else transparent
+   * ones */
+  int huge_pages;
+};
+
+/** @typedef Placement of the workers of an ensemble */
+typedef struct rrosace_ensemble_placement rrosace_ensemble_placement_t;
+
+/** @struct Ensemble structure */
+struct rrosace_ensemble;
+
+/** @typedef Ensemble */
+typedef struct rrosace_ensemble rrosace_ensemble_t;
+
+/**
+ * @brief Create an ensemble, with the default placement
+ * @param[in] p_sim The initial simulation, with the immediate semantics
+ * @param[in] nb_workers The number of workers, from 1 to
+ * RROSACE_ENSEMBLE_MAX_WORKERS
+ * @param[in] nb_results The number of results of a run
+ * @return A new ensemble, NULL if failed
+ */
+rrosace_ensemble_t *rrosace_ensemble_new(const rrosace_sim_t *p_sim,
+                                         size_t nb_workers, size_t nb_results);
+
+/**
+ * @brief Get the default placement: local, without arena
+ * @param[out] p_placement The placement
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_ensemble_default_placement(
+    rrosace_ensemble_placement_t *p_placement);
+
+/**
+ * @brief Create an ensemble, its workers placed
+ * @param[in] p_sim The initial simulation, with the immediate semantics
+ * @param[in] nb_workers The number of workers, from 1 to
+ * RROSACE_ENSEMBLE_MAX_WORKERS
+ * @param[in] nb_results The number of results of a run
+ * @param[in] p_placement The placement of the workers
+ * @return A new ensemble, NULL if failed
+ */
+rrosace_ensemble_t *
+rrosace_ensemble_new_placed(const rrosace_sim_t *p_sim, size_t nb_workers,
+                            size_t nb_results,
+                            const rrosace_ensemble_placement_t *p_placement);
+
+/**
+ * @brief Destroy an ensemble, waiting for its runs
+ * @param[in,out] p_ensemble The ensemble to destroy
+ */
+void rrosace_ensemble_del(rrosace_ensemble_t *p_ensemble);
+
+/**
+ * @brief Start the runs of an ensemble on its workers, and return
+ * @param[in,out] p_ensemble The ensemble, not running
+ * @param[in] nb_runs The number of runs
+ * @param[in] run The run
+ * @param[in,out] p_arg The argument of the run, shared by the workers
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_ensemble_start(rrosace_ensemble_t *p_ensemble, size_t nb_runs,
+                           rrosace_ensemble_run_t run, void *p_arg);
+
+/**
+ * @brief Take the runs finished since the last collection, from a single
+ * thread
+ * @param[in,out] p_ensemble The ensemble
+ * @param[out] runs The indices of the runs finished
+ * @param[in] max_runs The largest number of indices
+ * @return The number of indices written
+ */
+size_t rrosace_ensemble_collect(rrosace_ensemble_t *p_ensemble, size_t runs[],
+                                size_t max_runs);
+
+/**
+ * @brief Wait for the runs of an ensemble
+ * @param[in,out] p_ensemble The ensemble
+ * @return EXIT_SUCCESS if all the runs succeeded, else EXIT_FAILURE
+ */
+int rrosace_ensemble_wait(rrosace_ensemble_t *p_ensemble);
+
+/**
+ * @brief Get the results of a run, once collected or waited for
+ * @param[in] p_ensemble The ensemble
+ * @param[in] run The index of the run
+ * @return The results, NULL if failed
+ */
+const double *rrosace_ensemble_get_results(const rrosace_ensemble_t *p_ensemble,
+                                           size_t run);
+
+/**
+ * @brief Get the arena of the worker running a simulation, from a run
+ * @param[in] p_ensemble The ensemble
+ * @param[in] p_sim The simulation given to the run
+ * @return The arena, zeroed at the creation of the ensemble, NULL if none
+ */
+void *rrosace_ensemble_get_arena(const rrosace_ensemble_t *p_ensemble,
+                                 const rrosace_sim_t *p_sim);
+
+/**
+ * @brief Get the number of arenas of an ensemble backed with reserved huge
+ * pages
+ * @param[in] p_ensemble The ensemble
+ * @return The number of arenas
+ */
+size_t rrosace_ensemble_get_nb_huge(const rrosace_ensemble_t *p_ensemble);
+
+/**
+ * @brief Get the statistics of a worker of an ensemble, once waited for
+ * @param[in] p_ensemble The ensemble
+ * @param[in] worker The worker
+ * @param[out] p_nb_runs The number of runs it ran
+ * @param[out] p_nb_steals The number of runs it stole
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_ensemble_get_stats(const rrosace_ensemble_t *p_ensemble,
+                               size_t worker, size_t *p_nb_runs,
+                               size_t *p_nb_steals);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_ENSEMBLE_H */
@@ -0,0 +1,104 @@
+/**
+ * @file rrosace_events.h
+ * @brief RROSACE Scheduling of cyber-physical system library zero-crossing
+ * events header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Variable-step stepping of a system with guards. A step is taken as large as
+ * asked, and when a guard changes sign during the step, the step is shortened
+ * by root finding to land on the earliest crossing.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_EVENTS_H
+#define RROSACE_EVENTS_H
+
+#include <stddef.h>
+
+/** Guard index when no guard crossed during a step */
+#define RROSACE_EVENTS_NO_EVENT ((size_t)-1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @typedef Step of a system from a state over any duration
+ * @param[in] p_context The user context
+ * @param[in] state_in The state at the start of the step
+ * @param[in] dt The duration of the step
+ * @param[out] state_out The state at the end of the step
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+typedef int (*rrosace_events_step_t)(void *p_context, const double state_in[],
+                                     double dt, double state_out[]);
+
+/**
+ * @typedef Guard of a system, an event when its sign changes
+ * @param[in] p_context The user context
+ * @param[in] guard The index of the guard
+ * @param[in] state The state
+ * @return The value of the guard
+ */
+typedef double (*rrosace_events_guard_t)(void *p_context, size_t guard,
+                                         const double state[]);
+
+/** @struct Zero-crossing events locator structure */
+struct rrosace_events;
+
+/** @typedef Zero-crossing events locator */
+typedef struct rrosace_events rrosace_events_t;
+
+/**
+ * @brief Create a zero-crossing events locator
+ * @param[in] state_size The number of doubles of the state
+ * @param[in] nb_guards The number of guards
+ * @param[in] step The step of the system
+ * @param[in] guard The guards of the system
+ * @param[in] p_context The user context given to the step and the guards
+ * @return A new zero-crossing events locator, NULL if failed
+ */
+rrosace_events_t *rrosace_events_new(size_t state_size, size_t nb_guards,
+                                     rrosace_events_step_t step,
+                                     rrosace_events_guard_t guard,
+                                     void *p_context);
+
+/**
+ * @brief Destroy a zero-crossing events locator
+ * @param[in,out] p_events The zero-crossing events locator to destroy
+ */
+void rrosace_events_del(rrosace_events_t *p_events);
+
+/**
+ * @brief Step the system, stopping on the earliest guard crossing
+ * @param[in,out] p_events The zero-crossing events locator
+ * @param[in,out] state The state, advanced by the elapsed duration
+ * @param[in] dt The largest duration of the step
+ * @param[in] time_tolerance The width of the bracket of a located crossing
+ * @param[out] p_elapsed The duration of the step, the crossing time if a guard
+ * crossed, else dt
+ * @param[out] p_guard The guard that crossed, else RROSACE_EVENTS_NO_EVENT
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ *
+ * The crossing is bracketed from the right: the guard has already changed sign
+ * at the returned state.
+ */
+int rrosace_events_step(rrosace_events_t *p_events, double state[], double dt,
+                        double time_tolerance, double *p_elapsed,
+                        size_t *p_guard);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_EVENTS_H */
@@ -0,0 +1,146 @@
+/**
+ * @file rrosace_explore.h
+ * @brief RROSACE Scheduling of cyber-physical system library schedule order
+ * exploration header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * An exploration runs a simulation over a horizon in every valid order of the
+ * tasks released at a same tick, among the tasks explored, the others keeping
+ * their place. Each tick expands the distinct states of the previous one, in
+ * parallel from their snapshots, and the children are merged by state hash,
+ * so that equivalent orders share a single branch. The distinct states at the
+ * horizon are the trajectories, each with the number of schedules reaching it
+ * and one of them.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_EXPLORE_H
+#define RROSACE_EXPLORE_H
+
+#include <stddef.h>
+
+#include <rrosace_sim.h>
+
+/** Largest number of tasks explored */
+#define RROSACE_EXPLORE_MAX_TASKS (8)
+
+/** Largest number of threads helping the calling one */
+#define RROSACE_EXPLORE_MAX_THREADS (64)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @struct Exploration structure */
+struct rrosace_explore;
+
+/** @typedef Exploration */
+typedef struct rrosace_explore rrosace_explore_t;
+
+/**
+ * @brief Create an exploration
+ * @param[in] p_sim The simulation to start from, with the immediate
+ * semantics, copied
+ * @param[in] tasks The tasks whose orders are explored
+ * @param[in] nb_tasks The number of tasks, from 1 to RROSACE_EXPLORE_MAX_TASKS
+ * @param[in] nb_threads The number of threads helping the calling one, up to
+ * RROSACE_EXPLORE_MAX_THREADS
+ * @param[in] max_states The largest number of distinct states of a tick
+ * @return A new exploration, NULL if failed
+ */
+rrosace_explore_t *rrosace_explore_new(const rrosace_sim_t *p_sim,
+                                       const rrosace_sim_task_t tasks[],
+                                       size_t nb_tasks, size_t nb_threads,
+                                       size_t max_states);
+
+/**
+ * @brief Destroy an exploration
+ * @param[in,out] p_explore The exploration to destroy
+ */
+void rrosace_explore_del(rrosace_explore_t *p_explore);
+
+/**
+ * @brief Declare that a task runs before another one when both are released
+ * at a tick, before the run
+ * @param[in,out] p_explore The exploration
+ * @param[in] before The task running first, explored
+ * @param[in] after The task running next, explored
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_explore_add_precedence(rrosace_explore_t *p_explore,
+                                   rrosace_sim_task_t before,
+                                   rrosace_sim_task_t after);
+
+/**
+ * @brief Explore the schedules over a horizon
+ * @param[in,out] p_explore The exploration
+ * @param[in] horizon The number of physical ticks
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE, also when a tick has more
+ * than max_states distinct states
+ */
+int rrosace_explore_run(rrosace_explore_t *p_explore, size_t horizon);
+
+/**
+ * @brief Get the number of distinct trajectories of an exploration
+ * @param[in] p_explore The exploration
+ * @return The number of distinct states at the horizon
+ */
+size_t rrosace_explore_get_nb_trajectories(const rrosace_explore_t *p_explore);
+
+/**
+ * @brief Get the number of states of an exploration
+ * @param[in] p_explore The exploration
+ * @param[out] p_nb_simulated The number of ticks simulated
+ * @param[out] p_nb_distinct The number of distinct states kept, over the
+ * ticks
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_explore_get_nb_states(const rrosace_explore_t *p_explore,
+                                  size_t *p_nb_simulated,
+                                  size_t *p_nb_distinct);
+
+/**
+ * @brief Get the simulation at the horizon of a trajectory
+ * @param[in] p_explore The exploration
+ * @param[in] trajectory The trajectory
+ * @return The simulation, NULL if failed
+ */
+const rrosace_sim_t *
+rrosace_explore_get_sim(const rrosace_explore_t *p_explore, size_t trajectory);
+
+/**
+ * @brief Get the number of schedules reaching a trajectory
+ * @param[in] p_explore The exploration
+ * @param[in] trajectory The trajectory
+ * @return The number of schedules, 0 if failed
+ */
+double rrosace_explore_get_nb_schedules(const rrosace_explore_t *p_explore,
+                                        size_t trajectory);
+
+/**
+ * @brief Get the order of a tick in a schedule reaching a trajectory
+ * @param[in] p_explore The exploration
+ * @param[in] trajectory The trajectory
+ * @param[in] tick The tick, from the start of the exploration
+ * @param[out] order The RROSACE_SIM_NB_TASKS tasks, in execution order
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_explore_get_order(const rrosace_explore_t *p_explore,
+                              size_t trajectory, size_t tick,
+                              rrosace_sim_task_t order[]);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_EXPLORE_H */
@@ -24,6 +24,13 @@
 
 #define RROSACE_FCC_DEFAULT_FREQ (RROSACE_DEFAULT_CYBER_FREQ)
 
+/** Altitude error beyond which the altitude hold saturates the vertical speed
+ * command, in m */
+#define RROSACE_FCC_H_SWITCH (50.0)
+
+/** Size of the FCC state, integrators and altitude hold switch, in doubles */
+#define RROSACE_FCC_STATE_SIZE (5)
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -59,6 +66,22 @@ rrosace_fcc_t *rrosace_fcc_copy(const rrosace_fcc_t *p_other);
  */
 void rrosace_fcc_del(rrosace_fcc_t *p_fcc);
 
+/**
+ * @brief Get the state of an FCC
+ * @param[in] p_fcc The FCC
+ * @param[out] state The state, RROSACE_FCC_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_fcc_get_state(const rrosace_fcc_t *p_fcc, double state[]);
+
+/**
+ * @brief Set the state of an FCC
+ * @param[in,out] p_fcc The FCC
+ * @param[in] state The state, RROSACE_FCC_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_fcc_set_state(rrosace_fcc_t *p_fcc, const double state[]);
+
 /**
  * @brief Execute an instance of an FCC model in command mode
  * @param[in,out] p_fcc The FCC model to execute
@@ -257,6 +280,24 @@ public:
   get_dt() const {
     return m_dt;
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_mode);
+    ports.input(&r_h);
+    ports.input(&r_vz);
+    ports.input(&r_va);
+    ports.input(&r_q);
+    ports.input(&r_az);
+    ports.input(&r_h_c);
+    ports.input(&r_vz_c);
+    ports.input(&r_va_c);
+    ports.output(&r_delta_e_c);
+    ports.output(&r_delta_th_c);
+  }
 };
 
 /** @class Flight control computer
@@ -414,6 +455,28 @@ public:
   get_dt() const {
     return m_dt;
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_mode);
+    ports.input(&r_h);
+    ports.input(&r_vz);
+    ports.input(&r_va);
+    ports.input(&r_q);
+    ports.input(&r_az);
+    ports.input(&r_h_c);
+    ports.input(&r_vz_c);
+    ports.input(&r_va_c);
+    ports.input(&r_delta_e_c);
+    ports.input(&r_delta_th_c);
+    ports.input(&r_other_master_in_law);
+    ports.output(&r_relay_delta_e_c);
+    ports.output(&r_relay_delta_th_c);
+    ports.output(&r_master_in_law);
+  }
 };
 
 /** @class Flight control computer
@@ -548,6 +611,14 @@ public:
   get_dt() const {
     return p_flight_control_computer->get_dt();
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    p_flight_control_computer->register_ports(ports);
+  }
 };
 } /* namespace RROSACE */
 #endif /* __cplusplus */
@@ -224,6 +224,19 @@ public:
   get_dt() const {
     return m_dt;
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_h_c_in);
+    ports.input(&r_vz_c_in);
+    ports.input(&r_va_c_in);
+    ports.output(&r_h_c_out);
+    ports.output(&r_vz_c_out);
+    ports.output(&r_va_c_out);
+  }
 };
 } /* namespace RROSACE */
 #endif /* __cplusplus */
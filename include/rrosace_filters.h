@@ -20,6 +20,9 @@
 
 #include <rrosace_constants.h>
 
+/** Size of the anti-aliasing filter state, in doubles */
+#define RROSACE_FILTER_STATE_SIZE (2)
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -75,6 +78,22 @@ rrosace_filter_t *rrosace_filter_copy(const rrosace_filter_t *p_other);
  */
 void rrosace_filter_del(rrosace_filter_t *p_filter);
 
+/**
+ * @brief Get the state of a filter
+ * @param[in] p_filter The filter
+ * @param[out] state The state, RROSACE_FILTER_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_filter_get_state(const rrosace_filter_t *p_filter, double state[]);
+
+/**
+ * @brief Set the state of a filter
+ * @param[in,out] p_filter The filter
+ * @param[in] state The state, RROSACE_FILTER_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_filter_set_state(rrosace_filter_t *p_filter, const double state[]);
+
 /**
  * @brief Anti-aliasing filter next state
  * @param[in,out] p_filter The filter to execute
@@ -186,6 +205,15 @@ public:
   get_dt() const {
     return m_dt;
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_value);
+    ports.output(&r_filtered_value);
+  }
 };
 
 /** @class Altitude filter
@@ -227,6 +255,14 @@ public:
   get_dt() const {
     return filter.get_dt();
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    filter.register_ports(ports);
+  }
 };
 
 /** @class Vertical airspeed filter
@@ -269,6 +305,14 @@ public:
   get_dt() const {
     return filter.get_dt();
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    filter.register_ports(ports);
+  }
 };
 
 /** @class True airspeed filter
@@ -310,6 +354,14 @@ public:
   get_dt() const {
     return filter.get_dt();
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    filter.register_ports(ports);
+  }
 };
 
 /** @class Pitch rate filter
@@ -351,6 +403,14 @@ public:
   get_dt() const {
     return filter.get_dt();
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    filter.register_ports(ports);
+  }
 };
 
 /** @class Vertical acceleration filter
@@ -394,6 +454,14 @@ public:
   get_dt() const {
     return filter.get_dt();
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    filter.register_ports(ports);
+  }
 };
 
 } /* namespace RROSACE */
@@ -24,6 +24,15 @@
 /** Flight dynamics default freq */
 #define RROSACE_FLIGHT_DYNAMICS_DEFAULT_FREQ (RROSACE_DEFAULT_PHYSICAL_FREQ)
 
+/** Flight dynamics parameter mass, in kg */
+#define RROSACE_MASSE (57837.5)
+
+/** Flight dynamics parameter pitch moment of inertia, in kg.m^2 */
+#define RROSACE_I_Y (3781272.0)
+
+/** Size of the flight dynamics state, u, w, q, theta and h, in doubles */
+#define RROSACE_FLIGHT_DYNAMICS_STATE_SIZE (5)
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -54,6 +63,35 @@ rrosace_flight_dynamics_copy(const rrosace_flight_dynamics_t *p_other);
  */
 void rrosace_flight_dynamics_del(rrosace_flight_dynamics_t *p_flight_dynamics);
 
+/**
+ * @brief Get the state of a flight dynamics
+ * @param[in] p_flight_dynamics The flight dynamics
+ * @param[out] state The state, RROSACE_FLIGHT_DYNAMICS_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_flight_dynamics_get_state(
+    const rrosace_flight_dynamics_t *p_flight_dynamics, double state[]);
+
+/**
+ * @brief Set the state of a flight dynamics
+ * @param[in,out] p_flight_dynamics The flight dynamics
+ * @param[in] state The state, RROSACE_FLIGHT_DYNAMICS_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_flight_dynamics_set_state(
+    rrosace_flight_dynamics_t *p_flight_dynamics, const double state[]);
+
+/**
+ * @brief Set the aircraft parameters of a flight dynamics, RROSACE_MASSE and
+ * RROSACE_I_Y when created
+ * @param[in,out] p_flight_dynamics The flight dynamics
+ * @param[in] masse The mass
+ * @param[in] i_y The pitch moment of inertia
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_flight_dynamics_set_parameters(
+    rrosace_flight_dynamics_t *p_flight_dynamics, double masse, double i_y);
+
 /**
  * @brief Execute an model instance of a given duration
  * @param[in,out] p_flight_dynamics The flight dynamics model to execute
@@ -195,6 +233,20 @@ public:
   get_dt() const {
     return m_dt;
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_delta_e);
+    ports.input(&r_t);
+    ports.output(&r_h);
+    ports.output(&r_vz);
+    ports.output(&r_va);
+    ports.output(&r_q);
+    ports.output(&r_az);
+  }
 };
 } /* namespace RROSACE */
 #endif /* __cplusplus */
@@ -184,6 +184,15 @@ public:
   get_dt() const {
     return m_dt;
   }
+
+  /**
+   * @brief Register the data read and written by the model
+   * @param[in,out] ports The ports of the model
+   */
+  void register_ports(Ports &ports) const {
+    ports.input(&r_mode_in);
+    ports.output(&r_mode_out);
+  }
 };
 } /* namespace RROSACE */
 #endif /* __cplusplus */
@@ -0,0 +1,181 @@
+/**
+ * @file rrosace_jitter.h
+ * @brief RROSACE Scheduling of cyber-physical system library release-jitter
+ * Monte Carlo header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * The coincidence problem of the COM and MON FCCs depends on small
+ * differences in their release and completion times, and in the ones of the
+ * cables. A release-jitter Monte Carlo runs batches of schedules on the
+ * discrete-event executor. Each run draws from their laws, for every task, a
+ * first release offset, and the largest release jitter and execution time of
+ * the run; each release then draws its own release jitter and execution time
+ * uniformly up to these. The runs are spread on an ensemble; each one counts
+ * the relays opening and the master in law changes. The runs are then binned
+ * by the jitters they drew, to tell which ranges cause them.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_JITTER_H
+#define RROSACE_JITTER_H
+
+#include <stddef.h>
+
+#include <rrosace_sim.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @enum Laws of the jitters */
+enum rrosace_jitter_law {
+  RROSACE_JITTER_NONE,     /**< always the lower bound */
+  RROSACE_JITTER_UNIFORM,  /**< uniform between the bounds */
+  RROSACE_JITTER_NORMAL,   /**< bounded normal, the mean of four uniforms */
+  RROSACE_JITTER_EXTREMES, /**< either bound, with even odds */
+  RROSACE_JITTER_NB_LAWS   /**< number of laws */
+};
+
+/** @typedef Laws of the jitters */
+typedef enum rrosace_jitter_law rrosace_jitter_law_t;
+
+/** @enum Jitters drawn for a task */
+enum rrosace_jitter_feature {
+  RROSACE_JITTER_OFFSET,     /**< first release offset of the run */
+  RROSACE_JITTER_RELEASE,    /**< largest release jitter of the run */
+  RROSACE_JITTER_EXECUTION,  /**< largest execution time of the run */
+  RROSACE_JITTER_NB_FEATURES /**< number of jitters */
+};
+
+/** @typedef Jitters drawn for a task */
+typedef enum rrosace_jitter_feature rrosace_jitter_feature_t;
+
+/** @struct Distribution of a jitter */
+struct rrosace_jitter_distribution {
+  /** Law */
+  rrosace_jitter_law_t law;
+  /** Lower bound, in ns */
+  unsigned long min;
+  /** Upper bound, in ns */
+  unsigned long max;
+};
+
+/** @typedef Distribution of a jitter */
+typedef struct rrosace_jitter_distribution rrosace_jitter_distribution_t;
+
+/** @struct Outcome of a run */
+struct rrosace_jitter_outcome {
+  /** Number of relays opening */
+  size_t nb_openings;
+  /** Number of master in law changes */
+  size_t nb_changes;
+  /** Time of the first opening or change, in s, negative if none */
+  double t_first;
+  /** Jitters drawn, in ns, by task then feature */
+  unsigned long jitters[RROSACE_SIM_NB_TASKS][RROSACE_JITTER_NB_FEATURES];
+};
+
+/** @typedef Outcome of a run */
+typedef struct rrosace_jitter_outcome rrosace_jitter_outcome_t;
+
+/** @struct Release-jitter Monte Carlo structure */
+struct rrosace_jitter;
+
+/** @typedef Release-jitter Monte Carlo */
+typedef struct rrosace_jitter rrosace_jitter_t;
+
+/**
+ * @brief Create a release-jitter Monte Carlo, without jitter
+ * @param[in] p_sim The initial simulation of the runs, with the immediate
+ * semantics
+ * @param[in] nb_workers The number of workers, from 1 to
+ * RROSACE_ENSEMBLE_MAX_WORKERS
+ * @return A new release-jitter Monte Carlo, NULL if failed
+ */
+rrosace_jitter_t *rrosace_jitter_new(const rrosace_sim_t *p_sim,
+                                     size_t nb_workers);
+
+/**
+ * @brief Destroy a release-jitter Monte Carlo
+ * @param[in,out] p_jitter The release-jitter Monte Carlo to destroy
+ */
+void rrosace_jitter_del(rrosace_jitter_t *p_jitter);
+
+/**
+ * @brief Set the distributions of the jitters of a task, at its default
+ * period
+ *
+ * The largest release jitter and execution time sum below the period.
+ *
+ * @param[in,out] p_jitter The release-jitter Monte Carlo
+ * @param[in] task The task
+ * @param[in] p_offset The distribution of the first release, NULL for none
+ * @param[in] p_release The distribution of the release jitters, NULL for
+ * none
+ * @param[in] p_execution The distribution of the execution times, NULL for
+ * none
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_jitter_set_task(rrosace_jitter_t *p_jitter, rrosace_sim_task_t task,
+                            const rrosace_jitter_distribution_t *p_offset,
+                            const rrosace_jitter_distribution_t *p_release,
+                            const rrosace_jitter_distribution_t *p_execution);
+
+/**
+ * @brief Run a batch of jittered schedules, replacing the previous one
+ *
+ * The run of a given index draws the same jitters for a given seed.
+ *
+ * @param[in,out] p_jitter The release-jitter Monte Carlo
+ * @param[in] nb_runs The number of runs
+ * @param[in] duration The duration of a run, in s
+ * @param[in] seed The seed of the jitters
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_jitter_run(rrosace_jitter_t *p_jitter, size_t nb_runs,
+                       double duration, unsigned long seed);
+
+/**
+ * @brief Get the outcome of a run of the last batch
+ * @param[in] p_jitter The release-jitter Monte Carlo
+ * @param[in] run The index of the run
+ * @param[out] p_outcome The outcome of the run
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_jitter_get_outcome(const rrosace_jitter_t *p_jitter, size_t run,
+                               rrosace_jitter_outcome_t *p_outcome);
+
+/**
+ * @brief Count the runs of the last batch whose jitter falls in a range, the
+ * bounds of its distribution split in even ranges, the last one closed
+ * @param[in] p_jitter The release-jitter Monte Carlo
+ * @param[in] task The task
+ * @param[in] feature The jitter
+ * @param[in] nb_ranges The number of ranges
+ * @param[in] range The range
+ * @param[out] p_nb_runs The number of runs in the range
+ * @param[out] p_nb_openings The number of them opening a relay
+ * @param[out] p_nb_changes The number of them changing a master in law
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_jitter_get_range(const rrosace_jitter_t *p_jitter,
+                             rrosace_sim_task_t task,
+                             rrosace_jitter_feature_t feature,
+                             size_t nb_ranges, size_t range, size_t *p_nb_runs,
+                             size_t *p_nb_openings, size_t *p_nb_changes);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_JITTER_H */
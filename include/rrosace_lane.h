@@ -0,0 +1,210 @@
+/**
+ * @file rrosace_lane.h
+ * @brief RROSACE Scheduling of cyber-physical system library remote FCC lanes
+ * header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * A lane runs an FCC in another process or on another core, like a redundant
+ * computer. The host and the lane share a memory mapping holding two lock-free
+ * single-producer single-consumer rings, one for the inputs of the steps and
+ * one for their outputs. The lane serves the steps of its FCC, and the host
+ * steps it through a proxy with the same parameters as the FCC steps, or
+ * posts the steps of several lanes before waiting for them.
+ *
+ * A lane is created by the host before the process of the lane is forked, or
+ * shared by threads. The host gives up waiting on a lane after
+ * RROSACE_LANE_TIMEOUT, and a lane stops serving once the host process is
+ * gone, so that neither hangs on a dead peer. The steps are numbered, so that
+ * the late outputs of a step given up are discarded by the next wait.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_LANE_H
+#define RROSACE_LANE_H
+
+#include <rrosace_cables.h>
+#include <rrosace_fcc.h>
+#include <rrosace_flight_mode.h>
+
+/** Number of messages a ring holds, a power of two */
+#define RROSACE_LANE_RING_SIZE (8)
+
+/** Time the host waits on a lane before failing, in s */
+#define RROSACE_LANE_TIMEOUT (1.0)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @struct Lane structure */
+struct rrosace_lane;
+
+/** @typedef Lane */
+typedef struct rrosace_lane rrosace_lane_t;
+
+/**
+ * @brief Create a lane in a shared memory mapping
+ * @return A new lane, NULL if failed
+ */
+rrosace_lane_t *rrosace_lane_new(void);
+
+/**
+ * @brief Destroy a lane, in each process mapping it
+ * @param[in,out] p_lane The lane to destroy
+ */
+void rrosace_lane_del(rrosace_lane_t *p_lane);
+
+/**
+ * @brief Serve the steps of an FCC, from the lane process, until stopped
+ * @param[in,out] p_lane The lane
+ * @param[in,out] p_fcc The FCC of the lane
+ * @return EXIT_SUCCESS if stopped, else EXIT_FAILURE, the host process being
+ * gone
+ */
+int rrosace_lane_serve(rrosace_lane_t *p_lane, rrosace_fcc_t *p_fcc);
+
+/**
+ * @brief Stop serving a lane, from the host
+ * @param[in,out] p_lane The lane
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_lane_stop(rrosace_lane_t *p_lane);
+
+/**
+ * @brief Post a COM step to a lane, from the host
+ * @param[in,out] p_lane The lane
+ * @param[in] mode The flight mode
+ * @param[in] h_f The filtered altitude
+ * @param[in] vz_f The filtered vertical speed
+ * @param[in] va_f The filtered true airspeed
+ * @param[in] q_f The filtered pitch rate
+ * @param[in] az_f The filtered vertical acceleration
+ * @param[in] h_c The altitude command
+ * @param[in] vz_c The vertical speed command
+ * @param[in] va_c The true airspeed command
+ * @param[in] dt The execution period
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_lane_post_com(rrosace_lane_t *p_lane, rrosace_mode_t mode,
+                          double h_f, double vz_f, double va_f, double q_f,
+                          double az_f, double h_c, double vz_c, double va_c,
+                          double dt);
+
+/**
+ * @brief Wait for the outputs of the oldest COM step posted to a lane
+ * @param[in,out] p_lane The lane
+ * @param[out] p_delta_e_c The elevator deflection command
+ * @param[out] p_delta_th_c The throttle command
+ * @return EXIT_SUCCESS if the step succeeded, else EXIT_FAILURE
+ */
+int rrosace_lane_wait_com(rrosace_lane_t *p_lane, double *p_delta_e_c,
+                          double *p_delta_th_c);
+
+/**
+ * @brief Post a MON step to a lane, from the host
+ * @param[in,out] p_lane The lane
+ * @param[in] mode The flight mode
+ * @param[in] h_f The filtered altitude
+ * @param[in] vz_f The filtered vertical speed
+ * @param[in] va_f The filtered true airspeed
+ * @param[in] q_f The filtered pitch rate
+ * @param[in] az_f The filtered vertical acceleration
+ * @param[in] h_c The altitude command
+ * @param[in] vz_c The vertical speed command
+ * @param[in] va_c The true airspeed command
+ * @param[in] delta_e_c_monitored The elevator deflection command monitored
+ * @param[in] delta_th_c_monitored The throttle command monitored
+ * @param[in] other_master_in_law The master in law state of the other couple
+ * @param[in] dt The execution period
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_lane_post_mon(rrosace_lane_t *p_lane, rrosace_mode_t mode,
+                          double h_f, double vz_f, double va_f, double q_f,
+                          double az_f, double h_c, double vz_c, double va_c,
+                          double delta_e_c_monitored,
+                          double delta_th_c_monitored,
+                          rrosace_master_in_law_t other_master_in_law,
+                          double dt);
+
+/**
+ * @brief Wait for the outputs of the oldest MON step posted to a lane
+ * @param[in,out] p_lane The lane
+ * @param[out] p_relay_delta_e_c The elevator deflection command relay
+ * @param[out] p_relay_delta_th_c The throttle command relay
+ * @param[out] p_master_in_law The master in law state
+ * @return EXIT_SUCCESS if the step succeeded, else EXIT_FAILURE
+ */
+int rrosace_lane_wait_mon(rrosace_lane_t *p_lane,
+                          rrosace_relay_state_t *p_relay_delta_e_c,
+                          rrosace_relay_state_t *p_relay_delta_th_c,
+                          rrosace_master_in_law_t *p_master_in_law);
+
+/**
+ * @brief Step the COM FCC of a lane, from the host, and wait for its outputs
+ * @param[in,out] p_lane The lane
+ * @param[in] mode The flight mode
+ * @param[in] h_f The filtered altitude
+ * @param[in] vz_f The filtered vertical speed
+ * @param[in] va_f The filtered true airspeed
+ * @param[in] q_f The filtered pitch rate
+ * @param[in] az_f The filtered vertical acceleration
+ * @param[in] h_c The altitude command
+ * @param[in] vz_c The vertical speed command
+ * @param[in] va_c The true airspeed command
+ * @param[out] p_delta_e_c The elevator deflection command
+ * @param[out] p_delta_th_c The throttle command
+ * @param[in] dt The execution period
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_lane_com_step(rrosace_lane_t *p_lane, rrosace_mode_t mode,
+                          double h_f, double vz_f, double va_f, double q_f,
+                          double az_f, double h_c, double vz_c, double va_c,
+                          double *p_delta_e_c, double *p_delta_th_c,
+                          double dt);
+
+/**
+ * @brief Step the MON FCC of a lane, from the host, and wait for its outputs
+ * @param[in,out] p_lane The lane
+ * @param[in] mode The flight mode
+ * @param[in] h_f The filtered altitude
+ * @param[in] vz_f The filtered vertical speed
+ * @param[in] va_f The filtered true airspeed
+ * @param[in] q_f The filtered pitch rate
+ * @param[in] az_f The filtered vertical acceleration
+ * @param[in] h_c The altitude command
+ * @param[in] vz_c The vertical speed command
+ * @param[in] va_c The true airspeed command
+ * @param[in] delta_e_c_monitored The elevator deflection command monitored
+ * @param[in] delta_th_c_monitored The throttle command monitored
+ * @param[in] other_master_in_law The master in law state of the other couple
+ * @param[out] p_relay_delta_e_c The elevator deflection command relay
+ * @param[out] p_relay_delta_th_c The throttle command relay
+ * @param[out] p_master_in_law The master in law state
+ * @param[in] dt The execution period
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_lane_mon_step(rrosace_lane_t *p_lane, rrosace_mode_t mode,
+                          double h_f, double vz_f, double va_f, double q_f,
+                          double az_f, double h_c, double vz_c, double va_c,
+                          double delta_e_c_monitored,
+                          double delta_th_c_monitored,
+                          rrosace_master_in_law_t other_master_in_law,
+                          rrosace_relay_state_t *p_relay_delta_e_c,
+                          rrosace_relay_state_t *p_relay_delta_th_c,
+                          rrosace_master_in_law_t *p_master_in_law, double dt);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_LANE_H */
@@ -0,0 +1,117 @@
+/**
+ * @file rrosace_parareal.h
+ * @brief RROSACE Scheduling of cyber-physical system library Parareal
+ * time-parallel driver header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Parareal splits a long trajectory in time slices. A cheap coarse propagator
+ * sweeps the slices serially, the accurate fine propagator runs on all the
+ * slices in parallel, and the slice boundaries are corrected until they
+ * converge to the serial fine trajectory.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_PARAREAL_H
+#define RROSACE_PARAREAL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @typedef Propagator of a state over one time slice
+ * @param[in] p_context The user context of the driver
+ * @param[in] slice The index of the time slice
+ * @param[in] state_in The state at the start of the slice
+ * @param[out] state_out The state at the end of the slice
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ *
+ * The fine propagator is called concurrently on different slices, and must
+ * therefore be reentrant.
+ */
+typedef int (*rrosace_parareal_propagator_t)(void *p_context, size_t slice,
+                                             const double state_in[],
+                                             double state_out[]);
+
+/** @struct Parareal driver structure */
+struct rrosace_parareal;
+
+/** @typedef Parareal driver */
+typedef struct rrosace_parareal rrosace_parareal_t;
+
+/**
+ * @brief Create a Parareal driver
+ * @param[in] state_size The number of doubles of the state
+ * @param[in] nb_slices The number of time slices
+ * @param[in] fine The fine propagator, reference of the trajectory
+ * @param[in] coarse The coarse propagator
+ * @param[in] p_context The user context given to the propagators
+ * @return A new Parareal driver, NULL if failed
+ */
+rrosace_parareal_t *rrosace_parareal_new(size_t state_size, size_t nb_slices,
+                                         rrosace_parareal_propagator_t fine,
+                                         rrosace_parareal_propagator_t coarse,
+                                         void *p_context);
+
+/**
+ * @brief Destroy a Parareal driver
+ * @param[in,out] p_parareal The Parareal driver to destroy
+ */
+void rrosace_parareal_del(rrosace_parareal_t *p_parareal);
+
+/**
+ * @brief Declare a discrete entry of the state, such as a relay state
+ * @param[in,out] p_parareal The Parareal driver
+ * @param[in] index The index of the entry in the state
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ *
+ * Discrete entries are not corrected additively: they take the fine value
+ * when the coarse propagator agrees with its previous iteration, else the
+ * new coarse value.
+ */
+int rrosace_parareal_set_discrete(rrosace_parareal_t *p_parareal,
+                                  size_t index);
+
+/**
+ * @brief Run the Parareal iterations from an initial state
+ * @param[in,out] p_parareal The Parareal driver
+ * @param[in] state0 The initial state
+ * @param[in] tolerance The relative tolerance on the slices boundaries
+ * @param[in] max_iterations The maximum number of iterations, the trajectory
+ * is exact after nb_slices iterations
+ * @param[in] nb_threads The number of threads for the fine propagations
+ * @param[out] p_iterations The number of iterations done, can be NULL
+ * @return EXIT_SUCCESS if converged, else EXIT_FAILURE
+ */
+int rrosace_parareal_run(rrosace_parareal_t *p_parareal, const double state0[],
+                         double tolerance, size_t max_iterations,
+                         size_t nb_threads, size_t *p_iterations);
+
+/**
+ * @brief Get the state at a slice boundary after a run
+ * @param[in] p_parareal The Parareal driver
+ * @param[in] slice The boundary, from 0 (initial state) to nb_slices (final
+ * state)
+ * @param[out] state The state at the boundary
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_parareal_get_state(const rrosace_parareal_t *p_parareal,
+                               size_t slice, double state[]);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_PARAREAL_H */
@@ -0,0 +1,248 @@
+/**
+ * @file rrosace_pool.h
+ * @brief RROSACE Scheduling of cyber-physical system library thread pool
+ * header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * A pool keeps its threads waiting for jobs. A job is a number of independent
+ * items; the threads of the pool and the calling one claim them until none is
+ * left, and the call returns once all of them are done. Items are claimed and
+ * counted with atomics, the mutex only publishing a job and signaling the last
+ * item done.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_POOL_H
+#define RROSACE_POOL_H
+
+#include <rrosace_common.h>
+
+#ifdef __cplusplus
+
+#include <pthread.h>
+
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace RROSACE {
+
+/** @class Thread pool
+ *  @brief Threads running the items of a job with the calling one
+ */
+class ThreadPool {
+public:
+  /** @class Job
+   *  @brief Independent items run by a pool
+   */
+  class Job {
+  public:
+    virtual ~Job() {}
+
+    /**
+     * @brief Run an item
+     * @param[in] item The index of the item
+     */
+    virtual void run(size_t item) = 0;
+  };
+
+  /**
+   * @brief Thread pool constructor
+   * @param[in] nb_threads The number of threads helping the calling one
+   */
+  explicit ThreadPool(size_t nb_threads)
+      : m_threads(), m_mutex(), m_start(), m_done(), p_job(nullptr),
+        m_nb_items(0), m_end(0), m_next(0), m_nb_done(0), m_generation(0),
+        m_stop(false), m_error() {
+    pthread_mutex_init(&m_mutex, nullptr);
+    pthread_cond_init(&m_start, nullptr);
+    pthread_cond_init(&m_done, nullptr);
+
+    for (size_t thread = 0; thread < nb_threads; ++thread) {
+      pthread_t id;
+
+      if (pthread_create(&id, nullptr, worker, this)) {
+        stop();
+        pthread_cond_destroy(&m_done);
+        pthread_cond_destroy(&m_start);
+        pthread_mutex_destroy(&m_mutex);
+        throw(std::runtime_error("Pool thread creation failed."));
+      }
+      m_threads.push_back(id);
+    }
+  }
+
+  /**
+   * @brief Thread pool destructor
+   */
+  ~ThreadPool() {
+    stop();
+    pthread_cond_destroy(&m_done);
+    pthread_cond_destroy(&m_start);
+    pthread_mutex_destroy(&m_mutex);
+  }
+
+  /**
+   * @brief Get the number of threads
+   * @return The number of threads helping the calling one
+   */
+  size_t get_nb_threads() const { return m_threads.size(); }
+
+  /**
+   * @brief Run the items of a job, the first error of an item being rethrown
+   * once all of them are done
+   * @param[in,out] job The job
+   * @param[in] nb_items The number of items
+   */
+  void run(Job &job, size_t nb_items) {
+    size_t end;
+
+    pthread_mutex_lock(&m_mutex);
+    p_job = &job;
+    /* Items numbered on from the last job, a late thread finding none left */
+    end = __atomic_load_n(&m_next, __ATOMIC_RELAXED) + nb_items;
+    m_nb_items = nb_items;
+    m_end = end;
+    __atomic_store_n(&m_nb_done, 0, __ATOMIC_RELAXED);
+    ++m_generation;
+    pthread_cond_broadcast(&m_start);
+    pthread_mutex_unlock(&m_mutex);
+
+    run_items(job, end, nb_items);
+
+    pthread_mutex_lock(&m_mutex);
+    while (__atomic_load_n(&m_nb_done, __ATOMIC_ACQUIRE) < nb_items) {
+      pthread_cond_wait(&m_done, &m_mutex);
+    }
+    p_job = nullptr;
+    const std::string error = m_error;
+    m_error.clear();
+    pthread_mutex_unlock(&m_mutex);
+
+    if (!error.empty()) {
+      throw(std::runtime_error(error));
+    }
+  }
+
+private:
+  std::vector<pthread_t> m_threads;
+  pthread_mutex_t m_mutex;
+  /** Signaled when a job is published */
+  pthread_cond_t m_start;
+  /** Signaled when the last item of a job is done */
+  pthread_cond_t m_done;
+  /** The job being run */
+  Job *p_job;
+  size_t m_nb_items;
+  /** The number following the last item of the job */
+  size_t m_end;
+  /** The number of the next item to claim */
+  size_t m_next;
+  /** The number of items of the job done */
+  size_t m_nb_done;
+  unsigned long m_generation;
+  bool m_stop;
+  std::string m_error;
+
+  ThreadPool(const ThreadPool &);
+  ThreadPool &operator=(const ThreadPool &);
+
+  void stop() {
+    pthread_mutex_lock(&m_mutex);
+    m_stop = true;
+    pthread_cond_broadcast(&m_start);
+    pthread_mutex_unlock(&m_mutex);
+
+    for (std::vector<pthread_t>::iterator it = m_threads.begin();
+         it != m_threads.end(); ++it) {
+      pthread_join(*it, nullptr);
+    }
+    m_threads.clear();
+  }
+
+  /**
+   * @brief Run the items of a job until none is left
+   * @param[in,out] job The job
+   * @param[in] end The number following its last item
+   * @param[in] nb_items Its number of items
+   */
+  void run_items(Job &job, size_t end, size_t nb_items) {
+    size_t next = __atomic_load_n(&m_next, __ATOMIC_RELAXED);
+
+    while (next < end) {
+      std::string error;
+
+      /* A failed exchange reloads the next item to claim */
+      if (!__atomic_compare_exchange_n(&m_next, &next, next + 1, false,
+                                       __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        continue;
+      }
+
+      try {
+        job.run(nb_items - (end - next));
+      } catch (const std::exception &e) {
+        error = e.what();
+      }
+
+      if (!error.empty()) {
+        pthread_mutex_lock(&m_mutex);
+        if (m_error.empty()) {
+          m_error = error;
+        }
+        pthread_mutex_unlock(&m_mutex);
+      }
+      if (__atomic_add_fetch(&m_nb_done, 1, __ATOMIC_RELEASE) == nb_items) {
+        pthread_mutex_lock(&m_mutex);
+        pthread_cond_signal(&m_done);
+        pthread_mutex_unlock(&m_mutex);
+      }
+
+      next = __atomic_load_n(&m_next, __ATOMIC_RELAXED);
+    }
+  }
+
+  static void *worker(void *p_arg) {
+    ThreadPool *const p_pool = static_cast<ThreadPool *>(p_arg);
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&p_pool->m_mutex);
+    for (;;) {
+      while (!p_pool->m_stop && (p_pool->m_generation == seen)) {
+        pthread_cond_wait(&p_pool->m_start, &p_pool->m_mutex);
+      }
+      if (p_pool->m_stop) {
+        break;
+      }
+      seen = p_pool->m_generation;
+      /* The job may be over before the thread wakes */
+      if (p_pool->p_job) {
+        Job &job = *p_pool->p_job;
+        const size_t end = p_pool->m_end;
+        const size_t nb_items = p_pool->m_nb_items;
+
+        pthread_mutex_unlock(&p_pool->m_mutex);
+        p_pool->run_items(job, end, nb_items);
+        pthread_mutex_lock(&p_pool->m_mutex);
+      }
+    }
+    pthread_mutex_unlock(&p_pool->m_mutex);
+
+    return nullptr;
+  }
+};
+} /* namespace RROSACE */
+#endif /* __cplusplus */
+
+#endif /* RROSACE_POOL_H */
@@ -0,0 +1,198 @@
+/**
+ * @file rrosace_qmc.h
+ * @brief RROSACE Scheduling of cyber-physical system library quasi-Monte
+ * Carlo campaigns header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Low discrepancy sequences, Owen-scrambled Sobol and randomly permuted
+ * Halton, mapped onto named parameters of a campaign. The campaign runs
+ * several independent randomizations of the sequence side by side, the
+ * spread of their estimates giving the confidence on the statistics of the
+ * outputs while the campaign runs.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_QMC_H
+#define RROSACE_QMC_H
+
+#include <stddef.h>
+
+/** Largest dimension of a sequence */
+#define RROSACE_QMC_MAX_DIMENSION (16)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** RROSACE sampling sequences */
+enum rrosace_qmc_sequence {
+  RROSACE_QMC_RANDOM, /**< pseudo-random, the plain Monte Carlo reference */
+  RROSACE_QMC_HALTON, /**< Halton with random digit permutations */
+  RROSACE_QMC_SOBOL   /**< Sobol with nested uniform (Owen) scrambling */
+};
+typedef enum rrosace_qmc_sequence rrosace_qmc_sequence_t;
+
+/** RROSACE parameters distributions */
+enum rrosace_qmc_distribution {
+  RROSACE_QMC_UNIFORM, /**< uniform between a and b */
+  RROSACE_QMC_NORMAL   /**< normal of mean a and standard deviation b */
+};
+typedef enum rrosace_qmc_distribution rrosace_qmc_distribution_t;
+
+/** @struct Parameter of a campaign */
+struct rrosace_qmc_parameter {
+  const char *name;                        /**< name of the parameter */
+  rrosace_qmc_distribution_t distribution; /**< distribution */
+  double a;                                /**< minimum, or mean */
+  double b;                                /**< maximum, or deviation */
+};
+
+/** @typedef Parameter of a campaign */
+typedef struct rrosace_qmc_parameter rrosace_qmc_parameter_t;
+
+/** @struct Sampling sequence structure */
+struct rrosace_qmc;
+
+/** @typedef Sampling sequence */
+typedef struct rrosace_qmc rrosace_qmc_t;
+
+/** @struct Campaign structure */
+struct rrosace_qmc_campaign;
+
+/** @typedef Campaign */
+typedef struct rrosace_qmc_campaign rrosace_qmc_campaign_t;
+
+/**
+ * @brief Create a randomized sampling sequence
+ * @param[in] sequence The kind of sequence
+ * @param[in] dimension The dimension of the points, up to
+ * RROSACE_QMC_MAX_DIMENSION
+ * @param[in] seed The seed of the randomization
+ * @return A new sampling sequence, NULL if failed
+ */
+rrosace_qmc_t *rrosace_qmc_new(rrosace_qmc_sequence_t sequence,
+                               size_t dimension, unsigned long seed);
+
+/**
+ * @brief Destroy a sampling sequence
+ * @param[in,out] p_qmc The sampling sequence to destroy
+ */
+void rrosace_qmc_del(rrosace_qmc_t *p_qmc);
+
+/**
+ * @brief Draw the next point of a sampling sequence
+ * @param[in,out] p_qmc The sampling sequence
+ * @param[out] point The point, in [0, 1)^dimension
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_qmc_next(rrosace_qmc_t *p_qmc, double point[]);
+
+/**
+ * @brief Create a campaign
+ * @param[in] sequence The kind of sequence
+ * @param[in] parameters The parameters sampled, copied but not their names
+ * @param[in] nb_parameters The number of parameters
+ * @param[in] nb_outputs The number of outputs of a run
+ * @param[in] nb_replicates The number of independent randomizations, at
+ * least 2
+ * @param[in] seed The seed of the randomizations
+ * @return A new campaign, NULL if failed
+ */
+rrosace_qmc_campaign_t *
+rrosace_qmc_campaign_new(rrosace_qmc_sequence_t sequence,
+                         const rrosace_qmc_parameter_t parameters[],
+                         size_t nb_parameters, size_t nb_outputs,
+                         size_t nb_replicates, unsigned long seed);
+
+/**
+ * @brief Destroy a campaign
+ * @param[in,out] p_campaign The campaign to destroy
+ */
+void rrosace_qmc_campaign_del(rrosace_qmc_campaign_t *p_campaign);
+
+/**
+ * @brief Find a parameter of a campaign by its name
+ * @param[in] p_campaign The campaign
+ * @param[in] name The name of the parameter
+ * @return The index of the parameter in the values, nb_parameters if not
+ * found
+ */
+size_t rrosace_qmc_campaign_find(const rrosace_qmc_campaign_t *p_campaign,
+                                 const char *name);
+
+/**
+ * @brief Draw the parameters of the next run, the replicates taking turns
+ * @param[in,out] p_campaign The campaign
+ * @param[out] values The values of the parameters
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_qmc_campaign_sample(rrosace_qmc_campaign_t *p_campaign,
+                                double values[]);
+
+/**
+ * @brief Record the outputs of the last run drawn
+ * @param[in,out] p_campaign The campaign
+ * @param[in] outputs The outputs of the run
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_qmc_campaign_record(rrosace_qmc_campaign_t *p_campaign,
+                                const double outputs[]);
+
+/**
+ * @brief Get the number of runs recorded
+ * @param[in] p_campaign The campaign
+ * @return The number of runs recorded
+ */
+size_t rrosace_qmc_campaign_get_runs(const rrosace_qmc_campaign_t *p_campaign);
+
+/**
+ * @brief Get the estimated mean of an output, the mean of the estimates of
+ * the replicates
+ * @param[in] p_campaign The campaign
+ * @param[in] output The index of the output
+ * @param[out] p_mean The estimated mean
+ * @param[out] p_half_width The half width of its 95 % confidence interval
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_qmc_campaign_get_mean(const rrosace_qmc_campaign_t *p_campaign,
+                                  size_t output, double *p_mean,
+                                  double *p_half_width);
+
+/**
+ * @brief Get the estimated standard deviation of an output, the mean of the
+ * estimates of the replicates
+ * @param[in] p_campaign The campaign
+ * @param[in] output The index of the output
+ * @param[out] p_deviation The estimated standard deviation
+ * @param[out] p_half_width The half width of its 95 % confidence interval
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_qmc_campaign_get_deviation(
+    const rrosace_qmc_campaign_t *p_campaign, size_t output,
+    double *p_deviation, double *p_half_width);
+
+/**
+ * @brief Tell if the mean and the deviation of every output are known within
+ * a tolerance
+ * @param[in] p_campaign The campaign
+ * @param[in] tolerances The largest half widths, per output
+ * @return 1 if converged, else 0
+ */
+int rrosace_qmc_campaign_converged(const rrosace_qmc_campaign_t *p_campaign,
+                                   const double tolerances[]);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_QMC_H */
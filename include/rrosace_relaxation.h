@@ -0,0 +1,103 @@
+/**
+ * @file rrosace_relaxation.h
+ * @brief RROSACE Scheduling of cyber-physical system library waveform
+ * relaxation header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Gauss-Jacobi waveform relaxation between two partitions of a system. Each
+ * partition simulates a whole time window from the waveform produced by the
+ * other partition at the previous iteration, both partitions in parallel,
+ * until the waveforms agree. The window is then committed and the next one
+ * starts from the committed states.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_RELAXATION_H
+#define RROSACE_RELAXATION_H
+
+#include <stddef.h>
+
+/** Number of partitions of a waveform relaxation */
+#define RROSACE_RELAXATION_NB_PARTITIONS (2)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @struct Partition of a waveform relaxation */
+struct rrosace_relaxation_partition {
+  /** Number of outputs per tick, inputs of the other partition */
+  size_t nb_outputs;
+  /**
+   * Simulate the window from the last committed state, with the inputs of
+   * each tick of the window, and give the outputs of each tick, as arrays of
+   * nb_ticks * nb_outputs of the other partition, and nb_ticks * nb_outputs
+   */
+  int (*simulate)(void *p_context, size_t nb_ticks, const double inputs[],
+                  double outputs[]);
+  /** Commit the last simulation of the window, with its outputs */
+  int (*commit)(void *p_context, size_t nb_ticks, const double outputs[]);
+  /** User context of the partition */
+  void *p_context;
+};
+
+/** @typedef Partition of a waveform relaxation */
+typedef struct rrosace_relaxation_partition rrosace_relaxation_partition_t;
+
+/** @struct Waveform relaxation structure */
+struct rrosace_relaxation;
+
+/** @typedef Waveform relaxation */
+typedef struct rrosace_relaxation rrosace_relaxation_t;
+
+/**
+ * @brief Create a waveform relaxation between two partitions
+ * @param[in] partitions The two partitions
+ * @param[in] window_ticks The number of ticks of a window
+ * @param[in] outputs0 The initial outputs of each partition, held during the
+ * first guess of the first window
+ * @param[in] nb_threads 2 to simulate the partitions in parallel, 1 to
+ * simulate them one after the other
+ * @return A new waveform relaxation, NULL if failed
+ */
+rrosace_relaxation_t *rrosace_relaxation_new(
+    const rrosace_relaxation_partition_t
+        partitions[RROSACE_RELAXATION_NB_PARTITIONS],
+    size_t window_ticks,
+    const double *const outputs0[RROSACE_RELAXATION_NB_PARTITIONS],
+    size_t nb_threads);
+
+/**
+ * @brief Destroy a waveform relaxation
+ * @param[in,out] p_relaxation The waveform relaxation to destroy
+ */
+void rrosace_relaxation_del(rrosace_relaxation_t *p_relaxation);
+
+/**
+ * @brief Relax the next window until the waveforms agree, and commit it
+ * @param[in,out] p_relaxation The waveform relaxation
+ * @param[in] tolerance The absolute tolerance between two iterations, 0 to
+ * reproduce exactly the serial simulation
+ * @param[in] max_iterations The maximum number of iterations
+ * @param[out] p_iterations The number of iterations done, can be NULL
+ * @return EXIT_SUCCESS if converged and committed, else EXIT_FAILURE
+ */
+int rrosace_relaxation_window(rrosace_relaxation_t *p_relaxation,
+                              double tolerance, size_t max_iterations,
+                              size_t *p_iterations);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_RELAXATION_H */
@@ -0,0 +1,246 @@
+/**
+ * @file rrosace_rt.h
+ * @brief RROSACE Scheduling of cyber-physical system library real-time
+ * executor header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * A real-time executor paces the ticks of a simulation on the monotonic clock,
+ * as a plant model on a hardware-in-the-loop bench. It measures the release
+ * jitter and the execution time of each tick, and counts the deadline
+ * overruns. The statistics can be read while the simulation runs.
+ *
+ * Tasks may be given a budget: their steps are then measured one by one, and
+ * a step over its budget triggers the policy of the task, for a number of
+ * releases or ticks, so that the loop keeps its rate under load spikes. The
+ * overruns and the releases degraded are recorded in a log of events,
+ * allocated with the executor. Observers run after each tick, the optional
+ * ones shed while a task asks for it.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_RT_H
+#define RROSACE_RT_H
+
+#include <stddef.h>
+
+#include <rrosace_sim.h>
+
+/** Number of buckets of the histograms, the last one gathering the overflow */
+#define RROSACE_RT_NB_BUCKETS (64)
+
+/** Largest number of observers of a real-time executor */
+#define RROSACE_RT_MAX_OBSERVERS (8)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @struct Configuration of a real-time executor */
+struct rrosace_rt_config {
+  double period; /**< period of the ticks, in s */
+  /** Busy wait before each release, in s, 0 to only sleep */
+  double spin;
+  /** SCHED_FIFO priority, 0 to keep the scheduling policy */
+  int priority;
+  /** Core the ticks run on, -1 to keep the affinity */
+  int cpu;
+  int lock_memory;     /**< lock and pre-fault the memory */
+  double bucket_width; /**< width of the buckets of the histograms, in s */
+  /** Number of events kept, the oldest ones overwritten, 0 for none */
+  size_t nb_events;
+};
+
+/** @typedef Configuration of a real-time executor */
+typedef struct rrosace_rt_config rrosace_rt_config_t;
+
+/** @struct Statistics of a real-time executor */
+struct rrosace_rt_stats {
+  size_t nb_ticks;    /**< number of ticks run */
+  size_t nb_overruns; /**< number of ticks completed after their deadline */
+  double jitter_min;  /**< smallest release jitter, in s */
+  double jitter_max;  /**< largest release jitter, in s */
+  double jitter_mean; /**< mean release jitter, in s */
+  double exec_min;    /**< smallest execution time, in s */
+  double exec_max;    /**< largest execution time, in s */
+  double exec_mean;   /**< mean execution time, in s */
+  /** Release jitters, by buckets of bucket_width */
+  size_t jitter_histogram[RROSACE_RT_NB_BUCKETS];
+  /** Execution times, by buckets of bucket_width */
+  size_t exec_histogram[RROSACE_RT_NB_BUCKETS];
+  /** Steps over their budget, by task */
+  size_t nb_task_overruns[RROSACE_SIM_NB_TASKS];
+  size_t nb_events; /**< number of events recorded since the run started */
+};
+
+/** @typedef Statistics of a real-time executor */
+typedef struct rrosace_rt_stats rrosace_rt_stats_t;
+
+/** @enum Policies of a task on overrun */
+enum rrosace_rt_policy {
+  /** Only record the overrun */
+  RROSACE_RT_RECORD,
+  /** Skip the next releases of the task */
+  RROSACE_RT_SKIP,
+  /** Drop the outputs of the step overrunning, holding the previous ones */
+  RROSACE_RT_HOLD,
+  /** Run the next releases with the degraded step of the task */
+  RROSACE_RT_DEGRADE,
+  /** Shed the optional observers for the next ticks */
+  RROSACE_RT_SHED,
+  RROSACE_RT_NB_POLICIES /**< number of policies */
+};
+
+/** @typedef Policies of a task on overrun */
+typedef enum rrosace_rt_policy rrosace_rt_policy_t;
+
+/** @struct Budget of a task of a simulation run by a real-time executor */
+struct rrosace_rt_budget {
+  double budget;              /**< execution time allowed to a step, in s */
+  rrosace_rt_policy_t policy; /**< policy on overrun */
+  /** Releases skipped or degraded, or ticks shed, after an overrun */
+  size_t nb_recovery;
+  /** Step of the task, NULL for rrosace_sim_step_task */
+  rrosace_sim_step_t step;
+  /** Cheaper step of the task, run while degraded */
+  rrosace_sim_step_t degraded;
+  void *p_arg; /**< argument of the steps */
+};
+
+/** @typedef Budget of a task of a simulation run by a real-time executor */
+typedef struct rrosace_rt_budget rrosace_rt_budget_t;
+
+/** @enum Kinds of the events of a real-time executor */
+enum rrosace_rt_event_kind {
+  RROSACE_RT_EVENT_OVERRUN,  /**< step over its budget */
+  RROSACE_RT_EVENT_SKIPPED,  /**< release skipped */
+  RROSACE_RT_EVENT_HELD,     /**< outputs of a step dropped */
+  RROSACE_RT_EVENT_DEGRADED, /**< release run with the degraded step */
+  RROSACE_RT_EVENT_SHED      /**< optional observers shed for a tick */
+};
+
+/** @typedef Kinds of the events of a real-time executor */
+typedef enum rrosace_rt_event_kind rrosace_rt_event_kind_t;
+
+/** @struct Event of a real-time executor */
+struct rrosace_rt_event {
+  rrosace_rt_event_kind_t kind; /**< kind of the event */
+  size_t tick;                  /**< tick of the run */
+  rrosace_sim_task_t task;      /**< task, of the overrun for a shed tick */
+  double exec;                  /**< execution time of the step, in s */
+};
+
+/** @typedef Event of a real-time executor */
+typedef struct rrosace_rt_event rrosace_rt_event_t;
+
+/**
+ * @typedef Observer of the ticks of a real-time executor, run after each tick
+ * @param[in] p_sim The simulation
+ * @param[in,out] p_arg The argument given with the observer
+ */
+typedef void (*rrosace_rt_observer_t)(const rrosace_sim_t *p_sim, void *p_arg);
+
+/** @struct Real-time executor structure */
+struct rrosace_rt;
+
+/** @typedef Real-time executor */
+typedef struct rrosace_rt rrosace_rt_t;
+
+/**
+ * @brief Get the default configuration: physical rate, sleep only, default
+ * scheduling, no pinning nor memory locking, buckets of 1 us, 1024 events
+ * @param[out] p_config The configuration
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_rt_default_config(rrosace_rt_config_t *p_config);
+
+/**
+ * @brief Create a real-time executor
+ * @param[in] p_config The configuration, copied
+ * @return A new real-time executor, NULL if failed
+ */
+rrosace_rt_t *rrosace_rt_new(const rrosace_rt_config_t *p_config);
+
+/**
+ * @brief Destroy a real-time executor
+ * @param[in,out] p_rt The real-time executor to destroy
+ */
+void rrosace_rt_del(rrosace_rt_t *p_rt);
+
+/**
+ * @brief Set the budget of a task, before a run
+ *
+ * A degraded step is needed by the RROSACE_RT_DEGRADE policy only. A step
+ * overrunning while degraded renews the recovery.
+ *
+ * @param[in,out] p_rt The real-time executor
+ * @param[in] task The task
+ * @param[in] p_budget The budget, copied, NULL to no longer measure the task
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_rt_set_budget(rrosace_rt_t *p_rt, rrosace_sim_task_t task,
+                          const rrosace_rt_budget_t *p_budget);
+
+/**
+ * @brief Add an observer of the ticks, before a run
+ * @param[in,out] p_rt The real-time executor
+ * @param[in] observer The observer
+ * @param[in,out] p_arg The argument of the observer
+ * @param[in] optional Whether the observer may be shed
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE, also beyond
+ * RROSACE_RT_MAX_OBSERVERS
+ */
+int rrosace_rt_add_observer(rrosace_rt_t *p_rt, rrosace_rt_observer_t observer,
+                            void *p_arg, int optional);
+
+/**
+ * @brief Run a simulation paced, a physical tick per period, from the
+ * calling thread
+ *
+ * The scheduling policy, affinity and memory locking are applied for the run
+ * only. The statistics and the events restart with the run. With budgets, the
+ * simulation needs the immediate semantics.
+ *
+ * @param[in,out] p_rt The real-time executor
+ * @param[in,out] p_sim The simulation
+ * @param[in] n_ticks The number of ticks to run
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE, also when the configuration
+ * cannot be applied
+ */
+int rrosace_rt_run(rrosace_rt_t *p_rt, rrosace_sim_t *p_sim, size_t n_ticks);
+
+/**
+ * @brief Get the statistics of a real-time executor, from any thread, also
+ * during a run
+ * @param[in] p_rt The real-time executor
+ * @param[out] p_stats The statistics
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_rt_get_stats(const rrosace_rt_t *p_rt, rrosace_rt_stats_t *p_stats);
+
+/**
+ * @brief Get events of a real-time executor, from any thread, also during a
+ * run
+ * @param[in] p_rt The real-time executor
+ * @param[in] first The index of the first event, from the start of the run
+ * @param[in] nb_events The largest number of events to get
+ * @param[out] events The events
+ * @return The number of events got, 0 from an event already overwritten
+ */
+size_t rrosace_rt_get_events(const rrosace_rt_t *p_rt, size_t first,
+                             size_t nb_events, rrosace_rt_event_t events[]);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_RT_H */
@@ -0,0 +1,122 @@
+/**
+ * @file rrosace_server.h
+ * @brief RROSACE Scheduling of cyber-physical system library job server
+ * header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * A job server keeps one warm simulation per pinned worker, created once from
+ * an initial simulation by the worker itself, on the NUMA node of its core.
+ * The workers are pinned on the cores of the affinity mask of the creating
+ * thread, from the one it runs on.
+ * Jobs are queued by priority, then submission order, and each runs on a
+ * worker simulation reset to the initial state, its samples given to a sink
+ * from the worker thread, so that a daemon can stream them back to its
+ * clients without building models per job.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_SERVER_H
+#define RROSACE_SERVER_H
+
+#include <stddef.h>
+
+#include <rrosace_sim.h>
+
+/** Largest number of workers of a job server */
+#define RROSACE_SERVER_MAX_WORKERS (256)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @struct Scenario job */
+struct rrosace_server_job {
+  unsigned long id; /**< identifier, given back to the sink */
+  int priority;     /**< priority, the highest first */
+  double h_c;       /**< altitude command */
+  double vz_c;      /**< vertical speed command */
+  double va_c;      /**< true airspeed command */
+  size_t nb_ticks;  /**< duration, in physical ticks */
+  size_t stride;    /**< ticks between samples, 0 for the last one only */
+};
+
+/** @typedef Scenario job */
+typedef struct rrosace_server_job rrosace_server_job_t;
+
+/**
+ * @typedef Sink of the samples of a job, called from a worker thread
+ * @param[in,out] p_sink The argument given with the job
+ * @param[in] p_job The job
+ * @param[in] tick The ticks run
+ * @param[in] p_values The values, NULL once the job ended, the ticks run
+ * being less than its duration if it failed or was cancelled
+ * @return EXIT_SUCCESS to go on, else EXIT_FAILURE to cancel the job
+ */
+typedef int (*rrosace_server_sink_t)(void *p_sink,
+                                     const rrosace_server_job_t *p_job,
+                                     size_t tick,
+                                     const rrosace_sim_values_t *p_values);
+
+/** @struct Job server structure */
+struct rrosace_server;
+
+/** @typedef Job server */
+typedef struct rrosace_server rrosace_server_t;
+
+/**
+ * @brief Create a job server, its workers waiting for jobs
+ * @param[in] p_sim The initial simulation, with the immediate semantics
+ * @param[in] nb_workers The number of workers, from 1 to
+ * RROSACE_SERVER_MAX_WORKERS
+ * @return A new job server, NULL if failed
+ */
+rrosace_server_t *rrosace_server_new(const rrosace_sim_t *p_sim,
+                                     size_t nb_workers);
+
+/**
+ * @brief Destroy a job server, ending the queued jobs without running them
+ * @param[in,out] p_server The job server to destroy
+ */
+void rrosace_server_del(rrosace_server_t *p_server);
+
+/**
+ * @brief Queue a job
+ * @param[in,out] p_server The job server
+ * @param[in] p_job The job, copied
+ * @param[in] sink The sink of its samples
+ * @param[in,out] p_sink The argument of the sink
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_server_submit(rrosace_server_t *p_server,
+                          const rrosace_server_job_t *p_job,
+                          rrosace_server_sink_t sink, void *p_sink);
+
+/**
+ * @brief Wait until no job is queued or running
+ * @param[in,out] p_server The job server
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_server_wait(rrosace_server_t *p_server);
+
+/**
+ * @brief Get the number of jobs run to their end
+ * @param[in,out] p_server The job server
+ * @return The number of jobs completed
+ */
+size_t rrosace_server_get_nb_done(rrosace_server_t *p_server);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_SERVER_H */
@@ -0,0 +1,525 @@
+/**
+ * @file rrosace_sim.h
+ * @brief RROSACE Scheduling of cyber-physical system library simulation
+ * runtime header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * A simulation owns a whole closed loop: the models, the values they
+ * exchange, the logical time and the rate of each model. It has no global
+ * state, so that any number of simulations run in one process, one per
+ * thread if needed.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_SIM_H
+#define RROSACE_SIM_H
+
+#include <stddef.h>
+
+#include <rrosace_cables.h>
+#include <rrosace_elevator.h>
+#include <rrosace_engine.h>
+#include <rrosace_fcc.h>
+#include <rrosace_filters.h>
+#include <rrosace_flight_dynamics.h>
+#include <rrosace_flight_mode.h>
+
+/** Number of couples of FCCs, COM and MON, of a simulation */
+#define RROSACE_SIM_NB_FCCS_COUPLES (2)
+
+/** Number of FCCs of a simulation */
+#define RROSACE_SIM_NB_FCCS (RROSACE_SIM_NB_FCCS_COUPLES * 2)
+
+/** Size of the values of a simulation and its phase, in doubles */
+#define RROSACE_SIM_VALUES_SIZE (19 + 6 * RROSACE_SIM_NB_FCCS_COUPLES)
+
+/** Number of filters of a simulation */
+#define RROSACE_SIM_NB_FILTERS (5)
+
+/** Size of the state of a simulation, its values, phase and models, in
+ * doubles */
+#define RROSACE_SIM_STATE_SIZE                                                 \
+  (RROSACE_SIM_VALUES_SIZE + RROSACE_ENGINE_STATE_SIZE +                       \
+   RROSACE_ELEVATOR_STATE_SIZE + RROSACE_FLIGHT_DYNAMICS_STATE_SIZE +          \
+   RROSACE_SIM_NB_FILTERS * RROSACE_FILTER_STATE_SIZE +                        \
+   RROSACE_SIM_NB_FCCS * RROSACE_FCC_STATE_SIZE)
+
+/** Offset of the states of the engine, the elevator and the flight dynamics
+ * in the state of a simulation, in doubles */
+#define RROSACE_SIM_PHYSICAL_STATE_OFFSET (RROSACE_SIM_VALUES_SIZE)
+
+/** Size of the states of the engine, the elevator and the flight dynamics, in
+ * doubles */
+#define RROSACE_SIM_PHYSICAL_STATE_SIZE                                        \
+  (RROSACE_ENGINE_STATE_SIZE + RROSACE_ELEVATOR_STATE_SIZE +                   \
+   RROSACE_FLIGHT_DYNAMICS_STATE_SIZE)
+
+/** Offset of the states of the FCCs in the state of a simulation, COM FCCs
+ * first, in doubles */
+#define RROSACE_SIM_FCCS_STATE_OFFSET                                          \
+  (RROSACE_SIM_PHYSICAL_STATE_OFFSET + RROSACE_SIM_PHYSICAL_STATE_SIZE +       \
+   RROSACE_SIM_NB_FILTERS * RROSACE_FILTER_STATE_SIZE)
+
+/** Largest number of threads of a team besides the caller, one per filter
+ * but the caller's */
+#define RROSACE_SIM_MAX_TEAM_THREADS (RROSACE_SIM_NB_FILTERS - 1)
+
+/** Mask of a stage of a simulation */
+#define RROSACE_SIM_STAGE(stage) (1U << (stage))
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @enum Semantics of the data exchanged between the models */
+enum rrosace_sim_semantics {
+  /** Outputs visible to the next models of the same tick */
+  RROSACE_SIM_IMMEDIATE,
+  /**
+   * Logical Execution Time: inputs read at release, outputs published at the
+   * deadline, one period later
+   */
+  RROSACE_SIM_LET,
+  /** LET, the cyber partition running on its own thread */
+  RROSACE_SIM_LET_CONCURRENT,
+  /** LET, each rate group running on its own thread, pinned within the
+   * affinity mask of the caller */
+  RROSACE_SIM_LET_RATE_GROUPS
+};
+
+/** @typedef Semantics of the data exchanged between the models */
+typedef enum rrosace_sim_semantics rrosace_sim_semantics_t;
+
+/** @enum Tasks of a simulation, in the execution order of a tick */
+enum rrosace_sim_task {
+  RROSACE_SIM_TASK_ELEVATOR,        /**< elevator */
+  RROSACE_SIM_TASK_ENGINE,          /**< engine */
+  RROSACE_SIM_TASK_FLIGHT_DYNAMICS, /**< flight dynamics */
+  RROSACE_SIM_TASK_H_FILTER,        /**< altitude filter */
+  RROSACE_SIM_TASK_VZ_FILTER,       /**< vertical speed filter */
+  RROSACE_SIM_TASK_VA_FILTER,       /**< true airspeed filter */
+  RROSACE_SIM_TASK_Q_FILTER,        /**< pitch rate filter */
+  RROSACE_SIM_TASK_AZ_FILTER,       /**< vertical acceleration filter */
+  RROSACE_SIM_TASK_FLIGHT_MODE,     /**< flight mode */
+  RROSACE_SIM_TASK_FCU,             /**< flight control unit */
+  RROSACE_SIM_TASK_FCCS_COM,        /**< COM FCCs */
+  RROSACE_SIM_TASK_FCCS_MON,        /**< MON FCCs */
+  RROSACE_SIM_TASK_CABLES,          /**< cables */
+  RROSACE_SIM_NB_TASKS              /**< number of tasks */
+};
+
+/** @typedef Tasks of a simulation */
+typedef enum rrosace_sim_task rrosace_sim_task_t;
+
+/** @enum Stages of a tick, tasks whose models are independent of each other
+ */
+enum rrosace_sim_stage {
+  RROSACE_SIM_STAGE_FILTERS, /**< filters, each one a model */
+  RROSACE_SIM_STAGE_FCCS,    /**< FCCs, each couple of COM and MON a model */
+  RROSACE_SIM_NB_STAGES      /**< number of stages */
+};
+
+/** @typedef Stages of a tick */
+typedef enum rrosace_sim_stage rrosace_sim_stage_t;
+
+/** @struct Costs of the stages of a tick, serial and on a team */
+struct rrosace_sim_team_costs {
+  /** Fork and join of the team, without any model, in s */
+  double fork_join;
+  /** Stage stepped by the caller, in s */
+  double serial[RROSACE_SIM_NB_STAGES];
+  /** Stage stepped by the team, in s */
+  double parallel[RROSACE_SIM_NB_STAGES];
+  /** Step of a model of the stage, in s */
+  double model[RROSACE_SIM_NB_STAGES];
+  /**
+   * Step of a model over which the stage is faster on the team, in s: the
+   * fork and join over the steps the caller no longer runs
+   */
+  double break_even[RROSACE_SIM_NB_STAGES];
+};
+
+/** @typedef Costs of the stages of a tick, serial and on a team */
+typedef struct rrosace_sim_team_costs rrosace_sim_team_costs_t;
+
+/** @struct Values exchanged between the models of a simulation */
+struct rrosace_sim_values {
+  rrosace_mode_t mode; /**< flight mode */
+  double delta_e;      /**< elevator deflection */
+  /** Elevator deflection commands of the COM FCCs */
+  double delta_e_c_partial[RROSACE_SIM_NB_FCCS_COUPLES];
+  /** Throttle commands of the COM FCCs */
+  double delta_th_c_partial[RROSACE_SIM_NB_FCCS_COUPLES];
+  /** Elevator deflection command relays of the MON FCCs */
+  rrosace_relay_state_t relay_delta_e_c[RROSACE_SIM_NB_FCCS_COUPLES];
+  /** Throttle command relays of the MON FCCs */
+  rrosace_relay_state_t relay_delta_th_c[RROSACE_SIM_NB_FCCS_COUPLES];
+  double delta_e_c;  /**< elevator deflection command */
+  double delta_th_c; /**< throttle command */
+  double t;          /**< thrust */
+  double h;          /**< altitude */
+  double vz;         /**< vertical speed */
+  double va;         /**< true airspeed */
+  double q;          /**< pitch rate */
+  double az;         /**< vertical acceleration */
+  double h_f;        /**< filtered altitude */
+  double vz_f;       /**< filtered vertical speed */
+  double va_f;       /**< filtered true airspeed */
+  double q_f;        /**< filtered pitch rate */
+  double az_f;       /**< filtered vertical acceleration */
+  /** Master in law states of the MON FCCs */
+  rrosace_master_in_law_t master_in_laws[RROSACE_SIM_NB_FCCS_COUPLES];
+  /** Master in law states of the other couple, seen by the MON FCCs */
+  rrosace_master_in_law_t other_master_in_laws[RROSACE_SIM_NB_FCCS_COUPLES];
+  double h_c;  /**< altitude command */
+  double vz_c; /**< vertical speed command */
+  double va_c; /**< true airspeed command */
+};
+
+/** @typedef Values exchanged between the models of a simulation */
+typedef struct rrosace_sim_values rrosace_sim_values_t;
+
+/** @struct Parameters of the aircraft and of the sensors of a simulation */
+struct rrosace_sim_parameters {
+  double masse;   /**< mass */
+  double i_y;     /**< pitch moment of inertia */
+  double tau;     /**< engine time constant */
+  double omega;   /**< elevator natural frequency */
+  double xi;      /**< elevator damping ratio */
+  double h_bias;  /**< altitude sensor bias */
+  double vz_bias; /**< vertical speed sensor bias */
+  double va_bias; /**< true airspeed sensor bias */
+  double q_bias;  /**< pitch rate sensor bias */
+  double az_bias; /**< vertical acceleration sensor bias */
+};
+
+/** @typedef Parameters of the aircraft and of the sensors of a simulation */
+typedef struct rrosace_sim_parameters rrosace_sim_parameters_t;
+
+/** @struct Simulation structure */
+struct rrosace_sim;
+
+/** @typedef Simulation */
+typedef struct rrosace_sim rrosace_sim_t;
+
+/**
+ * @typedef Step of a released task, delegated by a tick, which typically
+ * calls rrosace_sim_step_task
+ * @param[in,out] p_sim The simulation
+ * @param[in] task The task
+ * @param[in] dt The time step of the task, in s
+ * @param[in,out] p_arg The argument given with the step
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+typedef int (*rrosace_sim_step_t)(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                                  double dt, void *p_arg);
+
+/**
+ * @typedef Future of a branched simulation, in a process of its own, which
+ * modifies and runs its copy of the simulation
+ * @param[in,out] p_sim The copy of the simulation of the branch
+ * @param[in] branch The index of the branch
+ * @param[in,out] p_arg The argument given to the branching, a copy of it
+ * @param[out] results The results of the branch
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+typedef int (*rrosace_sim_branch_t)(rrosace_sim_t *p_sim, size_t branch,
+                                    void *p_arg, double results[]);
+
+/**
+ * @brief Create a simulation at trim, the first couple of FCCs in law
+ * @param[in] mode The flight mode
+ * @param[in] h_c The altitude command
+ * @param[in] vz_c The vertical speed command
+ * @param[in] va_c The true airspeed command
+ * @return A new simulation, NULL if failed
+ */
+rrosace_sim_t *rrosace_sim_new(rrosace_mode_t mode, double h_c, double vz_c,
+                               double va_c);
+
+/**
+ * @brief Copy a simulation in a new one, models and logical time included
+ * @param[in] p_other The simulation to copy
+ * @return A new simulation, NULL if failed
+ */
+rrosace_sim_t *rrosace_sim_copy(const rrosace_sim_t *p_other);
+
+/**
+ * @brief Destroy a simulation
+ * @param[in,out] p_sim The simulation to destroy
+ */
+void rrosace_sim_del(rrosace_sim_t *p_sim);
+
+/**
+ * @brief Set the semantics of a simulation, before its first tick
+ *
+ * With LET, the filters, flight mode, FCU and FCCs form the cyber partition,
+ * the actuators, flight dynamics and cables the physical one. Each couple of
+ * COM and MON FCCs acts as one task. The concurrent semantics has the same
+ * results as the serial one.
+ *
+ * With rate groups, the tasks of a same rate form a group. The groups only
+ * meet at the hyperperiod boundaries; in between, a group waits for another
+ * only for the outputs it reads, each published once in a slot stamped with
+ * its deadline. The results are still the serial LET ones.
+ *
+ * The team of the simulation, if any, is removed with the LET semantics.
+ *
+ * @param[in,out] p_sim The simulation
+ * @param[in] semantics The semantics
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_set_semantics(rrosace_sim_t *p_sim,
+                              rrosace_sim_semantics_t semantics);
+
+/**
+ * @brief Get the semantics of a simulation
+ * @param[in] p_sim The simulation
+ * @return The semantics
+ */
+rrosace_sim_semantics_t rrosace_sim_get_semantics(const rrosace_sim_t *p_sim);
+
+/**
+ * @brief Run a simulation for a number of physical ticks
+ * @param[in,out] p_sim The simulation
+ * @param[in] n_ticks The number of ticks to run
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_run(rrosace_sim_t *p_sim, size_t n_ticks);
+
+/**
+ * @brief Run a physical tick of a simulation, with the immediate semantics,
+ * the tasks released in a given order
+ * @param[in,out] p_sim The simulation
+ * @param[in] order The RROSACE_SIM_NB_TASKS tasks, each once, in execution
+ * order
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_run_ordered(rrosace_sim_t *p_sim,
+                            const rrosace_sim_task_t order[]);
+
+/**
+ * @brief Run a physical tick of a simulation, with the immediate semantics,
+ * each task released stepped in execution order by a given step, for an
+ * executor which measures or replaces the steps
+ * @param[in,out] p_sim The simulation
+ * @param[in] step The step of the tasks released
+ * @param[in,out] p_arg The argument of the step
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_run_delegated(rrosace_sim_t *p_sim, rrosace_sim_step_t step,
+                              void *p_arg);
+
+/**
+ * @brief Set the team of a simulation with the immediate semantics, stepping
+ * the models of some stages of a tick in parallel
+ *
+ * The threads of the team are started once and spin between the stages,
+ * yielding their core only to the threads ready on it, never sleeping: a
+ * stage is forked by a counter the caller bumps, and joined by a sense
+ * reversing barrier of the team and the caller, which steps its share of the
+ * models. The results are the serial ones. A stage pays only when its models
+ * cost more than the fork and join, which rrosace_sim_tune_team measures.
+ * The copies and the branches of the simulation run without the team.
+ *
+ * The threads are pinned on the cores of the affinity mask of the caller, but
+ * the one it runs on, and left unpinned when the mask has no other core: the
+ * simulations run concurrently are given disjoint masks to keep their teams
+ * apart.
+ *
+ * @param[in,out] p_sim The simulation
+ * @param[in] nb_threads The number of threads besides the caller, up to
+ * RROSACE_SIM_MAX_TEAM_THREADS, 0 to remove the team
+ * @param[in] stages The mask of the stages run by the team, of
+ * RROSACE_SIM_STAGE
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_set_team(rrosace_sim_t *p_sim, size_t nb_threads,
+                         unsigned int stages);
+
+/**
+ * @brief Measure the stages of a tick serial and on the team of a
+ * simulation, and leave on the team only the stages it makes faster
+ *
+ * The stages are measured with all their models released, on a copy of the
+ * simulation, which is left as is.
+ *
+ * @param[in,out] p_sim The simulation, with a team
+ * @param[in] nb_reps The number of repetitions of each measurement
+ * @param[out] p_costs The costs measured, NULL if not needed
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_tune_team(rrosace_sim_t *p_sim, size_t nb_reps,
+                          rrosace_sim_team_costs_t *p_costs);
+
+/**
+ * @brief Get the stages run by the team of a simulation
+ * @param[in] p_sim The simulation
+ * @return The mask of the stages, 0 without a team
+ */
+unsigned int rrosace_sim_get_team_stages(const rrosace_sim_t *p_sim);
+
+/**
+ * @brief Branch a simulation into futures, each one forked in a process of
+ * its own, and wait for their results
+ *
+ * A branch starts from the memory of the calling process, shared
+ * copy-on-write: the branch point copies no state, and the pages are copied
+ * as the branch writes them. Only the results come back, through a shared
+ * mapping. The simulation of the calling process is left as is. A branch
+ * runs only its calling thread, and must not wait for the other ones.
+ *
+ * @param[in] p_sim The simulation, with the immediate semantics
+ * @param[in] nb_branches The number of branches
+ * @param[in] nb_workers The largest number of branches running at once
+ * @param[in] branch The future of the branches
+ * @param[in,out] p_arg The argument of the branches
+ * @param[in] nb_results The number of results of a branch
+ * @param[out] results The results, nb_results per branch, undefined for the
+ * branches failed
+ * @return EXIT_SUCCESS if all the branches succeeded, else EXIT_FAILURE
+ */
+int rrosace_sim_branch(const rrosace_sim_t *p_sim, size_t nb_branches,
+                       size_t nb_workers, rrosace_sim_branch_t branch,
+                       void *p_arg, size_t nb_results, double results[]);
+
+/**
+ * @brief Get the state of a simulation: its values, its phase in the
+ * hyperperiod and the states of its models, not the outputs pending with LET
+ * @param[in] p_sim The simulation
+ * @param[out] state The state, RROSACE_SIM_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_get_state(const rrosace_sim_t *p_sim, double state[]);
+
+/**
+ * @brief Set the state of a simulation with the immediate semantics, as got
+ * from one with the same periods, without allocating
+ *
+ * The logical time restarts at the phase of the state, and the FCU commands
+ * at the published ones.
+ *
+ * @param[in,out] p_sim The simulation
+ * @param[in] state The state, RROSACE_SIM_STATE_SIZE doubles
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_set_state(rrosace_sim_t *p_sim, const double state[]);
+
+/**
+ * @brief Tell whether an entry of the state of a simulation is discrete: the
+ * mode, a relay, a master in law, the phase or an altitude hold switch
+ * @param[in] index The index of the entry in the state
+ * @return 1 if discrete, else 0
+ */
+int rrosace_sim_is_discrete(size_t index);
+
+/**
+ * @brief Get the period of a task of a simulation
+ * @param[in] p_sim The simulation
+ * @param[in] task The task
+ * @return The period, in physical ticks, 0 if failed
+ */
+size_t rrosace_sim_get_task_period(const rrosace_sim_t *p_sim,
+                                   rrosace_sim_task_t task);
+
+/**
+ * @brief Step a single task of a simulation, with the immediate semantics,
+ * for an executor of its own
+ *
+ * The logical time is left as is.
+ *
+ * @param[in,out] p_sim The simulation
+ * @param[in] task The task
+ * @param[in] dt The time step, in s
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_step_task(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                          double dt);
+
+/**
+ * @brief Change the FCU commands of a simulation
+ * @param[in,out] p_sim The simulation
+ * @param[in] h_c The altitude command
+ * @param[in] vz_c The vertical speed command
+ * @param[in] va_c The true airspeed command
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_set_commands(rrosace_sim_t *p_sim, double h_c, double vz_c,
+                             double va_c);
+
+/**
+ * @brief Get the nominal parameters, those of a new simulation, unbiased
+ * @param[out] p_parameters The parameters
+ */
+void rrosace_sim_nominal_parameters(rrosace_sim_parameters_t *p_parameters);
+
+/**
+ * @brief Change the parameters of a simulation, the states of its models
+ * kept; the biases are added to the measures the filters read
+ * @param[in,out] p_sim The simulation
+ * @param[in] p_parameters The parameters, copied
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_set_parameters(rrosace_sim_t *p_sim,
+                               const rrosace_sim_parameters_t *p_parameters);
+
+/**
+ * @brief Change the frequency the filters of a simulation are designed for,
+ * their states kept, for a coarse model stepped by rrosace_sim_step_task
+ *
+ * The periods of the tasks are left as is.
+ *
+ * @param[in,out] p_sim The simulation
+ * @param[in] frequency The frequency
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_set_filters_frequency(rrosace_sim_t *p_sim,
+                                      rrosace_filter_frequency_t frequency);
+
+/**
+ * @brief Get the values exchanged by the models of a simulation, the
+ * published ones with LET
+ * @param[in] p_sim The simulation
+ * @return The values, NULL if failed
+ */
+const rrosace_sim_values_t *rrosace_sim_get_values(const rrosace_sim_t *p_sim);
+
+/**
+ * @brief Overwrite the values exchanged by the models of a simulation, with
+ * the immediate semantics, to hold outputs dropped by an executor
+ * @param[in,out] p_sim The simulation
+ * @param[in] p_values The values, copied
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_sim_set_values(rrosace_sim_t *p_sim,
+                           const rrosace_sim_values_t *p_values);
+
+/**
+ * @brief Get the logical time of a simulation
+ * @param[in] p_sim The simulation
+ * @return The number of physical ticks run
+ */
+size_t rrosace_sim_get_logical_time(const rrosace_sim_t *p_sim);
+
+/**
+ * @brief Get the simulated time of a simulation
+ * @param[in] p_sim The simulation
+ * @return The simulated time, in s
+ */
+double rrosace_sim_get_time(const rrosace_sim_t *p_sim);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_SIM_H */
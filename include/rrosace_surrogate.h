@@ -0,0 +1,150 @@
+/**
+ * @file rrosace_surrogate.h
+ * @brief RROSACE Scheduling of cyber-physical system library reduced-order
+ * surrogate header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Identification of a linear ARX (AutoRegressive with eXogenous inputs)
+ * surrogate of the closed loop around trim, from batch simulation records.
+ * The surrogate answers what-if queries on constant commands, and reports
+ * when a query leaves the trust region of the identification data, in which
+ * case the full simulation has to be used.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf
+ * Publication of RROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_SURROGATE_H
+#define RROSACE_SURROGATE_H
+
+#include <stddef.h>
+
+/** Maximum number of inputs of a surrogate */
+#define RROSACE_SURROGATE_MAX_INPUTS (4)
+/** Maximum number of outputs of a surrogate */
+#define RROSACE_SURROGATE_MAX_OUTPUTS (4)
+/** Maximum ARX order of a surrogate */
+#define RROSACE_SURROGATE_MAX_ORDER (8)
+
+/** Minimum coefficient of determination of each output to trust a surrogate */
+#define RROSACE_SURROGATE_MIN_FIT (0.99)
+/** Output margin around the identified outputs range, in ratio of the range */
+#define RROSACE_SURROGATE_OUTPUT_MARGIN (0.1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @enum Validity of a surrogate query */
+enum rrosace_surrogate_validity {
+  RROSACE_SURROGATE_TRUSTED,  /**< Query inside the trust region */
+  RROSACE_SURROGATE_UNTRUSTED /**< Query outside, use the full simulation */
+};
+
+/** @typedef Alias for the validity of a surrogate query */
+typedef enum rrosace_surrogate_validity rrosace_surrogate_validity_t;
+
+/** @struct Surrogate structure */
+struct rrosace_surrogate;
+
+/** @typedef Surrogate */
+typedef struct rrosace_surrogate rrosace_surrogate_t;
+
+/**
+ * @brief Create a surrogate, not identified yet
+ * @param[in] nb_inputs The number of inputs, up to
+ * RROSACE_SURROGATE_MAX_INPUTS
+ * @param[in] nb_outputs The number of outputs, up to
+ * RROSACE_SURROGATE_MAX_OUTPUTS
+ * @param[in] order The ARX order, up to RROSACE_SURROGATE_MAX_ORDER
+ * @param[in] u_eq The inputs at trim
+ * @param[in] y_eq The outputs at trim
+ * @return A new surrogate, NULL if the dimensions are not supported
+ */
+rrosace_surrogate_t *rrosace_surrogate_new(size_t nb_inputs, size_t nb_outputs,
+                                           size_t order, const double u_eq[],
+                                           const double y_eq[]);
+
+/**
+ * @brief Copy a surrogate in a new one
+ * @param[in] p_other the surrogate to copy
+ * @return A new surrogate
+ */
+rrosace_surrogate_t *rrosace_surrogate_copy(const rrosace_surrogate_t *p_other);
+
+/**
+ * @brief Destroy a surrogate
+ * @param[in,out] p_surrogate The surrogate to destroy
+ */
+void rrosace_surrogate_del(rrosace_surrogate_t *p_surrogate);
+
+/**
+ * @brief Start a new identification record, with the loop at trim
+ * @param[in,out] p_surrogate The surrogate under identification
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_surrogate_begin_record(rrosace_surrogate_t *p_surrogate);
+
+/**
+ * @brief Add a sample of the current record to the identification data
+ * @param[in,out] p_surrogate The surrogate under identification
+ * @param[in] u The inputs applied from this sample on
+ * @param[in] y The outputs sampled
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_surrogate_add_sample(rrosace_surrogate_t *p_surrogate,
+                                 const double u[], const double y[]);
+
+/**
+ * @brief Identify the surrogate from all the samples added
+ * @param[in,out] p_surrogate The surrogate to identify
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_surrogate_identify(rrosace_surrogate_t *p_surrogate);
+
+/**
+ * @brief Get the fit of an output on the identification data
+ * @param[in] p_surrogate The identified surrogate
+ * @param[in] output The output index
+ * @return The coefficient of determination of the output, 0 if unknown
+ */
+double rrosace_surrogate_get_fit(const rrosace_surrogate_t *p_surrogate,
+                                 size_t output);
+
+/**
+ * @brief Check if a constant inputs query is inside the trust region
+ * @param[in] p_surrogate The identified surrogate
+ * @param[in] u The inputs applied from trim
+ * @param[in] nb_steps The query horizon, in samples
+ * @return RROSACE_SURROGATE_TRUSTED if inside, else RROSACE_SURROGATE_UNTRUSTED
+ */
+rrosace_surrogate_validity_t
+rrosace_surrogate_check(const rrosace_surrogate_t *p_surrogate,
+                        const double u[], size_t nb_steps);
+
+/**
+ * @brief Predict the outputs for constant inputs applied from trim
+ * @param[in] p_surrogate The identified surrogate
+ * @param[in] u The inputs applied from trim
+ * @param[in] nb_steps The query horizon, in samples
+ * @param[out] y The outputs predicted at the horizon
+ * @param[out] p_validity The validity of the prediction
+ * @return EXIT_SUCCESS if OK, else EXIT_FAILURE
+ */
+int rrosace_surrogate_predict(const rrosace_surrogate_t *p_surrogate,
+                              const double u[], size_t nb_steps, double y[],
+                              rrosace_surrogate_validity_t *p_validity);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RROSACE_SURROGATE_H */
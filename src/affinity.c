@@ -0,0 +1,81 @@
+/**
+ * @file affinity.c
+ * @brief RROSACE Scheduling of cyber-physical system library internal thread
+ * placement body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifdef __linux__
+/* Thread affinity */
+#define _GNU_SOURCE
+#else
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "affinity.h"
+
+void rrosace_pin_core(int core) {
+#ifdef __linux__
+  cpu_set_t cores;
+
+  if (core >= 0) {
+    CPU_ZERO(&cores);
+    CPU_SET(core, &cores);
+    pthread_setaffinity_np(pthread_self(), sizeof(cores), &cores);
+  }
+#else
+  (void)core;
+#endif
+}
+
+int rrosace_spread_core(size_t index, int spare) {
+  int ret = -1;
+#ifdef __linux__
+  const int current = sched_getcpu();
+  cpu_set_t cores;
+  int nb_cores;
+  int i;
+
+  if (pthread_getaffinity_np(pthread_self(), sizeof(cores), &cores)) {
+    goto out;
+  }
+  if (spare && (current >= 0)) {
+    CPU_CLR(current, &cores);
+  }
+  nb_cores = CPU_COUNT(&cores);
+  if (!nb_cores) {
+    goto out;
+  }
+
+  index %= (size_t)nb_cores;
+  for (i = 0; i < CPU_SETSIZE; ++i) {
+    const int core = ((current > 0) ? current + i : i) % CPU_SETSIZE;
+
+    if (CPU_ISSET(core, &cores) && !index--) {
+      ret = core;
+      break;
+    }
+  }
+
+out:
+#else
+  (void)index;
+  (void)spare;
+#endif
+
+  return (ret);
+}
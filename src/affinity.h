@@ -0,0 +1,43 @@
+/**
+ * @file affinity.h
+ * @brief RROSACE Scheduling of cyber-physical system library internal thread
+ * placement header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Shared by the modules pinning their threads on cores, not installed. The
+ * threads are left where they are on the systems without affinity.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_AFFINITY_H
+#define RROSACE_AFFINITY_H
+
+#include <stddef.h>
+
+/**
+ * @brief Pin the calling thread on a core
+ * @param[in] core The core, -1 to leave the thread where it is
+ */
+void rrosace_pin_core(int core);
+
+/**
+ * @brief Get the core of a thread spread over the cores the calling thread
+ * may run on, from the one it runs on, so that the threads of callers on
+ * different cores do not pile up on the first ones
+ * @param[in] index The index of the thread, wrapped around the cores
+ * @param[in] spare Leave the core of the calling thread to it
+ * @return The core, -1 when no core is allowed
+ */
+int rrosace_spread_core(size_t index, int spare);
+
+#endif /* RROSACE_AFFINITY_H */
@@ -0,0 +1,461 @@
+/**
+ * @file campaign.c
+ * @brief RROSACE Scheduling of cyber-physical system library campaign sharding
+ * body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace_campaign.h>
+
+/* Serialized results: magic, version, byte order check, number of runs,
+ * number of results and number of runs done, then the runs done in order,
+ * each with its index and results, then the checksum */
+#define MAGIC "RRCAMPR"
+#define VERSION (1)
+#define FIELD_SIZE (8)
+#define HEADER_SIZE (6 * FIELD_SIZE)
+#define CHECKSUM_SIZE (FIELD_SIZE)
+
+/* Byte order check, exactly represented, read byte reversed from a host of
+ * the other byte order */
+#define CHECK_VALUE (1.5)
+
+/* 32-bit FNV-1a */
+#define FNV_OFFSET (2166136261UL)
+#define FNV_PRIME (16777619UL)
+
+struct rrosace_campaign {
+  size_t nb_runs;
+  size_t nb_results;
+  size_t nb_done;
+  double *p_results;
+  unsigned char *p_done;
+};
+
+/* Run of a shard, given its index in the campaign */
+struct shard_run {
+  size_t first;
+  rrosace_ensemble_run_t run;
+  void *p_arg;
+};
+
+static int shard_run_func(rrosace_sim_t * /* p_sim */, size_t /* run */,
+                          void * /* p_arg */, double results[]);
+
+static void put_integer(unsigned char * /* p_field */, size_t /* value */);
+
+static int get_integer(const unsigned char * /* p_field */,
+                       size_t * /* p_value */);
+
+static void get_double(const unsigned char * /* p_field */, int /* swap */,
+                       double * /* p_value */);
+
+static unsigned long checksum(const unsigned char * /* buffer */,
+                              size_t /* size */);
+
+static int shard_run_func(rrosace_sim_t *p_sim, size_t run, void *p_arg,
+                          double results[]) {
+  const struct shard_run *p_shard_run = (const struct shard_run *)p_arg;
+
+  return (p_shard_run->run(p_sim, p_shard_run->first + run, p_shard_run->p_arg,
+                           results));
+}
+
+static void put_integer(unsigned char *p_field, size_t value) {
+  size_t i;
+
+  for (i = 0; i < FIELD_SIZE; ++i) {
+    p_field[i] = (unsigned char)(value & 0xffU);
+    value >>= 8;
+  }
+}
+
+static int get_integer(const unsigned char *p_field, size_t *p_value) {
+  int ret = EXIT_FAILURE;
+  size_t value = 0;
+  size_t i;
+
+  for (i = FIELD_SIZE; i > 0; --i) {
+    /* Too large for the host */
+    if (value > ((size_t)-1 >> 8)) {
+      goto out;
+    }
+    value = (value << 8) | p_field[i - 1];
+  }
+  *p_value = value;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+static void get_double(const unsigned char *p_field, int swap,
+                       double *p_value) {
+  unsigned char bytes[FIELD_SIZE];
+  size_t i;
+
+  for (i = 0; i < FIELD_SIZE; ++i) {
+    bytes[i] = p_field[swap ? FIELD_SIZE - 1 - i : i];
+  }
+  /* Copied, as the field is not aligned in the buffer */
+  memcpy(p_value, bytes, FIELD_SIZE);
+}
+
+static unsigned long checksum(const unsigned char *buffer, size_t size) {
+  unsigned long hash = FNV_OFFSET;
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    hash = ((hash ^ buffer[i]) * FNV_PRIME) & 0xffffffffUL;
+  }
+
+  return (hash);
+}
+
+int rrosace_campaign_get_shard(size_t nb_runs, size_t nb_shards, size_t shard,
+                               size_t *p_first, size_t *p_nb_runs) {
+  int ret = EXIT_FAILURE;
+  size_t nb_base;
+  size_t nb_extra;
+
+  if (!nb_shards || (shard >= nb_shards) || !p_first || !p_nb_runs) {
+    goto out;
+  }
+
+  /* The first shards take one more run */
+  nb_base = nb_runs / nb_shards;
+  nb_extra = nb_runs % nb_shards;
+  *p_first = shard * nb_base + ((shard < nb_extra) ? shard : nb_extra);
+  *p_nb_runs = nb_base + (shard < nb_extra);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+rrosace_campaign_t *rrosace_campaign_new(size_t nb_runs, size_t nb_results) {
+  rrosace_campaign_t *p_campaign = NULL;
+
+  if (!nb_runs || !nb_results ||
+      (nb_runs > (size_t)-1 / sizeof(double) / nb_results)) {
+    goto out;
+  }
+
+  p_campaign = (rrosace_campaign_t *)calloc(1, sizeof(rrosace_campaign_t));
+  if (!p_campaign) {
+    goto out;
+  }
+
+  p_campaign->nb_runs = nb_runs;
+  p_campaign->nb_results = nb_results;
+  p_campaign->p_results =
+      (double *)calloc(nb_runs * nb_results, sizeof(double));
+  p_campaign->p_done = (unsigned char *)calloc(nb_runs, 1);
+  if (!p_campaign->p_results || !p_campaign->p_done) {
+    rrosace_campaign_del(p_campaign);
+    p_campaign = NULL;
+  }
+
+out:
+  return (p_campaign);
+}
+
+void rrosace_campaign_del(rrosace_campaign_t *p_campaign) {
+  if (p_campaign) {
+    free(p_campaign->p_done);
+    free(p_campaign->p_results);
+    free(p_campaign);
+  }
+}
+
+int rrosace_campaign_run_shard(rrosace_campaign_t *p_campaign,
+                               const rrosace_sim_t *p_sim, size_t nb_shards,
+                               size_t shard, size_t nb_workers,
+                               rrosace_ensemble_run_t run, void *p_arg) {
+  int ret = EXIT_FAILURE;
+  rrosace_ensemble_t *p_ensemble = NULL;
+  struct shard_run shard_run;
+  size_t nb_runs;
+  size_t i;
+
+  if (!p_campaign || !run ||
+      (rrosace_campaign_get_shard(p_campaign->nb_runs, nb_shards, shard,
+                                  &shard_run.first,
+                                  &nb_runs) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (i = 0; i < nb_runs; ++i) {
+    if (p_campaign->p_done[shard_run.first + i]) {
+      goto out;
+    }
+  }
+
+  shard_run.run = run;
+  shard_run.p_arg = p_arg;
+
+  p_ensemble = rrosace_ensemble_new(p_sim, nb_workers, p_campaign->nb_results);
+  if (!p_ensemble ||
+      (rrosace_ensemble_start(p_ensemble, nb_runs, shard_run_func,
+                              &shard_run) == EXIT_FAILURE) ||
+      (rrosace_ensemble_wait(p_ensemble) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (i = 0; i < nb_runs; ++i) {
+    if (rrosace_campaign_set_results(
+            p_campaign, shard_run.first + i,
+            rrosace_ensemble_get_results(p_ensemble, i)) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_ensemble_del(p_ensemble);
+
+  return (ret);
+}
+
+int rrosace_campaign_set_results(rrosace_campaign_t *p_campaign, size_t run,
+                                 const double results[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_campaign || (run >= p_campaign->nb_runs) || p_campaign->p_done[run] ||
+      !results) {
+    goto out;
+  }
+
+  memcpy(&p_campaign->p_results[run * p_campaign->nb_results], results,
+         p_campaign->nb_results * sizeof(double));
+  p_campaign->p_done[run] = 1;
+  ++p_campaign->nb_done;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+const double *rrosace_campaign_get_results(const rrosace_campaign_t *p_campaign,
+                                           size_t run) {
+  return ((p_campaign && (run < p_campaign->nb_runs) &&
+           p_campaign->p_done[run])
+              ? &p_campaign->p_results[run * p_campaign->nb_results]
+              : NULL);
+}
+
+size_t rrosace_campaign_get_nb_done(const rrosace_campaign_t *p_campaign) {
+  return (p_campaign ? p_campaign->nb_done : 0);
+}
+
+int rrosace_campaign_merge(rrosace_campaign_t *p_campaign,
+                           const rrosace_campaign_t *p_other) {
+  int ret = EXIT_FAILURE;
+  size_t run;
+
+  if (!p_campaign || !p_other || (p_campaign == p_other) ||
+      (p_campaign->nb_runs != p_other->nb_runs) ||
+      (p_campaign->nb_results != p_other->nb_results)) {
+    goto out;
+  }
+
+  /* Nothing merged if a run is in both */
+  for (run = 0; run < p_campaign->nb_runs; ++run) {
+    if (p_campaign->p_done[run] && p_other->p_done[run]) {
+      goto out;
+    }
+  }
+
+  for (run = 0; run < p_campaign->nb_runs; ++run) {
+    if (p_other->p_done[run]) {
+      rrosace_campaign_set_results(
+          p_campaign, run, &p_other->p_results[run * p_other->nb_results]);
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_campaign_get_stats(const rrosace_campaign_t *p_campaign,
+                               size_t result, double *p_mean, double *p_min,
+                               double *p_max) {
+  int ret = EXIT_FAILURE;
+  double sum = 0.;
+  size_t nb_seen = 0;
+  size_t run;
+
+  if (!p_campaign || !p_campaign->nb_done ||
+      (result >= p_campaign->nb_results) || !p_mean || !p_min || !p_max) {
+    goto out;
+  }
+
+  for (run = 0; run < p_campaign->nb_runs; ++run) {
+    if (p_campaign->p_done[run]) {
+      const double value =
+          p_campaign->p_results[run * p_campaign->nb_results + result];
+
+      if (!nb_seen++) {
+        *p_min = value;
+        *p_max = value;
+      }
+      *p_min = (value < *p_min) ? value : *p_min;
+      *p_max = (value > *p_max) ? value : *p_max;
+      sum += value;
+    }
+  }
+  *p_mean = sum / (double)p_campaign->nb_done;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+size_t rrosace_campaign_get_size(const rrosace_campaign_t *p_campaign) {
+  return (p_campaign
+              ? HEADER_SIZE +
+                    p_campaign->nb_done *
+                        (FIELD_SIZE + p_campaign->nb_results * sizeof(double)) +
+                    CHECKSUM_SIZE
+              : 0);
+}
+
+int rrosace_campaign_write(const rrosace_campaign_t *p_campaign,
+                           unsigned char buffer[], size_t size) {
+  int ret = EXIT_FAILURE;
+  const double check = CHECK_VALUE;
+  unsigned char *p_field = buffer;
+  size_t run;
+
+  if (!p_campaign || !buffer || (sizeof(double) != FIELD_SIZE) ||
+      (size < rrosace_campaign_get_size(p_campaign))) {
+    goto out;
+  }
+
+  memcpy(p_field, MAGIC, FIELD_SIZE);
+  put_integer(p_field += FIELD_SIZE, VERSION);
+  memcpy(p_field += FIELD_SIZE, &check, FIELD_SIZE);
+  put_integer(p_field += FIELD_SIZE, p_campaign->nb_runs);
+  put_integer(p_field += FIELD_SIZE, p_campaign->nb_results);
+  put_integer(p_field += FIELD_SIZE, p_campaign->nb_done);
+  p_field += FIELD_SIZE;
+
+  for (run = 0; run < p_campaign->nb_runs; ++run) {
+    if (p_campaign->p_done[run]) {
+      put_integer(p_field, run);
+      p_field += FIELD_SIZE;
+      memcpy(p_field, &p_campaign->p_results[run * p_campaign->nb_results],
+             p_campaign->nb_results * sizeof(double));
+      p_field += p_campaign->nb_results * sizeof(double);
+    }
+  }
+
+  put_integer(p_field, checksum(buffer, (size_t)(p_field - buffer)));
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+rrosace_campaign_t *rrosace_campaign_read(const unsigned char buffer[],
+                                          size_t size) {
+  rrosace_campaign_t *p_campaign = NULL;
+  const unsigned char *p_field = buffer;
+  double check;
+  int swap;
+  size_t version;
+  size_t nb_runs;
+  size_t nb_results;
+  size_t nb_done;
+  size_t record_size;
+  size_t sum;
+  size_t previous = 0;
+  size_t i;
+
+  if (!buffer || (sizeof(double) != FIELD_SIZE) ||
+      (size < HEADER_SIZE + CHECKSUM_SIZE) ||
+      memcmp(p_field, MAGIC, FIELD_SIZE) ||
+      (get_integer(p_field += FIELD_SIZE, &version) == EXIT_FAILURE) ||
+      (version != VERSION)) {
+    goto out;
+  }
+
+  /* Results converted if written on a host of the other byte order */
+  get_double(p_field += FIELD_SIZE, 0, &check);
+  swap = (check != CHECK_VALUE);
+  if (swap) {
+    get_double(p_field, 1, &check);
+  }
+  if ((check != CHECK_VALUE) ||
+      (get_integer(p_field += FIELD_SIZE, &nb_runs) == EXIT_FAILURE) ||
+      (get_integer(p_field += FIELD_SIZE, &nb_results) == EXIT_FAILURE) ||
+      (get_integer(p_field += FIELD_SIZE, &nb_done) == EXIT_FAILURE) ||
+      (get_integer(&buffer[size - CHECKSUM_SIZE], &sum) == EXIT_FAILURE) ||
+      (sum != checksum(buffer, size - CHECKSUM_SIZE))) {
+    goto out;
+  }
+  p_field += FIELD_SIZE;
+
+  /* Size checked before allocating the runs */
+  if (!nb_results || (nb_results > (size_t)-1 / sizeof(double) - 1)) {
+    goto out;
+  }
+  record_size = FIELD_SIZE + nb_results * sizeof(double);
+  if ((nb_done > nb_runs) ||
+      ((size - HEADER_SIZE - CHECKSUM_SIZE) % record_size) ||
+      (nb_done != (size - HEADER_SIZE - CHECKSUM_SIZE) / record_size)) {
+    goto out;
+  }
+
+  p_campaign = rrosace_campaign_new(nb_runs, nb_results);
+  if (!p_campaign) {
+    goto out;
+  }
+
+  for (i = 0; i < nb_done; ++i) {
+    size_t run;
+    size_t result;
+
+    /* Runs in increasing order, so that none is repeated */
+    if ((get_integer(p_field, &run) == EXIT_FAILURE) || (run >= nb_runs) ||
+        (i && (run <= previous))) {
+      rrosace_campaign_del(p_campaign);
+      p_campaign = NULL;
+      goto out;
+    }
+    p_field += FIELD_SIZE;
+    for (result = 0; result < nb_results; ++result) {
+      get_double(p_field, swap,
+                 &p_campaign->p_results[run * nb_results + result]);
+      p_field += FIELD_SIZE;
+    }
+    p_campaign->p_done[run] = 1;
+    ++p_campaign->nb_done;
+    previous = run;
+  }
+
+out:
+  return (p_campaign);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file delay_line.c
+ * @brief RROSACE Scheduling of cyber-physical system library transport delay
+ * line body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace_delay_line.h>
+
+/* The ring follows the line in the same block, so that a short one shares
+ * the cache line of its indices */
+struct rrosace_delay_line {
+  /* Size of the ring minus one, the size a power of two */
+  size_t mask;
+  /* Next slot written */
+  size_t head;
+  size_t nb_ticks;
+  double *ring;
+};
+
+static size_t ring_size(size_t /* nb_ticks */);
+
+/**
+ * @brief Smallest power of two above a delay
+ */
+static size_t ring_size(size_t nb_ticks) {
+  size_t size = 1;
+
+  while (size <= nb_ticks) {
+    size <<= 1;
+  }
+
+  return (size);
+}
+
+rrosace_delay_line_t *rrosace_delay_line_new(size_t nb_ticks, double initial) {
+  rrosace_delay_line_t *p_delay_line = NULL;
+  size_t size;
+
+  if (nb_ticks > RROSACE_DELAY_LINE_MAX_TICKS) {
+    goto out;
+  }
+
+  size = ring_size(nb_ticks);
+  p_delay_line = (rrosace_delay_line_t *)malloc(sizeof(rrosace_delay_line_t) +
+                                                size * sizeof(double));
+  if (!p_delay_line) {
+    goto out;
+  }
+
+  p_delay_line->mask = size - 1;
+  p_delay_line->head = 0;
+  p_delay_line->nb_ticks = nb_ticks;
+  p_delay_line->ring = (double *)(p_delay_line + 1);
+  rrosace_delay_line_reset(p_delay_line, initial);
+
+out:
+  return (p_delay_line);
+}
+
+rrosace_delay_line_t *
+rrosace_delay_line_copy(const rrosace_delay_line_t *p_other) {
+  rrosace_delay_line_t *p_delay_line = NULL;
+
+  if (!p_other) {
+    goto out;
+  }
+
+  p_delay_line = rrosace_delay_line_new(p_other->nb_ticks, 0.);
+  if (!p_delay_line) {
+    goto out;
+  }
+
+  p_delay_line->head = p_other->head;
+  memcpy(p_delay_line->ring, p_other->ring,
+         (p_other->mask + 1) * sizeof(double));
+
+out:
+  return (p_delay_line);
+}
+
+void rrosace_delay_line_del(rrosace_delay_line_t *p_delay_line) {
+  free(p_delay_line);
+}
+
+int rrosace_delay_line_reset(rrosace_delay_line_t *p_delay_line,
+                             double value) {
+  int ret = EXIT_FAILURE;
+  size_t i;
+
+  if (!p_delay_line) {
+    goto out;
+  }
+
+  for (i = 0; i <= p_delay_line->mask; ++i) {
+    p_delay_line->ring[i] = value;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+size_t
+rrosace_delay_line_get_nb_ticks(const rrosace_delay_line_t *p_delay_line) {
+  return (p_delay_line ? p_delay_line->nb_ticks : 0);
+}
+
+int rrosace_delay_line_step(rrosace_delay_line_t *p_delay_line, double in,
+                            double *p_out) {
+  int ret = EXIT_FAILURE;
+  size_t head;
+
+  if (!p_delay_line || !p_out) {
+    goto out;
+  }
+
+  head = p_delay_line->head;
+  p_delay_line->ring[head] = in;
+  *p_out = p_delay_line->ring[(head - p_delay_line->nb_ticks) &
+                              p_delay_line->mask];
+  p_delay_line->head = (head + 1) & p_delay_line->mask;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
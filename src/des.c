@@ -0,0 +1,327 @@
+/**
+ * @file des.c
+ * @brief RROSACE Scheduling of cyber-physical system library discrete-event
+ * executor body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <rrosace_constants.h>
+#include <rrosace_des.h>
+
+#include "random.h"
+
+#define NSEC_PER_SEC (1000000000UL)
+#define MASK_32 (0xFFFFFFFFUL)
+
+/* Instant, in integer nanoseconds */
+struct instant {
+  unsigned long sec;
+  unsigned long nsec;
+};
+
+/* Next release of a task */
+struct event {
+  struct instant release;
+  size_t task;
+};
+
+struct timing {
+  unsigned long period;
+  unsigned long offset;
+  unsigned long jitter;
+  rrosace_des_delay_t delay;
+  void *p_delay_arg;
+  /* Release before jitter */
+  struct instant nominal;
+  /* Previous release */
+  struct instant last;
+  int released;
+};
+
+struct rrosace_des {
+  rrosace_sim_t *p_sim;
+  struct timing timings[RROSACE_SIM_NB_TASKS];
+  /* Binary min-heap of the next releases, one per task */
+  struct event heap[RROSACE_SIM_NB_TASKS];
+  size_t heap_size;
+  int started;
+  struct instant now;
+  size_t nb_events;
+  unsigned long random_state;
+};
+
+static void add(struct instant * /* p_instant */, unsigned long /* ns */);
+
+static unsigned long elapsed(const struct instant * /* p_a */,
+                             const struct instant * /* p_b */);
+
+static int earlier(const struct event * /* p_a */,
+                   const struct event * /* p_b */);
+
+static void sift_up(rrosace_des_t * /* p_des */, size_t /* index */);
+
+static void sift_down(rrosace_des_t * /* p_des */, size_t /* index */);
+
+static struct event next_event(rrosace_des_t * /* p_des */,
+                               size_t /* task */);
+
+static void start(rrosace_des_t * /* p_des */);
+
+static void add(struct instant *p_instant, unsigned long ns) {
+  p_instant->sec += ns / NSEC_PER_SEC;
+  p_instant->nsec += ns % NSEC_PER_SEC;
+  if (p_instant->nsec >= NSEC_PER_SEC) {
+    ++p_instant->sec;
+    p_instant->nsec -= NSEC_PER_SEC;
+  }
+}
+
+/**
+ * @brief Nanoseconds from an instant to a later and close one
+ */
+static unsigned long elapsed(const struct instant *p_a,
+                             const struct instant *p_b) {
+  return ((p_b->sec - p_a->sec) * NSEC_PER_SEC + p_b->nsec - p_a->nsec);
+}
+
+/**
+ * @brief Release order, the ties in the tick order
+ */
+static int earlier(const struct event *p_a, const struct event *p_b) {
+  if (p_a->release.sec != p_b->release.sec) {
+    return (p_a->release.sec < p_b->release.sec);
+  }
+  if (p_a->release.nsec != p_b->release.nsec) {
+    return (p_a->release.nsec < p_b->release.nsec);
+  }
+
+  return (p_a->task < p_b->task);
+}
+
+static void sift_up(rrosace_des_t *p_des, size_t index) {
+  struct event *heap = p_des->heap;
+
+  while (index) {
+    const size_t parent = (index - 1) / 2;
+    struct event swap;
+
+    if (!earlier(&heap[index], &heap[parent])) {
+      break;
+    }
+    swap = heap[index];
+    heap[index] = heap[parent];
+    heap[parent] = swap;
+    index = parent;
+  }
+}
+
+static void sift_down(rrosace_des_t *p_des, size_t index) {
+  struct event *heap = p_des->heap;
+
+  for (;;) {
+    const size_t left = 2 * index + 1;
+    size_t smallest = index;
+    struct event swap;
+
+    if ((left < p_des->heap_size) && earlier(&heap[left], &heap[smallest])) {
+      smallest = left;
+    }
+    if ((left + 1 < p_des->heap_size) &&
+        earlier(&heap[left + 1], &heap[smallest])) {
+      smallest = left + 1;
+    }
+    if (smallest == index) {
+      break;
+    }
+    swap = heap[index];
+    heap[index] = heap[smallest];
+    heap[smallest] = swap;
+    index = smallest;
+  }
+}
+
+/**
+ * @brief Next release of a task, from its nominal one
+ */
+static struct event next_event(rrosace_des_t *p_des, size_t task) {
+  const struct timing *p_timing = &p_des->timings[task];
+  struct event event;
+
+  event.release = p_timing->nominal;
+  event.task = task;
+  if (p_timing->jitter) {
+    add(&event.release,
+        rrosace_random_next(&p_des->random_state) % (p_timing->jitter + 1));
+  }
+  if (p_timing->delay) {
+    add(&event.release,
+        p_timing->delay(p_timing->p_delay_arg, (rrosace_sim_task_t)task));
+  }
+  /* A release never precedes the previous one of its task */
+  if (p_timing->released) {
+    struct event last;
+
+    last.release = p_timing->last;
+    last.task = task;
+    if (earlier(&event, &last)) {
+      event.release = p_timing->last;
+    }
+  }
+
+  return (event);
+}
+
+static void start(rrosace_des_t *p_des) {
+  size_t task;
+
+  for (task = 0; task < RROSACE_SIM_NB_TASKS; ++task) {
+    struct timing *p_timing = &p_des->timings[task];
+
+    p_timing->nominal.sec = 0;
+    p_timing->nominal.nsec = 0;
+    add(&p_timing->nominal, p_timing->offset);
+    p_des->heap[p_des->heap_size] = next_event(p_des, task);
+    sift_up(p_des, p_des->heap_size++);
+  }
+
+  p_des->started = 1;
+}
+
+rrosace_des_t *rrosace_des_new(rrosace_sim_t *p_sim, unsigned long seed) {
+  rrosace_des_t *p_des = NULL;
+  size_t task;
+
+  if (!p_sim || (rrosace_sim_get_semantics(p_sim) != RROSACE_SIM_IMMEDIATE)) {
+    goto out;
+  }
+
+  p_des = (rrosace_des_t *)calloc(1, sizeof(rrosace_des_t));
+  if (!p_des) {
+    goto out;
+  }
+
+  p_des->p_sim = p_sim;
+  p_des->random_state = seed & MASK_32;
+
+  for (task = 0; task < RROSACE_SIM_NB_TASKS; ++task) {
+    p_des->timings[task].period =
+        (unsigned long)rrosace_sim_get_task_period(p_sim,
+                                                   (rrosace_sim_task_t)task) *
+        (NSEC_PER_SEC / RROSACE_DEFAULT_PHYSICAL_FREQ);
+  }
+
+out:
+  return (p_des);
+}
+
+void rrosace_des_del(rrosace_des_t *p_des) { free(p_des); }
+
+int rrosace_des_set_timing(rrosace_des_t *p_des, rrosace_sim_task_t task,
+                           unsigned long period, unsigned long offset,
+                           unsigned long jitter) {
+  int ret = EXIT_FAILURE;
+  struct timing *p_timing;
+
+  if (!p_des || p_des->started || ((size_t)task >= RROSACE_SIM_NB_TASKS) ||
+      !period || (jitter >= period)) {
+    goto out;
+  }
+
+  p_timing = &p_des->timings[task];
+  p_timing->period = period;
+  p_timing->offset = offset;
+  p_timing->jitter = jitter;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_des_set_delay(rrosace_des_t *p_des, rrosace_sim_task_t task,
+                          rrosace_des_delay_t delay, void *p_arg) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_des || p_des->started || ((size_t)task >= RROSACE_SIM_NB_TASKS)) {
+    goto out;
+  }
+
+  p_des->timings[task].delay = delay;
+  p_des->timings[task].p_delay_arg = p_arg;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_des_run_until(rrosace_des_t *p_des, double t) {
+  int ret = EXIT_FAILURE;
+  struct event end;
+
+  if (!p_des || !(t >= 0.)) {
+    goto out;
+  }
+
+  if (!p_des->started) {
+    start(p_des);
+  }
+
+  end.release.sec = (unsigned long)floor(t);
+  end.release.nsec = 0;
+  add(&end.release, (unsigned long)((t - floor(t)) * NSEC_PER_SEC + 0.5));
+  end.task = 0;
+
+  ret = EXIT_SUCCESS;
+  while ((ret == EXIT_SUCCESS) && earlier(&p_des->heap[0], &end)) {
+    const size_t task = p_des->heap[0].task;
+    struct timing *p_timing = &p_des->timings[task];
+    const struct instant release = p_des->heap[0].release;
+    const unsigned long dt = p_timing->released
+                                 ? elapsed(&p_timing->last, &release)
+                                 : p_timing->period;
+
+    ret = rrosace_sim_step_task(p_des->p_sim, (rrosace_sim_task_t)task,
+                                (double)dt / NSEC_PER_SEC);
+
+    p_timing->last = release;
+    p_timing->released = 1;
+    add(&p_timing->nominal, p_timing->period);
+    p_des->heap[0] = next_event(p_des, task);
+    sift_down(p_des, 0);
+    ++p_des->nb_events;
+  }
+
+  if ((end.release.sec > p_des->now.sec) ||
+      ((end.release.sec == p_des->now.sec) &&
+       (end.release.nsec > p_des->now.nsec))) {
+    p_des->now = end.release;
+  }
+
+out:
+  return (ret);
+}
+
+double rrosace_des_get_time(const rrosace_des_t *p_des) {
+  return (p_des ? (double)p_des->now.sec +
+                      (double)p_des->now.nsec / NSEC_PER_SEC
+                : 0.);
+}
+
+size_t rrosace_des_get_nb_events(const rrosace_des_t *p_des) {
+  return (p_des ? p_des->nb_events : 0);
+}
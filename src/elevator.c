@@ -66,6 +66,40 @@ void rrosace_elevator_del(rrosace_elevator_t *p_elevator) {
   }
 }
 
+int rrosace_elevator_get_state(const rrosace_elevator_t *p_elevator,
+                               double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_elevator || !state) {
+    goto out;
+  }
+
+  state[0] = p_elevator->x[0];
+  state[1] = p_elevator->x[1];
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_elevator_set_state(rrosace_elevator_t *p_elevator,
+                               const double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_elevator || !state) {
+    goto out;
+  }
+
+  p_elevator->x[0] = state[0];
+  p_elevator->x[1] = state[1];
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
 int rrosace_elevator_step(rrosace_elevator_t *p_elevator, double delta_e_c,
                           double *p_delta_e, double dt) {
   int ret = EXIT_FAILURE;
@@ -60,6 +60,36 @@ void rrosace_engine_del(rrosace_engine_t *p_engine) {
   }
 }
 
+int rrosace_engine_get_state(const rrosace_engine_t *p_engine, double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_engine || !state) {
+    goto out;
+  }
+
+  state[0] = p_engine->x;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_engine_set_state(rrosace_engine_t *p_engine, const double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_engine || !state) {
+    goto out;
+  }
+
+  p_engine->x = state[0];
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
 int rrosace_engine_step(rrosace_engine_t *p_engine, double delta_th_c,
                         double *p_t, double dt) {
   int ret = EXIT_FAILURE;
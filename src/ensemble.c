@@ -0,0 +1,590 @@
+/**
+ * @file ensemble.c
+ * @brief RROSACE Scheduling of cyber-physical system library ensemble runner
+ * body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifdef __linux__
+/* Thread pinning of the workers, anonymous and huge page mappings */
+#define _GNU_SOURCE
+#else
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <rrosace_ensemble.h>
+
+#include "affinity.h"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/* Size of a cache line, so that workers do not share one */
+#define CACHE_LINE (64)
+
+/* No run */
+#define NO_RUN ((size_t)-1)
+
+/* Worker, alone in its arena */
+struct worker {
+  /* Deque of the runs [top, bottom), stolen from the top */
+  long top;
+  char top_padding[CACHE_LINE - sizeof(long)];
+  /* Popped from the bottom by the worker only */
+  long bottom;
+  char bottom_padding[CACHE_LINE - sizeof(long)];
+  rrosace_ensemble_t *p_ensemble;
+  size_t index;
+  /* Core in the affinity mask of the creating thread, -1 if none */
+  int core;
+  rrosace_sim_t *p_sim;
+  pthread_t thread;
+  int started;
+  size_t nb_runs;
+  size_t nb_steals;
+  /* Arena of the runs, within the mapping */
+  void *p_arena;
+  void *p_mapping;
+  size_t mapped;
+  /* Mapping on reserved huge pages */
+  int huge;
+  /* Whether the simulation and arena were placed */
+  int placed;
+};
+
+struct rrosace_ensemble {
+  double initial_state[RROSACE_SIM_STATE_SIZE];
+  struct worker *p_workers[RROSACE_ENSEMBLE_MAX_WORKERS];
+  size_t nb_workers;
+  size_t nb_results;
+  size_t nb_runs;
+  rrosace_ensemble_run_t run;
+  void *p_arg;
+  double *p_results;
+  /* Collector: stack of the finished runs, linked by their indices */
+  size_t *p_next;
+  size_t head;
+  /* Runs taken from the collector and not yet returned by collect */
+  size_t pending;
+  int running;
+  int ret;
+  rrosace_ensemble_placement_t placement;
+  /* Initial simulation, while the workers are placed */
+  const rrosace_sim_t *p_initial;
+};
+
+static size_t pop(struct worker * /* p_worker */);
+
+static size_t steal(struct worker * /* p_thief */,
+                    struct worker * /* p_victim */);
+
+static size_t steal_any(struct worker * /* p_thief */);
+
+static void push_finished(rrosace_ensemble_t * /* p_ensemble */,
+                          size_t /* run */);
+
+static void *worker_main(void * /* p_arg */);
+
+static int map_arena(struct worker * /* p_worker */, size_t /* size */,
+                     int /* huge_pages */);
+
+static int place(struct worker * /* p_worker */);
+
+static void *place_main(void * /* p_arg */);
+
+/**
+ * @brief Take the last run of the deque of a worker, racing the thieves for
+ * the very last one
+ */
+static size_t pop(struct worker *p_worker) {
+  const long bottom = __atomic_load_n(&p_worker->bottom, __ATOMIC_RELAXED) - 1;
+  long top;
+  size_t run = NO_RUN;
+
+  __atomic_store_n(&p_worker->bottom, bottom, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  top = __atomic_load_n(&p_worker->top, __ATOMIC_RELAXED);
+
+  if (top < bottom) {
+    return ((size_t)bottom);
+  }
+
+  if ((top == bottom) &&
+      __atomic_compare_exchange_n(&p_worker->top, &top, top + 1, 0,
+                                  __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+    run = (size_t)bottom;
+  }
+  __atomic_store_n(&p_worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+  return (run);
+}
+
+/**
+ * @brief Take the first run of the deque of another worker
+ */
+static size_t steal(struct worker *p_thief, struct worker *p_victim) {
+  for (;;) {
+    long top = __atomic_load_n(&p_victim->top, __ATOMIC_ACQUIRE);
+    long bottom;
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    bottom = __atomic_load_n(&p_victim->bottom, __ATOMIC_ACQUIRE);
+
+    if (top >= bottom) {
+      return (NO_RUN);
+    }
+    if (__atomic_compare_exchange_n(&p_victim->top, &top, top + 1, 0,
+                                    __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+      ++p_thief->nb_steals;
+      return ((size_t)top);
+    }
+  }
+}
+
+/**
+ * @brief Steal from the next workers in turn, runs never being added back
+ * once all the deques are seen empty
+ */
+static size_t steal_any(struct worker *p_thief) {
+  const rrosace_ensemble_t *p_ensemble = p_thief->p_ensemble;
+  size_t i;
+
+  for (i = 1; i < p_ensemble->nb_workers; ++i) {
+    struct worker *p_victim =
+        p_ensemble->p_workers[(p_thief->index + i) % p_ensemble->nb_workers];
+    const size_t run = steal(p_thief, p_victim);
+
+    if (run != NO_RUN) {
+      return (run);
+    }
+  }
+
+  return (NO_RUN);
+}
+
+static void push_finished(rrosace_ensemble_t *p_ensemble, size_t run) {
+  size_t head = __atomic_load_n(&p_ensemble->head, __ATOMIC_RELAXED);
+
+  do {
+    p_ensemble->p_next[run] = head;
+  } while (!__atomic_compare_exchange_n(&p_ensemble->head, &head, run, 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+static void *worker_main(void *p_arg) {
+  struct worker *p_worker = (struct worker *)p_arg;
+  rrosace_ensemble_t *p_ensemble = p_worker->p_ensemble;
+
+  rrosace_pin_core(p_worker->core);
+
+  for (;;) {
+    size_t run = pop(p_worker);
+
+    if (run == NO_RUN) {
+      run = steal_any(p_worker);
+      if (run == NO_RUN) {
+        break;
+      }
+    }
+
+    if ((rrosace_sim_set_state(p_worker->p_sim, p_ensemble->initial_state) ==
+         EXIT_FAILURE) ||
+        (p_ensemble->run(p_worker->p_sim, run, p_ensemble->p_arg,
+                         &p_ensemble->p_results[run *
+                                                p_ensemble->nb_results]) ==
+         EXIT_FAILURE)) {
+      __atomic_store_n(&p_ensemble->ret, EXIT_FAILURE, __ATOMIC_RELAXED);
+    }
+    ++p_worker->nb_runs;
+
+    push_finished(p_ensemble, run);
+  }
+
+  return (NULL);
+}
+
+/**
+ * @brief Map the arena of a worker, and touch it from the calling thread
+ */
+static int map_arena(struct worker *p_worker, size_t size, int huge_pages) {
+  int ret = EXIT_FAILURE;
+  size_t mapped = size;
+  void *p_mapping = MAP_FAILED;
+
+  if (huge_pages) {
+    mapped = (size + RROSACE_ENSEMBLE_HUGE_PAGE - 1) /
+             RROSACE_ENSEMBLE_HUGE_PAGE * RROSACE_ENSEMBLE_HUGE_PAGE;
+#ifdef MAP_HUGETLB
+    p_mapping = mmap(NULL, mapped, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    p_worker->huge = (p_mapping != MAP_FAILED);
+#endif
+  }
+
+  if (p_mapping == MAP_FAILED) {
+    /* Transparent huge pages need an aligned arena, one more page mapped to
+     * align it */
+    if (huge_pages) {
+      mapped += RROSACE_ENSEMBLE_HUGE_PAGE;
+    }
+    p_mapping = mmap(NULL, mapped, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p_mapping == MAP_FAILED) {
+      goto out;
+    }
+  }
+
+  p_worker->p_mapping = p_mapping;
+  p_worker->mapped = mapped;
+  p_worker->p_arena = p_mapping;
+
+  if (huge_pages && !p_worker->huge) {
+    const size_t misalignment =
+        (size_t)p_mapping % RROSACE_ENSEMBLE_HUGE_PAGE;
+
+    if (misalignment) {
+      p_worker->p_arena =
+          (char *)p_mapping + (RROSACE_ENSEMBLE_HUGE_PAGE - misalignment);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(p_worker->p_arena, mapped - RROSACE_ENSEMBLE_HUGE_PAGE,
+            MADV_HUGEPAGE);
+#endif
+  }
+
+  /* First touch, on the NUMA node of the calling thread */
+  memset(p_worker->p_arena, 0, size);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+/**
+ * @brief Allocate the simulation and arena of a worker
+ */
+static int place(struct worker *p_worker) {
+  const rrosace_ensemble_t *p_ensemble = p_worker->p_ensemble;
+  const rrosace_ensemble_placement_t *p_placement = &p_ensemble->placement;
+
+  p_worker->p_sim = rrosace_sim_copy(p_ensemble->p_initial);
+
+  return ((p_worker->p_sim &&
+           (!p_placement->arena_size ||
+            (map_arena(p_worker, p_placement->arena_size,
+                       p_placement->huge_pages) == EXIT_SUCCESS)))
+              ? EXIT_SUCCESS
+              : EXIT_FAILURE);
+}
+
+/**
+ * @brief Place a worker from its thread, pinned on the core it runs on
+ */
+static void *place_main(void *p_arg) {
+  struct worker *p_worker = (struct worker *)p_arg;
+
+  rrosace_pin_core(p_worker->core);
+  p_worker->placed = place(p_worker);
+
+  return (NULL);
+}
+
+int rrosace_ensemble_default_placement(
+    rrosace_ensemble_placement_t *p_placement) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_placement) {
+    goto out;
+  }
+
+  p_placement->local = 1;
+  p_placement->arena_size = 0;
+  p_placement->huge_pages = 0;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+rrosace_ensemble_t *rrosace_ensemble_new(const rrosace_sim_t *p_sim,
+                                         size_t nb_workers, size_t nb_results) {
+  rrosace_ensemble_placement_t placement;
+
+  rrosace_ensemble_default_placement(&placement);
+
+  return (rrosace_ensemble_new_placed(p_sim, nb_workers, nb_results,
+                                      &placement));
+}
+
+rrosace_ensemble_t *
+rrosace_ensemble_new_placed(const rrosace_sim_t *p_sim, size_t nb_workers,
+                            size_t nb_results,
+                            const rrosace_ensemble_placement_t *p_placement) {
+  rrosace_ensemble_t *p_ensemble = NULL;
+  size_t worker;
+
+  if (!p_sim || (rrosace_sim_get_semantics(p_sim) != RROSACE_SIM_IMMEDIATE) ||
+      !nb_workers || (nb_workers > RROSACE_ENSEMBLE_MAX_WORKERS) ||
+      !p_placement) {
+    goto out;
+  }
+
+  p_ensemble = (rrosace_ensemble_t *)calloc(1, sizeof(rrosace_ensemble_t));
+  if (!p_ensemble) {
+    goto out;
+  }
+
+  p_ensemble->nb_results = nb_results;
+  p_ensemble->head = NO_RUN;
+  p_ensemble->pending = NO_RUN;
+  p_ensemble->ret = EXIT_SUCCESS;
+  p_ensemble->placement = *p_placement;
+
+  if (rrosace_sim_get_state(p_sim, p_ensemble->initial_state) ==
+      EXIT_FAILURE) {
+    rrosace_ensemble_del(p_ensemble);
+    p_ensemble = NULL;
+    goto out;
+  }
+
+  for (worker = 0; worker < nb_workers; ++worker) {
+    void *p_arena;
+
+    if (posix_memalign(&p_arena, CACHE_LINE, sizeof(struct worker))) {
+      rrosace_ensemble_del(p_ensemble);
+      p_ensemble = NULL;
+      goto out;
+    }
+    memset(p_arena, 0, sizeof(struct worker));
+    p_ensemble->p_workers[worker] = (struct worker *)p_arena;
+    ++p_ensemble->nb_workers;
+
+    p_ensemble->p_workers[worker]->p_ensemble = p_ensemble;
+    p_ensemble->p_workers[worker]->index = worker;
+    p_ensemble->p_workers[worker]->core = rrosace_spread_core(worker, 0);
+    p_ensemble->p_workers[worker]->placed = EXIT_FAILURE;
+  }
+
+  /* Placed from the threads pinned as the workers will be, or from this one */
+  p_ensemble->p_initial = p_sim;
+  for (worker = 0; worker < nb_workers; ++worker) {
+    struct worker *p_worker = p_ensemble->p_workers[worker];
+
+    if (!p_placement->local) {
+      p_worker->placed = place(p_worker);
+    } else if (!pthread_create(&p_worker->thread, NULL, place_main,
+                               p_worker)) {
+      p_worker->started = 1;
+    }
+  }
+  for (worker = 0; worker < nb_workers; ++worker) {
+    struct worker *p_worker = p_ensemble->p_workers[worker];
+
+    if (p_worker->started) {
+      pthread_join(p_worker->thread, NULL);
+      p_worker->started = 0;
+    }
+  }
+  p_ensemble->p_initial = NULL;
+
+  for (worker = 0; worker < nb_workers; ++worker) {
+    if (p_ensemble->p_workers[worker]->placed == EXIT_FAILURE) {
+      rrosace_ensemble_del(p_ensemble);
+      p_ensemble = NULL;
+      goto out;
+    }
+  }
+
+out:
+  return (p_ensemble);
+}
+
+void rrosace_ensemble_del(rrosace_ensemble_t *p_ensemble) {
+  size_t worker;
+
+  if (p_ensemble) {
+    rrosace_ensemble_wait(p_ensemble);
+    for (worker = 0; worker < p_ensemble->nb_workers; ++worker) {
+      struct worker *p_worker = p_ensemble->p_workers[worker];
+
+      rrosace_sim_del(p_worker->p_sim);
+      if (p_worker->p_mapping) {
+        munmap(p_worker->p_mapping, p_worker->mapped);
+      }
+      free(p_worker);
+    }
+    free(p_ensemble->p_next);
+    free(p_ensemble->p_results);
+    free(p_ensemble);
+  }
+}
+
+int rrosace_ensemble_start(rrosace_ensemble_t *p_ensemble, size_t nb_runs,
+                           rrosace_ensemble_run_t run, void *p_arg) {
+  int ret = EXIT_FAILURE;
+  size_t worker;
+
+  if (!p_ensemble || p_ensemble->running || !run) {
+    goto out;
+  }
+
+  free(p_ensemble->p_next);
+  free(p_ensemble->p_results);
+  /* One more element, so that no run is not mistaken for a failure */
+  p_ensemble->p_next = (size_t *)malloc((nb_runs + 1) * sizeof(size_t));
+  p_ensemble->p_results = (double *)calloc(
+      nb_runs * p_ensemble->nb_results + 1, sizeof(double));
+  if (!p_ensemble->p_next || !p_ensemble->p_results) {
+    goto out;
+  }
+
+  p_ensemble->nb_runs = nb_runs;
+  p_ensemble->run = run;
+  p_ensemble->p_arg = p_arg;
+  p_ensemble->head = NO_RUN;
+  p_ensemble->pending = NO_RUN;
+  p_ensemble->ret = EXIT_SUCCESS;
+
+  /* Runs split evenly, before any worker starts stealing */
+  for (worker = 0; worker < p_ensemble->nb_workers; ++worker) {
+    struct worker *p_worker = p_ensemble->p_workers[worker];
+
+    p_worker->top = (long)(worker * nb_runs / p_ensemble->nb_workers);
+    p_worker->bottom = (long)((worker + 1) * nb_runs / p_ensemble->nb_workers);
+    p_worker->nb_runs = 0;
+    p_worker->nb_steals = 0;
+    p_worker->started = 0;
+  }
+
+  p_ensemble->running = 1;
+  ret = EXIT_SUCCESS;
+
+  for (worker = 0; worker < p_ensemble->nb_workers; ++worker) {
+    struct worker *p_worker = p_ensemble->p_workers[worker];
+
+    if (pthread_create(&p_worker->thread, NULL, worker_main, p_worker)) {
+      /* The workers started steal the runs of the others */
+      ret = EXIT_FAILURE;
+      break;
+    }
+    p_worker->started = 1;
+  }
+
+  if ((ret == EXIT_FAILURE) && !p_ensemble->p_workers[0]->started) {
+    p_ensemble->running = 0;
+  }
+
+out:
+  return (ret);
+}
+
+size_t rrosace_ensemble_collect(rrosace_ensemble_t *p_ensemble, size_t runs[],
+                                size_t max_runs) {
+  size_t nb_runs = 0;
+
+  if (!p_ensemble || !runs) {
+    return (0);
+  }
+
+  if (p_ensemble->pending == NO_RUN) {
+    p_ensemble->pending =
+        __atomic_exchange_n(&p_ensemble->head, NO_RUN, __ATOMIC_ACQUIRE);
+  }
+
+  while ((nb_runs < max_runs) && (p_ensemble->pending != NO_RUN)) {
+    runs[nb_runs++] = p_ensemble->pending;
+    p_ensemble->pending = p_ensemble->p_next[p_ensemble->pending];
+  }
+
+  return (nb_runs);
+}
+
+int rrosace_ensemble_wait(rrosace_ensemble_t *p_ensemble) {
+  size_t worker;
+
+  if (!p_ensemble) {
+    return (EXIT_FAILURE);
+  }
+
+  if (p_ensemble->running) {
+    for (worker = 0; worker < p_ensemble->nb_workers; ++worker) {
+      if (p_ensemble->p_workers[worker]->started) {
+        pthread_join(p_ensemble->p_workers[worker]->thread, NULL);
+        p_ensemble->p_workers[worker]->started = 0;
+      }
+    }
+    p_ensemble->running = 0;
+  }
+
+  return (p_ensemble->ret);
+}
+
+const double *rrosace_ensemble_get_results(const rrosace_ensemble_t *p_ensemble,
+                                           size_t run) {
+  return ((p_ensemble && (run < p_ensemble->nb_runs))
+              ? &p_ensemble->p_results[run * p_ensemble->nb_results]
+              : NULL);
+}
+
+void *rrosace_ensemble_get_arena(const rrosace_ensemble_t *p_ensemble,
+                                 const rrosace_sim_t *p_sim) {
+  size_t worker;
+
+  if (p_ensemble && p_sim) {
+    for (worker = 0; worker < p_ensemble->nb_workers; ++worker) {
+      if (p_ensemble->p_workers[worker]->p_sim == p_sim) {
+        return (p_ensemble->p_workers[worker]->p_arena);
+      }
+    }
+  }
+
+  return (NULL);
+}
+
+size_t rrosace_ensemble_get_nb_huge(const rrosace_ensemble_t *p_ensemble) {
+  size_t nb_huge = 0;
+  size_t worker;
+
+  if (p_ensemble) {
+    for (worker = 0; worker < p_ensemble->nb_workers; ++worker) {
+      nb_huge += (size_t)p_ensemble->p_workers[worker]->huge;
+    }
+  }
+
+  return (nb_huge);
+}
+
+int rrosace_ensemble_get_stats(const rrosace_ensemble_t *p_ensemble,
+                               size_t worker, size_t *p_nb_runs,
+                               size_t *p_nb_steals) {
+  if (!p_ensemble || p_ensemble->running ||
+      (worker >= p_ensemble->nb_workers) || !p_nb_runs || !p_nb_steals) {
+    return (EXIT_FAILURE);
+  }
+
+  *p_nb_runs = p_ensemble->p_workers[worker]->nb_runs;
+  *p_nb_steals = p_ensemble->p_workers[worker]->nb_steals;
+
+  return (EXIT_SUCCESS);
+}
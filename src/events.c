@@ -0,0 +1,218 @@
+/**
+ * @file events.c
+ * @brief RROSACE Scheduling of cyber-physical system library zero-crossing
+ * events body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace_events.h>
+
+/* Bound of the root finding iterations, reached only on degenerate guards */
+#define MAX_ITERATIONS (200)
+
+enum side { NO_SIDE, LOW_SIDE, HIGH_SIDE };
+
+struct rrosace_events {
+  size_t state_size;
+  size_t nb_guards;
+  rrosace_events_step_t step;
+  rrosace_events_guard_t guard;
+  void *p_context;
+
+  /* State at the start of the step, at a trial time, and at the crossing */
+  double *state0;
+  double *trial;
+  double *crossing;
+  /* Guards at the start of the step */
+  double *guards0;
+};
+
+static int crossed(double /* g0 */, double /* g */);
+
+static int locate(rrosace_events_t * /* p_events */, size_t /* guard */,
+                  double /* hi */, double /* g_hi */,
+                  double /* time_tolerance */, double * /* p_time */);
+
+/**
+ * @brief Whether a guard changed sign since the start of the step, a guard
+ * reaching zero counts as crossed, a guard starting at zero does not
+ */
+static int crossed(double g0, double g) {
+  return (((g0 < 0.) && (g >= 0.)) || ((g0 > 0.) && (g <= 0.)));
+}
+
+/**
+ * @brief Locate the crossing of a guard in ]0, hi] with the Illinois variant
+ * of the regula falsi, the guard being crossed at hi
+ */
+static int locate(rrosace_events_t *p_events, size_t guard, double hi,
+                  double g_hi, double time_tolerance, double *p_time) {
+  int ret = EXIT_SUCCESS;
+  double lo = 0.;
+  double g_lo = p_events->guards0[guard];
+  enum side last = NO_SIDE;
+  size_t iteration;
+
+  for (iteration = 0;
+       (iteration < MAX_ITERATIONS) && (hi - lo > time_tolerance) &&
+       (ret == EXIT_SUCCESS);
+       ++iteration) {
+    double t = hi - g_hi * (hi - lo) / (g_hi - g_lo);
+    double g;
+
+    /* Fall back to bisection when the secant leaves the bracket */
+    if (!(t > lo) || !(t < hi)) {
+      t = lo + (hi - lo) / 2.;
+    }
+
+    ret = p_events->step(p_events->p_context, p_events->state0, t,
+                         p_events->trial);
+    g = p_events->guard(p_events->p_context, guard, p_events->trial);
+
+    if (crossed(p_events->guards0[guard], g)) {
+      hi = t;
+      g_hi = g;
+      if (last == HIGH_SIDE) {
+        g_lo /= 2.;
+      }
+      last = HIGH_SIDE;
+    } else {
+      lo = t;
+      g_lo = g;
+      if (last == LOW_SIDE) {
+        g_hi /= 2.;
+      }
+      last = LOW_SIDE;
+    }
+  }
+
+  *p_time = hi;
+
+  return (ret);
+}
+
+rrosace_events_t *rrosace_events_new(size_t state_size, size_t nb_guards,
+                                     rrosace_events_step_t step,
+                                     rrosace_events_guard_t guard,
+                                     void *p_context) {
+  rrosace_events_t *p_events = NULL;
+
+  if (!state_size || !step || (nb_guards && !guard)) {
+    goto out;
+  }
+
+  p_events = (rrosace_events_t *)calloc(1, sizeof(*p_events));
+  if (!p_events) {
+    goto out;
+  }
+
+  p_events->state_size = state_size;
+  p_events->nb_guards = nb_guards;
+  p_events->step = step;
+  p_events->guard = guard;
+  p_events->p_context = p_context;
+  p_events->state0 = (double *)malloc(state_size * sizeof(double));
+  p_events->trial = (double *)malloc(state_size * sizeof(double));
+  p_events->crossing = (double *)malloc(state_size * sizeof(double));
+  p_events->guards0 = (double *)malloc((nb_guards + 1) * sizeof(double));
+
+  if (!p_events->state0 || !p_events->trial || !p_events->crossing ||
+      !p_events->guards0) {
+    rrosace_events_del(p_events);
+    p_events = NULL;
+  }
+
+out:
+  return (p_events);
+}
+
+void rrosace_events_del(rrosace_events_t *p_events) {
+  if (p_events) {
+    free(p_events->state0);
+    free(p_events->trial);
+    free(p_events->crossing);
+    free(p_events->guards0);
+    free(p_events);
+  }
+}
+
+int rrosace_events_step(rrosace_events_t *p_events, double state[], double dt,
+                        double time_tolerance, double *p_elapsed,
+                        size_t *p_guard) {
+  int ret = EXIT_FAILURE;
+  const size_t state_bytes = p_events ? p_events->state_size * sizeof(double)
+                                      : 0;
+  double elapsed = dt;
+  size_t event = RROSACE_EVENTS_NO_EVENT;
+  size_t guard;
+
+  if (!p_events || !state || !p_elapsed || !p_guard || !(dt > 0.) ||
+      !(time_tolerance > 0.)) {
+    goto out;
+  }
+
+  memcpy(p_events->state0, state, state_bytes);
+  for (guard = 0; guard < p_events->nb_guards; ++guard) {
+    p_events->guards0[guard] =
+        p_events->guard(p_events->p_context, guard, p_events->state0);
+  }
+
+  if (p_events->step(p_events->p_context, p_events->state0, dt, state) ==
+      EXIT_FAILURE) {
+    goto out;
+  }
+
+  for (guard = 0; guard < p_events->nb_guards; ++guard) {
+    const double g = p_events->guard(p_events->p_context, guard, state);
+    double time;
+
+    if (!crossed(p_events->guards0[guard], g)) {
+      continue;
+    }
+
+    if (locate(p_events, guard, dt, g, time_tolerance, &time) ==
+        EXIT_FAILURE) {
+      goto out;
+    }
+
+    if ((event == RROSACE_EVENTS_NO_EVENT) || (time < elapsed)) {
+      elapsed = time;
+      event = guard;
+    }
+  }
+
+  /* Land on the earliest crossing */
+  if ((event != RROSACE_EVENTS_NO_EVENT) && (elapsed < dt)) {
+    if (p_events->step(p_events->p_context, p_events->state0, elapsed,
+                       p_events->crossing) == EXIT_FAILURE) {
+      goto out;
+    }
+    memcpy(state, p_events->crossing, state_bytes);
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  if (p_elapsed) {
+    *p_elapsed = elapsed;
+  }
+  if (p_guard) {
+    *p_guard = event;
+  }
+
+  return (ret);
+}
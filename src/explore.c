@@ -0,0 +1,711 @@
+/**
+ * @file explore.c
+ * @brief RROSACE Scheduling of cyber-physical system library schedule order
+ * exploration body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace_explore.h>
+
+/* Mask of a task */
+#define TASK(task) (1U << (task))
+
+/* FNV-1a parameters, on 32 bits to stay within an unsigned long */
+#define FNV_OFFSET (2166136261UL)
+#define FNV_PRIME (16777619UL)
+#define MASK_32 (0xFFFFFFFFUL)
+
+/* Distinct state of a tick */
+struct node {
+  /* Snapshot, deleted once the next tick is expanded */
+  rrosace_sim_t *p_sim;
+  double state[RROSACE_SIM_STATE_SIZE];
+  unsigned long hash;
+  /* Node of the previous tick and order leading to this one */
+  size_t parent;
+  size_t order;
+  /* Number of schedules reaching the state */
+  double nb_schedules;
+};
+
+/* Orders of the tasks released at some ticks */
+struct orders {
+  /* Explored tasks released */
+  unsigned int released;
+  size_t nb_orders;
+  rrosace_sim_task_t (*p_orders)[RROSACE_SIM_NB_TASKS];
+};
+
+/* Distinct states of a tick */
+struct level {
+  struct node *p_nodes;
+  size_t nb_nodes;
+  /* Orders expanding the previous tick into this one */
+  size_t orders;
+};
+
+/* Expansion of a tick, shared with the threads */
+struct expansion {
+  const struct level *p_parents;
+  const struct orders *p_orders;
+  struct node *p_children;
+  size_t nb_jobs;
+  size_t next;
+  int ret;
+};
+
+struct rrosace_explore {
+  rrosace_sim_t *p_sim;
+  rrosace_sim_task_t tasks[RROSACE_EXPLORE_MAX_TASKS];
+  size_t nb_tasks;
+  /* Explored tasks each task must follow */
+  unsigned int predecessors[RROSACE_SIM_NB_TASKS];
+  size_t nb_threads;
+  size_t max_states;
+  struct orders *p_orders;
+  size_t nb_orders;
+  struct level *p_levels;
+  size_t nb_levels;
+  size_t nb_simulated;
+};
+
+static unsigned long hash_state(const double * /* state */);
+
+static int next_permutation(size_t * /* indices */, size_t /* n */);
+
+static int same_released(const rrosace_sim_task_t * /* order */,
+                         const rrosace_sim_task_t * /* other */,
+                         unsigned int /* released */);
+
+static int build_orders(rrosace_explore_t * /* p_explore */,
+                        unsigned int /* released */,
+                        struct orders * /* p_orders */);
+
+static int find_orders(rrosace_explore_t * /* p_explore */,
+                       unsigned int /* released */, size_t * /* p_index */);
+
+static int expand(const struct level * /* p_parents */,
+                  const struct orders * /* p_orders */, size_t /* job */,
+                  struct node * /* p_child */);
+
+static void *expansion_main(void * /* p_arg */);
+
+static int expand_level(rrosace_explore_t * /* p_explore */,
+                        const struct level * /* p_parents */,
+                        const struct orders * /* p_orders */,
+                        struct node * /* p_children */, size_t /* nb_jobs */);
+
+static int merge(rrosace_explore_t * /* p_explore */,
+                 struct node * /* p_children */, size_t /* nb_jobs */,
+                 struct level * /* p_level */);
+
+static void delete_levels(rrosace_explore_t * /* p_explore */);
+
+static const struct node *
+trajectory_node(const rrosace_explore_t * /* p_explore */,
+                size_t /* trajectory */);
+
+static unsigned long hash_state(const double *state) {
+  const unsigned char *p_byte = (const unsigned char *)state;
+  const unsigned char *p_end =
+      p_byte + RROSACE_SIM_STATE_SIZE * sizeof(double);
+  unsigned long hash = FNV_OFFSET;
+
+  while (p_byte < p_end) {
+    hash = ((hash ^ *p_byte++) * FNV_PRIME) & MASK_32;
+  }
+
+  return (hash);
+}
+
+/**
+ * @brief Next lexicographic permutation of indices
+ * @return 0 when the indices were the last permutation
+ */
+static int next_permutation(size_t *indices, size_t n) {
+  size_t i = n - 1;
+  size_t j = n - 1;
+  size_t swap;
+
+  while (i && (indices[i - 1] >= indices[i])) {
+    --i;
+  }
+  if (!i) {
+    return (0);
+  }
+
+  while (indices[j] <= indices[i - 1]) {
+    --j;
+  }
+  swap = indices[i - 1];
+  indices[i - 1] = indices[j];
+  indices[j] = swap;
+
+  for (j = n - 1; i < j; ++i, --j) {
+    swap = indices[i];
+    indices[i] = indices[j];
+    indices[j] = swap;
+  }
+
+  return (1);
+}
+
+/**
+ * @brief Do two orders run the released explored tasks in the same order
+ */
+static int same_released(const rrosace_sim_task_t *order,
+                         const rrosace_sim_task_t *other,
+                         unsigned int released) {
+  size_t i = 0;
+  size_t j = 0;
+
+  for (;;) {
+    while ((i < RROSACE_SIM_NB_TASKS) && !(released & TASK(order[i]))) {
+      ++i;
+    }
+    while ((j < RROSACE_SIM_NB_TASKS) && !(released & TASK(other[j]))) {
+      ++j;
+    }
+    if ((i == RROSACE_SIM_NB_TASKS) || (j == RROSACE_SIM_NB_TASKS)) {
+      return ((i == RROSACE_SIM_NB_TASKS) && (j == RROSACE_SIM_NB_TASKS));
+    }
+    if (order[i++] != other[j++]) {
+      return (0);
+    }
+  }
+}
+
+/**
+ * @brief Build the orders of the explored tasks meeting the precedences, the
+ * other tasks keeping their place in the tick, one per order of the released
+ * ones
+ */
+static int build_orders(rrosace_explore_t *p_explore, unsigned int released,
+                        struct orders *p_orders) {
+  size_t indices[RROSACE_EXPLORE_MAX_TASKS];
+  size_t slots[RROSACE_EXPLORE_MAX_TASKS];
+  size_t nb_slots = 0;
+  size_t capacity = 0;
+  size_t i;
+
+  p_orders->released = released;
+  p_orders->nb_orders = 0;
+  p_orders->p_orders = NULL;
+
+  /* Explored tasks are sorted, their slots are their places in a tick */
+  for (i = 0; i < RROSACE_SIM_NB_TASKS; ++i) {
+    size_t k;
+
+    for (k = 0; k < p_explore->nb_tasks; ++k) {
+      if ((size_t)p_explore->tasks[k] == i) {
+        slots[nb_slots++] = i;
+      }
+    }
+  }
+  for (i = 0; i < p_explore->nb_tasks; ++i) {
+    indices[i] = i;
+  }
+
+  do {
+    rrosace_sim_task_t order[RROSACE_SIM_NB_TASKS];
+    unsigned int done = 0;
+    int valid = 1;
+    size_t k;
+
+    for (i = 0; i < RROSACE_SIM_NB_TASKS; ++i) {
+      order[i] = (rrosace_sim_task_t)i;
+    }
+    for (i = 0; i < p_explore->nb_tasks; ++i) {
+      const rrosace_sim_task_t task = p_explore->tasks[indices[i]];
+
+      order[slots[i]] = task;
+      if ((released & TASK(task)) &&
+          ((p_explore->predecessors[task] & released) & ~done)) {
+        valid = 0;
+      }
+      done |= TASK(task);
+    }
+
+    for (k = 0; valid && (k < p_orders->nb_orders); ++k) {
+      valid = !same_released(order, p_orders->p_orders[k], released);
+    }
+    if (!valid) {
+      continue;
+    }
+
+    if (p_orders->nb_orders == capacity) {
+      rrosace_sim_task_t(*p_grown)[RROSACE_SIM_NB_TASKS];
+
+      capacity = capacity ? 2 * capacity : 8;
+      p_grown = (rrosace_sim_task_t(*)[RROSACE_SIM_NB_TASKS])realloc(
+          p_orders->p_orders, capacity * sizeof(*p_grown));
+      if (!p_grown) {
+        return (EXIT_FAILURE);
+      }
+      p_orders->p_orders = p_grown;
+    }
+    memcpy(p_orders->p_orders[p_orders->nb_orders++], order, sizeof(order));
+  } while (next_permutation(indices, p_explore->nb_tasks));
+
+  /* Cyclic precedences leave no order */
+  return (p_orders->nb_orders ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+static int find_orders(rrosace_explore_t *p_explore, unsigned int released,
+                       size_t *p_index) {
+  struct orders *p_grown;
+  size_t index;
+
+  for (index = 0; index < p_explore->nb_orders; ++index) {
+    if (p_explore->p_orders[index].released == released) {
+      *p_index = index;
+      return (EXIT_SUCCESS);
+    }
+  }
+
+  p_grown = (struct orders *)realloc(p_explore->p_orders,
+                                     (p_explore->nb_orders + 1) *
+                                         sizeof(struct orders));
+  if (!p_grown) {
+    return (EXIT_FAILURE);
+  }
+  p_explore->p_orders = p_grown;
+
+  if (build_orders(p_explore, released, &p_grown[index]) == EXIT_FAILURE) {
+    free(p_grown[index].p_orders);
+    return (EXIT_FAILURE);
+  }
+  ++p_explore->nb_orders;
+  *p_index = index;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Run an order from a state of the previous tick
+ */
+static int expand(const struct level *p_parents, const struct orders *p_orders,
+                  size_t job, struct node *p_child) {
+  const size_t parent = job / p_orders->nb_orders;
+  const size_t order = job % p_orders->nb_orders;
+
+  p_child->parent = parent;
+  p_child->order = order;
+  p_child->nb_schedules = p_parents->p_nodes[parent].nb_schedules;
+  p_child->p_sim = rrosace_sim_copy(p_parents->p_nodes[parent].p_sim);
+  if (!p_child->p_sim ||
+      (rrosace_sim_run_ordered(p_child->p_sim, p_orders->p_orders[order]) ==
+       EXIT_FAILURE) ||
+      (rrosace_sim_get_state(p_child->p_sim, p_child->state) ==
+       EXIT_FAILURE)) {
+    return (EXIT_FAILURE);
+  }
+  p_child->hash = hash_state(p_child->state);
+
+  return (EXIT_SUCCESS);
+}
+
+static void *expansion_main(void *p_arg) {
+  struct expansion *p_expansion = (struct expansion *)p_arg;
+
+  for (;;) {
+    const size_t job =
+        __atomic_fetch_add(&p_expansion->next, 1, __ATOMIC_RELAXED);
+
+    if (job >= p_expansion->nb_jobs) {
+      break;
+    }
+    if (expand(p_expansion->p_parents, p_expansion->p_orders, job,
+               &p_expansion->p_children[job]) == EXIT_FAILURE) {
+      __atomic_store_n(&p_expansion->ret, EXIT_FAILURE, __ATOMIC_RELAXED);
+    }
+  }
+
+  return (NULL);
+}
+
+/**
+ * @brief Expand every state of a tick by every order, on the threads and
+ * the calling one
+ */
+static int expand_level(rrosace_explore_t *p_explore,
+                        const struct level *p_parents,
+                        const struct orders *p_orders, struct node *p_children,
+                        size_t nb_jobs) {
+  struct expansion expansion;
+  pthread_t threads[RROSACE_EXPLORE_MAX_THREADS];
+  size_t nb_threads = 0;
+
+  expansion.p_parents = p_parents;
+  expansion.p_orders = p_orders;
+  expansion.p_children = p_children;
+  expansion.nb_jobs = nb_jobs;
+  expansion.next = 0;
+  expansion.ret = EXIT_SUCCESS;
+
+  while ((nb_threads < p_explore->nb_threads) && (nb_threads + 1 < nb_jobs) &&
+         !pthread_create(&threads[nb_threads], NULL, expansion_main,
+                         &expansion)) {
+    ++nb_threads;
+  }
+
+  expansion_main(&expansion);
+
+  while (nb_threads) {
+    pthread_join(threads[--nb_threads], NULL);
+  }
+
+  return (expansion.ret);
+}
+
+/**
+ * @brief Keep the first child of each distinct state, in job order so that
+ * the result does not depend on the threads, and sum the schedules of the
+ * others
+ */
+static int merge(rrosace_explore_t *p_explore, struct node *p_children,
+                 size_t nb_jobs, struct level *p_level) {
+  int ret = EXIT_FAILURE;
+  size_t *p_table = NULL;
+  size_t table_size = 1;
+  size_t job;
+
+  while (table_size < 2 * nb_jobs) {
+    table_size *= 2;
+  }
+  p_table = (size_t *)malloc(table_size * sizeof(size_t));
+  if (!p_table) {
+    goto out;
+  }
+  for (job = 0; job < table_size; ++job) {
+    p_table[job] = nb_jobs;
+  }
+
+  p_level->nb_nodes = 0;
+  for (job = 0; job < nb_jobs; ++job) {
+    struct node *p_child = &p_children[job];
+    size_t slot = p_child->hash & (table_size - 1);
+
+    while (p_table[slot] != nb_jobs) {
+      struct node *p_kept = &p_level->p_nodes[p_table[slot]];
+
+      if ((p_kept->hash == p_child->hash) &&
+          !memcmp(p_kept->state, p_child->state, sizeof(p_child->state))) {
+        break;
+      }
+      slot = (slot + 1) & (table_size - 1);
+    }
+
+    if (p_table[slot] != nb_jobs) {
+      p_level->p_nodes[p_table[slot]].nb_schedules += p_child->nb_schedules;
+      rrosace_sim_del(p_child->p_sim);
+      p_child->p_sim = NULL;
+      continue;
+    }
+
+    if (p_level->nb_nodes == p_explore->max_states) {
+      goto out;
+    }
+    p_table[slot] = p_level->nb_nodes;
+    p_level->p_nodes[p_level->nb_nodes++] = *p_child;
+    p_child->p_sim = NULL;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  free(p_table);
+
+  return (ret);
+}
+
+static void delete_levels(rrosace_explore_t *p_explore) {
+  size_t level;
+  size_t node;
+
+  for (level = 0; level < p_explore->nb_levels; ++level) {
+    struct level *p_level = &p_explore->p_levels[level];
+
+    for (node = 0; node < p_level->nb_nodes; ++node) {
+      rrosace_sim_del(p_level->p_nodes[node].p_sim);
+    }
+    free(p_level->p_nodes);
+  }
+  free(p_explore->p_levels);
+  p_explore->p_levels = NULL;
+  p_explore->nb_levels = 0;
+}
+
+static const struct node *
+trajectory_node(const rrosace_explore_t *p_explore, size_t trajectory) {
+  const struct level *p_last;
+
+  if (!p_explore || !p_explore->nb_levels) {
+    return (NULL);
+  }
+
+  p_last = &p_explore->p_levels[p_explore->nb_levels - 1];
+
+  return (trajectory < p_last->nb_nodes ? &p_last->p_nodes[trajectory] : NULL);
+}
+
+rrosace_explore_t *rrosace_explore_new(const rrosace_sim_t *p_sim,
+                                       const rrosace_sim_task_t tasks[],
+                                       size_t nb_tasks, size_t nb_threads,
+                                       size_t max_states) {
+  rrosace_explore_t *p_explore = NULL;
+  unsigned int explored = 0;
+  size_t i;
+
+  if (!p_sim || (rrosace_sim_get_semantics(p_sim) != RROSACE_SIM_IMMEDIATE) ||
+      !tasks || !nb_tasks || (nb_tasks > RROSACE_EXPLORE_MAX_TASKS) ||
+      (nb_threads > RROSACE_EXPLORE_MAX_THREADS) || !max_states) {
+    goto out;
+  }
+
+  for (i = 0; i < nb_tasks; ++i) {
+    if (((size_t)tasks[i] >= RROSACE_SIM_NB_TASKS) ||
+        (explored & TASK(tasks[i]))) {
+      goto out;
+    }
+    explored |= TASK(tasks[i]);
+  }
+
+  p_explore = (rrosace_explore_t *)calloc(1, sizeof(rrosace_explore_t));
+  if (!p_explore) {
+    goto out;
+  }
+
+  p_explore->p_sim = rrosace_sim_copy(p_sim);
+  if (!p_explore->p_sim) {
+    rrosace_explore_del(p_explore);
+    p_explore = NULL;
+    goto out;
+  }
+
+  /* Sorted, so that the identity permutation is the tick order */
+  for (i = 0; i < RROSACE_SIM_NB_TASKS; ++i) {
+    if (explored & TASK(i)) {
+      p_explore->tasks[p_explore->nb_tasks++] = (rrosace_sim_task_t)i;
+    }
+  }
+  p_explore->nb_threads = nb_threads;
+  p_explore->max_states = max_states;
+
+out:
+  return (p_explore);
+}
+
+void rrosace_explore_del(rrosace_explore_t *p_explore) {
+  size_t i;
+
+  if (p_explore) {
+    delete_levels(p_explore);
+    for (i = 0; i < p_explore->nb_orders; ++i) {
+      free(p_explore->p_orders[i].p_orders);
+    }
+    free(p_explore->p_orders);
+    rrosace_sim_del(p_explore->p_sim);
+    free(p_explore);
+  }
+}
+
+int rrosace_explore_add_precedence(rrosace_explore_t *p_explore,
+                                   rrosace_sim_task_t before,
+                                   rrosace_sim_task_t after) {
+  int ret = EXIT_FAILURE;
+  unsigned int explored = 0;
+  size_t i;
+
+  if (!p_explore || p_explore->nb_levels || (before == after)) {
+    goto out;
+  }
+
+  for (i = 0; i < p_explore->nb_tasks; ++i) {
+    explored |= TASK(p_explore->tasks[i]);
+  }
+  if (((size_t)before >= RROSACE_SIM_NB_TASKS) ||
+      ((size_t)after >= RROSACE_SIM_NB_TASKS) ||
+      !(explored & TASK(before)) || !(explored & TASK(after))) {
+    goto out;
+  }
+
+  p_explore->predecessors[after] |= TASK(before);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_explore_run(rrosace_explore_t *p_explore, size_t horizon) {
+  int ret = EXIT_FAILURE;
+  struct node *p_children = NULL;
+  size_t nb_jobs = 0;
+  size_t level;
+
+  if (!p_explore || p_explore->nb_levels) {
+    return (EXIT_FAILURE);
+  }
+
+  p_explore->p_levels =
+      (struct level *)calloc(horizon + 1, sizeof(struct level));
+  if (!p_explore->p_levels) {
+    goto out;
+  }
+  p_explore->nb_levels = 1;
+
+  p_explore->p_levels[0].p_nodes =
+      (struct node *)calloc(1, sizeof(struct node));
+  if (!p_explore->p_levels[0].p_nodes) {
+    goto out;
+  }
+  p_explore->p_levels[0].nb_nodes = 1;
+  p_explore->p_levels[0].p_nodes[0].nb_schedules = 1.;
+  p_explore->p_levels[0].p_nodes[0].p_sim = rrosace_sim_copy(p_explore->p_sim);
+  if (!p_explore->p_levels[0].p_nodes[0].p_sim) {
+    goto out;
+  }
+
+  for (level = 1; level <= horizon; ++level) {
+    struct level *p_parents = &p_explore->p_levels[level - 1];
+    struct level *p_level = &p_explore->p_levels[level];
+    const size_t logical_time =
+        rrosace_sim_get_logical_time(p_explore->p_sim) + level - 1;
+    unsigned int released = 0;
+    size_t i;
+
+    for (i = 0; i < p_explore->nb_tasks; ++i) {
+      const rrosace_sim_task_t task = p_explore->tasks[i];
+
+      if (!(logical_time %
+            rrosace_sim_get_task_period(p_explore->p_sim, task))) {
+        released |= TASK(task);
+      }
+    }
+    if (find_orders(p_explore, released, &p_level->orders) == EXIT_FAILURE) {
+      goto out;
+    }
+
+    nb_jobs =
+        p_parents->nb_nodes * p_explore->p_orders[p_level->orders].nb_orders;
+    p_children = (struct node *)calloc(nb_jobs, sizeof(struct node));
+    p_level->p_nodes = (struct node *)malloc(nb_jobs * sizeof(struct node));
+    p_explore->nb_levels = level + 1;
+    if (!p_children || !p_level->p_nodes) {
+      goto out;
+    }
+
+    p_explore->nb_simulated += nb_jobs;
+    if ((expand_level(p_explore, p_parents,
+                      &p_explore->p_orders[p_level->orders], p_children,
+                      nb_jobs) == EXIT_FAILURE) ||
+        (merge(p_explore, p_children, nb_jobs, p_level) == EXIT_FAILURE)) {
+      goto out;
+    }
+
+    free(p_children);
+    p_children = NULL;
+
+    /* Only the snapshots of the last tick are expanded */
+    for (i = 0; i < p_parents->nb_nodes; ++i) {
+      rrosace_sim_del(p_parents->p_nodes[i].p_sim);
+      p_parents->p_nodes[i].p_sim = NULL;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  if (p_children) {
+    size_t job;
+
+    for (job = 0; job < nb_jobs; ++job) {
+      rrosace_sim_del(p_children[job].p_sim);
+    }
+    free(p_children);
+  }
+  if (ret == EXIT_FAILURE) {
+    delete_levels(p_explore);
+  }
+
+  return (ret);
+}
+
+size_t rrosace_explore_get_nb_trajectories(const rrosace_explore_t *p_explore) {
+  return ((p_explore && p_explore->nb_levels)
+              ? p_explore->p_levels[p_explore->nb_levels - 1].nb_nodes
+              : 0);
+}
+
+int rrosace_explore_get_nb_states(const rrosace_explore_t *p_explore,
+                                  size_t *p_nb_simulated,
+                                  size_t *p_nb_distinct) {
+  size_t level;
+
+  if (!p_explore || !p_nb_simulated || !p_nb_distinct) {
+    return (EXIT_FAILURE);
+  }
+
+  *p_nb_simulated = p_explore->nb_simulated;
+  *p_nb_distinct = 0;
+  for (level = 1; level < p_explore->nb_levels; ++level) {
+    *p_nb_distinct += p_explore->p_levels[level].nb_nodes;
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+const rrosace_sim_t *
+rrosace_explore_get_sim(const rrosace_explore_t *p_explore, size_t trajectory) {
+  const struct node *p_node = trajectory_node(p_explore, trajectory);
+
+  return (p_node ? p_node->p_sim : NULL);
+}
+
+double rrosace_explore_get_nb_schedules(const rrosace_explore_t *p_explore,
+                                        size_t trajectory) {
+  const struct node *p_node = trajectory_node(p_explore, trajectory);
+
+  return (p_node ? p_node->nb_schedules : 0.);
+}
+
+int rrosace_explore_get_order(const rrosace_explore_t *p_explore,
+                              size_t trajectory, size_t tick,
+                              rrosace_sim_task_t order[]) {
+  const struct node *p_node = trajectory_node(p_explore, trajectory);
+  size_t level;
+
+  if (!p_node || !order || (tick + 1 >= p_explore->nb_levels)) {
+    return (EXIT_FAILURE);
+  }
+
+  /* Back from the horizon to the tick, through the parents */
+  for (level = p_explore->nb_levels - 1; level > tick + 1; --level) {
+    p_node = &p_explore->p_levels[level - 1].p_nodes[p_node->parent];
+  }
+
+  memcpy(order,
+         p_explore->p_orders[p_explore->p_levels[level].orders]
+             .p_orders[p_node->order],
+         RROSACE_SIM_NB_TASKS * sizeof(rrosace_sim_task_t));
+
+  return (EXIT_SUCCESS);
+}
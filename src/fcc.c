@@ -27,7 +27,7 @@
 #define EPSILON_DELTA_TH_C (RROSACE_TIME_RESOLUTION)
 
 /* Controller parameters */
-#define H_SWITCH (50.0)
+#define H_SWITCH (RROSACE_FCC_H_SWITCH)
 
 /* Altitude hold */
 #define KP_H (0.1014048)
@@ -332,6 +332,44 @@ void rrosace_fcc_del(rrosace_fcc_t *p_fcc) {
   }
 }
 
+int rrosace_fcc_get_state(const rrosace_fcc_t *p_fcc, double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_fcc || !state) {
+    goto out;
+  }
+
+  state[0] = p_fcc->altitude_hold.controller.integrator;
+  state[1] = (double)p_fcc->altitude_hold.need_reinit;
+  state[2] = p_fcc->altitude_hold.old_vz_c;
+  state[3] = p_fcc->vz_control.integrator;
+  state[4] = p_fcc->va_control.integrator;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_fcc_set_state(rrosace_fcc_t *p_fcc, const double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_fcc || !state) {
+    goto out;
+  }
+
+  p_fcc->altitude_hold.controller.integrator = state[0];
+  p_fcc->altitude_hold.need_reinit = state[1] != 0. ? CONTINUE : NEED_REINIT;
+  p_fcc->altitude_hold.old_vz_c = state[2];
+  p_fcc->vz_control.integrator = state[3];
+  p_fcc->va_control.integrator = state[4];
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
 int rrosace_fcc_com_step(rrosace_fcc_t *p_fcc, rrosace_mode_t mode, double h_f,
                          double vz_f, double va_f, double q_f, double az_f,
                          double h_c, double vz_c, double va_c,
@@ -367,6 +367,38 @@ void rrosace_filter_del(rrosace_filter_t *p_filter) {
   }
 }
 
+int rrosace_filter_get_state(const rrosace_filter_t *p_filter, double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_filter || !state) {
+    goto out;
+  }
+
+  state[0] = p_filter->selected_filter.second_order_filter.x[0];
+  state[1] = p_filter->selected_filter.second_order_filter.x[1];
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_filter_set_state(rrosace_filter_t *p_filter, const double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_filter || !state) {
+    goto out;
+  }
+
+  p_filter->selected_filter.second_order_filter.x[0] = state[0];
+  p_filter->selected_filter.second_order_filter.x[1] = state[1];
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
 int rrosace_filter_step(rrosace_filter_t *p_filter, double to_filter,
                         double *p_filtered) {
   int ret = EXIT_FAILURE;
@@ -34,8 +34,6 @@
 #define RS (287.05)
 
 /* Aircraft parameters */
-#define MASSE (57837.5)
-#define I_Y (3781272.0)
 #define S (122.6)
 #define C_BAR (4.29)
 #define CD_0 (0.016)
@@ -57,6 +55,9 @@ struct rrosace_flight_dynamics {
   double q;
   double theta;
   double h;
+
+  double masse;
+  double i_y;
 };
 
 rrosace_flight_dynamics_t *rrosace_flight_dynamics_new() {
@@ -72,6 +73,8 @@ rrosace_flight_dynamics_t *rrosace_flight_dynamics_new() {
   p_flight_dynamics->q = RROSACE_Q_EQ;
   p_flight_dynamics->theta = THETA_EQ;
   p_flight_dynamics->h = RROSACE_H_EQ;
+  p_flight_dynamics->masse = RROSACE_MASSE;
+  p_flight_dynamics->i_y = RROSACE_I_Y;
 
 out:
   return (p_flight_dynamics);
@@ -90,6 +93,8 @@ rrosace_flight_dynamics_copy(const rrosace_flight_dynamics_t *p_other) {
   p_flight_dynamics->q = p_other->q;
   p_flight_dynamics->theta = p_other->theta;
   p_flight_dynamics->h = p_other->h;
+  p_flight_dynamics->masse = p_other->masse;
+  p_flight_dynamics->i_y = p_other->i_y;
 
 out:
   return (p_flight_dynamics);
@@ -101,6 +106,63 @@ void rrosace_flight_dynamics_del(rrosace_flight_dynamics_t *p_flight_dynamics) {
   }
 }
 
+int rrosace_flight_dynamics_get_state(
+    const rrosace_flight_dynamics_t *p_flight_dynamics, double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_flight_dynamics || !state) {
+    goto out;
+  }
+
+  state[0] = p_flight_dynamics->u;
+  state[1] = p_flight_dynamics->w;
+  state[2] = p_flight_dynamics->q;
+  state[3] = p_flight_dynamics->theta;
+  state[4] = p_flight_dynamics->h;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_flight_dynamics_set_state(
+    rrosace_flight_dynamics_t *p_flight_dynamics, const double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_flight_dynamics || !state) {
+    goto out;
+  }
+
+  p_flight_dynamics->u = state[0];
+  p_flight_dynamics->w = state[1];
+  p_flight_dynamics->q = state[2];
+  p_flight_dynamics->theta = state[3];
+  p_flight_dynamics->h = state[4];
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_flight_dynamics_set_parameters(
+    rrosace_flight_dynamics_t *p_flight_dynamics, double masse, double i_y) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_flight_dynamics || !(masse > 0.) || !(i_y > 0.)) {
+    goto out;
+  }
+
+  p_flight_dynamics->masse = masse;
+  p_flight_dynamics->i_y = i_y;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
 int rrosace_flight_dynamics_step(rrosace_flight_dynamics_t *p_flight_dynamics,
                                  double delta_e, double t, double *p_h,
                                  double *p_vz, double *p_va, double *p_q,
@@ -153,14 +215,16 @@ int rrosace_flight_dynamics_step(rrosace_flight_dynamics_t *p_flight_dynamics,
   *p_vz = p_flight_dynamics->w * cos(p_flight_dynamics->theta) -
           p_flight_dynamics->u * sin(p_flight_dynamics->theta);
   *p_q = p_flight_dynamics->q;
-  *p_az = G_0 * cos(p_flight_dynamics->theta) + za / MASSE;
+  *p_az = G_0 * cos(p_flight_dynamics->theta) + za / p_flight_dynamics->masse;
   *p_h = p_flight_dynamics->h;
 
   u_dot = -G_0 * sin(p_flight_dynamics->theta) -
-          p_flight_dynamics->q * p_flight_dynamics->w + (xa + t) / MASSE;
+          p_flight_dynamics->q * p_flight_dynamics->w +
+          (xa + t) / p_flight_dynamics->masse;
   w_dot = G_0 * cos(p_flight_dynamics->theta) +
-          p_flight_dynamics->q * p_flight_dynamics->u + za / MASSE;
-  q_dot = ma / I_Y;
+          p_flight_dynamics->q * p_flight_dynamics->u +
+          za / p_flight_dynamics->masse;
+  q_dot = ma / p_flight_dynamics->i_y;
   theta_dot = p_flight_dynamics->q;
   h_dot = p_flight_dynamics->u * sin(p_flight_dynamics->theta) -
           p_flight_dynamics->w * cos(p_flight_dynamics->theta);
@@ -0,0 +1,431 @@
+/**
+ * @file jitter.c
+ * @brief RROSACE Scheduling of cyber-physical system library release-jitter
+ * Monte Carlo body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace_constants.h>
+#include <rrosace_des.h>
+#include <rrosace_ensemble.h>
+#include <rrosace_jitter.h>
+
+#include "random.h"
+
+#define NSEC_PER_SEC (1000000000UL)
+#define MASK_32 (0xFFFFFFFFUL)
+#define RANDOM_RANGE (4294967296.)
+
+/* Results of a run: openings, changes, first time, then the jitters */
+#define RESULT_NB_OPENINGS (0)
+#define RESULT_NB_CHANGES (1)
+#define RESULT_T_FIRST (2)
+#define RESULT_JITTERS (3)
+#define RESULTS_SIZE                                                           \
+  (RESULT_JITTERS + RROSACE_SIM_NB_TASKS * RROSACE_JITTER_NB_FEATURES)
+
+typedef rrosace_jitter_distribution_t
+    distributions_t[RROSACE_SIM_NB_TASKS][RROSACE_JITTER_NB_FEATURES];
+
+struct rrosace_jitter {
+  rrosace_ensemble_t *p_ensemble;
+  unsigned long periods[RROSACE_SIM_NB_TASKS];
+  distributions_t distributions;
+  /* Batch, read by the workers */
+  distributions_t batch_distributions;
+  size_t nb_runs;
+  size_t nb_ticks;
+  unsigned long seed;
+};
+
+/* Jitters drawn for a run, by task then feature */
+struct run_context {
+  const rrosace_jitter_t *p_jitter;
+  unsigned long random_state;
+  unsigned long jitters[RROSACE_SIM_NB_TASKS][RROSACE_JITTER_NB_FEATURES];
+};
+
+static double uniform(unsigned long * /* p_state */);
+
+static unsigned long draw(const rrosace_jitter_distribution_t * /* p_law */,
+                          unsigned long * /* p_state */);
+
+static int valid(const rrosace_jitter_distribution_t * /* p_law */);
+
+static unsigned long delay_func(void * /* p_arg */,
+                                rrosace_sim_task_t /* task */);
+
+static int run_func(rrosace_sim_t * /* p_sim */, size_t /* run */,
+                    void * /* p_arg */, double results[]);
+
+/**
+ * @brief Uniform draw in [0, 1)
+ */
+static double uniform(unsigned long *p_state) {
+  return ((double)rrosace_random_next(p_state) / RANDOM_RANGE);
+}
+
+static unsigned long draw(const rrosace_jitter_distribution_t *p_law,
+                          unsigned long *p_state) {
+  double u;
+
+  switch (p_law->law) {
+  case RROSACE_JITTER_UNIFORM:
+    u = uniform(p_state);
+    break;
+  case RROSACE_JITTER_NORMAL:
+    u = uniform(p_state);
+    u += uniform(p_state);
+    u += uniform(p_state);
+    u += uniform(p_state);
+    u /= 4.;
+    break;
+  case RROSACE_JITTER_EXTREMES:
+    u = (rrosace_random_next(p_state) & 1UL) ? 1. : 0.;
+    break;
+  default:
+    u = 0.;
+    break;
+  }
+
+  return (p_law->min +
+          (unsigned long)((double)(p_law->max - p_law->min) * u + 0.5));
+}
+
+static int valid(const rrosace_jitter_distribution_t *p_law) {
+  return (((size_t)p_law->law < RROSACE_JITTER_NB_LAWS) &&
+          (p_law->min <= p_law->max));
+}
+
+/**
+ * @brief Release jitter and execution time of a release, each uniform up to
+ * the largest one of the run
+ */
+static unsigned long delay_func(void *p_arg, rrosace_sim_task_t task) {
+  struct run_context *p_context = (struct run_context *)p_arg;
+  const rrosace_jitter_distribution_t *distributions =
+      p_context->p_jitter->batch_distributions[task];
+  rrosace_jitter_distribution_t release;
+  rrosace_jitter_distribution_t execution;
+
+  release.law = RROSACE_JITTER_UNIFORM;
+  release.min = distributions[RROSACE_JITTER_RELEASE].min;
+  release.max = p_context->jitters[task][RROSACE_JITTER_RELEASE];
+  execution.law = RROSACE_JITTER_UNIFORM;
+  execution.min = distributions[RROSACE_JITTER_EXECUTION].min;
+  execution.max = p_context->jitters[task][RROSACE_JITTER_EXECUTION];
+
+  return (draw(&release, &p_context->random_state) +
+          draw(&execution, &p_context->random_state));
+}
+
+/**
+ * @brief Run a jittered schedule, watching the relays and the masters in law
+ * at each physical tick
+ */
+static int run_func(rrosace_sim_t *p_sim, size_t run, void *p_arg,
+                    double results[]) {
+  int ret = EXIT_FAILURE;
+  const rrosace_jitter_t *p_jitter = (const rrosace_jitter_t *)p_arg;
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+  rrosace_des_t *p_des = rrosace_des_new(p_sim, 0UL);
+  struct run_context context;
+  rrosace_relay_state_t relays[2 * RROSACE_SIM_NB_FCCS_COUPLES];
+  rrosace_master_in_law_t masters[RROSACE_SIM_NB_FCCS_COUPLES];
+  unsigned long run_state = (unsigned long)run & MASK_32;
+  size_t nb_openings = 0;
+  size_t nb_changes = 0;
+  double t_first = -1.;
+  size_t task;
+  size_t tick;
+  size_t i;
+
+  if (!p_des) {
+    goto out;
+  }
+
+  memset(&context, 0, sizeof(context));
+  context.p_jitter = p_jitter;
+  context.random_state =
+      (p_jitter->seed ^ rrosace_random_next(&run_state)) & MASK_32;
+
+  for (task = 0; task < RROSACE_SIM_NB_TASKS; ++task) {
+    const rrosace_jitter_distribution_t *distributions =
+        p_jitter->batch_distributions[task];
+
+    for (i = 0; i < RROSACE_JITTER_NB_FEATURES; ++i) {
+      context.jitters[task][i] =
+          draw(&distributions[i], &context.random_state);
+    }
+    if ((rrosace_des_set_timing(p_des, (rrosace_sim_task_t)task,
+                                p_jitter->periods[task],
+                                context.jitters[task][RROSACE_JITTER_OFFSET],
+                                0UL) == EXIT_FAILURE) ||
+        ((context.jitters[task][RROSACE_JITTER_RELEASE] ||
+          context.jitters[task][RROSACE_JITTER_EXECUTION]) &&
+         (rrosace_des_set_delay(p_des, (rrosace_sim_task_t)task, delay_func,
+                                &context) == EXIT_FAILURE))) {
+      goto out;
+    }
+  }
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+    relays[2 * i] = p_values->relay_delta_e_c[i];
+    relays[2 * i + 1] = p_values->relay_delta_th_c[i];
+    masters[i] = p_values->master_in_laws[i];
+  }
+
+  for (tick = 1; tick <= p_jitter->nb_ticks; ++tick) {
+    const size_t nb_events = nb_openings + nb_changes;
+
+    if (rrosace_des_run_until(p_des, (double)tick /
+                                         RROSACE_DEFAULT_PHYSICAL_FREQ) ==
+        EXIT_FAILURE) {
+      goto out;
+    }
+
+    for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+      if ((p_values->relay_delta_e_c[i] == RROSACE_RELAY_OPENED) &&
+          (relays[2 * i] == RROSACE_RELAY_CLOSED)) {
+        ++nb_openings;
+      }
+      if ((p_values->relay_delta_th_c[i] == RROSACE_RELAY_OPENED) &&
+          (relays[2 * i + 1] == RROSACE_RELAY_CLOSED)) {
+        ++nb_openings;
+      }
+      relays[2 * i] = p_values->relay_delta_e_c[i];
+      relays[2 * i + 1] = p_values->relay_delta_th_c[i];
+      if (p_values->master_in_laws[i] != masters[i]) {
+        ++nb_changes;
+        masters[i] = p_values->master_in_laws[i];
+      }
+    }
+
+    if ((t_first < 0.) && (nb_openings + nb_changes > nb_events)) {
+      t_first = (double)tick / RROSACE_DEFAULT_PHYSICAL_FREQ;
+    }
+  }
+
+  results[RESULT_NB_OPENINGS] = (double)nb_openings;
+  results[RESULT_NB_CHANGES] = (double)nb_changes;
+  results[RESULT_T_FIRST] = t_first;
+  for (task = 0; task < RROSACE_SIM_NB_TASKS; ++task) {
+    for (i = 0; i < RROSACE_JITTER_NB_FEATURES; ++i) {
+      results[RESULT_JITTERS + task * RROSACE_JITTER_NB_FEATURES + i] =
+          (double)context.jitters[task][i];
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_des_del(p_des);
+
+  return (ret);
+}
+
+rrosace_jitter_t *rrosace_jitter_new(const rrosace_sim_t *p_sim,
+                                     size_t nb_workers) {
+  rrosace_jitter_t *p_jitter = NULL;
+  size_t task;
+
+  if (!p_sim || (rrosace_sim_get_semantics(p_sim) != RROSACE_SIM_IMMEDIATE)) {
+    goto out;
+  }
+
+  p_jitter = (rrosace_jitter_t *)calloc(1, sizeof(rrosace_jitter_t));
+  if (!p_jitter) {
+    goto out;
+  }
+
+  p_jitter->p_ensemble = rrosace_ensemble_new(p_sim, nb_workers, RESULTS_SIZE);
+  if (!p_jitter->p_ensemble) {
+    free(p_jitter);
+    p_jitter = NULL;
+    goto out;
+  }
+
+  for (task = 0; task < RROSACE_SIM_NB_TASKS; ++task) {
+    size_t feature;
+
+    p_jitter->periods[task] =
+        (unsigned long)rrosace_sim_get_task_period(p_sim,
+                                                   (rrosace_sim_task_t)task) *
+        (NSEC_PER_SEC / RROSACE_DEFAULT_PHYSICAL_FREQ);
+    for (feature = 0; feature < RROSACE_JITTER_NB_FEATURES; ++feature) {
+      p_jitter->distributions[task][feature].law = RROSACE_JITTER_NONE;
+    }
+  }
+
+out:
+  return (p_jitter);
+}
+
+void rrosace_jitter_del(rrosace_jitter_t *p_jitter) {
+  if (p_jitter) {
+    rrosace_ensemble_del(p_jitter->p_ensemble);
+    free(p_jitter);
+  }
+}
+
+int rrosace_jitter_set_task(rrosace_jitter_t *p_jitter, rrosace_sim_task_t task,
+                            const rrosace_jitter_distribution_t *p_offset,
+                            const rrosace_jitter_distribution_t *p_release,
+                            const rrosace_jitter_distribution_t *p_execution) {
+  int ret = EXIT_FAILURE;
+  const rrosace_jitter_distribution_t none = {RROSACE_JITTER_NONE, 0UL, 0UL};
+  rrosace_jitter_distribution_t *distributions;
+
+  if (!p_jitter || ((size_t)task >= RROSACE_SIM_NB_TASKS)) {
+    goto out;
+  }
+
+  p_offset = p_offset ? p_offset : &none;
+  p_release = p_release ? p_release : &none;
+  p_execution = p_execution ? p_execution : &none;
+  if (!valid(p_offset) || !valid(p_release) || !valid(p_execution) ||
+      (p_release->max + p_execution->max >= p_jitter->periods[task])) {
+    goto out;
+  }
+
+  distributions = p_jitter->distributions[task];
+  distributions[RROSACE_JITTER_OFFSET] = *p_offset;
+  distributions[RROSACE_JITTER_RELEASE] = *p_release;
+  distributions[RROSACE_JITTER_EXECUTION] = *p_execution;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_jitter_run(rrosace_jitter_t *p_jitter, size_t nb_runs,
+                       double duration, unsigned long seed) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_jitter || !nb_runs || !(duration > 0.)) {
+    goto out;
+  }
+
+  memcpy(p_jitter->batch_distributions, p_jitter->distributions,
+         sizeof(distributions_t));
+  p_jitter->nb_runs = 0;
+  p_jitter->nb_ticks =
+      (size_t)(duration * RROSACE_DEFAULT_PHYSICAL_FREQ + 0.5);
+  p_jitter->seed = seed & MASK_32;
+
+  if ((rrosace_ensemble_start(p_jitter->p_ensemble, nb_runs, run_func,
+                              p_jitter) == EXIT_FAILURE) ||
+      (rrosace_ensemble_wait(p_jitter->p_ensemble) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  p_jitter->nb_runs = nb_runs;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_jitter_get_outcome(const rrosace_jitter_t *p_jitter, size_t run,
+                               rrosace_jitter_outcome_t *p_outcome) {
+  int ret = EXIT_FAILURE;
+  const double *results;
+  size_t task;
+  size_t feature;
+
+  if (!p_jitter || (run >= p_jitter->nb_runs) || !p_outcome) {
+    goto out;
+  }
+
+  results = rrosace_ensemble_get_results(p_jitter->p_ensemble, run);
+  if (!results) {
+    goto out;
+  }
+
+  p_outcome->nb_openings = (size_t)results[RESULT_NB_OPENINGS];
+  p_outcome->nb_changes = (size_t)results[RESULT_NB_CHANGES];
+  p_outcome->t_first = results[RESULT_T_FIRST];
+  for (task = 0; task < RROSACE_SIM_NB_TASKS; ++task) {
+    for (feature = 0; feature < RROSACE_JITTER_NB_FEATURES; ++feature) {
+      p_outcome->jitters[task][feature] = (unsigned long)
+          results[RESULT_JITTERS + task * RROSACE_JITTER_NB_FEATURES + feature];
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_jitter_get_range(const rrosace_jitter_t *p_jitter,
+                             rrosace_sim_task_t task,
+                             rrosace_jitter_feature_t feature,
+                             size_t nb_ranges, size_t range, size_t *p_nb_runs,
+                             size_t *p_nb_openings, size_t *p_nb_changes) {
+  int ret = EXIT_FAILURE;
+  const rrosace_jitter_distribution_t *p_law;
+  double width;
+  size_t run;
+
+  if (!p_jitter || ((size_t)task >= RROSACE_SIM_NB_TASKS) ||
+      ((size_t)feature >= RROSACE_JITTER_NB_FEATURES) ||
+      (range >= nb_ranges) || !p_nb_runs || !p_nb_openings ||
+      !p_nb_changes) {
+    goto out;
+  }
+
+  p_law = &p_jitter->batch_distributions[task][feature];
+  width = (double)(p_law->max - p_law->min);
+  *p_nb_runs = 0;
+  *p_nb_openings = 0;
+  *p_nb_changes = 0;
+
+  for (run = 0; run < p_jitter->nb_runs; ++run) {
+    const double *results =
+        rrosace_ensemble_get_results(p_jitter->p_ensemble, run);
+    const double value =
+        results[RESULT_JITTERS + task * RROSACE_JITTER_NB_FEATURES + feature] -
+        (double)p_law->min;
+    size_t index = 0;
+
+    if ((width > 0.) && (value > 0.)) {
+      index = (size_t)(value * (double)nb_ranges / width);
+      if (index >= nb_ranges) {
+        index = nb_ranges - 1;
+      }
+    }
+    if (index != range) {
+      continue;
+    }
+
+    ++*p_nb_runs;
+    if (results[RESULT_NB_OPENINGS] > 0.) {
+      ++*p_nb_openings;
+    }
+    if (results[RESULT_NB_CHANGES] > 0.) {
+      ++*p_nb_changes;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
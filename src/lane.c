@@ -0,0 +1,488 @@
+/**
+ * @file lane.c
+ * @brief RROSACE Scheduling of cyber-physical system library remote FCC lanes
+ * body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifdef __linux__
+/* Anonymous shared mappings */
+#define _GNU_SOURCE
+#else
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <errno.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rrosace_lane.h>
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/* Size of a cache line, so that the producer and consumer do not share one */
+#define CACHE_LINE (64)
+
+/* Polls of a ring before yielding the core */
+#define SPINS (64)
+
+enum kind { COM, MON, STOP };
+
+/* Side of the lane waiting on a ring */
+enum side { HOST, LANE };
+
+/* Inputs of a step, or its outputs */
+struct message {
+  enum kind kind;
+  /* Number of the step posted, echoed with its outputs */
+  unsigned long sequence;
+  int ret;
+  rrosace_mode_t mode;
+  rrosace_master_in_law_t other_master_in_law;
+  rrosace_relay_state_t relay_delta_e_c;
+  rrosace_relay_state_t relay_delta_th_c;
+  rrosace_master_in_law_t master_in_law;
+  double h_f;
+  double vz_f;
+  double va_f;
+  double q_f;
+  double az_f;
+  double h_c;
+  double vz_c;
+  double va_c;
+  double delta_e_c;
+  double delta_th_c;
+  double dt;
+};
+
+/* Single-producer single-consumer ring, indexed by free running counters */
+struct ring {
+  unsigned long head;
+  char head_padding[CACHE_LINE - sizeof(unsigned long)];
+  unsigned long tail;
+  char tail_padding[CACHE_LINE - sizeof(unsigned long)];
+  struct message messages[RROSACE_LANE_RING_SIZE];
+};
+
+struct rrosace_lane {
+  /* Process of the host, watched by the lane */
+  pid_t host;
+  /* Steps posted, and steps waited for or given up, by the host */
+  unsigned long nb_posted;
+  unsigned long nb_awaited;
+  /* From the host to the lane */
+  struct ring inputs;
+  /* From the lane to the host */
+  struct ring outputs;
+};
+
+/* Wait of a side on a ring */
+struct wait {
+  const rrosace_lane_t *p_lane;
+  enum side side;
+  size_t spins;
+  /* Time past which the host gives up on the lane */
+  double deadline;
+};
+
+static double now(void);
+
+static void wait_init(struct wait * /* p_wait */,
+                      const rrosace_lane_t * /* p_lane */,
+                      enum side /* side */);
+
+static int spin(struct wait * /* p_wait */);
+
+static int produce(rrosace_lane_t * /* p_lane */, enum side /* side */,
+                   const struct message * /* p_message */);
+
+static int post(rrosace_lane_t * /* p_lane */,
+                struct message * /* p_message */);
+
+static int consume_outputs(rrosace_lane_t * /* p_lane */,
+                           struct message * /* p_message */);
+
+static int consume(rrosace_lane_t * /* p_lane */, enum side /* side */,
+                   struct message * /* p_message */);
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+static void wait_init(struct wait *p_wait, const rrosace_lane_t *p_lane,
+                      enum side side) {
+  p_wait->p_lane = p_lane;
+  p_wait->side = side;
+  p_wait->spins = 0;
+  p_wait->deadline = (side == HOST) ? now() + RROSACE_LANE_TIMEOUT : 0.;
+}
+
+/**
+ * @brief Poll again, yielding the core from time to time, unless the host
+ * timed out on the lane or the lane outlived the host process
+ */
+static int spin(struct wait *p_wait) {
+  int ret = EXIT_SUCCESS;
+
+  if (++p_wait->spins < SPINS) {
+    goto out;
+  }
+
+  sched_yield();
+  p_wait->spins = 0;
+
+  if (p_wait->side == HOST) {
+    ret = (now() > p_wait->deadline) ? EXIT_FAILURE : EXIT_SUCCESS;
+  } else {
+    ret = ((kill(p_wait->p_lane->host, 0) == -1) && (errno == ESRCH))
+              ? EXIT_FAILURE
+              : EXIT_SUCCESS;
+  }
+
+out:
+  return (ret);
+}
+
+static int produce(rrosace_lane_t *p_lane, enum side side,
+                   const struct message *p_message) {
+  int ret = EXIT_SUCCESS;
+  struct ring *p_ring = (side == HOST) ? &p_lane->inputs : &p_lane->outputs;
+  const unsigned long head = p_ring->head;
+  struct wait wait;
+
+  wait_init(&wait, p_lane, side);
+
+  while (head - __atomic_load_n(&p_ring->tail, __ATOMIC_ACQUIRE) >=
+         RROSACE_LANE_RING_SIZE) {
+    if (spin(&wait) == EXIT_FAILURE) {
+      ret = EXIT_FAILURE;
+      goto out;
+    }
+  }
+
+  p_ring->messages[head & (RROSACE_LANE_RING_SIZE - 1)] = *p_message;
+  __atomic_store_n(&p_ring->head, head + 1, __ATOMIC_RELEASE);
+
+out:
+  return (ret);
+}
+
+static int consume(rrosace_lane_t *p_lane, enum side side,
+                   struct message *p_message) {
+  int ret = EXIT_SUCCESS;
+  struct ring *p_ring = (side == HOST) ? &p_lane->outputs : &p_lane->inputs;
+  const unsigned long tail = p_ring->tail;
+  struct wait wait;
+
+  wait_init(&wait, p_lane, side);
+
+  while (__atomic_load_n(&p_ring->head, __ATOMIC_ACQUIRE) == tail) {
+    if (spin(&wait) == EXIT_FAILURE) {
+      ret = EXIT_FAILURE;
+      goto out;
+    }
+  }
+
+  *p_message = p_ring->messages[tail & (RROSACE_LANE_RING_SIZE - 1)];
+  __atomic_store_n(&p_ring->tail, tail + 1, __ATOMIC_RELEASE);
+
+out:
+  return (ret);
+}
+
+/**
+ * @brief Post a step from the host, numbered
+ */
+static int post(rrosace_lane_t *p_lane, struct message *p_message) {
+  int ret = EXIT_FAILURE;
+
+  p_message->sequence = p_lane->nb_posted;
+  if (produce(p_lane, HOST, p_message) == EXIT_FAILURE) {
+    goto out;
+  }
+  ++p_lane->nb_posted;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+/**
+ * @brief Consume the outputs of the oldest step awaited, the late outputs of
+ * the steps given up on a timeout being discarded
+ */
+static int consume_outputs(rrosace_lane_t *p_lane, struct message *p_message) {
+  int ret = EXIT_FAILURE;
+  unsigned long sequence;
+
+  if (p_lane->nb_awaited == p_lane->nb_posted) {
+    goto out;
+  }
+  /* Given up if the wait fails */
+  sequence = p_lane->nb_awaited++;
+
+  do {
+    if (consume(p_lane, HOST, p_message) == EXIT_FAILURE) {
+      goto out;
+    }
+  } while (p_message->sequence != sequence);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+rrosace_lane_t *rrosace_lane_new(void) {
+  rrosace_lane_t *p_lane = NULL;
+  void *p_mapping = mmap(NULL, sizeof(rrosace_lane_t), PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+  if (p_mapping == MAP_FAILED) {
+    goto out;
+  }
+
+  /* Zeroed by the mapping, both rings empty */
+  p_lane = (rrosace_lane_t *)p_mapping;
+  p_lane->host = getpid();
+
+out:
+  return (p_lane);
+}
+
+void rrosace_lane_del(rrosace_lane_t *p_lane) {
+  if (p_lane) {
+    munmap(p_lane, sizeof(rrosace_lane_t));
+  }
+}
+
+int rrosace_lane_serve(rrosace_lane_t *p_lane, rrosace_fcc_t *p_fcc) {
+  int ret = EXIT_FAILURE;
+  struct message message;
+
+  if (!p_lane || !p_fcc) {
+    goto out;
+  }
+
+  while (consume(p_lane, LANE, &message) == EXIT_SUCCESS) {
+    switch (message.kind) {
+    case COM:
+      message.ret = rrosace_fcc_com_step(
+          p_fcc, message.mode, message.h_f, message.vz_f, message.va_f,
+          message.q_f, message.az_f, message.h_c, message.vz_c, message.va_c,
+          &message.delta_e_c, &message.delta_th_c, message.dt);
+      break;
+    case MON:
+      message.ret = rrosace_fcc_mon_step(
+          p_fcc, message.mode, message.h_f, message.vz_f, message.va_f,
+          message.q_f, message.az_f, message.h_c, message.vz_c, message.va_c,
+          message.delta_e_c, message.delta_th_c, message.other_master_in_law,
+          &message.relay_delta_e_c, &message.relay_delta_th_c,
+          &message.master_in_law, message.dt);
+      break;
+    default:
+      ret = EXIT_SUCCESS;
+      goto out;
+    }
+
+    if (produce(p_lane, LANE, &message) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+out:
+  return (ret);
+}
+
+int rrosace_lane_stop(rrosace_lane_t *p_lane) {
+  int ret = EXIT_FAILURE;
+  struct message message;
+
+  if (!p_lane) {
+    goto out;
+  }
+
+  memset(&message, 0, sizeof(message));
+  message.kind = STOP;
+  ret = produce(p_lane, HOST, &message);
+
+out:
+  return (ret);
+}
+
+int rrosace_lane_post_com(rrosace_lane_t *p_lane, rrosace_mode_t mode,
+                          double h_f, double vz_f, double va_f, double q_f,
+                          double az_f, double h_c, double vz_c, double va_c,
+                          double dt) {
+  int ret = EXIT_FAILURE;
+  struct message message;
+
+  if (!p_lane) {
+    goto out;
+  }
+
+  memset(&message, 0, sizeof(message));
+  message.kind = COM;
+  message.mode = mode;
+  message.h_f = h_f;
+  message.vz_f = vz_f;
+  message.va_f = va_f;
+  message.q_f = q_f;
+  message.az_f = az_f;
+  message.h_c = h_c;
+  message.vz_c = vz_c;
+  message.va_c = va_c;
+  message.dt = dt;
+  ret = post(p_lane, &message);
+
+out:
+  return (ret);
+}
+
+int rrosace_lane_wait_com(rrosace_lane_t *p_lane, double *p_delta_e_c,
+                          double *p_delta_th_c) {
+  int ret = EXIT_FAILURE;
+  struct message message;
+
+  if (!p_lane || !p_delta_e_c || !p_delta_th_c ||
+      (consume_outputs(p_lane, &message) == EXIT_FAILURE) ||
+      (message.kind != COM) || (message.ret == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  *p_delta_e_c = message.delta_e_c;
+  *p_delta_th_c = message.delta_th_c;
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_lane_post_mon(rrosace_lane_t *p_lane, rrosace_mode_t mode,
+                          double h_f, double vz_f, double va_f, double q_f,
+                          double az_f, double h_c, double vz_c, double va_c,
+                          double delta_e_c_monitored,
+                          double delta_th_c_monitored,
+                          rrosace_master_in_law_t other_master_in_law,
+                          double dt) {
+  int ret = EXIT_FAILURE;
+  struct message message;
+
+  if (!p_lane) {
+    goto out;
+  }
+
+  memset(&message, 0, sizeof(message));
+  message.kind = MON;
+  message.mode = mode;
+  message.h_f = h_f;
+  message.vz_f = vz_f;
+  message.va_f = va_f;
+  message.q_f = q_f;
+  message.az_f = az_f;
+  message.h_c = h_c;
+  message.vz_c = vz_c;
+  message.va_c = va_c;
+  message.delta_e_c = delta_e_c_monitored;
+  message.delta_th_c = delta_th_c_monitored;
+  message.other_master_in_law = other_master_in_law;
+  message.dt = dt;
+  ret = post(p_lane, &message);
+
+out:
+  return (ret);
+}
+
+int rrosace_lane_wait_mon(rrosace_lane_t *p_lane,
+                          rrosace_relay_state_t *p_relay_delta_e_c,
+                          rrosace_relay_state_t *p_relay_delta_th_c,
+                          rrosace_master_in_law_t *p_master_in_law) {
+  int ret = EXIT_FAILURE;
+  struct message message;
+
+  if (!p_lane || !p_relay_delta_e_c || !p_relay_delta_th_c ||
+      !p_master_in_law ||
+      (consume_outputs(p_lane, &message) == EXIT_FAILURE) ||
+      (message.kind != MON) || (message.ret == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  *p_relay_delta_e_c = message.relay_delta_e_c;
+  *p_relay_delta_th_c = message.relay_delta_th_c;
+  *p_master_in_law = message.master_in_law;
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_lane_com_step(rrosace_lane_t *p_lane, rrosace_mode_t mode,
+                          double h_f, double vz_f, double va_f, double q_f,
+                          double az_f, double h_c, double vz_c, double va_c,
+                          double *p_delta_e_c, double *p_delta_th_c,
+                          double dt) {
+  int ret = EXIT_FAILURE;
+
+  if ((rrosace_lane_post_com(p_lane, mode, h_f, vz_f, va_f, q_f, az_f, h_c,
+                             vz_c, va_c, dt) == EXIT_FAILURE) ||
+      (rrosace_lane_wait_com(p_lane, p_delta_e_c, p_delta_th_c) ==
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_lane_mon_step(rrosace_lane_t *p_lane, rrosace_mode_t mode,
+                          double h_f, double vz_f, double va_f, double q_f,
+                          double az_f, double h_c, double vz_c, double va_c,
+                          double delta_e_c_monitored,
+                          double delta_th_c_monitored,
+                          rrosace_master_in_law_t other_master_in_law,
+                          rrosace_relay_state_t *p_relay_delta_e_c,
+                          rrosace_relay_state_t *p_relay_delta_th_c,
+                          rrosace_master_in_law_t *p_master_in_law,
+                          double dt) {
+  int ret = EXIT_FAILURE;
+
+  if ((rrosace_lane_post_mon(p_lane, mode, h_f, vz_f, va_f, q_f, az_f, h_c,
+                             vz_c, va_c, delta_e_c_monitored,
+                             delta_th_c_monitored, other_master_in_law,
+                             dt) == EXIT_FAILURE) ||
+      (rrosace_lane_wait_mon(p_lane, p_relay_delta_e_c, p_relay_delta_th_c,
+                             p_master_in_law) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
@@ -0,0 +1,344 @@
+/**
+ * @file parareal.c
+ * @brief RROSACE Scheduling of cyber-physical system library Parareal
+ * time-parallel driver body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace_parareal.h>
+
+enum entry_kind { CONTINUOUS, DISCRETE };
+
+struct rrosace_parareal {
+  size_t state_size;
+  size_t nb_slices;
+  rrosace_parareal_propagator_t fine;
+  rrosace_parareal_propagator_t coarse;
+  void *p_context;
+
+  unsigned char *kinds;
+  /* Slices boundaries, nb_slices + 1 states */
+  double *u;
+  /* Fine and coarse propagations of the slices, nb_slices states each */
+  double *f;
+  double *g;
+  double *g_new;
+};
+
+/* Share of the fine propagations of an iteration for one thread */
+struct fine_worker {
+  rrosace_parareal_t *p_parareal;
+  size_t first;
+  size_t stride;
+  int ret;
+};
+
+static double *state_at(double * /* states */, size_t /* state_size */,
+                        size_t /* index */);
+
+static void *fine_propagations(void * /* p_arg */);
+
+static int fine_sweep(rrosace_parareal_t * /* p_parareal */,
+                      size_t /* first */, size_t /* nb_threads */);
+
+static int coarse_correction(rrosace_parareal_t * /* p_parareal */,
+                             size_t /* first */, double * /* p_max_change */);
+
+static double *state_at(double *states, size_t state_size, size_t index) {
+  return (states + state_size * index);
+}
+
+/**
+ * @brief Fine propagations of the slices first, first + stride, ...
+ */
+static void *fine_propagations(void *p_arg) {
+  struct fine_worker *p_worker = (struct fine_worker *)p_arg;
+  rrosace_parareal_t *p_parareal = p_worker->p_parareal;
+  const size_t state_size = p_parareal->state_size;
+  size_t slice;
+
+  p_worker->ret = EXIT_SUCCESS;
+
+  for (slice = p_worker->first;
+       (slice < p_parareal->nb_slices) && (p_worker->ret == EXIT_SUCCESS);
+       slice += p_worker->stride) {
+    p_worker->ret =
+        p_parareal->fine(p_parareal->p_context, slice,
+                         state_at(p_parareal->u, state_size, slice),
+                         state_at(p_parareal->f, state_size, slice));
+  }
+
+  return (NULL);
+}
+
+/**
+ * @brief Fine propagations of all the slices not converged yet, in parallel
+ */
+static int fine_sweep(rrosace_parareal_t *p_parareal, size_t first,
+                      size_t nb_threads) {
+  int ret = EXIT_FAILURE;
+  struct fine_worker *workers = NULL;
+  pthread_t *threads = NULL;
+  size_t nb_started = 0;
+  size_t i;
+
+  if (nb_threads > p_parareal->nb_slices - first) {
+    nb_threads = p_parareal->nb_slices - first;
+  }
+
+  workers = (struct fine_worker *)malloc(nb_threads * sizeof(*workers));
+  threads = (pthread_t *)malloc(nb_threads * sizeof(*threads));
+  if (!workers || !threads) {
+    goto out;
+  }
+
+  for (i = 0; i < nb_threads; ++i) {
+    workers[i].p_parareal = p_parareal;
+    workers[i].first = first + i;
+    workers[i].stride = nb_threads;
+    workers[i].ret = EXIT_FAILURE;
+  }
+
+  /* The calling thread takes the first share */
+  for (nb_started = 1; nb_started < nb_threads; ++nb_started) {
+    if (pthread_create(&threads[nb_started], NULL, fine_propagations,
+                       &workers[nb_started]) != 0) {
+      break;
+    }
+  }
+
+  fine_propagations(&workers[0]);
+
+  ret = EXIT_SUCCESS;
+  for (i = 1; i < nb_started; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  for (i = 0; i < nb_threads; ++i) {
+    if ((i >= nb_started) || (workers[i].ret == EXIT_FAILURE)) {
+      ret = EXIT_FAILURE;
+    }
+  }
+
+out:
+  free(threads);
+  free(workers);
+
+  return (ret);
+}
+
+/**
+ * @brief Serial coarse sweep correcting the boundaries after the first slice
+ * not converged yet, U(k+1) = G_new(U(k)) + F_old(U(k)) - G_old(U(k))
+ */
+static int coarse_correction(rrosace_parareal_t *p_parareal, size_t first,
+                             double *p_max_change) {
+  int ret = EXIT_SUCCESS;
+  const size_t state_size = p_parareal->state_size;
+  size_t slice;
+  size_t i;
+
+  *p_max_change = 0.;
+
+  for (slice = first; (slice < p_parareal->nb_slices) && (ret == EXIT_SUCCESS);
+       ++slice) {
+    double *u_in = state_at(p_parareal->u, state_size, slice);
+    double *u_out = state_at(p_parareal->u, state_size, slice + 1);
+    double *f = state_at(p_parareal->f, state_size, slice);
+    double *g = state_at(p_parareal->g, state_size, slice);
+
+    /* The start of the first slice is exact, so is its fine propagation */
+    if (slice == first) {
+      memcpy(p_parareal->g_new, g, state_size * sizeof(double));
+    } else {
+      ret = p_parareal->coarse(p_parareal->p_context, slice, u_in,
+                               p_parareal->g_new);
+    }
+
+    for (i = 0; (i < state_size) && (ret == EXIT_SUCCESS); ++i) {
+      double value;
+      double change;
+
+      if (slice == first) {
+        value = f[i];
+      } else if (p_parareal->kinds[i] == DISCRETE) {
+        value = p_parareal->g_new[i] == g[i] ? f[i] : p_parareal->g_new[i];
+      } else {
+        value = p_parareal->g_new[i] + f[i] - g[i];
+      }
+
+      change = fabs(value - u_out[i]) / (fabs(u_out[i]) > 1. ? fabs(u_out[i])
+                                                             : 1.);
+      if (change > *p_max_change) {
+        *p_max_change = change;
+      }
+
+      u_out[i] = value;
+    }
+
+    memcpy(g, p_parareal->g_new, state_size * sizeof(double));
+  }
+
+  return (ret);
+}
+
+rrosace_parareal_t *rrosace_parareal_new(size_t state_size, size_t nb_slices,
+                                         rrosace_parareal_propagator_t fine,
+                                         rrosace_parareal_propagator_t coarse,
+                                         void *p_context) {
+  rrosace_parareal_t *p_parareal = NULL;
+
+  if (!state_size || !nb_slices || !fine || !coarse) {
+    goto out;
+  }
+
+  p_parareal = (rrosace_parareal_t *)calloc(1, sizeof(rrosace_parareal_t));
+  if (!p_parareal) {
+    goto out;
+  }
+
+  p_parareal->state_size = state_size;
+  p_parareal->nb_slices = nb_slices;
+  p_parareal->fine = fine;
+  p_parareal->coarse = coarse;
+  p_parareal->p_context = p_context;
+
+  p_parareal->kinds = (unsigned char *)malloc(state_size);
+  p_parareal->u =
+      (double *)malloc((nb_slices + 1) * state_size * sizeof(double));
+  p_parareal->f = (double *)malloc(nb_slices * state_size * sizeof(double));
+  p_parareal->g = (double *)malloc(nb_slices * state_size * sizeof(double));
+  p_parareal->g_new = (double *)malloc(state_size * sizeof(double));
+
+  if (!p_parareal->kinds || !p_parareal->u || !p_parareal->f ||
+      !p_parareal->g || !p_parareal->g_new) {
+    rrosace_parareal_del(p_parareal);
+    p_parareal = NULL;
+    goto out;
+  }
+
+  memset(p_parareal->kinds, CONTINUOUS, state_size);
+
+out:
+  return (p_parareal);
+}
+
+void rrosace_parareal_del(rrosace_parareal_t *p_parareal) {
+  if (p_parareal) {
+    free(p_parareal->kinds);
+    free(p_parareal->u);
+    free(p_parareal->f);
+    free(p_parareal->g);
+    free(p_parareal->g_new);
+    free(p_parareal);
+  }
+}
+
+int rrosace_parareal_set_discrete(rrosace_parareal_t *p_parareal,
+                                  size_t index) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_parareal || (index >= p_parareal->state_size)) {
+    goto out;
+  }
+
+  p_parareal->kinds[index] = DISCRETE;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_parareal_run(rrosace_parareal_t *p_parareal, const double state0[],
+                         double tolerance, size_t max_iterations,
+                         size_t nb_threads, size_t *p_iterations) {
+  int ret = EXIT_FAILURE;
+  size_t state_size;
+  size_t first = 0;
+  size_t iterations = 0;
+  double max_change = tolerance + 1.;
+  size_t slice;
+
+  if (!p_parareal || !state0 || !nb_threads) {
+    goto out;
+  }
+
+  state_size = p_parareal->state_size;
+
+  /* Initial guess from a coarse sweep */
+  memcpy(p_parareal->u, state0, state_size * sizeof(double));
+  for (slice = 0; slice < p_parareal->nb_slices; ++slice) {
+    ret = p_parareal->coarse(p_parareal->p_context, slice,
+                             state_at(p_parareal->u, state_size, slice),
+                             state_at(p_parareal->g, state_size, slice));
+    if (ret == EXIT_FAILURE) {
+      goto out;
+    }
+    memcpy(state_at(p_parareal->u, state_size, slice + 1),
+           state_at(p_parareal->g, state_size, slice),
+           state_size * sizeof(double));
+  }
+
+  /* After each iteration, one more slice is exact */
+  while ((max_change > tolerance) && (first < p_parareal->nb_slices) &&
+         (iterations < max_iterations)) {
+    ret = fine_sweep(p_parareal, first, nb_threads);
+    if (ret == EXIT_FAILURE) {
+      goto out;
+    }
+
+    ret = coarse_correction(p_parareal, first, &max_change);
+    if (ret == EXIT_FAILURE) {
+      goto out;
+    }
+
+    ++first;
+    ++iterations;
+  }
+
+  ret = (max_change <= tolerance) || (first == p_parareal->nb_slices)
+            ? EXIT_SUCCESS
+            : EXIT_FAILURE;
+
+out:
+  if (p_iterations) {
+    *p_iterations = iterations;
+  }
+
+  return (ret);
+}
+
+int rrosace_parareal_get_state(const rrosace_parareal_t *p_parareal,
+                               size_t slice, double state[]) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_parareal || !state || (slice > p_parareal->nb_slices)) {
+    goto out;
+  }
+
+  memcpy(state, p_parareal->u + p_parareal->state_size * slice,
+         p_parareal->state_size * sizeof(double));
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
@@ -0,0 +1,659 @@
+/**
+ * @file qmc.c
+ * @brief RROSACE Scheduling of cyber-physical system library quasi-Monte
+ * Carlo campaigns body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace_qmc.h>
+
+#include "random.h"
+
+/* Sequences are generated on 32 bits */
+#define MASK_32 (0xFFFFFFFFUL)
+#define TWO_POW_32 (4294967296.0)
+#define SOBOL_BITS (32)
+
+/* Digits of a Halton coordinate, enough for the double precision */
+#define MANTISSA_BITS (53)
+
+/* Bounds of the normal quantiles, the sequences may reach 0 */
+#define MIN_PROBABILITY (1e-16)
+
+/* Primitive polynomials and initial direction numbers of the Sobol sequence,
+ * from Joe and Kuo (new-joe-kuo-6.21201), the first dimension being the van
+ * der Corput sequence */
+#define SOBOL_MAX_DEGREE (6)
+static const unsigned int sobol_degrees[RROSACE_QMC_MAX_DIMENSION] = {
+    0, 1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6};
+static const unsigned int sobol_polynomials[RROSACE_QMC_MAX_DIMENSION] = {
+    0, 0, 1, 1, 2, 1, 4, 2, 4, 7, 11, 13, 14, 1, 13, 16};
+static const unsigned int
+    sobol_initials[RROSACE_QMC_MAX_DIMENSION][SOBOL_MAX_DEGREE] = {
+        {0, 0, 0, 0, 0, 0},     {1, 0, 0, 0, 0, 0},   {1, 3, 0, 0, 0, 0},
+        {1, 3, 1, 0, 0, 0},     {1, 1, 1, 0, 0, 0},   {1, 1, 3, 3, 0, 0},
+        {1, 3, 5, 13, 0, 0},    {1, 1, 5, 5, 17, 0},  {1, 1, 5, 5, 5, 0},
+        {1, 1, 7, 11, 19, 0},   {1, 1, 5, 1, 1, 0},   {1, 1, 1, 3, 11, 0},
+        {1, 3, 5, 5, 31, 0},    {1, 3, 3, 9, 7, 49},  {1, 1, 1, 15, 21, 21},
+        {1, 3, 1, 13, 27, 49}};
+
+static const unsigned int halton_bases[RROSACE_QMC_MAX_DIMENSION] = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+
+/* Two-sided 97.5 % Student quantiles, per degrees of freedom from 1 */
+#define NB_STUDENT_QUANTILES (30)
+#define NORMAL_QUANTILE (1.96)
+static const double student_quantiles[NB_STUDENT_QUANTILES] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+struct rrosace_qmc {
+  rrosace_qmc_sequence_t sequence;
+  size_t dimension;
+  unsigned long index;
+  unsigned long random_state;
+
+  /* Sobol, direction numbers, current point and scrambling seeds */
+  unsigned long directions[RROSACE_QMC_MAX_DIMENSION][SOBOL_BITS];
+  unsigned long sobol[RROSACE_QMC_MAX_DIMENSION];
+  unsigned long seeds[RROSACE_QMC_MAX_DIMENSION];
+
+  /* Halton, per dimension, a permutation of the digits per position */
+  unsigned char *permutations[RROSACE_QMC_MAX_DIMENSION];
+  size_t nb_digits[RROSACE_QMC_MAX_DIMENSION];
+};
+
+/** Statistics of an output over a replicate, Welford's recurrence */
+struct statistics {
+  size_t count;
+  double mean;
+  double m2;
+};
+
+struct rrosace_qmc_campaign {
+  rrosace_qmc_parameter_t *parameters;
+  size_t nb_parameters;
+  size_t nb_outputs;
+  size_t nb_replicates;
+  rrosace_qmc_t **p_replicates;
+  /* Statistics, per replicate then per output */
+  struct statistics *statistics;
+  size_t next_replicate;
+  size_t pending_replicate;
+  size_t nb_runs;
+  double *point;
+};
+
+static unsigned long reverse_bits(unsigned long /* x */);
+
+static unsigned long owen_scramble(unsigned long /* x */,
+                                   unsigned long /* seed */);
+
+static void sobol_init(rrosace_qmc_t * /* p_qmc */);
+
+static int halton_init(rrosace_qmc_t * /* p_qmc */);
+
+static double halton_coordinate(const rrosace_qmc_t * /* p_qmc */,
+                                size_t /* dimension */,
+                                unsigned long /* index */);
+
+static double normal_quantile(double /* p */);
+
+static double student_quantile(size_t /* degrees */);
+
+static int replicates_spread(const rrosace_qmc_campaign_t * /* p_campaign */,
+                             size_t /* output */, int /* deviation */,
+                             double * /* p_estimate */,
+                             double * /* p_half_width */);
+
+static unsigned long reverse_bits(unsigned long x) {
+  unsigned long reversed = 0;
+  size_t bit;
+
+  for (bit = 0; bit < SOBOL_BITS; ++bit) {
+    reversed = (reversed << 1) | (x & 1UL);
+    x >>= 1;
+  }
+
+  return (reversed);
+}
+
+/**
+ * @brief Nested uniform scrambling in base 2 by a hash of the reversed bits,
+ * after Burley, Practical Hash-based Owen Scrambling, JCGT 2020
+ */
+static unsigned long owen_scramble(unsigned long x, unsigned long seed) {
+  x = reverse_bits(x);
+  x ^= (x * 0x3D20ADEAUL) & MASK_32;
+  x = (x + seed) & MASK_32;
+  x = (x * ((seed >> 16) | 1UL)) & MASK_32;
+  x ^= (x * 0x05526C56UL) & MASK_32;
+  x ^= (x * 0x53A22864UL) & MASK_32;
+
+  return (reverse_bits(x));
+}
+
+/**
+ * @brief Direction numbers from the primitive polynomials
+ */
+static void sobol_init(rrosace_qmc_t *p_qmc) {
+  size_t dimension;
+  size_t k;
+  size_t j;
+
+  for (dimension = 0; dimension < p_qmc->dimension; ++dimension) {
+    const size_t degree = sobol_degrees[dimension];
+    unsigned long *directions = p_qmc->directions[dimension];
+
+    if (dimension == 0) {
+      for (k = 0; k < SOBOL_BITS; ++k) {
+        directions[k] = 1UL << (SOBOL_BITS - 1 - k);
+      }
+    } else {
+      for (k = 0; k < degree; ++k) {
+        directions[k] = (unsigned long)sobol_initials[dimension][k]
+                        << (SOBOL_BITS - 1 - k);
+      }
+      for (k = degree; k < SOBOL_BITS; ++k) {
+        directions[k] =
+            directions[k - degree] ^ (directions[k - degree] >> degree);
+        for (j = 1; j < degree; ++j) {
+          if ((sobol_polynomials[dimension] >> (degree - 1 - j)) & 1U) {
+            directions[k] ^= directions[k - j];
+          }
+        }
+      }
+    }
+
+    p_qmc->sobol[dimension] = 0;
+    p_qmc->seeds[dimension] = rrosace_random_next(&p_qmc->random_state);
+  }
+}
+
+/**
+ * @brief Random permutations of the digits, per dimension and position
+ */
+static int halton_init(rrosace_qmc_t *p_qmc) {
+  size_t dimension;
+  size_t position;
+  unsigned int digit;
+
+  for (dimension = 0; dimension < p_qmc->dimension; ++dimension) {
+    const unsigned int base = halton_bases[dimension];
+    const size_t nb_digits =
+        (size_t)ceil(MANTISSA_BITS * log(2.) / log((double)base));
+    unsigned char *permutations =
+        (unsigned char *)malloc(nb_digits * base * sizeof(unsigned char));
+
+    if (!permutations) {
+      return (EXIT_FAILURE);
+    }
+    p_qmc->permutations[dimension] = permutations;
+    p_qmc->nb_digits[dimension] = nb_digits;
+
+    /* Fisher-Yates shuffles */
+    for (position = 0; position < nb_digits; ++position) {
+      unsigned char *permutation = permutations + position * base;
+
+      for (digit = 0; digit < base; ++digit) {
+        permutation[digit] = (unsigned char)digit;
+      }
+      for (digit = base - 1; digit > 0; --digit) {
+        const unsigned int other =
+            (unsigned int)(rrosace_random_next(&p_qmc->random_state) %
+                           (digit + 1));
+        const unsigned char swap = permutation[digit];
+
+        permutation[digit] = permutation[other];
+        permutation[other] = swap;
+      }
+    }
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+static double halton_coordinate(const rrosace_qmc_t *p_qmc, size_t dimension,
+                                unsigned long index) {
+  const unsigned int base = halton_bases[dimension];
+  const unsigned char *permutations = p_qmc->permutations[dimension];
+  const double inverse_base = 1. / base;
+  double weight = inverse_base;
+  double coordinate = 0.;
+  size_t position;
+
+  for (position = 0; position < p_qmc->nb_digits[dimension]; ++position) {
+    const unsigned int digit = (unsigned int)(index % base);
+
+    coordinate += weight * permutations[position * base + digit];
+    weight *= inverse_base;
+    index /= base;
+  }
+
+  return (coordinate < 1. ? coordinate : 1. - DBL_EPSILON / 2.);
+}
+
+/**
+ * @brief Quantile of the standard normal distribution, Acklam's rational
+ * approximation, relative error below 1.2e-9
+ */
+static double normal_quantile(double p) {
+  static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02,
+                             -2.759285104469687e+02, 1.383577518672690e+02,
+                             -3.066479806614716e+01, 2.506628277459239e+00};
+  static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02,
+                             -1.556989798598866e+02, 6.680131188771972e+01,
+                             -1.328068155288572e+01};
+  static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01,
+                             -2.400758277161838e+00, -2.549732539343734e+00,
+                             4.374664141464968e+00,  2.938163982698783e+00};
+  static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01,
+                             2.445134137142996e+00, 3.754408661907416e+00};
+  const double p_low = 0.02425;
+  double q;
+  double r;
+
+  if (p < MIN_PROBABILITY) {
+    p = MIN_PROBABILITY;
+  } else if (p > 1. - MIN_PROBABILITY) {
+    p = 1. - MIN_PROBABILITY;
+  }
+
+  if (p < p_low) {
+    q = sqrt(-2. * log(p));
+    return ((((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q +
+             c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.));
+  }
+
+  if (p > 1. - p_low) {
+    q = sqrt(-2. * log(1. - p));
+    return (-(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q +
+              c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.));
+  }
+
+  q = p - 0.5;
+  r = q * q;
+  return ((((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r +
+           a[5]) *
+          q /
+          (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.));
+}
+
+static double student_quantile(size_t degrees) {
+  return (degrees <= NB_STUDENT_QUANTILES ? student_quantiles[degrees - 1]
+                                          : NORMAL_QUANTILE);
+}
+
+/**
+ * @brief Estimate of an output statistic, the mean of the replicates
+ * estimates, and the half width of its confidence interval from their spread
+ */
+static int replicates_spread(const rrosace_qmc_campaign_t *p_campaign,
+                             size_t output, int deviation, double *p_estimate,
+                             double *p_half_width) {
+  const size_t nb_replicates = p_campaign->nb_replicates;
+  double sum = 0.;
+  double sum_squares = 0.;
+  double mean;
+  double variance;
+  size_t replicate;
+
+  for (replicate = 0; replicate < nb_replicates; ++replicate) {
+    const struct statistics *p_statistics =
+        &p_campaign->statistics[replicate * p_campaign->nb_outputs + output];
+    double estimate;
+
+    if (p_statistics->count < 2) {
+      return (EXIT_FAILURE);
+    }
+
+    estimate = deviation
+                   ? sqrt(p_statistics->m2 / (double)(p_statistics->count - 1))
+                   : p_statistics->mean;
+    sum += estimate;
+    sum_squares += estimate * estimate;
+  }
+
+  mean = sum / (double)nb_replicates;
+  variance = (sum_squares - sum * mean) / (double)(nb_replicates - 1);
+
+  *p_estimate = mean;
+  *p_half_width = student_quantile(nb_replicates - 1) *
+                  sqrt((variance > 0. ? variance : 0.) /
+                       (double)nb_replicates);
+
+  return (EXIT_SUCCESS);
+}
+
+rrosace_qmc_t *rrosace_qmc_new(rrosace_qmc_sequence_t sequence,
+                               size_t dimension, unsigned long seed) {
+  rrosace_qmc_t *p_qmc = NULL;
+
+  if (!dimension || (dimension > RROSACE_QMC_MAX_DIMENSION)) {
+    goto out;
+  }
+
+  p_qmc = (rrosace_qmc_t *)calloc(1, sizeof(*p_qmc));
+  if (!p_qmc) {
+    goto out;
+  }
+
+  p_qmc->sequence = sequence;
+  p_qmc->dimension = dimension;
+  p_qmc->random_state = seed & MASK_32;
+
+  switch (sequence) {
+  case RROSACE_QMC_SOBOL:
+    sobol_init(p_qmc);
+    break;
+  case RROSACE_QMC_HALTON:
+    if (halton_init(p_qmc) == EXIT_FAILURE) {
+      rrosace_qmc_del(p_qmc);
+      p_qmc = NULL;
+    }
+    break;
+  case RROSACE_QMC_RANDOM:
+    break;
+  default:
+    rrosace_qmc_del(p_qmc);
+    p_qmc = NULL;
+    break;
+  }
+
+out:
+  return (p_qmc);
+}
+
+void rrosace_qmc_del(rrosace_qmc_t *p_qmc) {
+  size_t dimension;
+
+  if (p_qmc) {
+    for (dimension = 0; dimension < RROSACE_QMC_MAX_DIMENSION; ++dimension) {
+      free(p_qmc->permutations[dimension]);
+    }
+    free(p_qmc);
+  }
+}
+
+int rrosace_qmc_next(rrosace_qmc_t *p_qmc, double point[]) {
+  int ret = EXIT_FAILURE;
+  size_t dimension;
+
+  if (!p_qmc || !point) {
+    goto out;
+  }
+
+  switch (p_qmc->sequence) {
+  case RROSACE_QMC_SOBOL: {
+    unsigned long index = p_qmc->index;
+    size_t lowest_zero = 0;
+
+    if (index == MASK_32) {
+      goto out;
+    }
+
+    for (dimension = 0; dimension < p_qmc->dimension; ++dimension) {
+      point[dimension] = (double)owen_scramble(p_qmc->sobol[dimension],
+                                               p_qmc->seeds[dimension]) /
+                         TWO_POW_32;
+    }
+
+    /* Gray code order, one direction per point */
+    while (index & 1UL) {
+      index >>= 1;
+      ++lowest_zero;
+    }
+    for (dimension = 0; dimension < p_qmc->dimension; ++dimension) {
+      p_qmc->sobol[dimension] ^= p_qmc->directions[dimension][lowest_zero];
+    }
+    break;
+  }
+  case RROSACE_QMC_HALTON:
+    for (dimension = 0; dimension < p_qmc->dimension; ++dimension) {
+      point[dimension] = halton_coordinate(p_qmc, dimension, p_qmc->index);
+    }
+    break;
+  default:
+    for (dimension = 0; dimension < p_qmc->dimension; ++dimension) {
+      const unsigned long high = rrosace_random_next(&p_qmc->random_state) >> 5;
+      const unsigned long low = rrosace_random_next(&p_qmc->random_state) >> 6;
+
+      point[dimension] = ((double)high * 67108864. + (double)low) /
+                         9007199254740992.;
+    }
+    break;
+  }
+
+  p_qmc->index = (p_qmc->index + 1) & MASK_32;
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+rrosace_qmc_campaign_t *
+rrosace_qmc_campaign_new(rrosace_qmc_sequence_t sequence,
+                         const rrosace_qmc_parameter_t parameters[],
+                         size_t nb_parameters, size_t nb_outputs,
+                         size_t nb_replicates, unsigned long seed) {
+  rrosace_qmc_campaign_t *p_campaign = NULL;
+  unsigned long random_state = seed & MASK_32;
+  size_t replicate;
+
+  if (!parameters || !nb_parameters || !nb_outputs || (nb_replicates < 2)) {
+    goto out;
+  }
+
+  p_campaign = (rrosace_qmc_campaign_t *)calloc(1, sizeof(*p_campaign));
+  if (!p_campaign) {
+    goto out;
+  }
+
+  p_campaign->nb_parameters = nb_parameters;
+  p_campaign->nb_outputs = nb_outputs;
+  p_campaign->nb_replicates = nb_replicates;
+  p_campaign->pending_replicate = nb_replicates;
+  p_campaign->parameters = (rrosace_qmc_parameter_t *)malloc(
+      nb_parameters * sizeof(rrosace_qmc_parameter_t));
+  p_campaign->p_replicates =
+      (rrosace_qmc_t **)calloc(nb_replicates, sizeof(rrosace_qmc_t *));
+  p_campaign->statistics = (struct statistics *)calloc(
+      nb_replicates * nb_outputs, sizeof(struct statistics));
+  p_campaign->point = (double *)malloc(nb_parameters * sizeof(double));
+
+  if (!p_campaign->parameters || !p_campaign->p_replicates ||
+      !p_campaign->statistics || !p_campaign->point) {
+    rrosace_qmc_campaign_del(p_campaign);
+    p_campaign = NULL;
+    goto out;
+  }
+
+  memcpy(p_campaign->parameters, parameters,
+         nb_parameters * sizeof(rrosace_qmc_parameter_t));
+
+  for (replicate = 0; replicate < nb_replicates; ++replicate) {
+    p_campaign->p_replicates[replicate] = rrosace_qmc_new(
+        sequence, nb_parameters, rrosace_random_next(&random_state));
+    if (!p_campaign->p_replicates[replicate]) {
+      rrosace_qmc_campaign_del(p_campaign);
+      p_campaign = NULL;
+      goto out;
+    }
+  }
+
+out:
+  return (p_campaign);
+}
+
+void rrosace_qmc_campaign_del(rrosace_qmc_campaign_t *p_campaign) {
+  size_t replicate;
+
+  if (p_campaign) {
+    if (p_campaign->p_replicates) {
+      for (replicate = 0; replicate < p_campaign->nb_replicates;
+           ++replicate) {
+        rrosace_qmc_del(p_campaign->p_replicates[replicate]);
+      }
+    }
+    free(p_campaign->parameters);
+    free(p_campaign->p_replicates);
+    free(p_campaign->statistics);
+    free(p_campaign->point);
+    free(p_campaign);
+  }
+}
+
+size_t rrosace_qmc_campaign_find(const rrosace_qmc_campaign_t *p_campaign,
+                                 const char *name) {
+  size_t parameter;
+
+  if (!p_campaign || !name) {
+    return (0);
+  }
+
+  for (parameter = 0; parameter < p_campaign->nb_parameters; ++parameter) {
+    const char *parameter_name = p_campaign->parameters[parameter].name;
+
+    if (parameter_name && (strcmp(parameter_name, name) == 0)) {
+      break;
+    }
+  }
+
+  return (parameter);
+}
+
+int rrosace_qmc_campaign_sample(rrosace_qmc_campaign_t *p_campaign,
+                                double values[]) {
+  int ret = EXIT_FAILURE;
+  size_t parameter;
+
+  if (!p_campaign || !values) {
+    goto out;
+  }
+
+  if (rrosace_qmc_next(p_campaign->p_replicates[p_campaign->next_replicate],
+                       p_campaign->point) == EXIT_FAILURE) {
+    goto out;
+  }
+
+  for (parameter = 0; parameter < p_campaign->nb_parameters; ++parameter) {
+    const rrosace_qmc_parameter_t *p_parameter =
+        &p_campaign->parameters[parameter];
+    const double u = p_campaign->point[parameter];
+
+    if (p_parameter->distribution == RROSACE_QMC_NORMAL) {
+      values[parameter] = p_parameter->a + p_parameter->b * normal_quantile(u);
+    } else {
+      values[parameter] =
+          p_parameter->a + (p_parameter->b - p_parameter->a) * u;
+    }
+  }
+
+  p_campaign->pending_replicate = p_campaign->next_replicate;
+  p_campaign->next_replicate =
+      (p_campaign->next_replicate + 1) % p_campaign->nb_replicates;
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_qmc_campaign_record(rrosace_qmc_campaign_t *p_campaign,
+                                const double outputs[]) {
+  int ret = EXIT_FAILURE;
+  struct statistics *statistics;
+  size_t output;
+
+  if (!p_campaign || !outputs ||
+      (p_campaign->pending_replicate == p_campaign->nb_replicates)) {
+    goto out;
+  }
+
+  statistics = p_campaign->statistics +
+               p_campaign->pending_replicate * p_campaign->nb_outputs;
+
+  for (output = 0; output < p_campaign->nb_outputs; ++output) {
+    struct statistics *p_statistics = &statistics[output];
+    const double delta = outputs[output] - p_statistics->mean;
+
+    ++p_statistics->count;
+    p_statistics->mean += delta / (double)p_statistics->count;
+    p_statistics->m2 += delta * (outputs[output] - p_statistics->mean);
+  }
+
+  p_campaign->pending_replicate = p_campaign->nb_replicates;
+  ++p_campaign->nb_runs;
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+size_t rrosace_qmc_campaign_get_runs(const rrosace_qmc_campaign_t *p_campaign) {
+  return (p_campaign ? p_campaign->nb_runs : 0);
+}
+
+int rrosace_qmc_campaign_get_mean(const rrosace_qmc_campaign_t *p_campaign,
+                                  size_t output, double *p_mean,
+                                  double *p_half_width) {
+  if (!p_campaign || (output >= p_campaign->nb_outputs) || !p_mean ||
+      !p_half_width) {
+    return (EXIT_FAILURE);
+  }
+
+  return (replicates_spread(p_campaign, output, 0, p_mean, p_half_width));
+}
+
+int rrosace_qmc_campaign_get_deviation(
+    const rrosace_qmc_campaign_t *p_campaign, size_t output,
+    double *p_deviation, double *p_half_width) {
+  if (!p_campaign || (output >= p_campaign->nb_outputs) || !p_deviation ||
+      !p_half_width) {
+    return (EXIT_FAILURE);
+  }
+
+  return (replicates_spread(p_campaign, output, 1, p_deviation, p_half_width));
+}
+
+int rrosace_qmc_campaign_converged(const rrosace_qmc_campaign_t *p_campaign,
+                                   const double tolerances[]) {
+  size_t output;
+  double estimate;
+  double half_width;
+
+  if (!p_campaign || !tolerances) {
+    return (0);
+  }
+
+  for (output = 0; output < p_campaign->nb_outputs; ++output) {
+    if ((replicates_spread(p_campaign, output, 0, &estimate, &half_width) ==
+         EXIT_FAILURE) ||
+        (half_width > tolerances[output]) ||
+        (replicates_spread(p_campaign, output, 1, &estimate, &half_width) ==
+         EXIT_FAILURE) ||
+        (half_width > tolerances[output])) {
+      return (0);
+    }
+  }
+
+  return (1);
+}
@@ -0,0 +1,32 @@
+/**
+ * @file random.c
+ * @brief RROSACE Scheduling of cyber-physical system library internal
+ * pseudo-random generator body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#include "random.h"
+
+#define MASK_32 (0xFFFFFFFFUL)
+
+unsigned long rrosace_random_next(unsigned long *p_state) {
+  unsigned long z;
+
+  *p_state = (*p_state + 0x9E3779B9UL) & MASK_32;
+  z = *p_state;
+  z = ((z ^ (z >> 16)) * 0x85EBCA6BUL) & MASK_32;
+  z = ((z ^ (z >> 13)) * 0xC2B2AE35UL) & MASK_32;
+
+  return (z ^ (z >> 16));
+}
@@ -0,0 +1,32 @@
+/**
+ * @file random.h
+ * @brief RROSACE Scheduling of cyber-physical system library internal
+ * pseudo-random generator header.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Shared by the modules drawing reproducible pseudo-random numbers, not
+ * installed.
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifndef RROSACE_RANDOM_H
+#define RROSACE_RANDOM_H
+
+/**
+ * @brief Weyl sequence hashed by the MurmurHash3 finalizer, on 32 bits
+ * @param[in,out] p_state The state of the sequence, on 32 bits
+ * @return The next number, on 32 bits
+ */
+unsigned long rrosace_random_next(unsigned long *p_state);
+
+#endif /* RROSACE_RANDOM_H */
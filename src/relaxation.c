@@ -0,0 +1,278 @@
+/**
+ * @file relaxation.c
+ * @brief RROSACE Scheduling of cyber-physical system library waveform
+ * relaxation body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace_relaxation.h>
+
+enum worker_state { NO_WORKER, RUNNING, STOPPING };
+
+struct rrosace_relaxation {
+  rrosace_relaxation_partition_t partitions[RROSACE_RELAXATION_NB_PARTITIONS];
+  size_t window_ticks;
+
+  /* Outputs of the previous iteration, and of the current one */
+  double *waveforms[RROSACE_RELAXATION_NB_PARTITIONS];
+  double *next_waveforms[RROSACE_RELAXATION_NB_PARTITIONS];
+
+  /* Worker simulating the second partition, synchronized per iteration */
+  pthread_t worker;
+  pthread_barrier_t start;
+  pthread_barrier_t done;
+  enum worker_state worker_state;
+  int worker_ret;
+};
+
+static int simulate(rrosace_relaxation_t * /* p_relaxation */,
+                    size_t /* partition */);
+
+static void *worker_loop(void * /* p_arg */);
+
+static int iterate(rrosace_relaxation_t * /* p_relaxation */,
+                   double * /* p_max_change */);
+
+static int simulate(rrosace_relaxation_t *p_relaxation, size_t partition) {
+  const rrosace_relaxation_partition_t *p_partition =
+      &p_relaxation->partitions[partition];
+
+  return (p_partition->simulate(
+      p_partition->p_context, p_relaxation->window_ticks,
+      p_relaxation->waveforms[RROSACE_RELAXATION_NB_PARTITIONS - 1 -
+                              partition],
+      p_relaxation->next_waveforms[partition]));
+}
+
+static void *worker_loop(void *p_arg) {
+  rrosace_relaxation_t *p_relaxation = (rrosace_relaxation_t *)p_arg;
+
+  for (;;) {
+    pthread_barrier_wait(&p_relaxation->start);
+    if (p_relaxation->worker_state == STOPPING) {
+      break;
+    }
+    p_relaxation->worker_ret = simulate(p_relaxation, 1);
+    pthread_barrier_wait(&p_relaxation->done);
+  }
+
+  return (NULL);
+}
+
+/**
+ * @brief One Jacobi iteration, each partition from the previous waveform of
+ * the other one
+ */
+static int iterate(rrosace_relaxation_t *p_relaxation, double *p_max_change) {
+  int ret;
+  size_t partition;
+  size_t i;
+
+  if (p_relaxation->worker_state == RUNNING) {
+    pthread_barrier_wait(&p_relaxation->start);
+    ret = simulate(p_relaxation, 0);
+    pthread_barrier_wait(&p_relaxation->done);
+    if (p_relaxation->worker_ret == EXIT_FAILURE) {
+      ret = EXIT_FAILURE;
+    }
+  } else {
+    ret = simulate(p_relaxation, 0);
+    if (ret == EXIT_SUCCESS) {
+      ret = simulate(p_relaxation, 1);
+    }
+  }
+
+  *p_max_change = 0.;
+
+  for (partition = 0;
+       (partition < RROSACE_RELAXATION_NB_PARTITIONS) && (ret == EXIT_SUCCESS);
+       ++partition) {
+    const size_t size = p_relaxation->window_ticks *
+                        p_relaxation->partitions[partition].nb_outputs;
+    double *waveform = p_relaxation->next_waveforms[partition];
+
+    for (i = 0; i < size; ++i) {
+      const double change =
+          fabs(waveform[i] - p_relaxation->waveforms[partition][i]);
+      if (change > *p_max_change) {
+        *p_max_change = change;
+      }
+    }
+
+    p_relaxation->next_waveforms[partition] =
+        p_relaxation->waveforms[partition];
+    p_relaxation->waveforms[partition] = waveform;
+  }
+
+  return (ret);
+}
+
+rrosace_relaxation_t *rrosace_relaxation_new(
+    const rrosace_relaxation_partition_t
+        partitions[RROSACE_RELAXATION_NB_PARTITIONS],
+    size_t window_ticks,
+    const double *const outputs0[RROSACE_RELAXATION_NB_PARTITIONS],
+    size_t nb_threads) {
+  rrosace_relaxation_t *p_relaxation = NULL;
+  size_t partition;
+
+  if (!partitions || !window_ticks || !outputs0 || !nb_threads) {
+    goto out;
+  }
+
+  p_relaxation = (rrosace_relaxation_t *)calloc(1, sizeof(*p_relaxation));
+  if (!p_relaxation) {
+    goto out;
+  }
+
+  p_relaxation->window_ticks = window_ticks;
+  p_relaxation->worker_state = NO_WORKER;
+
+  for (partition = 0; partition < RROSACE_RELAXATION_NB_PARTITIONS;
+       ++partition) {
+    const size_t nb_outputs = partitions[partition].nb_outputs;
+
+    p_relaxation->partitions[partition] = partitions[partition];
+    p_relaxation->waveforms[partition] =
+        (double *)malloc(window_ticks * nb_outputs * sizeof(double));
+    p_relaxation->next_waveforms[partition] =
+        (double *)malloc(window_ticks * nb_outputs * sizeof(double));
+
+    if (!partitions[partition].simulate || !partitions[partition].commit ||
+        !outputs0[partition] || !p_relaxation->waveforms[partition] ||
+        !p_relaxation->next_waveforms[partition]) {
+      rrosace_relaxation_del(p_relaxation);
+      p_relaxation = NULL;
+      goto out;
+    }
+
+    /* The last outputs of the previous window are at the end */
+    memcpy(p_relaxation->waveforms[partition] +
+               (window_ticks - 1) * nb_outputs,
+           outputs0[partition], nb_outputs * sizeof(double));
+  }
+
+  if (nb_threads > 1) {
+    /* What was initialized before a failure destroyed */
+    int error = pthread_barrier_init(&p_relaxation->start, NULL, 2);
+
+    if (!error) {
+      error = pthread_barrier_init(&p_relaxation->done, NULL, 2);
+      if (error) {
+        pthread_barrier_destroy(&p_relaxation->start);
+      }
+    }
+    if (!error) {
+      error = pthread_create(&p_relaxation->worker, NULL, worker_loop,
+                             p_relaxation);
+      if (error) {
+        pthread_barrier_destroy(&p_relaxation->done);
+        pthread_barrier_destroy(&p_relaxation->start);
+      }
+    }
+    if (error) {
+      rrosace_relaxation_del(p_relaxation);
+      p_relaxation = NULL;
+      goto out;
+    }
+    p_relaxation->worker_state = RUNNING;
+  }
+
+out:
+  return (p_relaxation);
+}
+
+void rrosace_relaxation_del(rrosace_relaxation_t *p_relaxation) {
+  size_t partition;
+
+  if (p_relaxation) {
+    if (p_relaxation->worker_state == RUNNING) {
+      p_relaxation->worker_state = STOPPING;
+      pthread_barrier_wait(&p_relaxation->start);
+      pthread_join(p_relaxation->worker, NULL);
+      pthread_barrier_destroy(&p_relaxation->start);
+      pthread_barrier_destroy(&p_relaxation->done);
+    }
+    for (partition = 0; partition < RROSACE_RELAXATION_NB_PARTITIONS;
+         ++partition) {
+      free(p_relaxation->waveforms[partition]);
+      free(p_relaxation->next_waveforms[partition]);
+    }
+    free(p_relaxation);
+  }
+}
+
+int rrosace_relaxation_window(rrosace_relaxation_t *p_relaxation,
+                              double tolerance, size_t max_iterations,
+                              size_t *p_iterations) {
+  int ret = EXIT_FAILURE;
+  double max_change = tolerance + 1.;
+  size_t iterations = 0;
+  size_t partition;
+  size_t tick;
+
+  if (!p_relaxation) {
+    goto out;
+  }
+
+  /* First guess, the last outputs of the previous window held */
+  for (partition = 0; partition < RROSACE_RELAXATION_NB_PARTITIONS;
+       ++partition) {
+    const size_t nb_outputs = p_relaxation->partitions[partition].nb_outputs;
+    double *waveform = p_relaxation->waveforms[partition];
+    const double *last =
+        waveform + (p_relaxation->window_ticks - 1) * nb_outputs;
+
+    for (tick = 0; tick + 1 < p_relaxation->window_ticks; ++tick) {
+      memcpy(waveform + tick * nb_outputs, last, nb_outputs * sizeof(double));
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+  while ((max_change > tolerance) && (iterations < max_iterations) &&
+         (ret == EXIT_SUCCESS)) {
+    ret = iterate(p_relaxation, &max_change);
+    ++iterations;
+  }
+
+  if ((ret == EXIT_FAILURE) || (max_change > tolerance)) {
+    ret = EXIT_FAILURE;
+    goto out;
+  }
+
+  for (partition = 0;
+       (partition < RROSACE_RELAXATION_NB_PARTITIONS) && (ret == EXIT_SUCCESS);
+       ++partition) {
+    const rrosace_relaxation_partition_t *p_partition =
+        &p_relaxation->partitions[partition];
+
+    ret = p_partition->commit(p_partition->p_context,
+                              p_relaxation->window_ticks,
+                              p_relaxation->waveforms[partition]);
+  }
+
+out:
+  if (p_iterations) {
+    *p_iterations = iterations;
+  }
+
+  return (ret);
+}
@@ -0,0 +1,683 @@
+/**
+ * @file rt.c
+ * @brief RROSACE Scheduling of cyber-physical system library real-time
+ * executor body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifdef __linux__
+/* Thread pinning */
+#define _GNU_SOURCE
+#else
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#include <rrosace_constants.h>
+#include <rrosace_rt.h>
+
+#define NSEC_PER_SEC (1000000000L)
+
+/* Stack touched before the run, so that it does not fault while paced */
+#define PREFAULT_STACK (64 * 1024)
+
+/* Thread settings kept during a run */
+struct settings {
+  int policy;
+  struct sched_param param;
+#ifdef __linux__
+  cpu_set_t cores;
+#endif
+};
+
+/* Budget of a task, with its releases left in recovery */
+struct task {
+  int measured;
+  rrosace_rt_budget_t budget;
+  size_t nb_left;
+};
+
+struct observer {
+  rrosace_rt_observer_t observe;
+  void *p_arg;
+  int optional;
+};
+
+struct rrosace_rt {
+  rrosace_rt_config_t config;
+  struct timespec period;
+  struct timespec spin;
+  /* Odd while the statistics or the events are updated */
+  unsigned long sequence;
+  rrosace_rt_stats_t stats;
+  /* Ring of config.nb_events events, stats.nb_events written */
+  rrosace_rt_event_t *events;
+  struct task tasks[RROSACE_SIM_NB_TASKS];
+  size_t nb_measured;
+  struct observer observers[RROSACE_RT_MAX_OBSERVERS];
+  size_t nb_observers;
+  /* Ticks left with the optional observers shed, and the task shedding */
+  size_t nb_shed;
+  rrosace_sim_task_t shedding;
+  /* Tick of the run, for the events */
+  size_t tick;
+  /* Values before a step, held if it overruns */
+  rrosace_sim_values_t held;
+};
+
+static struct timespec to_timespec(double seconds);
+
+static void add(struct timespec * /* p_a */, const struct timespec * /* p_b */);
+
+static double diff(const struct timespec * /* p_a */,
+                   const struct timespec * /* p_b */);
+
+static int before(const struct timespec * /* p_a */,
+                  const struct timespec * /* p_b */);
+
+static unsigned char prefault_stack(void);
+
+static int apply(const rrosace_rt_t * /* p_rt */,
+                 struct settings * /* p_saved */);
+
+static void restore(const rrosace_rt_t * /* p_rt */,
+                    const struct settings * /* p_saved */);
+
+static void wait_release(const rrosace_rt_t * /* p_rt */,
+                         const struct timespec * /* p_release */);
+
+static size_t bucket(const rrosace_rt_t * /* p_rt */, double /* value */);
+
+static void record(rrosace_rt_t * /* p_rt */, double /* jitter */,
+                   double /* exec */, int /* overrun */);
+
+static void record_event(rrosace_rt_t * /* p_rt */,
+                         rrosace_rt_event_kind_t /* kind */,
+                         rrosace_sim_task_t /* task */, double /* exec */);
+
+static int sim_step(rrosace_sim_t * /* p_sim */, rrosace_sim_task_t /* task */,
+                    double /* dt */, void * /* p_arg */);
+
+static int measured_step(rrosace_sim_t * /* p_sim */,
+                         rrosace_sim_task_t /* task */, double /* dt */,
+                         void * /* p_arg */);
+
+static void observe(rrosace_rt_t * /* p_rt */,
+                    const rrosace_sim_t * /* p_sim */);
+
+static struct timespec to_timespec(double seconds) {
+  struct timespec ts;
+
+  ts.tv_sec = (time_t)seconds;
+  ts.tv_nsec = (long)((seconds - (double)ts.tv_sec) * NSEC_PER_SEC + 0.5);
+  if (ts.tv_nsec >= NSEC_PER_SEC) {
+    ++ts.tv_sec;
+    ts.tv_nsec -= NSEC_PER_SEC;
+  }
+
+  return (ts);
+}
+
+static void add(struct timespec *p_a, const struct timespec *p_b) {
+  p_a->tv_sec += p_b->tv_sec;
+  p_a->tv_nsec += p_b->tv_nsec;
+  if (p_a->tv_nsec >= NSEC_PER_SEC) {
+    ++p_a->tv_sec;
+    p_a->tv_nsec -= NSEC_PER_SEC;
+  }
+}
+
+/**
+ * @brief Difference of two instants, in s
+ */
+static double diff(const struct timespec *p_a, const struct timespec *p_b) {
+  return ((double)(p_a->tv_sec - p_b->tv_sec) +
+          (double)(p_a->tv_nsec - p_b->tv_nsec) / NSEC_PER_SEC);
+}
+
+static int before(const struct timespec *p_a, const struct timespec *p_b) {
+  return ((p_a->tv_sec < p_b->tv_sec) ||
+          ((p_a->tv_sec == p_b->tv_sec) && (p_a->tv_nsec < p_b->tv_nsec)));
+}
+
+static unsigned char prefault_stack(void) {
+  volatile unsigned char stack[PREFAULT_STACK];
+  unsigned char sum = 0;
+  size_t i;
+
+  for (i = 0; i < PREFAULT_STACK; i += 256) {
+    stack[i] = (unsigned char)i;
+    sum += stack[i];
+  }
+
+  return (sum);
+}
+
+/**
+ * @brief Apply the configuration to the calling thread, keeping its settings
+ */
+static int apply(const rrosace_rt_t *p_rt, struct settings *p_saved) {
+  int ret = EXIT_FAILURE;
+  const rrosace_rt_config_t *p_config = &p_rt->config;
+
+  if (pthread_getschedparam(pthread_self(), &p_saved->policy,
+                            &p_saved->param)) {
+    goto out;
+  }
+#ifdef __linux__
+  if (pthread_getaffinity_np(pthread_self(), sizeof(p_saved->cores),
+                             &p_saved->cores)) {
+    goto out;
+  }
+#endif
+
+  if (p_config->lock_memory) {
+    if (mlockall(MCL_CURRENT | MCL_FUTURE)) {
+      goto out;
+    }
+    (void)prefault_stack();
+  }
+
+  if (p_config->cpu >= 0) {
+#ifdef __linux__
+    cpu_set_t cores;
+
+    CPU_ZERO(&cores);
+    CPU_SET(p_config->cpu, &cores);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cores), &cores)) {
+      restore(p_rt, p_saved);
+      goto out;
+    }
+#else
+    restore(p_rt, p_saved);
+    goto out;
+#endif
+  }
+
+  if (p_config->priority > 0) {
+    struct sched_param param;
+
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = p_config->priority;
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param)) {
+      restore(p_rt, p_saved);
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+static void restore(const rrosace_rt_t *p_rt, const struct settings *p_saved) {
+  const rrosace_rt_config_t *p_config = &p_rt->config;
+
+  if (p_config->priority > 0) {
+    pthread_setschedparam(pthread_self(), p_saved->policy, &p_saved->param);
+  }
+#ifdef __linux__
+  if (p_config->cpu >= 0) {
+    pthread_setaffinity_np(pthread_self(), sizeof(p_saved->cores),
+                           &p_saved->cores);
+  }
+#endif
+  if (p_config->lock_memory) {
+    munlockall();
+  }
+}
+
+/**
+ * @brief Sleep until the release, or until the spin window before it, then
+ * busy wait
+ */
+static void wait_release(const rrosace_rt_t *p_rt,
+                         const struct timespec *p_release) {
+  struct timespec wake = *p_release;
+  struct timespec now;
+
+  if (p_rt->spin.tv_sec || p_rt->spin.tv_nsec) {
+    wake.tv_sec -= p_rt->spin.tv_sec;
+    wake.tv_nsec -= p_rt->spin.tv_nsec;
+    if (wake.tv_nsec < 0) {
+      --wake.tv_sec;
+      wake.tv_nsec += NSEC_PER_SEC;
+    }
+  }
+
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL) ==
+         EINTR) {
+  }
+
+  do {
+    clock_gettime(CLOCK_MONOTONIC, &now);
+  } while (before(&now, p_release));
+}
+
+static size_t bucket(const rrosace_rt_t *p_rt, double value) {
+  const double index = value / p_rt->config.bucket_width;
+
+  if (index <= 0.) {
+    return (0);
+  }
+
+  return (index >= RROSACE_RT_NB_BUCKETS - 1 ? RROSACE_RT_NB_BUCKETS - 1
+                                             : (size_t)index);
+}
+
+/**
+ * @brief Record a tick, the readers retrying while the statistics change
+ */
+static void record(rrosace_rt_t *p_rt, double jitter, double exec,
+                   int overrun) {
+  rrosace_rt_stats_t *p_stats = &p_rt->stats;
+  const unsigned long sequence = p_rt->sequence;
+  double n;
+
+  __atomic_store_n(&p_rt->sequence, sequence + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  n = (double)p_stats->nb_ticks;
+  if (!p_stats->nb_ticks || (jitter < p_stats->jitter_min)) {
+    p_stats->jitter_min = jitter;
+  }
+  if (!p_stats->nb_ticks || (jitter > p_stats->jitter_max)) {
+    p_stats->jitter_max = jitter;
+  }
+  if (!p_stats->nb_ticks || (exec < p_stats->exec_min)) {
+    p_stats->exec_min = exec;
+  }
+  if (!p_stats->nb_ticks || (exec > p_stats->exec_max)) {
+    p_stats->exec_max = exec;
+  }
+  p_stats->jitter_mean = (p_stats->jitter_mean * n + jitter) / (n + 1.);
+  p_stats->exec_mean = (p_stats->exec_mean * n + exec) / (n + 1.);
+  ++p_stats->jitter_histogram[bucket(p_rt, jitter)];
+  ++p_stats->exec_histogram[bucket(p_rt, exec)];
+  if (overrun) {
+    ++p_stats->nb_overruns;
+  }
+  ++p_stats->nb_ticks;
+
+  __atomic_store_n(&p_rt->sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Record an event, the readers retrying while the events change
+ */
+static void record_event(rrosace_rt_t *p_rt, rrosace_rt_event_kind_t kind,
+                         rrosace_sim_task_t task, double exec) {
+  rrosace_rt_stats_t *p_stats = &p_rt->stats;
+  const unsigned long sequence = p_rt->sequence;
+
+  __atomic_store_n(&p_rt->sequence, sequence + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  if (p_rt->config.nb_events) {
+    rrosace_rt_event_t *p_event =
+        &p_rt->events[p_stats->nb_events % p_rt->config.nb_events];
+
+    p_event->kind = kind;
+    p_event->tick = p_rt->tick;
+    p_event->task = task;
+    p_event->exec = exec;
+  }
+  if (kind == RROSACE_RT_EVENT_OVERRUN) {
+    ++p_stats->nb_task_overruns[task];
+  }
+  ++p_stats->nb_events;
+
+  __atomic_store_n(&p_rt->sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+static int sim_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task, double dt,
+                    void *p_arg) {
+  (void)p_arg;
+
+  return (rrosace_sim_step_task(p_sim, task, dt));
+}
+
+/**
+ * @brief Step a task released, measured against its budget if it has one,
+ * and apply its policy
+ */
+static int measured_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                         double dt, void *p_arg) {
+  int ret = EXIT_FAILURE;
+  rrosace_rt_t *p_rt = (rrosace_rt_t *)p_arg;
+  struct task *p_task = &p_rt->tasks[task];
+  const rrosace_rt_budget_t *p_budget = &p_task->budget;
+  rrosace_sim_step_t step = p_budget->step ? p_budget->step : sim_step;
+  int degraded = 0;
+  struct timespec start;
+  struct timespec end;
+  double exec;
+
+  if (!p_task->measured) {
+    ret = rrosace_sim_step_task(p_sim, task, dt);
+    goto out;
+  }
+
+  if (p_task->nb_left) {
+    --p_task->nb_left;
+    if (p_budget->policy == RROSACE_RT_SKIP) {
+      record_event(p_rt, RROSACE_RT_EVENT_SKIPPED, task, 0.);
+      ret = EXIT_SUCCESS;
+      goto out;
+    }
+    step = p_budget->degraded;
+    degraded = 1;
+  }
+
+  if (p_budget->policy == RROSACE_RT_HOLD) {
+    p_rt->held = *rrosace_sim_get_values(p_sim);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  ret = step(p_sim, task, dt, p_budget->p_arg);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  exec = diff(&end, &start);
+
+  if (ret == EXIT_FAILURE) {
+    goto out;
+  }
+
+  if (degraded) {
+    record_event(p_rt, RROSACE_RT_EVENT_DEGRADED, task, exec);
+  }
+
+  if (exec <= p_budget->budget) {
+    goto out;
+  }
+
+  record_event(p_rt, RROSACE_RT_EVENT_OVERRUN, task, exec);
+  switch (p_budget->policy) {
+  case RROSACE_RT_SKIP:
+  case RROSACE_RT_DEGRADE:
+    p_task->nb_left = p_budget->nb_recovery;
+    break;
+  case RROSACE_RT_HOLD:
+    ret = rrosace_sim_set_values(p_sim, &p_rt->held);
+    record_event(p_rt, RROSACE_RT_EVENT_HELD, task, exec);
+    break;
+  case RROSACE_RT_SHED:
+    if (p_budget->nb_recovery > p_rt->nb_shed) {
+      p_rt->nb_shed = p_budget->nb_recovery;
+      p_rt->shedding = task;
+    }
+    break;
+  default:
+    break;
+  }
+
+out:
+  return (ret);
+}
+
+/**
+ * @brief Run the observers after a tick, the optional ones unless shed
+ */
+static void observe(rrosace_rt_t *p_rt, const rrosace_sim_t *p_sim) {
+  size_t i;
+
+  for (i = 0; i < p_rt->nb_observers; ++i) {
+    const struct observer *p_observer = &p_rt->observers[i];
+
+    if (!p_observer->optional || !p_rt->nb_shed) {
+      p_observer->observe(p_sim, p_observer->p_arg);
+    }
+  }
+
+  if (p_rt->nb_shed) {
+    record_event(p_rt, RROSACE_RT_EVENT_SHED, p_rt->shedding, 0.);
+    --p_rt->nb_shed;
+  }
+}
+
+int rrosace_rt_default_config(rrosace_rt_config_t *p_config) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_config) {
+    goto out;
+  }
+
+  p_config->period = 1. / RROSACE_DEFAULT_PHYSICAL_FREQ;
+  p_config->spin = 0.;
+  p_config->priority = 0;
+  p_config->cpu = -1;
+  p_config->lock_memory = 0;
+  p_config->bucket_width = 1e-6;
+  p_config->nb_events = 1024;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+rrosace_rt_t *rrosace_rt_new(const rrosace_rt_config_t *p_config) {
+  rrosace_rt_t *p_rt = NULL;
+
+  if (!p_config || !(p_config->period > 0.) || (p_config->spin < 0.) ||
+      (p_config->spin >= p_config->period) || (p_config->priority < 0) ||
+      !(p_config->bucket_width > 0.)) {
+    goto out;
+  }
+
+  p_rt = (rrosace_rt_t *)calloc(1, sizeof(rrosace_rt_t));
+  if (!p_rt) {
+    goto out;
+  }
+
+  if (p_config->nb_events) {
+    p_rt->events = (rrosace_rt_event_t *)calloc(p_config->nb_events,
+                                                sizeof(rrosace_rt_event_t));
+    if (!p_rt->events) {
+      free(p_rt);
+      p_rt = NULL;
+      goto out;
+    }
+  }
+
+  p_rt->config = *p_config;
+  p_rt->period = to_timespec(p_config->period);
+  p_rt->spin = to_timespec(p_config->spin);
+
+out:
+  return (p_rt);
+}
+
+void rrosace_rt_del(rrosace_rt_t *p_rt) {
+  if (p_rt) {
+    free(p_rt->events);
+    free(p_rt);
+  }
+}
+
+int rrosace_rt_set_budget(rrosace_rt_t *p_rt, rrosace_sim_task_t task,
+                          const rrosace_rt_budget_t *p_budget) {
+  int ret = EXIT_FAILURE;
+  struct task *p_task;
+
+  if (!p_rt || ((size_t)task >= RROSACE_SIM_NB_TASKS) ||
+      (p_budget && (!(p_budget->budget > 0.) ||
+                    ((size_t)p_budget->policy >= RROSACE_RT_NB_POLICIES) ||
+                    ((p_budget->policy == RROSACE_RT_DEGRADE) &&
+                     !p_budget->degraded)))) {
+    goto out;
+  }
+
+  p_task = &p_rt->tasks[task];
+  if (p_budget) {
+    p_rt->nb_measured += !p_task->measured;
+    p_task->measured = 1;
+    p_task->budget = *p_budget;
+  } else {
+    p_rt->nb_measured -= p_task->measured;
+    p_task->measured = 0;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_rt_add_observer(rrosace_rt_t *p_rt, rrosace_rt_observer_t observer,
+                            void *p_arg, int optional) {
+  int ret = EXIT_FAILURE;
+  struct observer *p_observer;
+
+  if (!p_rt || !observer || (p_rt->nb_observers == RROSACE_RT_MAX_OBSERVERS)) {
+    goto out;
+  }
+
+  p_observer = &p_rt->observers[p_rt->nb_observers++];
+  p_observer->observe = observer;
+  p_observer->p_arg = p_arg;
+  p_observer->optional = optional;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_rt_run(rrosace_rt_t *p_rt, rrosace_sim_t *p_sim, size_t n_ticks) {
+  int ret = EXIT_FAILURE;
+  struct settings saved;
+  struct timespec release;
+  size_t task;
+  size_t tick;
+
+  if (!p_rt || !p_sim ||
+      (p_rt->nb_measured &&
+       (rrosace_sim_get_semantics(p_sim) != RROSACE_SIM_IMMEDIATE))) {
+    goto out;
+  }
+
+  for (task = 0; task < RROSACE_SIM_NB_TASKS; ++task) {
+    p_rt->tasks[task].nb_left = 0;
+  }
+  p_rt->nb_shed = 0;
+
+  __atomic_store_n(&p_rt->sequence, p_rt->sequence + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  memset(&p_rt->stats, 0, sizeof(p_rt->stats));
+  __atomic_store_n(&p_rt->sequence, p_rt->sequence + 1, __ATOMIC_RELEASE);
+
+  if (apply(p_rt, &saved) == EXIT_FAILURE) {
+    goto out;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &release);
+  add(&release, &p_rt->period);
+
+  for (tick = 0, ret = EXIT_SUCCESS; (tick < n_ticks) && (ret == EXIT_SUCCESS);
+       ++tick) {
+    struct timespec start;
+    struct timespec end;
+    struct timespec deadline;
+
+    wait_release(p_rt, &release);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    p_rt->tick = tick;
+    ret = p_rt->nb_measured
+              ? rrosace_sim_run_delegated(p_sim, measured_step, p_rt)
+              : rrosace_sim_run(p_sim, 1);
+    if (ret == EXIT_SUCCESS) {
+      observe(p_rt, p_sim);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    deadline = release;
+    add(&deadline, &p_rt->period);
+
+    record(p_rt, diff(&start, &release), diff(&end, &start),
+           before(&deadline, &end));
+
+    /* Releases stay on the absolute grid, late ones run right away */
+    release = deadline;
+  }
+
+  restore(p_rt, &saved);
+
+out:
+  return (ret);
+}
+
+int rrosace_rt_get_stats(const rrosace_rt_t *p_rt,
+                         rrosace_rt_stats_t *p_stats) {
+  int ret = EXIT_FAILURE;
+  unsigned long sequence;
+
+  if (!p_rt || !p_stats) {
+    goto out;
+  }
+
+  do {
+    sequence = __atomic_load_n(&p_rt->sequence, __ATOMIC_ACQUIRE);
+    memcpy(p_stats, &p_rt->stats, sizeof(*p_stats));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  } while ((sequence & 1) ||
+           (sequence != __atomic_load_n(&p_rt->sequence, __ATOMIC_RELAXED)));
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+size_t rrosace_rt_get_events(const rrosace_rt_t *p_rt, size_t first,
+                             size_t nb_events, rrosace_rt_event_t events[]) {
+  size_t nb_got = 0;
+  unsigned long sequence;
+
+  if (!p_rt || !events) {
+    goto out;
+  }
+
+  do {
+    size_t nb_written;
+    size_t i;
+
+    sequence = __atomic_load_n(&p_rt->sequence, __ATOMIC_ACQUIRE);
+    nb_written = p_rt->stats.nb_events;
+    nb_got = 0;
+    if ((first < nb_written) &&
+        (nb_written - first <= p_rt->config.nb_events)) {
+      nb_got = nb_written - first;
+      if (nb_got > nb_events) {
+        nb_got = nb_events;
+      }
+    }
+    for (i = 0; i < nb_got; ++i) {
+      events[i] = p_rt->events[(first + i) % p_rt->config.nb_events];
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  } while ((sequence & 1) ||
+           (sequence != __atomic_load_n(&p_rt->sequence, __ATOMIC_RELAXED)));
+
+out:
+  return (nb_got);
+}
@@ -0,0 +1,369 @@
+/**
+ * @file server.c
+ * @brief RROSACE Scheduling of cyber-physical system library job server body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include <rrosace_server.h>
+
+#include "affinity.h"
+
+/* Initial capacity of the queue */
+#define QUEUE_CAPACITY (64)
+
+/* Job queued, with its rank among the submissions */
+struct queued {
+  rrosace_server_job_t job;
+  rrosace_server_sink_t sink;
+  void *p_sink;
+  unsigned long sequence;
+};
+
+struct worker {
+  rrosace_server_t *p_server;
+  size_t index;
+  /* Core in the affinity mask of the creating thread, -1 if none */
+  int core;
+  /* Warm simulation, reset for each job */
+  rrosace_sim_t *p_sim;
+  pthread_t thread;
+  int started;
+};
+
+struct rrosace_server {
+  double initial_state[RROSACE_SIM_STATE_SIZE];
+  struct worker workers[RROSACE_SERVER_MAX_WORKERS];
+  size_t nb_workers;
+  pthread_mutex_t mutex;
+  /* Signaled when a job is queued, or the server stops */
+  pthread_cond_t work;
+  /* Signaled when no job is queued or running, or a worker is placed */
+  pthread_cond_t idle;
+  /* Binary heap of the jobs, highest priority then first submitted first */
+  struct queued *p_queue;
+  size_t nb_queued;
+  size_t capacity;
+  unsigned long sequence;
+  size_t nb_running;
+  size_t nb_done;
+  int stop;
+  /* Initial simulation, while the workers copy it, and their count */
+  const rrosace_sim_t *p_initial;
+  size_t nb_placed;
+};
+
+static int before(const struct queued * /* p_a */,
+                  const struct queued * /* p_b */);
+
+static void push(rrosace_server_t * /* p_server */,
+                 const struct queued * /* p_queued */);
+
+static struct queued pop(rrosace_server_t * /* p_server */);
+
+static int run_job(rrosace_server_t * /* p_server */,
+                   rrosace_sim_t * /* p_sim */,
+                   const struct queued * /* p_queued */);
+
+static void *worker_main(void * /* p_arg */);
+
+static int before(const struct queued *p_a, const struct queued *p_b) {
+  return ((p_a->job.priority > p_b->job.priority) ||
+          ((p_a->job.priority == p_b->job.priority) &&
+           (p_a->sequence < p_b->sequence)));
+}
+
+static void push(rrosace_server_t *p_server, const struct queued *p_queued) {
+  size_t i = p_server->nb_queued++;
+
+  while (i && before(p_queued, &p_server->p_queue[(i - 1) / 2])) {
+    p_server->p_queue[i] = p_server->p_queue[(i - 1) / 2];
+    i = (i - 1) / 2;
+  }
+  p_server->p_queue[i] = *p_queued;
+}
+
+static struct queued pop(rrosace_server_t *p_server) {
+  const struct queued first = p_server->p_queue[0];
+  const struct queued last = p_server->p_queue[--p_server->nb_queued];
+  size_t i = 0;
+
+  for (;;) {
+    size_t child = 2 * i + 1;
+
+    if (child >= p_server->nb_queued) {
+      break;
+    }
+    if ((child + 1 < p_server->nb_queued) &&
+        before(&p_server->p_queue[child + 1], &p_server->p_queue[child])) {
+      ++child;
+    }
+    if (!before(&p_server->p_queue[child], &last)) {
+      break;
+    }
+    p_server->p_queue[i] = p_server->p_queue[child];
+    i = child;
+  }
+  p_server->p_queue[i] = last;
+
+  return (first);
+}
+
+/**
+ * @brief Run a job on a warm simulation, giving its samples to its sink
+ * @return 1 if the job ran to its end, else 0
+ */
+static int run_job(rrosace_server_t *p_server, rrosace_sim_t *p_sim,
+                   const struct queued *p_queued) {
+  const rrosace_server_job_t *p_job = &p_queued->job;
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+  size_t tick = 0;
+
+  if ((rrosace_sim_set_state(p_sim, p_server->initial_state) ==
+       EXIT_FAILURE) ||
+      (rrosace_sim_set_commands(p_sim, p_job->h_c, p_job->vz_c,
+                                p_job->va_c) == EXIT_FAILURE)) {
+    p_queued->sink(p_queued->p_sink, p_job, 0, NULL);
+    return (0);
+  }
+
+  while (tick < p_job->nb_ticks) {
+    size_t nb_ticks = p_job->nb_ticks - tick;
+
+    if (p_job->stride && (p_job->stride < nb_ticks)) {
+      nb_ticks = p_job->stride;
+    }
+    if (rrosace_sim_run(p_sim, nb_ticks) == EXIT_FAILURE) {
+      break;
+    }
+    tick += nb_ticks;
+
+    if ((p_job->stride || (tick == p_job->nb_ticks)) &&
+        (p_queued->sink(p_queued->p_sink, p_job, tick, p_values) ==
+         EXIT_FAILURE)) {
+      break;
+    }
+  }
+
+  p_queued->sink(p_queued->p_sink, p_job, tick, NULL);
+
+  return (tick == p_job->nb_ticks);
+}
+
+static void *worker_main(void *p_arg) {
+  struct worker *p_worker = (struct worker *)p_arg;
+  rrosace_server_t *p_server = p_worker->p_server;
+
+  rrosace_pin_core(p_worker->core);
+
+  /* Warm simulation first touched by the worker, on the node of its core */
+  p_worker->p_sim = rrosace_sim_copy(p_server->p_initial);
+
+  pthread_mutex_lock(&p_server->mutex);
+  ++p_server->nb_placed;
+  pthread_cond_broadcast(&p_server->idle);
+  for (;;) {
+    struct queued queued;
+    int done;
+
+    while (!p_server->stop && !p_server->nb_queued) {
+      pthread_cond_wait(&p_server->work, &p_server->mutex);
+    }
+    if (p_server->stop) {
+      break;
+    }
+    queued = pop(p_server);
+    ++p_server->nb_running;
+    pthread_mutex_unlock(&p_server->mutex);
+
+    done = run_job(p_server, p_worker->p_sim, &queued);
+
+    pthread_mutex_lock(&p_server->mutex);
+    --p_server->nb_running;
+    p_server->nb_done += (size_t)done;
+    if (!p_server->nb_running && !p_server->nb_queued) {
+      pthread_cond_broadcast(&p_server->idle);
+    }
+  }
+  pthread_mutex_unlock(&p_server->mutex);
+
+  return (NULL);
+}
+
+rrosace_server_t *rrosace_server_new(const rrosace_sim_t *p_sim,
+                                     size_t nb_workers) {
+  rrosace_server_t *p_server = NULL;
+  size_t worker;
+
+  if (!p_sim || (rrosace_sim_get_semantics(p_sim) != RROSACE_SIM_IMMEDIATE) ||
+      !nb_workers || (nb_workers > RROSACE_SERVER_MAX_WORKERS)) {
+    goto out;
+  }
+
+  p_server = (rrosace_server_t *)calloc(1, sizeof(rrosace_server_t));
+  if (!p_server) {
+    goto out;
+  }
+
+  pthread_mutex_init(&p_server->mutex, NULL);
+  pthread_cond_init(&p_server->work, NULL);
+  pthread_cond_init(&p_server->idle, NULL);
+
+  p_server->capacity = QUEUE_CAPACITY;
+  p_server->p_queue =
+      (struct queued *)malloc(p_server->capacity * sizeof(struct queued));
+  if (!p_server->p_queue ||
+      (rrosace_sim_get_state(p_sim, p_server->initial_state) ==
+       EXIT_FAILURE)) {
+    rrosace_server_del(p_server);
+    p_server = NULL;
+    goto out;
+  }
+
+  p_server->p_initial = p_sim;
+  for (worker = 0; worker < nb_workers; ++worker) {
+    p_server->workers[worker].p_server = p_server;
+    p_server->workers[worker].index = worker;
+    p_server->workers[worker].core = rrosace_spread_core(worker, 0);
+    ++p_server->nb_workers;
+    if (pthread_create(&p_server->workers[worker].thread, NULL, worker_main,
+                       &p_server->workers[worker])) {
+      break;
+    }
+    p_server->workers[worker].started = 1;
+  }
+
+  /* Warm simulations built by the workers before any job is queued */
+  pthread_mutex_lock(&p_server->mutex);
+  while (p_server->nb_placed < worker) {
+    pthread_cond_wait(&p_server->idle, &p_server->mutex);
+  }
+  pthread_mutex_unlock(&p_server->mutex);
+  p_server->p_initial = NULL;
+
+  for (worker = 0; worker < nb_workers; ++worker) {
+    if (!p_server->workers[worker].p_sim) {
+      rrosace_server_del(p_server);
+      p_server = NULL;
+      goto out;
+    }
+  }
+
+out:
+  return (p_server);
+}
+
+void rrosace_server_del(rrosace_server_t *p_server) {
+  size_t worker;
+
+  if (p_server) {
+    pthread_mutex_lock(&p_server->mutex);
+    p_server->stop = 1;
+    pthread_cond_broadcast(&p_server->work);
+    pthread_mutex_unlock(&p_server->mutex);
+
+    for (worker = 0; worker < p_server->nb_workers; ++worker) {
+      if (p_server->workers[worker].started) {
+        pthread_join(p_server->workers[worker].thread, NULL);
+      }
+      rrosace_sim_del(p_server->workers[worker].p_sim);
+    }
+
+    /* Queued jobs ended without a tick run */
+    while (p_server->nb_queued) {
+      const struct queued queued = pop(p_server);
+
+      queued.sink(queued.p_sink, &queued.job, 0, NULL);
+    }
+
+    pthread_cond_destroy(&p_server->idle);
+    pthread_cond_destroy(&p_server->work);
+    pthread_mutex_destroy(&p_server->mutex);
+    free(p_server->p_queue);
+    free(p_server);
+  }
+}
+
+int rrosace_server_submit(rrosace_server_t *p_server,
+                          const rrosace_server_job_t *p_job,
+                          rrosace_server_sink_t sink, void *p_sink) {
+  int ret = EXIT_FAILURE;
+  struct queued queued;
+
+  if (!p_server || !p_job || !sink) {
+    return (EXIT_FAILURE);
+  }
+
+  queued.job = *p_job;
+  queued.sink = sink;
+  queued.p_sink = p_sink;
+
+  pthread_mutex_lock(&p_server->mutex);
+
+  if (p_server->stop) {
+    goto out;
+  }
+
+  if (p_server->nb_queued == p_server->capacity) {
+    struct queued *p_queue = (struct queued *)realloc(
+        p_server->p_queue, 2 * p_server->capacity * sizeof(struct queued));
+
+    if (!p_queue) {
+      goto out;
+    }
+    p_server->p_queue = p_queue;
+    p_server->capacity *= 2;
+  }
+
+  queued.sequence = p_server->sequence++;
+  push(p_server, &queued);
+  pthread_cond_signal(&p_server->work);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  pthread_mutex_unlock(&p_server->mutex);
+
+  return (ret);
+}
+
+int rrosace_server_wait(rrosace_server_t *p_server) {
+  if (!p_server) {
+    return (EXIT_FAILURE);
+  }
+
+  pthread_mutex_lock(&p_server->mutex);
+  while (p_server->nb_queued || p_server->nb_running) {
+    pthread_cond_wait(&p_server->idle, &p_server->mutex);
+  }
+  pthread_mutex_unlock(&p_server->mutex);
+
+  return (EXIT_SUCCESS);
+}
+
+size_t rrosace_server_get_nb_done(rrosace_server_t *p_server) {
+  size_t nb_done = 0;
+
+  if (p_server) {
+    pthread_mutex_lock(&p_server->mutex);
+    nb_done = p_server->nb_done;
+    pthread_mutex_unlock(&p_server->mutex);
+  }
+
+  return (nb_done);
+}
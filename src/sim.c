@@ -0,0 +1,2591 @@
+/**
+ * @file sim.c
+ * @brief RROSACE Scheduling of cyber-physical system library simulation
+ * runtime body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#ifdef __linux__
+/* Thread pinning of the rate groups, anonymous shared mappings */
+#define _GNU_SOURCE
+#else
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rrosace_constants.h>
+#include <rrosace_elevator.h>
+#include <rrosace_engine.h>
+#include <rrosace_fcu.h>
+#include <rrosace_filters.h>
+#include <rrosace_flight_dynamics.h>
+#include <rrosace_sim.h>
+
+#include "affinity.h"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/* Tasks of a tick, in execution order */
+enum task {
+  ELEVATOR = RROSACE_SIM_TASK_ELEVATOR,
+  ENGINE = RROSACE_SIM_TASK_ENGINE,
+  FLIGHT_DYNAMICS = RROSACE_SIM_TASK_FLIGHT_DYNAMICS,
+  H_FILTER = RROSACE_SIM_TASK_H_FILTER,
+  VZ_FILTER = RROSACE_SIM_TASK_VZ_FILTER,
+  VA_FILTER = RROSACE_SIM_TASK_VA_FILTER,
+  Q_FILTER = RROSACE_SIM_TASK_Q_FILTER,
+  AZ_FILTER = RROSACE_SIM_TASK_AZ_FILTER,
+  FLIGHT_MODE = RROSACE_SIM_TASK_FLIGHT_MODE,
+  FCU = RROSACE_SIM_TASK_FCU,
+  FCCS_COM = RROSACE_SIM_TASK_FCCS_COM,
+  FCCS_MON = RROSACE_SIM_TASK_FCCS_MON,
+  CABLES = RROSACE_SIM_TASK_CABLES,
+  NB_TASKS = RROSACE_SIM_NB_TASKS
+};
+
+/* Mask of a task */
+#define TASK(task) (1U << (task))
+
+/* Largest hyperperiod of the task rates, in physical ticks */
+#define MAX_HYPERPERIOD (16)
+
+/* Buffer of the physical partition outputs, after the jobs buffers */
+#define PHYSICAL_BUFFER (MAX_HYPERPERIOD)
+
+/* No output pending publication */
+#define NO_BUFFER (MAX_HYPERPERIOD + 1)
+
+/* Polls of a rate group waiting for another before yielding its core */
+#define SPINS (64)
+
+/* Size of a cache line, so that the members of a team do not share one */
+#define CACHE_LINE (64)
+
+/* Task of no stage */
+#define NO_STAGE (RROSACE_SIM_NB_STAGES)
+
+/* Values of a couple of FCCs in the state, after the mode and the elevator
+ * deflection, its relays and master in laws after its commands */
+#define COUPLES_STATE_OFFSET (2)
+#define COUPLE_STATE_SIZE (6)
+#define COUPLE_DISCRETE_OFFSET (2)
+
+/* Altitude hold switch in the state of an FCC */
+#define FCC_SWITCH_OFFSET (1)
+
+struct models {
+  rrosace_engine_t *p_engine;
+  rrosace_elevator_t *p_elevator;
+  rrosace_flight_dynamics_t *p_flight_dynamics;
+  rrosace_filter_t *p_h_filter;
+  rrosace_filter_t *p_vz_filter;
+  rrosace_filter_t *p_va_filter;
+  rrosace_filter_t *p_q_filter;
+  rrosace_filter_t *p_az_filter;
+  rrosace_flight_mode_t *p_flight_mode;
+  rrosace_fcu_t *p_fcu;
+  rrosace_fcc_t *p_fccs[RROSACE_SIM_NB_FCCS];
+  /* Biases added to the measures the filters read */
+  rrosace_sim_parameters_t parameters;
+};
+
+/* A task reads its inputs and writes its outputs, which may be the same,
+ * over a time step */
+typedef int (*task_step_t)(struct models *, const rrosace_sim_values_t *,
+                           rrosace_sim_values_t *, double);
+
+/* Step of a task released, over its period */
+struct dispatch {
+  task_step_t step;
+  double dt;
+};
+
+/* Copy the outputs of a task from a buffer to the published values */
+typedef void (*task_publish_t)(rrosace_sim_values_t *,
+                               const rrosace_sim_values_t *);
+
+/* Cyber partition tasks released at a tick, with LET */
+struct job {
+  /* Values published at the release */
+  rrosace_sim_values_t input;
+  /* Outputs until their deadline */
+  rrosace_sim_values_t output;
+  /* Mask of the tasks */
+  unsigned int tasks;
+  unsigned long sequence;
+  int ret;
+};
+
+/* Outputs published by a rate group at a deadline, stamped with it */
+struct slot {
+  rrosace_sim_values_t values;
+  /* Deadline plus one, 0 before the first publication */
+  unsigned long version;
+};
+
+/* Tasks of a rate, on their own thread with LET */
+struct group {
+  rrosace_sim_t *p_sim;
+  size_t index;
+  size_t period;
+  /* Mask of the tasks */
+  unsigned int tasks;
+  /* Mask of the tasks of the other groups the tasks read */
+  unsigned int reads;
+  /* Values published, as seen by the group */
+  rrosace_sim_values_t view;
+  /* Outputs until their deadline */
+  rrosace_sim_values_t output;
+  /* A slot for each tick of the hyperperiod, written once between two
+   * hyperperiod barriers */
+  struct slot slots[MAX_HYPERPERIOD];
+  size_t logical_time;
+  /* Sense of the last hyperperiod barrier */
+  unsigned long sense;
+  /* Core in the affinity mask of the starting thread, -1 if none */
+  int core;
+  pthread_t thread;
+  int started;
+};
+
+/* Model of a stage forked: the tasks of a filter, or of a couple of FCCs */
+struct unit {
+  unsigned int tasks;
+  size_t couple;
+};
+
+/* Thread of a team */
+struct member {
+  struct team *p_team;
+  size_t index;
+  /* Core the member is pinned on, -1 if not pinned */
+  int core;
+  /* Sense of the last join */
+  unsigned long sense;
+  int ret;
+  pthread_t thread;
+  int started;
+  char padding[CACHE_LINE];
+};
+
+/* Threads stepping the models of a stage with the caller, within a tick */
+struct team {
+  /* Fork, bumped by the caller once the units are set */
+  unsigned long epoch;
+  char epoch_padding[CACHE_LINE - sizeof(unsigned long)];
+  /* Join, sense reversing barrier of the members and the caller */
+  unsigned long count;
+  unsigned long sense;
+  char barrier_padding[CACHE_LINE - 2 * sizeof(unsigned long)];
+  rrosace_sim_t *p_sim;
+  /* Units of the stage forked, and the models and values they step */
+  struct models *p_models;
+  rrosace_sim_values_t *p_values;
+  struct unit units[RROSACE_SIM_NB_FILTERS];
+  size_t nb_units;
+  /* Mask of the stages run by the team */
+  unsigned int stages;
+  unsigned long caller_sense;
+  int stop;
+  struct member members[RROSACE_SIM_MAX_TEAM_THREADS];
+  size_t nb_members;
+};
+
+struct rrosace_sim {
+  struct models models;
+  /* Values, the published ones with LET */
+  rrosace_sim_values_t values;
+  /* Rate table, period of each task in physical ticks */
+  size_t periods[NB_TASKS];
+  /* Tasks released at each tick of the hyperperiod, NULL step terminated */
+  struct dispatch schedule[MAX_HYPERPERIOD][NB_TASKS + 1];
+  /* Same, as masks */
+  unsigned int releases[MAX_HYPERPERIOD];
+  size_t hyperperiod;
+  /* Tick in the hyperperiod */
+  size_t phase;
+  size_t logical_time;
+  rrosace_sim_semantics_t semantics;
+  /* LET buffers, a job for each tick of the hyperperiod and the physical
+   * partition outputs */
+  struct job jobs[MAX_HYPERPERIOD];
+  rrosace_sim_values_t physical_output;
+  /* LET buffer and deadline of the outputs of each task */
+  size_t pending[NB_TASKS];
+  size_t deadlines[NB_TASKS];
+  /* Concurrent LET, thread of the cyber partition and its queue of jobs */
+  pthread_t helper;
+  int helper_started;
+  int stop;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  size_t queue[MAX_HYPERPERIOD];
+  unsigned long nb_submitted;
+  unsigned long nb_completed;
+  /* LET rate groups, their threads running up to the target */
+  struct group *p_groups;
+  size_t nb_groups;
+  size_t target;
+  size_t nb_groups_done;
+  int groups_ret;
+  int failed;
+  /* Sense reversing barrier of the hyperperiods */
+  unsigned long barrier_count;
+  unsigned long barrier_sense;
+  /* Immediate semantics, team of the stages of a tick */
+  struct team *p_team;
+};
+
+static int check_models(const struct models * /* p_models */);
+
+static void delete_models(struct models * /* p_models */);
+
+static void init_periods(rrosace_sim_t * /* p_sim */);
+
+static double task_dt(const rrosace_sim_t * /* p_sim */, size_t /* task */);
+
+static size_t gcd(size_t /* a */, size_t /* b */);
+
+static int init_schedule(rrosace_sim_t * /* p_sim */);
+
+static int elevator_step(struct models * /* p_models */,
+                         const rrosace_sim_values_t * /* p_in */,
+                         rrosace_sim_values_t * /* p_out */,
+                         double /* dt */);
+static int engine_step(struct models * /* p_models */,
+                       const rrosace_sim_values_t * /* p_in */,
+                       rrosace_sim_values_t * /* p_out */,
+                       double /* dt */);
+static int flight_dynamics_step(struct models * /* p_models */,
+                                const rrosace_sim_values_t * /* p_in */,
+                                rrosace_sim_values_t * /* p_out */,
+                                double /* dt */);
+static int h_filter_step(struct models * /* p_models */,
+                         const rrosace_sim_values_t * /* p_in */,
+                         rrosace_sim_values_t * /* p_out */,
+                         double /* dt */);
+static int vz_filter_step(struct models * /* p_models */,
+                          const rrosace_sim_values_t * /* p_in */,
+                          rrosace_sim_values_t * /* p_out */,
+                          double /* dt */);
+static int va_filter_step(struct models * /* p_models */,
+                          const rrosace_sim_values_t * /* p_in */,
+                          rrosace_sim_values_t * /* p_out */,
+                          double /* dt */);
+static int q_filter_step(struct models * /* p_models */,
+                         const rrosace_sim_values_t * /* p_in */,
+                         rrosace_sim_values_t * /* p_out */,
+                         double /* dt */);
+static int az_filter_step(struct models * /* p_models */,
+                          const rrosace_sim_values_t * /* p_in */,
+                          rrosace_sim_values_t * /* p_out */,
+                          double /* dt */);
+static int flight_mode_step(struct models * /* p_models */,
+                            const rrosace_sim_values_t * /* p_in */,
+                            rrosace_sim_values_t * /* p_out */,
+                            double /* dt */);
+static int fcu_step(struct models * /* p_models */,
+                    const rrosace_sim_values_t * /* p_in */,
+                    rrosace_sim_values_t * /* p_out */,
+                    double /* dt */);
+static int fcc_com_step(struct models * /* p_models */,
+                        const rrosace_sim_values_t * /* p_in */,
+                        rrosace_sim_values_t * /* p_out */, size_t /* couple */,
+                        double /* dt */);
+
+static int fcc_mon_step(struct models * /* p_models */,
+                        const rrosace_sim_values_t * /* p_in */,
+                        rrosace_sim_values_t * /* p_out */, size_t /* couple */,
+                        double /* dt */);
+
+static int fccs_com_step(struct models * /* p_models */,
+                         const rrosace_sim_values_t * /* p_in */,
+                         rrosace_sim_values_t * /* p_out */,
+                         double /* dt */);
+static int fccs_mon_step(struct models * /* p_models */,
+                         const rrosace_sim_values_t * /* p_in */,
+                         rrosace_sim_values_t * /* p_out */,
+                         double /* dt */);
+static int cables_step(struct models * /* p_models */,
+                       const rrosace_sim_values_t * /* p_in */,
+                       rrosace_sim_values_t * /* p_out */,
+                       double /* dt */);
+
+static void elevator_publish(rrosace_sim_values_t * /* p_values */,
+                             const rrosace_sim_values_t * /* p_buffer */);
+static void engine_publish(rrosace_sim_values_t * /* p_values */,
+                           const rrosace_sim_values_t * /* p_buffer */);
+static void
+flight_dynamics_publish(rrosace_sim_values_t * /* p_values */,
+                        const rrosace_sim_values_t * /* p_buffer */);
+static void h_filter_publish(rrosace_sim_values_t * /* p_values */,
+                             const rrosace_sim_values_t * /* p_buffer */);
+static void vz_filter_publish(rrosace_sim_values_t * /* p_values */,
+                              const rrosace_sim_values_t * /* p_buffer */);
+static void va_filter_publish(rrosace_sim_values_t * /* p_values */,
+                              const rrosace_sim_values_t * /* p_buffer */);
+static void q_filter_publish(rrosace_sim_values_t * /* p_values */,
+                             const rrosace_sim_values_t * /* p_buffer */);
+static void az_filter_publish(rrosace_sim_values_t * /* p_values */,
+                              const rrosace_sim_values_t * /* p_buffer */);
+static void flight_mode_publish(rrosace_sim_values_t * /* p_values */,
+                                const rrosace_sim_values_t * /* p_buffer */);
+static void fcu_publish(rrosace_sim_values_t * /* p_values */,
+                        const rrosace_sim_values_t * /* p_buffer */);
+static void fccs_com_publish(rrosace_sim_values_t * /* p_values */,
+                             const rrosace_sim_values_t * /* p_buffer */);
+static void fccs_mon_publish(rrosace_sim_values_t * /* p_values */,
+                             const rrosace_sim_values_t * /* p_buffer */);
+static void cables_publish(rrosace_sim_values_t * /* p_values */,
+                           const rrosace_sim_values_t * /* p_buffer */);
+
+static int run_immediate(rrosace_sim_t * /* p_sim */);
+
+static double now(void);
+
+static int run_units(struct team * /* p_team */, size_t /* first */,
+                     size_t /* stride */);
+
+static void join(struct team * /* p_team */, unsigned long * /* p_sense */);
+
+static void *member_main(void * /* p_arg */);
+
+static int fork_join(struct team * /* p_team */);
+
+static void set_units(struct team * /* p_team */, size_t /* stage */,
+                      unsigned int /* released */);
+
+static int run_stage(struct team * /* p_team */, size_t /* stage */,
+                     unsigned int /* released */);
+
+static int run_team(rrosace_sim_t * /* p_sim */);
+
+static void delete_team(rrosace_sim_t * /* p_sim */);
+
+static int run_job(rrosace_sim_t * /* p_sim */, struct job * /* p_job */);
+
+static void *helper_main(void * /* p_arg */);
+
+static int start_helper(rrosace_sim_t * /* p_sim */);
+
+static void stop_helper(rrosace_sim_t * /* p_sim */);
+
+static void drain(const rrosace_sim_t * /* p_sim */);
+
+static int publish(rrosace_sim_t * /* p_sim */);
+
+static int release(rrosace_sim_t * /* p_sim */);
+
+static int run_let(rrosace_sim_t * /* p_sim */);
+
+static int failed(const rrosace_sim_t * /* p_sim */);
+
+static void wait_version(const rrosace_sim_t * /* p_sim */,
+                         const struct slot * /* p_slot */,
+                         unsigned long /* version */);
+
+static void barrier_wait(rrosace_sim_t * /* p_sim */,
+                         struct group * /* p_group */);
+
+static int run_group(struct group * /* p_group */, size_t /* target */);
+
+static void set_member_cores(struct team * /* p_team */,
+                             size_t /* nb_threads */);
+
+static void *group_main(void * /* p_arg */);
+
+static int init_groups(rrosace_sim_t * /* p_sim */);
+
+static int copy_groups(rrosace_sim_t * /* p_sim */,
+                       const rrosace_sim_t * /* p_other */);
+
+static int start_groups(rrosace_sim_t * /* p_sim */);
+
+static void delete_groups(rrosace_sim_t * /* p_sim */);
+
+static int run_groups(rrosace_sim_t * /* p_sim */, size_t /* n_ticks */);
+
+static int wait_branch(pid_t /* pid */);
+
+static const task_step_t task_steps[NB_TASKS] = {
+    elevator_step,    engine_step,    flight_dynamics_step, h_filter_step,
+    vz_filter_step,   va_filter_step, q_filter_step,        az_filter_step,
+    flight_mode_step, fcu_step,       fccs_com_step,        fccs_mon_step,
+    cables_step};
+
+static const task_publish_t task_publishes[NB_TASKS] = {
+    elevator_publish,  engine_publish,    flight_dynamics_publish,
+    h_filter_publish,  vz_filter_publish, va_filter_publish,
+    q_filter_publish,  az_filter_publish, flight_mode_publish,
+    fcu_publish,       fccs_com_publish,  fccs_mon_publish,
+    cables_publish};
+
+/* Tasks of the cyber partition, the others being the physical one */
+static const int task_cyber[NB_TASKS] = {0, 0, 0, 1, 1, 1, 1,
+                                         1, 1, 1, 1, 1, 0};
+
+/* Tasks whose outputs each task reads */
+static const unsigned int task_reads[NB_TASKS] = {
+    TASK(CABLES),
+    TASK(CABLES),
+    TASK(ELEVATOR) | TASK(ENGINE),
+    TASK(FLIGHT_DYNAMICS),
+    TASK(FLIGHT_DYNAMICS),
+    TASK(FLIGHT_DYNAMICS),
+    TASK(FLIGHT_DYNAMICS),
+    TASK(FLIGHT_DYNAMICS),
+    0,
+    0,
+    TASK(H_FILTER) | TASK(VZ_FILTER) | TASK(VA_FILTER) | TASK(Q_FILTER) |
+        TASK(AZ_FILTER) | TASK(FLIGHT_MODE) | TASK(FCU),
+    TASK(H_FILTER) | TASK(VZ_FILTER) | TASK(VA_FILTER) | TASK(Q_FILTER) |
+        TASK(AZ_FILTER) | TASK(FLIGHT_MODE) | TASK(FCU) | TASK(FCCS_COM),
+    TASK(FCCS_COM) | TASK(FCCS_MON)};
+
+/* Stage of each task */
+static const size_t task_stages[NB_TASKS] = {
+    NO_STAGE,
+    NO_STAGE,
+    NO_STAGE,
+    RROSACE_SIM_STAGE_FILTERS,
+    RROSACE_SIM_STAGE_FILTERS,
+    RROSACE_SIM_STAGE_FILTERS,
+    RROSACE_SIM_STAGE_FILTERS,
+    RROSACE_SIM_STAGE_FILTERS,
+    NO_STAGE,
+    NO_STAGE,
+    RROSACE_SIM_STAGE_FCCS,
+    RROSACE_SIM_STAGE_FCCS,
+    NO_STAGE};
+
+/* Tasks of each stage, consecutive */
+static const unsigned int stage_tasks[RROSACE_SIM_NB_STAGES] = {
+    TASK(H_FILTER) | TASK(VZ_FILTER) | TASK(VA_FILTER) | TASK(Q_FILTER) |
+        TASK(AZ_FILTER),
+    TASK(FCCS_COM) | TASK(FCCS_MON)};
+
+/* Last task of each stage */
+static const size_t stage_last[RROSACE_SIM_NB_STAGES] = {AZ_FILTER,
+                                                          FCCS_MON};
+
+/* Type of each filter, in the order of their tasks */
+static const rrosace_filter_type_t filter_types[RROSACE_SIM_NB_FILTERS] = {
+    RROSACE_ALTITUDE_FILTER, RROSACE_VERTICAL_AIRSPEED_FILTER,
+    RROSACE_TRUE_AIRSPEED_FILTER, RROSACE_PITCH_RATE_FILTER,
+    RROSACE_VERTICAL_ACCELERATION_FILTER};
+
+static int check_models(const struct models *p_models) {
+  int ret = EXIT_FAILURE;
+  size_t i;
+
+  if (!p_models->p_engine || !p_models->p_elevator ||
+      !p_models->p_flight_dynamics || !p_models->p_h_filter ||
+      !p_models->p_vz_filter || !p_models->p_va_filter ||
+      !p_models->p_q_filter || !p_models->p_az_filter ||
+      !p_models->p_flight_mode || !p_models->p_fcu) {
+    goto out;
+  }
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS; ++i) {
+    if (!p_models->p_fccs[i]) {
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+static void delete_models(struct models *p_models) {
+  size_t i;
+
+  rrosace_engine_del(p_models->p_engine);
+  rrosace_elevator_del(p_models->p_elevator);
+  rrosace_flight_dynamics_del(p_models->p_flight_dynamics);
+  rrosace_filter_del(p_models->p_h_filter);
+  rrosace_filter_del(p_models->p_vz_filter);
+  rrosace_filter_del(p_models->p_va_filter);
+  rrosace_filter_del(p_models->p_q_filter);
+  rrosace_filter_del(p_models->p_az_filter);
+  rrosace_flight_mode_del(p_models->p_flight_mode);
+  rrosace_fcu_del(p_models->p_fcu);
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS; ++i) {
+    rrosace_fcc_del(p_models->p_fccs[i]);
+  }
+}
+
+/**
+ * @brief Periods of the tasks, from their frequencies and the physical one
+ */
+static void init_periods(rrosace_sim_t *p_sim) {
+  size_t *periods = p_sim->periods;
+
+  periods[ELEVATOR] = (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ /
+                               RROSACE_ELEVATOR_DEFAULT_FREQ);
+  periods[ENGINE] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_ENGINE_DEFAULT_FREQ);
+  periods[FLIGHT_DYNAMICS] = (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ /
+                                      RROSACE_FLIGHT_DYNAMICS_DEFAULT_FREQ);
+  periods[H_FILTER] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_FREQ_50_HZ);
+  periods[VZ_FILTER] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_FREQ_100_HZ);
+  periods[VA_FILTER] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_FREQ_100_HZ);
+  periods[Q_FILTER] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_FREQ_100_HZ);
+  periods[AZ_FILTER] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_FREQ_100_HZ);
+  periods[FLIGHT_MODE] = (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ /
+                                  RROSACE_FLIGHT_MODE_DEFAULT_FREQ);
+  periods[FCU] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_FCU_DEFAULT_FREQ);
+  periods[FCCS_COM] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_FCC_DEFAULT_FREQ);
+  periods[FCCS_MON] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_FCC_DEFAULT_FREQ);
+  periods[CABLES] =
+      (size_t)(RROSACE_DEFAULT_PHYSICAL_FREQ / RROSACE_CABLES_DEFAULT_FREQ);
+}
+
+/**
+ * @brief Time step of a task, its period
+ */
+static double task_dt(const rrosace_sim_t *p_sim, size_t task) {
+  return ((double)p_sim->periods[task] / RROSACE_DEFAULT_PHYSICAL_FREQ);
+}
+
+static size_t gcd(size_t a, size_t b) {
+  while (b) {
+    const size_t r = a % b;
+
+    a = b;
+    b = r;
+  }
+
+  return (a);
+}
+
+/**
+ * @brief Build the dispatch table of the hyperperiod from the rate table, so
+ * that a tick only walks the tasks it releases
+ */
+static int init_schedule(rrosace_sim_t *p_sim) {
+  int ret = EXIT_FAILURE;
+  size_t hyperperiod = 1;
+  size_t phase;
+  size_t task;
+
+  for (task = 0; task < NB_TASKS; ++task) {
+    if (!p_sim->periods[task]) {
+      goto out;
+    }
+    hyperperiod = hyperperiod / gcd(hyperperiod, p_sim->periods[task]) *
+                  p_sim->periods[task];
+    if (hyperperiod > MAX_HYPERPERIOD) {
+      goto out;
+    }
+  }
+
+  for (phase = 0; phase < hyperperiod; ++phase) {
+    size_t nb_released = 0;
+
+    p_sim->releases[phase] = 0;
+    for (task = 0; task < NB_TASKS; ++task) {
+      if (phase % p_sim->periods[task] == 0) {
+        p_sim->schedule[phase][nb_released].step = task_steps[task];
+        p_sim->schedule[phase][nb_released].dt = task_dt(p_sim, task);
+        ++nb_released;
+        p_sim->releases[phase] |= 1U << task;
+      }
+    }
+    p_sim->schedule[phase][nb_released].step = NULL;
+  }
+
+  p_sim->hyperperiod = hyperperiod;
+  p_sim->phase = 0;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+static int elevator_step(struct models *p_models,
+                         const rrosace_sim_values_t *p_in,
+                         rrosace_sim_values_t *p_out, double dt) {
+  return (rrosace_elevator_step(p_models->p_elevator, p_in->delta_e_c,
+                                &p_out->delta_e, dt));
+}
+
+static int engine_step(struct models *p_models,
+                       const rrosace_sim_values_t *p_in,
+                       rrosace_sim_values_t *p_out, double dt) {
+  return (rrosace_engine_step(p_models->p_engine, p_in->delta_th_c, &p_out->t,
+                              dt));
+}
+
+static int flight_dynamics_step(struct models *p_models,
+                                const rrosace_sim_values_t *p_in,
+                                rrosace_sim_values_t *p_out, double dt) {
+  return (rrosace_flight_dynamics_step(
+      p_models->p_flight_dynamics, p_in->delta_e, p_in->t, &p_out->h,
+      &p_out->vz, &p_out->va, &p_out->q, &p_out->az, dt));
+}
+
+static int h_filter_step(struct models *p_models,
+                         const rrosace_sim_values_t *p_in,
+                         rrosace_sim_values_t *p_out, double dt) {
+  (void)dt;
+
+  return (rrosace_filter_step(p_models->p_h_filter,
+                              p_in->h + p_models->parameters.h_bias,
+                              &p_out->h_f));
+}
+
+static int vz_filter_step(struct models *p_models,
+                          const rrosace_sim_values_t *p_in,
+                          rrosace_sim_values_t *p_out, double dt) {
+  (void)dt;
+
+  return (rrosace_filter_step(p_models->p_vz_filter,
+                              p_in->vz + p_models->parameters.vz_bias,
+                              &p_out->vz_f));
+}
+
+static int va_filter_step(struct models *p_models,
+                          const rrosace_sim_values_t *p_in,
+                          rrosace_sim_values_t *p_out, double dt) {
+  (void)dt;
+
+  return (rrosace_filter_step(p_models->p_va_filter,
+                              p_in->va + p_models->parameters.va_bias,
+                              &p_out->va_f));
+}
+
+static int q_filter_step(struct models *p_models,
+                         const rrosace_sim_values_t *p_in,
+                         rrosace_sim_values_t *p_out, double dt) {
+  (void)dt;
+
+  return (rrosace_filter_step(p_models->p_q_filter,
+                              p_in->q + p_models->parameters.q_bias,
+                              &p_out->q_f));
+}
+
+static int az_filter_step(struct models *p_models,
+                          const rrosace_sim_values_t *p_in,
+                          rrosace_sim_values_t *p_out, double dt) {
+  (void)dt;
+
+  return (rrosace_filter_step(p_models->p_az_filter,
+                              p_in->az + p_models->parameters.az_bias,
+                              &p_out->az_f));
+}
+
+static int flight_mode_step(struct models *p_models,
+                            const rrosace_sim_values_t *p_in,
+                            rrosace_sim_values_t *p_out, double dt) {
+  (void)p_in;
+  (void)dt;
+
+  p_out->mode = rrosace_flight_mode_get_mode(p_models->p_flight_mode);
+
+  return (EXIT_SUCCESS);
+}
+
+static int fcu_step(struct models *p_models, const rrosace_sim_values_t *p_in,
+                    rrosace_sim_values_t *p_out, double dt) {
+  const rrosace_fcu_t *p_fcu = p_models->p_fcu;
+
+  (void)p_in;
+  (void)dt;
+
+  p_out->h_c = rrosace_fcu_get_h_c(p_fcu);
+  p_out->vz_c = rrosace_fcu_get_vz_c(p_fcu);
+  p_out->va_c = rrosace_fcu_get_va_c(p_fcu);
+
+  return (EXIT_SUCCESS);
+}
+
+static int fcc_com_step(struct models *p_models,
+                        const rrosace_sim_values_t *p_in,
+                        rrosace_sim_values_t *p_out, size_t couple, double dt) {
+  return (rrosace_fcc_com_step(
+      p_models->p_fccs[couple], p_in->mode, p_in->h_f, p_in->vz_f, p_in->va_f,
+      p_in->q_f, p_in->az_f, p_in->h_c, p_in->vz_c, p_in->va_c,
+      &p_out->delta_e_c_partial[couple], &p_out->delta_th_c_partial[couple],
+      dt));
+}
+
+/**
+ * @brief The MON FCC checks the commands its COM FCC just computed from the
+ * same inputs, so it reads them from the outputs
+ */
+static int fcc_mon_step(struct models *p_models,
+                        const rrosace_sim_values_t *p_in,
+                        rrosace_sim_values_t *p_out, size_t couple, double dt) {
+  return (rrosace_fcc_mon_step(
+      p_models->p_fccs[couple + RROSACE_SIM_NB_FCCS_COUPLES], p_in->mode,
+      p_in->h_f, p_in->vz_f, p_in->va_f, p_in->q_f, p_in->az_f, p_in->h_c,
+      p_in->vz_c, p_in->va_c, p_out->delta_e_c_partial[couple],
+      p_out->delta_th_c_partial[couple], p_in->other_master_in_laws[couple],
+      &p_out->relay_delta_e_c[couple], &p_out->relay_delta_th_c[couple],
+      &p_out->master_in_laws[couple], dt));
+}
+
+static int fccs_com_step(struct models *p_models,
+                         const rrosace_sim_values_t *p_in,
+                         rrosace_sim_values_t *p_out, double dt) {
+  int ret = EXIT_SUCCESS;
+  size_t i;
+
+  for (i = 0; (i < RROSACE_SIM_NB_FCCS_COUPLES) && (ret == EXIT_SUCCESS);
+       ++i) {
+    ret = fcc_com_step(p_models, p_in, p_out, i, dt);
+  }
+
+  return (ret);
+}
+
+static int fccs_mon_step(struct models *p_models,
+                         const rrosace_sim_values_t *p_in,
+                         rrosace_sim_values_t *p_out, double dt) {
+  int ret = EXIT_SUCCESS;
+  size_t i;
+
+  for (i = 0; (i < RROSACE_SIM_NB_FCCS_COUPLES) && (ret == EXIT_SUCCESS);
+       ++i) {
+    ret = fcc_mon_step(p_models, p_in, p_out, i, dt);
+  }
+
+  return (ret);
+}
+
+static int cables_step(struct models *p_models,
+                       const rrosace_sim_values_t *p_in,
+                       rrosace_sim_values_t *p_out, double dt) {
+  int ret;
+  rrosace_cables_input_t cables_input[RROSACE_SIM_NB_FCCS_COUPLES];
+  rrosace_cables_output_t cables_output;
+  size_t i;
+
+  (void)p_models;
+  (void)dt;
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+    cables_input[i].delta_e_c = p_in->delta_e_c_partial[i];
+    cables_input[i].delta_th_c = p_in->delta_th_c_partial[i];
+    cables_input[i].relay_delta_e_c = p_in->relay_delta_e_c[i];
+    cables_input[i].relay_delta_th_c = p_in->relay_delta_th_c[i];
+  }
+
+  ret = rrosace_cables_step(cables_input, RROSACE_SIM_NB_FCCS_COUPLES,
+                            &cables_output);
+
+  p_out->delta_e_c = cables_output.delta_e_c;
+  p_out->delta_th_c = cables_output.delta_th_c;
+
+  return (ret);
+}
+
+static void elevator_publish(rrosace_sim_values_t *p_values,
+                             const rrosace_sim_values_t *p_buffer) {
+  p_values->delta_e = p_buffer->delta_e;
+}
+
+static void engine_publish(rrosace_sim_values_t *p_values,
+                           const rrosace_sim_values_t *p_buffer) {
+  p_values->t = p_buffer->t;
+}
+
+static void flight_dynamics_publish(rrosace_sim_values_t *p_values,
+                                    const rrosace_sim_values_t *p_buffer) {
+  p_values->h = p_buffer->h;
+  p_values->vz = p_buffer->vz;
+  p_values->va = p_buffer->va;
+  p_values->q = p_buffer->q;
+  p_values->az = p_buffer->az;
+}
+
+static void h_filter_publish(rrosace_sim_values_t *p_values,
+                             const rrosace_sim_values_t *p_buffer) {
+  p_values->h_f = p_buffer->h_f;
+}
+
+static void vz_filter_publish(rrosace_sim_values_t *p_values,
+                              const rrosace_sim_values_t *p_buffer) {
+  p_values->vz_f = p_buffer->vz_f;
+}
+
+static void va_filter_publish(rrosace_sim_values_t *p_values,
+                              const rrosace_sim_values_t *p_buffer) {
+  p_values->va_f = p_buffer->va_f;
+}
+
+static void q_filter_publish(rrosace_sim_values_t *p_values,
+                             const rrosace_sim_values_t *p_buffer) {
+  p_values->q_f = p_buffer->q_f;
+}
+
+static void az_filter_publish(rrosace_sim_values_t *p_values,
+                              const rrosace_sim_values_t *p_buffer) {
+  p_values->az_f = p_buffer->az_f;
+}
+
+static void flight_mode_publish(rrosace_sim_values_t *p_values,
+                                const rrosace_sim_values_t *p_buffer) {
+  p_values->mode = p_buffer->mode;
+}
+
+static void fcu_publish(rrosace_sim_values_t *p_values,
+                        const rrosace_sim_values_t *p_buffer) {
+  p_values->h_c = p_buffer->h_c;
+  p_values->vz_c = p_buffer->vz_c;
+  p_values->va_c = p_buffer->va_c;
+}
+
+static void fccs_com_publish(rrosace_sim_values_t *p_values,
+                             const rrosace_sim_values_t *p_buffer) {
+  size_t i;
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+    p_values->delta_e_c_partial[i] = p_buffer->delta_e_c_partial[i];
+    p_values->delta_th_c_partial[i] = p_buffer->delta_th_c_partial[i];
+  }
+}
+
+static void fccs_mon_publish(rrosace_sim_values_t *p_values,
+                             const rrosace_sim_values_t *p_buffer) {
+  size_t i;
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+    p_values->relay_delta_e_c[i] = p_buffer->relay_delta_e_c[i];
+    p_values->relay_delta_th_c[i] = p_buffer->relay_delta_th_c[i];
+    p_values->master_in_laws[i] = p_buffer->master_in_laws[i];
+  }
+}
+
+static void cables_publish(rrosace_sim_values_t *p_values,
+                           const rrosace_sim_values_t *p_buffer) {
+  p_values->delta_e_c = p_buffer->delta_e_c;
+  p_values->delta_th_c = p_buffer->delta_th_c;
+}
+
+/**
+ * @brief Immediate semantics tick, every task reading and writing the values
+ */
+static int run_immediate(rrosace_sim_t *p_sim) {
+  int ret = EXIT_SUCCESS;
+  const struct dispatch *p_dispatch;
+
+  if (p_sim->p_team && p_sim->p_team->stages) {
+    return (run_team(p_sim));
+  }
+
+  for (p_dispatch = p_sim->schedule[p_sim->phase];
+       p_dispatch->step && (ret == EXIT_SUCCESS); ++p_dispatch) {
+    ret = p_dispatch->step(&p_sim->models, &p_sim->values, &p_sim->values,
+                           p_dispatch->dt);
+  }
+
+  return (ret);
+}
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec + (double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief Step the units of a participant of a team, every stride from the
+ * first
+ */
+static int run_units(struct team *p_team, size_t first, size_t stride) {
+  int ret = EXIT_SUCCESS;
+  size_t i;
+
+  for (i = first; (i < p_team->nb_units) && (ret == EXIT_SUCCESS);
+       i += stride) {
+    const struct unit *p_unit = &p_team->units[i];
+    size_t task;
+
+    for (task = 0; (task < NB_TASKS) && (ret == EXIT_SUCCESS); ++task) {
+      const double dt = task_dt(p_team->p_sim, task);
+
+      if (!(p_unit->tasks & TASK(task))) {
+        continue;
+      }
+
+      if (task == FCCS_COM) {
+        ret = fcc_com_step(p_team->p_models, p_team->p_values,
+                           p_team->p_values, p_unit->couple, dt);
+      } else if (task == FCCS_MON) {
+        ret = fcc_mon_step(p_team->p_models, p_team->p_values,
+                           p_team->p_values, p_unit->couple, dt);
+      } else {
+        ret = task_steps[task](p_team->p_models, p_team->p_values,
+                               p_team->p_values, dt);
+      }
+    }
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Wait for the members of a team and the caller to step their units,
+ * polling before yielding the core
+ */
+static void join(struct team *p_team, unsigned long *p_sense) {
+  size_t spins = 0;
+
+  *p_sense = !*p_sense;
+
+  if (__atomic_add_fetch(&p_team->count, 1, __ATOMIC_ACQ_REL) ==
+      p_team->nb_members + 1) {
+    __atomic_store_n(&p_team->count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&p_team->sense, *p_sense, __ATOMIC_RELEASE);
+    return;
+  }
+
+  while (__atomic_load_n(&p_team->sense, __ATOMIC_ACQUIRE) != *p_sense) {
+    if (++spins >= SPINS) {
+      sched_yield();
+      spins = 0;
+    }
+  }
+}
+
+/**
+ * @brief Thread of a team member, spinning for the forks of the caller
+ */
+static void *member_main(void *p_arg) {
+  struct member *p_member = (struct member *)p_arg;
+  struct team *p_team = p_member->p_team;
+  unsigned long epoch = 0;
+  size_t spins = 0;
+
+  rrosace_pin_core(p_member->core);
+
+  for (;;) {
+    const unsigned long fork =
+        __atomic_load_n(&p_team->epoch, __ATOMIC_ACQUIRE);
+
+    if (fork == epoch) {
+      if (++spins >= SPINS) {
+        sched_yield();
+        spins = 0;
+      }
+      continue;
+    }
+    epoch = fork;
+    spins = 0;
+
+    if (p_team->stop) {
+      break;
+    }
+
+    p_member->ret =
+        run_units(p_team, p_member->index + 1, p_team->nb_members + 1);
+    join(p_team, &p_member->sense);
+  }
+
+  return (NULL);
+}
+
+/**
+ * @brief Fork the units set on a team, step the share of the caller, then
+ * join the members
+ */
+static int fork_join(struct team *p_team) {
+  int ret;
+  size_t member;
+
+  __atomic_add_fetch(&p_team->epoch, 1, __ATOMIC_RELEASE);
+  ret = run_units(p_team, 0, p_team->nb_members + 1);
+  join(p_team, &p_team->caller_sense);
+
+  for (member = 0; member < p_team->nb_members; ++member) {
+    if (p_team->members[member].ret == EXIT_FAILURE) {
+      ret = EXIT_FAILURE;
+    }
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Set the units of the tasks released of a stage, a unit for each
+ * filter, or for each couple of FCCs
+ */
+static void set_units(struct team *p_team, size_t stage,
+                      unsigned int released) {
+  const unsigned int tasks = released & stage_tasks[stage];
+  size_t i;
+
+  p_team->nb_units = 0;
+  if (stage == RROSACE_SIM_STAGE_FCCS) {
+    for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+      p_team->units[p_team->nb_units].tasks = tasks;
+      p_team->units[p_team->nb_units++].couple = i;
+    }
+  } else {
+    for (i = 0; i < NB_TASKS; ++i) {
+      if (tasks & TASK(i)) {
+        p_team->units[p_team->nb_units].tasks = TASK(i);
+        p_team->units[p_team->nb_units++].couple = 0;
+      }
+    }
+  }
+}
+
+static int run_stage(struct team *p_team, size_t stage,
+                     unsigned int released) {
+  set_units(p_team, stage, released);
+
+  /* A single unit is not worth a fork */
+  return ((p_team->nb_units > 1) ? fork_join(p_team)
+                                 : run_units(p_team, 0, 1));
+}
+
+/**
+ * @brief Immediate semantics tick, the stages of the team forked on it
+ */
+static int run_team(rrosace_sim_t *p_sim) {
+  int ret = EXIT_SUCCESS;
+  struct team *p_team = p_sim->p_team;
+  const unsigned int released = p_sim->releases[p_sim->phase];
+  size_t task;
+
+  for (task = 0; (task < NB_TASKS) && (ret == EXIT_SUCCESS); ++task) {
+    const size_t stage = task_stages[task];
+
+    if (!(released & TASK(task))) {
+      continue;
+    }
+
+    if ((stage != NO_STAGE) && (p_team->stages & RROSACE_SIM_STAGE(stage))) {
+      ret = run_stage(p_team, stage, released);
+      task = stage_last[stage];
+    } else {
+      ret = task_steps[task](&p_sim->models, &p_sim->values, &p_sim->values,
+                             task_dt(p_sim, task));
+    }
+  }
+
+  return (ret);
+}
+
+static void delete_team(rrosace_sim_t *p_sim) {
+  struct team *p_team = p_sim->p_team;
+  size_t member;
+
+  if (!p_team) {
+    return;
+  }
+
+  p_team->stop = 1;
+  __atomic_add_fetch(&p_team->epoch, 1, __ATOMIC_RELEASE);
+
+  for (member = 0; member < p_team->nb_members; ++member) {
+    if (p_team->members[member].started) {
+      pthread_join(p_team->members[member].thread, NULL);
+    }
+  }
+
+  free(p_team);
+  p_sim->p_team = NULL;
+}
+
+static int run_job(rrosace_sim_t *p_sim, struct job *p_job) {
+  int ret = EXIT_SUCCESS;
+  size_t task;
+
+  for (task = 0; (task < NB_TASKS) && (ret == EXIT_SUCCESS); ++task) {
+    if (p_job->tasks & (1U << task)) {
+      ret = task_steps[task](&p_sim->models, &p_job->input, &p_job->output,
+                             task_dt(p_sim, task));
+    }
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Thread of the cyber partition, running the jobs in release order
+ */
+static void *helper_main(void *p_arg) {
+  rrosace_sim_t *p_sim = (rrosace_sim_t *)p_arg;
+
+  pthread_mutex_lock(&p_sim->mutex);
+  for (;;) {
+    struct job *p_job;
+
+    while (!p_sim->stop && (p_sim->nb_completed == p_sim->nb_submitted)) {
+      pthread_cond_wait(&p_sim->cond, &p_sim->mutex);
+    }
+    if (p_sim->nb_completed == p_sim->nb_submitted) {
+      break;
+    }
+    p_job = &p_sim->jobs[p_sim->queue[p_sim->nb_completed % MAX_HYPERPERIOD]];
+    pthread_mutex_unlock(&p_sim->mutex);
+
+    p_job->ret = run_job(p_sim, p_job);
+
+    pthread_mutex_lock(&p_sim->mutex);
+    ++p_sim->nb_completed;
+    pthread_cond_broadcast(&p_sim->cond);
+  }
+  pthread_mutex_unlock(&p_sim->mutex);
+
+  return (NULL);
+}
+
+static int start_helper(rrosace_sim_t *p_sim) {
+  int ret = EXIT_FAILURE;
+
+  p_sim->stop = 0;
+  if (pthread_create(&p_sim->helper, NULL, helper_main, p_sim)) {
+    goto out;
+  }
+  p_sim->helper_started = 1;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+static void stop_helper(rrosace_sim_t *p_sim) {
+  if (p_sim->helper_started) {
+    pthread_mutex_lock(&p_sim->mutex);
+    p_sim->stop = 1;
+    pthread_cond_broadcast(&p_sim->cond);
+    pthread_mutex_unlock(&p_sim->mutex);
+
+    pthread_join(p_sim->helper, NULL);
+    p_sim->helper_started = 0;
+  }
+}
+
+/**
+ * @brief Wait for the jobs submitted to the cyber partition thread, before
+ * touching its models
+ */
+static void drain(const rrosace_sim_t *p_sim) {
+  rrosace_sim_t *p_mutable = (rrosace_sim_t *)p_sim;
+
+  if (p_sim->helper_started) {
+    pthread_mutex_lock(&p_mutable->mutex);
+    while (p_mutable->nb_completed != p_mutable->nb_submitted) {
+      pthread_cond_wait(&p_mutable->cond, &p_mutable->mutex);
+    }
+    pthread_mutex_unlock(&p_mutable->mutex);
+  }
+}
+
+/**
+ * @brief Publish the outputs of the tasks whose deadline is the current tick
+ */
+static int publish(rrosace_sim_t *p_sim) {
+  int ret = EXIT_SUCCESS;
+  size_t task;
+
+  for (task = 0; (task < NB_TASKS) && (ret == EXIT_SUCCESS); ++task) {
+    const size_t buffer = p_sim->pending[task];
+    const rrosace_sim_values_t *p_buffer;
+
+    if ((buffer == NO_BUFFER) ||
+        (p_sim->deadlines[task] != p_sim->logical_time)) {
+      continue;
+    }
+
+    if (buffer == PHYSICAL_BUFFER) {
+      p_buffer = &p_sim->physical_output;
+    } else {
+      struct job *p_job = &p_sim->jobs[buffer];
+
+      if (p_sim->helper_started) {
+        pthread_mutex_lock(&p_sim->mutex);
+        while (p_sim->nb_completed <= p_job->sequence) {
+          pthread_cond_wait(&p_sim->cond, &p_sim->mutex);
+        }
+        pthread_mutex_unlock(&p_sim->mutex);
+      }
+      ret = p_job->ret;
+      p_buffer = &p_job->output;
+    }
+
+    task_publishes[task](&p_sim->values, p_buffer);
+    p_sim->pending[task] = NO_BUFFER;
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Release the tasks of the current tick, the cyber ones as a job
+ * reading a copy of the published values
+ */
+static int release(rrosace_sim_t *p_sim) {
+  int ret = EXIT_SUCCESS;
+  const unsigned int released = p_sim->releases[p_sim->phase];
+  struct job *p_job = &p_sim->jobs[p_sim->phase];
+  size_t task;
+
+  p_job->tasks = 0;
+  for (task = 0; task < NB_TASKS; ++task) {
+    if (released & (1U << task)) {
+      p_sim->pending[task] =
+          task_cyber[task] ? p_sim->phase : (size_t)PHYSICAL_BUFFER;
+      p_sim->deadlines[task] = p_sim->logical_time + p_sim->periods[task];
+      if (task_cyber[task]) {
+        p_job->tasks |= 1U << task;
+      }
+    }
+  }
+
+  if (p_job->tasks) {
+    p_job->input = p_sim->values;
+    p_job->output = p_sim->values;
+
+    if (p_sim->helper_started) {
+      pthread_mutex_lock(&p_sim->mutex);
+      p_job->sequence = p_sim->nb_submitted;
+      p_sim->queue[p_sim->nb_submitted % MAX_HYPERPERIOD] = p_sim->phase;
+      ++p_sim->nb_submitted;
+      pthread_cond_broadcast(&p_sim->cond);
+      pthread_mutex_unlock(&p_sim->mutex);
+    } else {
+      p_job->ret = run_job(p_sim, p_job);
+    }
+  }
+
+  /* The physical partition runs meanwhile, from the published values */
+  for (task = 0; (task < NB_TASKS) && (ret == EXIT_SUCCESS); ++task) {
+    if ((released & (1U << task)) && !task_cyber[task]) {
+      ret = task_steps[task](&p_sim->models, &p_sim->values,
+                             &p_sim->physical_output, task_dt(p_sim, task));
+    }
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief LET semantics tick
+ */
+static int run_let(rrosace_sim_t *p_sim) {
+  int ret = publish(p_sim);
+
+  if (ret == EXIT_SUCCESS) {
+    ret = release(p_sim);
+  }
+
+  return (ret);
+}
+
+static int failed(const rrosace_sim_t *p_sim) {
+  return (__atomic_load_n(&p_sim->failed, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * @brief Wait for another rate group to publish at a deadline, polling
+ * before yielding the core
+ */
+static void wait_version(const rrosace_sim_t *p_sim, const struct slot *p_slot,
+                         unsigned long version) {
+  size_t spins = 0;
+
+  while ((__atomic_load_n(&p_slot->version, __ATOMIC_ACQUIRE) != version) &&
+         !failed(p_sim)) {
+    if (++spins >= SPINS) {
+      sched_yield();
+      spins = 0;
+    }
+  }
+}
+
+/**
+ * @brief Wait for all the rate groups to reach the hyperperiod boundary, so
+ * that the slots of the previous hyperperiod are no longer read
+ */
+static void barrier_wait(rrosace_sim_t *p_sim, struct group *p_group) {
+  size_t spins = 0;
+
+  p_group->sense = !p_group->sense;
+
+  if (__atomic_add_fetch(&p_sim->barrier_count, 1, __ATOMIC_ACQ_REL) ==
+      p_sim->nb_groups) {
+    __atomic_store_n(&p_sim->barrier_count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&p_sim->barrier_sense, p_group->sense, __ATOMIC_RELEASE);
+    return;
+  }
+
+  while ((__atomic_load_n(&p_sim->barrier_sense, __ATOMIC_ACQUIRE) !=
+          p_group->sense) &&
+         !failed(p_sim)) {
+    if (++spins >= SPINS) {
+      sched_yield();
+      spins = 0;
+    }
+  }
+}
+
+/**
+ * @brief Run the ticks of a rate group up to the target, publishing at its
+ * deadlines and reading the other groups at its releases
+ */
+static int run_group(struct group *p_group, size_t target) {
+  int ret = EXIT_SUCCESS;
+  rrosace_sim_t *p_sim = p_group->p_sim;
+  size_t tick;
+
+  for (tick = p_group->logical_time;
+       (tick < target) && (ret == EXIT_SUCCESS) && !failed(p_sim); ++tick) {
+    const size_t phase = tick % p_sim->hyperperiod;
+    size_t other;
+    size_t task;
+
+    if (!phase) {
+      barrier_wait(p_sim, p_group);
+    }
+
+    if (tick % p_group->period) {
+      continue;
+    }
+
+    /* Deadline of the previous job */
+    if (tick) {
+      struct slot *p_slot = &p_group->slots[phase];
+
+      for (task = 0; task < NB_TASKS; ++task) {
+        if (p_group->tasks & TASK(task)) {
+          task_publishes[task](&p_group->view, &p_group->output);
+        }
+      }
+      p_slot->values = p_group->output;
+      __atomic_store_n(&p_slot->version, (unsigned long)tick + 1,
+                       __ATOMIC_RELEASE);
+    }
+
+    /* Last publications of the other groups read */
+    for (other = 0; other < p_sim->nb_groups; ++other) {
+      const struct group *p_other = &p_sim->p_groups[other];
+      const size_t deadline = tick / p_other->period * p_other->period;
+      const struct slot *p_slot;
+
+      if ((other == p_group->index) || !(p_group->reads & p_other->tasks) ||
+          !deadline) {
+        continue;
+      }
+
+      p_slot = &p_other->slots[deadline % p_sim->hyperperiod];
+      wait_version(p_sim, p_slot, (unsigned long)deadline + 1);
+      for (task = 0; task < NB_TASKS; ++task) {
+        if (p_other->tasks & TASK(task)) {
+          task_publishes[task](&p_group->view, &p_slot->values);
+        }
+      }
+    }
+
+    /* Release */
+    p_group->output = p_group->view;
+    for (task = 0; (task < NB_TASKS) && (ret == EXIT_SUCCESS); ++task) {
+      if (p_group->tasks & TASK(task)) {
+        ret = task_steps[task](&p_sim->models, &p_group->view,
+                               &p_group->output, task_dt(p_sim, task));
+      }
+    }
+  }
+
+  if ((ret == EXIT_FAILURE) || failed(p_sim)) {
+    __atomic_store_n(&p_sim->failed, 1, __ATOMIC_RELEASE);
+    ret = EXIT_FAILURE;
+  }
+  p_group->logical_time = target;
+
+  return (ret);
+}
+
+/**
+ * @brief Spread the members of a team over the cores the caller may run on,
+ * but the one it runs on, the members being left unpinned when no other core
+ * is allowed
+ */
+static void set_member_cores(struct team *p_team, size_t nb_threads) {
+  size_t member;
+
+  for (member = 0; member < nb_threads; ++member) {
+    p_team->members[member].core = rrosace_spread_core(member, 1);
+  }
+}
+
+/**
+ * @brief Thread of a rate group, running up to each target set
+ */
+static void *group_main(void *p_arg) {
+  struct group *p_group = (struct group *)p_arg;
+  rrosace_sim_t *p_sim = p_group->p_sim;
+
+  rrosace_pin_core(p_group->core);
+
+  pthread_mutex_lock(&p_sim->mutex);
+  for (;;) {
+    size_t target;
+    int ret;
+
+    while (!p_sim->stop && (p_group->logical_time == p_sim->target)) {
+      pthread_cond_wait(&p_sim->cond, &p_sim->mutex);
+    }
+    if (p_sim->stop) {
+      break;
+    }
+    target = p_sim->target;
+    pthread_mutex_unlock(&p_sim->mutex);
+
+    ret = run_group(p_group, target);
+
+    pthread_mutex_lock(&p_sim->mutex);
+    if (ret == EXIT_FAILURE) {
+      p_sim->groups_ret = EXIT_FAILURE;
+    }
+    ++p_sim->nb_groups_done;
+    pthread_cond_broadcast(&p_sim->cond);
+  }
+  pthread_mutex_unlock(&p_sim->mutex);
+
+  return (NULL);
+}
+
+/**
+ * @brief Gather the tasks of a same period in rate groups
+ */
+static int init_groups(rrosace_sim_t *p_sim) {
+  int ret = EXIT_FAILURE;
+  size_t task;
+  size_t group;
+
+  p_sim->p_groups = (struct group *)calloc(NB_TASKS, sizeof(struct group));
+  if (!p_sim->p_groups) {
+    goto out;
+  }
+
+  p_sim->nb_groups = 0;
+  for (task = 0; task < NB_TASKS; ++task) {
+    for (group = 0; (group < p_sim->nb_groups) &&
+                    (p_sim->p_groups[group].period != p_sim->periods[task]);
+         ++group) {
+    }
+
+    if (group == p_sim->nb_groups) {
+      struct group *p_group = &p_sim->p_groups[p_sim->nb_groups++];
+
+      p_group->p_sim = p_sim;
+      p_group->index = group;
+      p_group->period = p_sim->periods[task];
+      p_group->view = p_sim->values;
+      p_group->output = p_sim->values;
+      p_group->logical_time = p_sim->logical_time;
+    }
+    p_sim->p_groups[group].tasks |= TASK(task);
+    p_sim->p_groups[group].reads |= task_reads[task];
+  }
+
+  for (group = 0; group < p_sim->nb_groups; ++group) {
+    p_sim->p_groups[group].reads &= ~p_sim->p_groups[group].tasks;
+  }
+
+  p_sim->target = p_sim->logical_time;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+static int copy_groups(rrosace_sim_t *p_sim, const rrosace_sim_t *p_other) {
+  int ret = EXIT_FAILURE;
+  size_t group;
+
+  p_sim->p_groups = (struct group *)calloc(NB_TASKS, sizeof(struct group));
+  if (!p_sim->p_groups) {
+    goto out;
+  }
+
+  memcpy(p_sim->p_groups, p_other->p_groups,
+         p_other->nb_groups * sizeof(struct group));
+  for (group = 0; group < p_other->nb_groups; ++group) {
+    p_sim->p_groups[group].p_sim = p_sim;
+    p_sim->p_groups[group].started = 0;
+  }
+  p_sim->nb_groups = p_other->nb_groups;
+  p_sim->target = p_other->target;
+  p_sim->failed = p_other->failed;
+  p_sim->barrier_sense = p_other->barrier_sense;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+static int start_groups(rrosace_sim_t *p_sim) {
+  int ret = EXIT_SUCCESS;
+  size_t group;
+
+  p_sim->stop = 0;
+  for (group = 0; (group < p_sim->nb_groups) && (ret == EXIT_SUCCESS);
+       ++group) {
+    struct group *p_group = &p_sim->p_groups[group];
+
+    p_group->core = rrosace_spread_core(group, 0);
+    if (pthread_create(&p_group->thread, NULL, group_main, p_group)) {
+      ret = EXIT_FAILURE;
+    } else {
+      p_group->started = 1;
+    }
+  }
+
+  return (ret);
+}
+
+static void delete_groups(rrosace_sim_t *p_sim) {
+  size_t group;
+
+  if (!p_sim->p_groups) {
+    return;
+  }
+
+  pthread_mutex_lock(&p_sim->mutex);
+  p_sim->stop = 1;
+  pthread_cond_broadcast(&p_sim->cond);
+  pthread_mutex_unlock(&p_sim->mutex);
+
+  for (group = 0; group < p_sim->nb_groups; ++group) {
+    if (p_sim->p_groups[group].started) {
+      pthread_join(p_sim->p_groups[group].thread, NULL);
+    }
+  }
+
+  free(p_sim->p_groups);
+  p_sim->p_groups = NULL;
+  p_sim->nb_groups = 0;
+}
+
+/**
+ * @brief Run the rate groups for a number of physical ticks, then gather the
+ * values they published
+ */
+static int run_groups(rrosace_sim_t *p_sim, size_t n_ticks) {
+  int ret;
+  size_t group;
+  size_t task;
+
+  if (!n_ticks) {
+    return (failed(p_sim) ? EXIT_FAILURE : EXIT_SUCCESS);
+  }
+
+  pthread_mutex_lock(&p_sim->mutex);
+  p_sim->target = p_sim->logical_time + n_ticks;
+  p_sim->nb_groups_done = 0;
+  p_sim->groups_ret = EXIT_SUCCESS;
+  pthread_cond_broadcast(&p_sim->cond);
+  while (p_sim->nb_groups_done < p_sim->nb_groups) {
+    pthread_cond_wait(&p_sim->cond, &p_sim->mutex);
+  }
+  ret = p_sim->groups_ret;
+  pthread_mutex_unlock(&p_sim->mutex);
+
+  for (group = 0; group < p_sim->nb_groups; ++group) {
+    const struct group *p_group = &p_sim->p_groups[group];
+
+    for (task = 0; task < NB_TASKS; ++task) {
+      if (p_group->tasks & TASK(task)) {
+        task_publishes[task](&p_sim->values, &p_group->view);
+      }
+    }
+  }
+
+  if (ret == EXIT_SUCCESS) {
+    p_sim->logical_time = p_sim->target;
+    p_sim->phase = p_sim->logical_time % p_sim->hyperperiod;
+  }
+
+  return (ret);
+}
+
+rrosace_sim_t *rrosace_sim_new(rrosace_mode_t mode, double h_c, double vz_c,
+                               double va_c) {
+  rrosace_sim_t *p_sim = (rrosace_sim_t *)calloc(1, sizeof(rrosace_sim_t));
+  struct models *p_models;
+  rrosace_sim_values_t *p_values;
+  size_t i;
+
+  if (!p_sim) {
+    goto out;
+  }
+
+  pthread_mutex_init(&p_sim->mutex, NULL);
+  pthread_cond_init(&p_sim->cond, NULL);
+
+  p_models = &p_sim->models;
+  p_values = &p_sim->values;
+
+  p_models->p_engine = rrosace_engine_new(RROSACE_TAU);
+  p_models->p_elevator = rrosace_elevator_new(RROSACE_OMEGA, RROSACE_XI);
+  p_models->p_flight_dynamics = rrosace_flight_dynamics_new();
+  p_models->p_h_filter =
+      rrosace_filter_new(RROSACE_ALTITUDE_FILTER, RROSACE_FILTER_FREQ_50HZ);
+  p_models->p_vz_filter = rrosace_filter_new(RROSACE_VERTICAL_AIRSPEED_FILTER,
+                                             RROSACE_FILTER_FREQ_100HZ);
+  p_models->p_va_filter = rrosace_filter_new(RROSACE_TRUE_AIRSPEED_FILTER,
+                                             RROSACE_FILTER_FREQ_100HZ);
+  p_models->p_q_filter =
+      rrosace_filter_new(RROSACE_PITCH_RATE_FILTER, RROSACE_FILTER_FREQ_100HZ);
+  p_models->p_az_filter = rrosace_filter_new(
+      RROSACE_VERTICAL_ACCELERATION_FILTER, RROSACE_FILTER_FREQ_100HZ);
+  p_models->p_flight_mode = rrosace_flight_mode_new();
+  p_models->p_fcu = rrosace_fcu_new();
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS; ++i) {
+    p_models->p_fccs[i] = rrosace_fcc_new();
+  }
+
+  if (check_models(p_models) == EXIT_FAILURE) {
+    rrosace_sim_del(p_sim);
+    p_sim = NULL;
+    goto out;
+  }
+
+  rrosace_sim_nominal_parameters(&p_models->parameters);
+
+  p_values->mode = mode;
+  p_values->delta_e = RROSACE_DELTA_E_EQ;
+  p_values->delta_e_c = RROSACE_DELTA_E_C_EQ;
+  p_values->delta_th_c = RROSACE_DELTA_TH_C_EQ;
+  p_values->t = RROSACE_T_EQ;
+  p_values->h = RROSACE_H_EQ;
+  p_values->vz = RROSACE_VZ_EQ;
+  p_values->va = RROSACE_VA_EQ;
+  p_values->q = RROSACE_Q_EQ;
+  p_values->az = RROSACE_AZ_EQ;
+  p_values->h_f = RROSACE_H_F_EQ;
+  p_values->vz_f = RROSACE_VZ_F_EQ;
+  p_values->va_f = RROSACE_VA_F_EQ;
+  p_values->q_f = RROSACE_Q_F_EQ;
+  p_values->az_f = RROSACE_AZ_F_EQ;
+  p_values->h_c = h_c;
+  p_values->vz_c = vz_c;
+  p_values->va_c = va_c;
+
+  /* First couple in law, second couple on standby */
+  for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+    p_values->delta_e_c_partial[i] = RROSACE_DELTA_E_EQ;
+    p_values->delta_th_c_partial[i] = RROSACE_DELTA_TH_EQ;
+    p_values->relay_delta_e_c[i] =
+        i == 0 ? RROSACE_RELAY_CLOSED : RROSACE_RELAY_OPENED;
+    p_values->relay_delta_th_c[i] =
+        i == 0 ? RROSACE_RELAY_CLOSED : RROSACE_RELAY_OPENED;
+    p_values->master_in_laws[i] =
+        i == 0 ? RROSACE_MASTER_IN_LAW : RROSACE_NOT_MASTER_IN_LAW;
+    p_values->other_master_in_laws[i] =
+        i == 0 ? RROSACE_NOT_MASTER_IN_LAW : RROSACE_MASTER_IN_LAW;
+  }
+
+  init_periods(p_sim);
+  if (init_schedule(p_sim) == EXIT_FAILURE) {
+    rrosace_sim_del(p_sim);
+    p_sim = NULL;
+    goto out;
+  }
+  p_sim->logical_time = 0;
+  p_sim->semantics = RROSACE_SIM_IMMEDIATE;
+  for (i = 0; i < NB_TASKS; ++i) {
+    p_sim->pending[i] = NO_BUFFER;
+  }
+
+  rrosace_flight_mode_set_mode(p_models->p_flight_mode, mode);
+  rrosace_sim_set_commands(p_sim, h_c, vz_c, va_c);
+
+out:
+  return (p_sim);
+}
+
+rrosace_sim_t *rrosace_sim_copy(const rrosace_sim_t *p_other) {
+  rrosace_sim_t *p_sim = NULL;
+  struct models *p_models;
+  const struct models *p_other_models;
+  size_t i;
+
+  if (!p_other) {
+    goto out;
+  }
+
+  p_sim = (rrosace_sim_t *)calloc(1, sizeof(rrosace_sim_t));
+  if (!p_sim) {
+    goto out;
+  }
+
+  pthread_mutex_init(&p_sim->mutex, NULL);
+  pthread_cond_init(&p_sim->cond, NULL);
+
+  drain(p_other);
+
+  p_models = &p_sim->models;
+  p_other_models = &p_other->models;
+
+  p_models->p_engine = rrosace_engine_copy(p_other_models->p_engine);
+  p_models->p_elevator = rrosace_elevator_copy(p_other_models->p_elevator);
+  p_models->p_flight_dynamics =
+      rrosace_flight_dynamics_copy(p_other_models->p_flight_dynamics);
+  p_models->p_h_filter = rrosace_filter_copy(p_other_models->p_h_filter);
+  p_models->p_vz_filter = rrosace_filter_copy(p_other_models->p_vz_filter);
+  p_models->p_va_filter = rrosace_filter_copy(p_other_models->p_va_filter);
+  p_models->p_q_filter = rrosace_filter_copy(p_other_models->p_q_filter);
+  p_models->p_az_filter = rrosace_filter_copy(p_other_models->p_az_filter);
+  p_models->p_flight_mode =
+      rrosace_flight_mode_copy(p_other_models->p_flight_mode);
+  p_models->p_fcu = rrosace_fcu_copy(p_other_models->p_fcu);
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS; ++i) {
+    p_models->p_fccs[i] = rrosace_fcc_copy(p_other_models->p_fccs[i]);
+  }
+
+  if (check_models(p_models) == EXIT_FAILURE) {
+    rrosace_sim_del(p_sim);
+    p_sim = NULL;
+    goto out;
+  }
+
+  p_models->parameters = p_other_models->parameters;
+  p_sim->values = p_other->values;
+  for (i = 0; i < NB_TASKS; ++i) {
+    p_sim->periods[i] = p_other->periods[i];
+    p_sim->pending[i] = p_other->pending[i];
+    p_sim->deadlines[i] = p_other->deadlines[i];
+  }
+  memcpy(p_sim->schedule, p_other->schedule, sizeof(p_sim->schedule));
+  memcpy(p_sim->releases, p_other->releases, sizeof(p_sim->releases));
+  memcpy(p_sim->jobs, p_other->jobs, sizeof(p_sim->jobs));
+  p_sim->physical_output = p_other->physical_output;
+  p_sim->hyperperiod = p_other->hyperperiod;
+  p_sim->phase = p_other->phase;
+  p_sim->logical_time = p_other->logical_time;
+  p_sim->semantics = p_other->semantics;
+
+  /* The jobs copied are complete, numbered before the first one to come */
+  for (i = 0; i < MAX_HYPERPERIOD; ++i) {
+    p_sim->jobs[i].sequence = 0;
+  }
+  p_sim->nb_submitted = 1;
+  p_sim->nb_completed = 1;
+  if (((p_sim->semantics == RROSACE_SIM_LET_CONCURRENT) &&
+       (start_helper(p_sim) == EXIT_FAILURE)) ||
+      ((p_sim->semantics == RROSACE_SIM_LET_RATE_GROUPS) &&
+       ((copy_groups(p_sim, p_other) == EXIT_FAILURE) ||
+        (start_groups(p_sim) == EXIT_FAILURE)))) {
+    rrosace_sim_del(p_sim);
+    p_sim = NULL;
+    goto out;
+  }
+
+out:
+  return (p_sim);
+}
+
+void rrosace_sim_del(rrosace_sim_t *p_sim) {
+  if (p_sim) {
+    delete_team(p_sim);
+    stop_helper(p_sim);
+    delete_groups(p_sim);
+    delete_models(&p_sim->models);
+    pthread_cond_destroy(&p_sim->cond);
+    pthread_mutex_destroy(&p_sim->mutex);
+    free(p_sim);
+  }
+}
+
+int rrosace_sim_set_semantics(rrosace_sim_t *p_sim,
+                              rrosace_sim_semantics_t semantics) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_sim || p_sim->logical_time) {
+    goto out;
+  }
+
+  stop_helper(p_sim);
+  delete_groups(p_sim);
+  if (semantics != RROSACE_SIM_IMMEDIATE) {
+    delete_team(p_sim);
+  }
+  p_sim->semantics = semantics;
+
+  switch (semantics) {
+  case RROSACE_SIM_IMMEDIATE:
+  case RROSACE_SIM_LET:
+    ret = EXIT_SUCCESS;
+    break;
+  case RROSACE_SIM_LET_CONCURRENT:
+    ret = start_helper(p_sim);
+    break;
+  case RROSACE_SIM_LET_RATE_GROUPS:
+    ret = init_groups(p_sim);
+    if (ret == EXIT_SUCCESS) {
+      ret = start_groups(p_sim);
+    }
+    break;
+  default:
+    break;
+  }
+
+  if (ret == EXIT_FAILURE) {
+    delete_groups(p_sim);
+    p_sim->semantics = RROSACE_SIM_IMMEDIATE;
+  }
+
+out:
+  return (ret);
+}
+
+rrosace_sim_semantics_t rrosace_sim_get_semantics(const rrosace_sim_t *p_sim) {
+  return (p_sim ? p_sim->semantics : RROSACE_SIM_IMMEDIATE);
+}
+
+int rrosace_sim_run(rrosace_sim_t *p_sim, size_t n_ticks) {
+  int ret = EXIT_FAILURE;
+  size_t tick;
+
+  if (!p_sim) {
+    goto out;
+  }
+
+  if (p_sim->semantics == RROSACE_SIM_LET_RATE_GROUPS) {
+    ret = run_groups(p_sim, n_ticks);
+    goto out;
+  }
+
+  for (tick = 0, ret = EXIT_SUCCESS; (tick < n_ticks) && (ret == EXIT_SUCCESS);
+       ++tick) {
+    ret = (p_sim->semantics == RROSACE_SIM_IMMEDIATE) ? run_immediate(p_sim)
+                                                      : run_let(p_sim);
+
+    if (ret == EXIT_SUCCESS) {
+      ++p_sim->logical_time;
+      if (++p_sim->phase == p_sim->hyperperiod) {
+        p_sim->phase = 0;
+      }
+    }
+  }
+
+out:
+  return (ret);
+}
+
+int rrosace_sim_run_ordered(rrosace_sim_t *p_sim,
+                            const rrosace_sim_task_t order[]) {
+  int ret = EXIT_FAILURE;
+  unsigned int seen = 0;
+  size_t i;
+
+  if (!p_sim || !order || (p_sim->semantics != RROSACE_SIM_IMMEDIATE)) {
+    goto out;
+  }
+
+  for (i = 0; i < NB_TASKS; ++i) {
+    if (((size_t)order[i] >= NB_TASKS) || (seen & TASK(order[i]))) {
+      goto out;
+    }
+    seen |= TASK(order[i]);
+  }
+
+  for (i = 0, ret = EXIT_SUCCESS; (i < NB_TASKS) && (ret == EXIT_SUCCESS);
+       ++i) {
+    if (p_sim->releases[p_sim->phase] & TASK(order[i])) {
+      ret = task_steps[order[i]](&p_sim->models, &p_sim->values,
+                                 &p_sim->values, task_dt(p_sim, order[i]));
+    }
+  }
+
+  if (ret == EXIT_SUCCESS) {
+    ++p_sim->logical_time;
+    if (++p_sim->phase == p_sim->hyperperiod) {
+      p_sim->phase = 0;
+    }
+  }
+
+out:
+  return (ret);
+}
+
+int rrosace_sim_run_delegated(rrosace_sim_t *p_sim, rrosace_sim_step_t step,
+                              void *p_arg) {
+  int ret = EXIT_FAILURE;
+  size_t task;
+
+  if (!p_sim || !step || (p_sim->semantics != RROSACE_SIM_IMMEDIATE)) {
+    goto out;
+  }
+
+  for (task = 0, ret = EXIT_SUCCESS; (task < NB_TASKS) && (ret == EXIT_SUCCESS);
+       ++task) {
+    if (p_sim->releases[p_sim->phase] & TASK(task)) {
+      ret = step(p_sim, (rrosace_sim_task_t)task, task_dt(p_sim, task), p_arg);
+    }
+  }
+
+  if (ret == EXIT_SUCCESS) {
+    ++p_sim->logical_time;
+    if (++p_sim->phase == p_sim->hyperperiod) {
+      p_sim->phase = 0;
+    }
+  }
+
+out:
+  return (ret);
+}
+
+int rrosace_sim_set_team(rrosace_sim_t *p_sim, size_t nb_threads,
+                         unsigned int stages) {
+  int ret = EXIT_FAILURE;
+  struct team *p_team;
+  void *p_memory;
+  size_t member;
+
+  if (!p_sim || (nb_threads > RROSACE_SIM_MAX_TEAM_THREADS) ||
+      (stages & ~(RROSACE_SIM_STAGE(RROSACE_SIM_NB_STAGES) - 1U)) ||
+      (p_sim->semantics != RROSACE_SIM_IMMEDIATE)) {
+    goto out;
+  }
+
+  delete_team(p_sim);
+  if (!nb_threads) {
+    ret = EXIT_SUCCESS;
+    goto out;
+  }
+
+  if (posix_memalign(&p_memory, CACHE_LINE, sizeof(struct team))) {
+    goto out;
+  }
+  memset(p_memory, 0, sizeof(struct team));
+  p_team = (struct team *)p_memory;
+  p_team->p_sim = p_sim;
+  p_team->p_models = &p_sim->models;
+  p_team->p_values = &p_sim->values;
+  p_team->stages = stages;
+  p_sim->p_team = p_team;
+  set_member_cores(p_team, nb_threads);
+
+  for (member = 0, ret = EXIT_SUCCESS;
+       (member < nb_threads) && (ret == EXIT_SUCCESS); ++member) {
+    struct member *p_member = &p_team->members[member];
+
+    p_member->p_team = p_team;
+    p_member->index = member;
+    p_member->ret = EXIT_SUCCESS;
+    if (pthread_create(&p_member->thread, NULL, member_main, p_member)) {
+      ret = EXIT_FAILURE;
+    } else {
+      p_member->started = 1;
+      ++p_team->nb_members;
+    }
+  }
+
+  if (ret == EXIT_FAILURE) {
+    delete_team(p_sim);
+  }
+
+out:
+  return (ret);
+}
+
+int rrosace_sim_tune_team(rrosace_sim_t *p_sim, size_t nb_reps,
+                          rrosace_sim_team_costs_t *p_costs) {
+  int ret = EXIT_FAILURE;
+  struct team *p_team;
+  rrosace_sim_t *p_copy = NULL;
+  rrosace_sim_team_costs_t costs;
+  unsigned int stages = 0;
+  size_t nb_saved;
+  size_t stage;
+  size_t rep;
+  double start;
+
+  if (!p_sim || !p_sim->p_team || !nb_reps) {
+    goto out;
+  }
+  p_team = p_sim->p_team;
+
+  p_copy = rrosace_sim_copy(p_sim);
+  if (!p_copy) {
+    goto out;
+  }
+
+  /* The measures step the models of the copy, once before timing */
+  p_team->p_models = &p_copy->models;
+  p_team->p_values = &p_copy->values;
+
+  p_team->nb_units = 0;
+  ret = fork_join(p_team);
+  start = now();
+  for (rep = 0; (rep < nb_reps) && (ret == EXIT_SUCCESS); ++rep) {
+    ret = fork_join(p_team);
+  }
+  costs.fork_join = (now() - start) / (double)nb_reps;
+
+  for (stage = 0; (stage < RROSACE_SIM_NB_STAGES) && (ret == EXIT_SUCCESS);
+       ++stage) {
+    set_units(p_team, stage, stage_tasks[stage]);
+
+    ret = run_units(p_team, 0, 1);
+    start = now();
+    for (rep = 0; (rep < nb_reps) && (ret == EXIT_SUCCESS); ++rep) {
+      ret = run_units(p_team, 0, 1);
+    }
+    costs.serial[stage] = (now() - start) / (double)nb_reps;
+
+    start = now();
+    for (rep = 0; (rep < nb_reps) && (ret == EXIT_SUCCESS); ++rep) {
+      ret = fork_join(p_team);
+    }
+    costs.parallel[stage] = (now() - start) / (double)nb_reps;
+
+    /* Steps no longer run by the caller, the team sharing the others */
+    nb_saved = p_team->nb_units - (p_team->nb_units + p_team->nb_members) /
+                                      (p_team->nb_members + 1);
+    costs.model[stage] = costs.serial[stage] / (double)p_team->nb_units;
+    costs.break_even[stage] = costs.fork_join / (double)nb_saved;
+
+    if (costs.parallel[stage] < costs.serial[stage]) {
+      stages |= RROSACE_SIM_STAGE(stage);
+    }
+  }
+
+  p_team->p_models = &p_sim->models;
+  p_team->p_values = &p_sim->values;
+
+  if (ret == EXIT_SUCCESS) {
+    p_team->stages = stages;
+    if (p_costs) {
+      *p_costs = costs;
+    }
+  }
+
+out:
+  rrosace_sim_del(p_copy);
+
+  return (ret);
+}
+
+unsigned int rrosace_sim_get_team_stages(const rrosace_sim_t *p_sim) {
+  return ((p_sim && p_sim->p_team) ? p_sim->p_team->stages : 0);
+}
+
+/**
+ * @brief Wait for the process of a branch
+ * @return EXIT_SUCCESS if the branch succeeded, else EXIT_FAILURE
+ */
+static int wait_branch(pid_t pid) {
+  int status;
+  pid_t waited;
+
+  do {
+    waited = waitpid(pid, &status, 0);
+  } while ((waited < 0) && (errno == EINTR));
+
+  return (((waited == pid) && WIFEXITED(status) &&
+           (WEXITSTATUS(status) == EXIT_SUCCESS))
+              ? EXIT_SUCCESS
+              : EXIT_FAILURE);
+}
+
+int rrosace_sim_branch(const rrosace_sim_t *p_sim, size_t nb_branches,
+                       size_t nb_workers, rrosace_sim_branch_t branch,
+                       void *p_arg, size_t nb_results, double results[]) {
+  int ret = EXIT_FAILURE;
+  const size_t size = nb_branches * nb_results * sizeof(double);
+  double *p_shared = NULL;
+  pid_t *pids = NULL;
+  size_t nb_forked = 0;
+  size_t nb_waited = 0;
+  size_t nb_to_fork = nb_branches;
+
+  if (!p_sim || !nb_branches || !nb_workers || !branch ||
+      (nb_results && !results) ||
+      (p_sim->semantics != RROSACE_SIM_IMMEDIATE)) {
+    goto out;
+  }
+
+  pids = (pid_t *)malloc(nb_branches * sizeof(pid_t));
+  if (!pids) {
+    goto out;
+  }
+
+  /* The results are the only memory written back, the simulation is shared
+   * copy-on-write by the fork */
+  if (size) {
+    void *p_mapping = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (p_mapping == MAP_FAILED) {
+      goto out;
+    }
+    p_shared = (double *)p_mapping;
+  }
+
+  ret = EXIT_SUCCESS;
+  while (nb_waited < nb_forked || nb_forked < nb_to_fork) {
+    if ((nb_forked < nb_to_fork) && (nb_forked - nb_waited < nb_workers)) {
+      const pid_t pid = fork();
+
+      /* The branch writes its own copy of the simulation, without the
+       * threads of its team */
+      if (!pid) {
+        ((rrosace_sim_t *)p_sim)->p_team = NULL;
+        _exit(branch((rrosace_sim_t *)p_sim, nb_forked, p_arg,
+                     p_shared ? p_shared + nb_forked * nb_results : NULL) ==
+                      EXIT_SUCCESS
+                  ? EXIT_SUCCESS
+                  : EXIT_FAILURE);
+      }
+      if (pid < 0) {
+        ret = EXIT_FAILURE;
+        nb_to_fork = nb_forked;
+      } else {
+        pids[nb_forked++] = pid;
+      }
+    } else if (wait_branch(pids[nb_waited++]) == EXIT_FAILURE) {
+      ret = EXIT_FAILURE;
+    }
+  }
+
+  if (size) {
+    memcpy(results, p_shared, size);
+  }
+
+out:
+  if (p_shared) {
+    munmap(p_shared, size);
+  }
+  free(pids);
+
+  return (ret);
+}
+
+int rrosace_sim_get_state(const rrosace_sim_t *p_sim, double state[]) {
+  int ret = EXIT_FAILURE;
+  const rrosace_sim_values_t *p_values;
+  const struct models *p_models;
+  const rrosace_filter_t *filters[RROSACE_SIM_NB_FILTERS];
+  double *p_state = state;
+  size_t i;
+
+  if (!p_sim || !state) {
+    goto out;
+  }
+
+  p_values = &p_sim->values;
+  p_models = &p_sim->models;
+
+  *p_state++ = (double)p_values->mode;
+  *p_state++ = p_values->delta_e;
+  for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+    *p_state++ = p_values->delta_e_c_partial[i];
+    *p_state++ = p_values->delta_th_c_partial[i];
+    *p_state++ = (double)p_values->relay_delta_e_c[i];
+    *p_state++ = (double)p_values->relay_delta_th_c[i];
+    *p_state++ = (double)p_values->master_in_laws[i];
+    *p_state++ = (double)p_values->other_master_in_laws[i];
+  }
+  *p_state++ = p_values->delta_e_c;
+  *p_state++ = p_values->delta_th_c;
+  *p_state++ = p_values->t;
+  *p_state++ = p_values->h;
+  *p_state++ = p_values->vz;
+  *p_state++ = p_values->va;
+  *p_state++ = p_values->q;
+  *p_state++ = p_values->az;
+  *p_state++ = p_values->h_f;
+  *p_state++ = p_values->vz_f;
+  *p_state++ = p_values->va_f;
+  *p_state++ = p_values->q_f;
+  *p_state++ = p_values->az_f;
+  *p_state++ = p_values->h_c;
+  *p_state++ = p_values->vz_c;
+  *p_state++ = p_values->va_c;
+  /* Phase in the hyperperiod, as the tasks released depend on it */
+  *p_state++ = (double)p_sim->phase;
+
+  if (rrosace_engine_get_state(p_models->p_engine, p_state) == EXIT_FAILURE) {
+    goto out;
+  }
+  p_state += RROSACE_ENGINE_STATE_SIZE;
+
+  if (rrosace_elevator_get_state(p_models->p_elevator, p_state) ==
+      EXIT_FAILURE) {
+    goto out;
+  }
+  p_state += RROSACE_ELEVATOR_STATE_SIZE;
+
+  if (rrosace_flight_dynamics_get_state(p_models->p_flight_dynamics,
+                                        p_state) == EXIT_FAILURE) {
+    goto out;
+  }
+  p_state += RROSACE_FLIGHT_DYNAMICS_STATE_SIZE;
+
+  filters[0] = p_models->p_h_filter;
+  filters[1] = p_models->p_vz_filter;
+  filters[2] = p_models->p_va_filter;
+  filters[3] = p_models->p_q_filter;
+  filters[4] = p_models->p_az_filter;
+  for (i = 0; i < RROSACE_SIM_NB_FILTERS; ++i) {
+    if (rrosace_filter_get_state(filters[i], p_state) == EXIT_FAILURE) {
+      goto out;
+    }
+    p_state += RROSACE_FILTER_STATE_SIZE;
+  }
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS; ++i) {
+    if (rrosace_fcc_get_state(p_models->p_fccs[i], p_state) == EXIT_FAILURE) {
+      goto out;
+    }
+    p_state += RROSACE_FCC_STATE_SIZE;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_sim_set_state(rrosace_sim_t *p_sim, const double state[]) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_values_t *p_values;
+  struct models *p_models;
+  rrosace_filter_t *filters[RROSACE_SIM_NB_FILTERS];
+  const double *p_state = state;
+  size_t phase;
+  size_t i;
+
+  if (!p_sim || !state || (p_sim->semantics != RROSACE_SIM_IMMEDIATE)) {
+    goto out;
+  }
+
+  phase = (size_t)state[RROSACE_SIM_VALUES_SIZE - 1];
+  if (phase >= p_sim->hyperperiod) {
+    goto out;
+  }
+
+  p_values = &p_sim->values;
+  p_models = &p_sim->models;
+
+  p_values->mode = (rrosace_mode_t)*p_state++;
+  p_values->delta_e = *p_state++;
+  for (i = 0; i < RROSACE_SIM_NB_FCCS_COUPLES; ++i) {
+    p_values->delta_e_c_partial[i] = *p_state++;
+    p_values->delta_th_c_partial[i] = *p_state++;
+    p_values->relay_delta_e_c[i] = (rrosace_relay_state_t)*p_state++;
+    p_values->relay_delta_th_c[i] = (rrosace_relay_state_t)*p_state++;
+    p_values->master_in_laws[i] = (rrosace_master_in_law_t)*p_state++;
+    p_values->other_master_in_laws[i] = (rrosace_master_in_law_t)*p_state++;
+  }
+  p_values->delta_e_c = *p_state++;
+  p_values->delta_th_c = *p_state++;
+  p_values->t = *p_state++;
+  p_values->h = *p_state++;
+  p_values->vz = *p_state++;
+  p_values->va = *p_state++;
+  p_values->q = *p_state++;
+  p_values->az = *p_state++;
+  p_values->h_f = *p_state++;
+  p_values->vz_f = *p_state++;
+  p_values->va_f = *p_state++;
+  p_values->q_f = *p_state++;
+  p_values->az_f = *p_state++;
+  p_values->h_c = *p_state++;
+  p_values->vz_c = *p_state++;
+  p_values->va_c = *p_state++;
+  ++p_state;
+
+  if (rrosace_engine_set_state(p_models->p_engine, p_state) == EXIT_FAILURE) {
+    goto out;
+  }
+  p_state += RROSACE_ENGINE_STATE_SIZE;
+
+  if (rrosace_elevator_set_state(p_models->p_elevator, p_state) ==
+      EXIT_FAILURE) {
+    goto out;
+  }
+  p_state += RROSACE_ELEVATOR_STATE_SIZE;
+
+  if (rrosace_flight_dynamics_set_state(p_models->p_flight_dynamics,
+                                        p_state) == EXIT_FAILURE) {
+    goto out;
+  }
+  p_state += RROSACE_FLIGHT_DYNAMICS_STATE_SIZE;
+
+  filters[0] = p_models->p_h_filter;
+  filters[1] = p_models->p_vz_filter;
+  filters[2] = p_models->p_va_filter;
+  filters[3] = p_models->p_q_filter;
+  filters[4] = p_models->p_az_filter;
+  for (i = 0; i < RROSACE_SIM_NB_FILTERS; ++i) {
+    if (rrosace_filter_set_state(filters[i], p_state) == EXIT_FAILURE) {
+      goto out;
+    }
+    p_state += RROSACE_FILTER_STATE_SIZE;
+  }
+
+  for (i = 0; i < RROSACE_SIM_NB_FCCS; ++i) {
+    if (rrosace_fcc_set_state(p_models->p_fccs[i], p_state) == EXIT_FAILURE) {
+      goto out;
+    }
+    p_state += RROSACE_FCC_STATE_SIZE;
+  }
+
+  /* Stateless but for their mode and commands, which are published */
+  rrosace_flight_mode_set_mode(p_models->p_flight_mode, p_values->mode);
+  rrosace_fcu_set_h_c(p_models->p_fcu, p_values->h_c);
+  rrosace_fcu_set_vz_c(p_models->p_fcu, p_values->vz_c);
+  rrosace_fcu_set_va_c(p_models->p_fcu, p_values->va_c);
+
+  p_sim->phase = phase;
+  p_sim->logical_time = phase;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_sim_is_discrete(size_t index) {
+  int discrete = 0;
+
+  if ((index == 0) || (index == RROSACE_SIM_VALUES_SIZE - 1)) {
+    /* Mode and phase */
+    discrete = 1;
+  } else if ((index >= COUPLES_STATE_OFFSET) &&
+             (index < COUPLES_STATE_OFFSET +
+                          COUPLE_STATE_SIZE * RROSACE_SIM_NB_FCCS_COUPLES)) {
+    discrete = (index - COUPLES_STATE_OFFSET) % COUPLE_STATE_SIZE >=
+               COUPLE_DISCRETE_OFFSET;
+  } else if ((index >= RROSACE_SIM_FCCS_STATE_OFFSET) &&
+             (index < RROSACE_SIM_STATE_SIZE)) {
+    discrete = (index - RROSACE_SIM_FCCS_STATE_OFFSET) %
+                   RROSACE_FCC_STATE_SIZE ==
+               FCC_SWITCH_OFFSET;
+  }
+
+  return (discrete);
+}
+
+size_t rrosace_sim_get_task_period(const rrosace_sim_t *p_sim,
+                                   rrosace_sim_task_t task) {
+  return ((p_sim && ((size_t)task < NB_TASKS)) ? p_sim->periods[task] : 0);
+}
+
+int rrosace_sim_step_task(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                          double dt) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_sim || ((size_t)task >= NB_TASKS) ||
+      (p_sim->semantics != RROSACE_SIM_IMMEDIATE)) {
+    goto out;
+  }
+
+  ret = task_steps[task](&p_sim->models, &p_sim->values, &p_sim->values, dt);
+
+out:
+  return (ret);
+}
+
+int rrosace_sim_set_commands(rrosace_sim_t *p_sim, double h_c, double vz_c,
+                             double va_c) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_sim) {
+    goto out;
+  }
+
+  drain(p_sim);
+
+  rrosace_fcu_set_h_c(p_sim->models.p_fcu, h_c);
+  rrosace_fcu_set_vz_c(p_sim->models.p_fcu, vz_c);
+  rrosace_fcu_set_va_c(p_sim->models.p_fcu, va_c);
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+void rrosace_sim_nominal_parameters(rrosace_sim_parameters_t *p_parameters) {
+  if (p_parameters) {
+    p_parameters->masse = RROSACE_MASSE;
+    p_parameters->i_y = RROSACE_I_Y;
+    p_parameters->tau = RROSACE_TAU;
+    p_parameters->omega = RROSACE_OMEGA;
+    p_parameters->xi = RROSACE_XI;
+    p_parameters->h_bias = 0.;
+    p_parameters->vz_bias = 0.;
+    p_parameters->va_bias = 0.;
+    p_parameters->q_bias = 0.;
+    p_parameters->az_bias = 0.;
+  }
+}
+
+int rrosace_sim_set_parameters(rrosace_sim_t *p_sim,
+                               const rrosace_sim_parameters_t *p_parameters) {
+  int ret = EXIT_FAILURE;
+  struct models *p_models;
+  rrosace_engine_t *p_engine = NULL;
+  rrosace_elevator_t *p_elevator = NULL;
+  double engine_state[RROSACE_ENGINE_STATE_SIZE];
+  double elevator_state[RROSACE_ELEVATOR_STATE_SIZE];
+
+  if (!p_sim || !p_parameters) {
+    goto out;
+  }
+
+  drain(p_sim);
+
+  p_models = &p_sim->models;
+
+  /* The engine and the elevator take their parameters when created */
+  p_engine = rrosace_engine_new(p_parameters->tau);
+  p_elevator = rrosace_elevator_new(p_parameters->omega, p_parameters->xi);
+  if (!p_engine || !p_elevator ||
+      (rrosace_engine_get_state(p_models->p_engine, engine_state) ==
+       EXIT_FAILURE) ||
+      (rrosace_engine_set_state(p_engine, engine_state) == EXIT_FAILURE) ||
+      (rrosace_elevator_get_state(p_models->p_elevator, elevator_state) ==
+       EXIT_FAILURE) ||
+      (rrosace_elevator_set_state(p_elevator, elevator_state) ==
+       EXIT_FAILURE) ||
+      (rrosace_flight_dynamics_set_parameters(
+           p_models->p_flight_dynamics, p_parameters->masse,
+           p_parameters->i_y) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  rrosace_engine_del(p_models->p_engine);
+  rrosace_elevator_del(p_models->p_elevator);
+  p_models->p_engine = p_engine;
+  p_models->p_elevator = p_elevator;
+  p_engine = NULL;
+  p_elevator = NULL;
+  p_models->parameters = *p_parameters;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_engine_del(p_engine);
+  rrosace_elevator_del(p_elevator);
+
+  return (ret);
+}
+
+int rrosace_sim_set_filters_frequency(rrosace_sim_t *p_sim,
+                                      rrosace_filter_frequency_t frequency) {
+  int ret = EXIT_FAILURE;
+  rrosace_filter_t **p_filters[RROSACE_SIM_NB_FILTERS];
+  rrosace_filter_t *filters[RROSACE_SIM_NB_FILTERS] = {NULL};
+  double state[RROSACE_FILTER_STATE_SIZE];
+  size_t i;
+
+  if (!p_sim) {
+    goto out;
+  }
+
+  drain(p_sim);
+
+  p_filters[0] = &p_sim->models.p_h_filter;
+  p_filters[1] = &p_sim->models.p_vz_filter;
+  p_filters[2] = &p_sim->models.p_va_filter;
+  p_filters[3] = &p_sim->models.p_q_filter;
+  p_filters[4] = &p_sim->models.p_az_filter;
+
+  /* All the filters replaced, or none */
+  for (i = 0; i < RROSACE_SIM_NB_FILTERS; ++i) {
+    filters[i] = rrosace_filter_new(filter_types[i], frequency);
+    if (!filters[i] ||
+        (rrosace_filter_get_state(*p_filters[i], state) == EXIT_FAILURE) ||
+        (rrosace_filter_set_state(filters[i], state) == EXIT_FAILURE)) {
+      goto out;
+    }
+  }
+
+  for (i = 0; i < RROSACE_SIM_NB_FILTERS; ++i) {
+    rrosace_filter_del(*p_filters[i]);
+    *p_filters[i] = filters[i];
+    filters[i] = NULL;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (i = 0; i < RROSACE_SIM_NB_FILTERS; ++i) {
+    rrosace_filter_del(filters[i]);
+  }
+
+  return (ret);
+}
+
+const rrosace_sim_values_t *rrosace_sim_get_values(const rrosace_sim_t *p_sim) {
+  return (p_sim ? &p_sim->values : NULL);
+}
+
+int rrosace_sim_set_values(rrosace_sim_t *p_sim,
+                           const rrosace_sim_values_t *p_values) {
+  int ret = EXIT_FAILURE;
+
+  if (!p_sim || !p_values || (p_sim->semantics != RROSACE_SIM_IMMEDIATE)) {
+    goto out;
+  }
+
+  p_sim->values = *p_values;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+size_t rrosace_sim_get_logical_time(const rrosace_sim_t *p_sim) {
+  return (p_sim ? p_sim->logical_time : 0);
+}
+
+double rrosace_sim_get_time(const rrosace_sim_t *p_sim) {
+  return (p_sim ? (double)p_sim->logical_time / RROSACE_DEFAULT_PHYSICAL_FREQ
+                : 0.);
+}
@@ -0,0 +1,523 @@
+/**
+ * @file surrogate.c
+ * @brief RROSACE Scheduling of cyber-physical system library reduced-order
+ * surrogate body.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * Based on the Open Source ROSACE (Research Open-Source Avionics and Control
+ * Engineering) case study.
+ * Implementations of ROSACE available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/
+ * Publication of ROSACE available at:
+ * https://oatao.univ-toulouse.fr/11522/1/Siron_11522.pdf Publication of RROSACE
+ * available at:
+ * https://svn.onera.fr/schedmcore/branches/ROSACE_CaseStudy/redundant/report_redundant_rosace_matlab.pdf
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rrosace_surrogate.h>
+
+#define MAX_REGRESSORS                                                         \
+  (RROSACE_SURROGATE_MAX_ORDER *                                               \
+   (RROSACE_SURROGATE_MAX_INPUTS + RROSACE_SURROGATE_MAX_OUTPUTS))
+#define MAX_COLUMNS (MAX_REGRESSORS + RROSACE_SURROGATE_MAX_OUTPUTS)
+
+/* Relative Tikhonov regularization of the least squares */
+#define RIDGE (1e-9)
+
+enum identification_state { NOT_IDENTIFIED, IDENTIFIED };
+
+struct rrosace_surrogate {
+  size_t nb_inputs;
+  size_t nb_outputs;
+  size_t order;
+  size_t nb_regressors;
+
+  double u_eq[RROSACE_SURROGATE_MAX_INPUTS];
+  double y_eq[RROSACE_SURROGATE_MAX_OUTPUTS];
+
+  /* Identification data, as the triangular factor of [regressors | outputs],
+   * updated row by row with Givens rotations. */
+  double r[MAX_COLUMNS][MAX_COLUMNS];
+  double y_sum[RROSACE_SURROGATE_MAX_OUTPUTS];
+  double y_sum_sq[RROSACE_SURROGATE_MAX_OUTPUTS];
+  size_t nb_samples;
+
+  /* Current record, deviations from trim, most recent first */
+  double regressors[MAX_REGRESSORS];
+  size_t record_length;
+  size_t max_record_length;
+
+  /* Trust region, deviations from trim */
+  double u_min[RROSACE_SURROGATE_MAX_INPUTS];
+  double u_max[RROSACE_SURROGATE_MAX_INPUTS];
+  double y_min[RROSACE_SURROGATE_MAX_OUTPUTS];
+  double y_max[RROSACE_SURROGATE_MAX_OUTPUTS];
+
+  /* Identified model */
+  double theta[RROSACE_SURROGATE_MAX_OUTPUTS][MAX_REGRESSORS];
+  double fit[RROSACE_SURROGATE_MAX_OUTPUTS];
+  enum identification_state identification;
+};
+
+static void shift_regressors(size_t /* nb_regressors */,
+                             size_t /* nb_per_lag */,
+                             double * /* regressors */,
+                             const double * /* dy */, size_t /* nb_outputs */,
+                             const double * /* du */, size_t /* nb_inputs */);
+
+static void givens_update(double (*)[MAX_COLUMNS] /* r */,
+                          size_t /* nb_columns */, double * /* row */);
+
+/**
+ * @brief Push the latest deviations in the regressors, dropping the oldest
+ */
+static void shift_regressors(size_t nb_regressors, size_t nb_per_lag,
+                             double *regressors, const double *dy,
+                             size_t nb_outputs, const double *du,
+                             size_t nb_inputs) {
+  size_t i;
+
+  for (i = nb_regressors; i > nb_per_lag; --i) {
+    regressors[i - 1] = regressors[i - 1 - nb_per_lag];
+  }
+
+  for (i = 0; i < nb_outputs; ++i) {
+    regressors[i] = dy[i];
+  }
+
+  for (i = 0; i < nb_inputs; ++i) {
+    regressors[nb_outputs + i] = du[i];
+  }
+}
+
+/**
+ * @brief Rotate a new row in the upper triangular factor
+ */
+static void givens_update(double (*r)[MAX_COLUMNS], size_t nb_columns,
+                          double *row) {
+  size_t i;
+  size_t j;
+
+  for (i = 0; i < nb_columns; ++i) {
+    double radius;
+    double c;
+    double s;
+
+    if (row[i] == 0.) {
+      continue;
+    }
+
+    radius = sqrt(r[i][i] * r[i][i] + row[i] * row[i]);
+    c = r[i][i] / radius;
+    s = row[i] / radius;
+
+    for (j = i; j < nb_columns; ++j) {
+      const double r_ij = r[i][j];
+      r[i][j] = c * r_ij + s * row[j];
+      row[j] = -s * r_ij + c * row[j];
+    }
+  }
+}
+
+rrosace_surrogate_t *rrosace_surrogate_new(size_t nb_inputs, size_t nb_outputs,
+                                           size_t order, const double u_eq[],
+                                           const double y_eq[]) {
+  rrosace_surrogate_t *p_surrogate = NULL;
+  size_t i;
+
+  if (!u_eq || !y_eq) {
+    goto out;
+  }
+
+  if ((nb_inputs == 0) || (nb_inputs > RROSACE_SURROGATE_MAX_INPUTS) ||
+      (nb_outputs == 0) || (nb_outputs > RROSACE_SURROGATE_MAX_OUTPUTS) ||
+      (order == 0) || (order > RROSACE_SURROGATE_MAX_ORDER)) {
+    goto out;
+  }
+
+  p_surrogate = (rrosace_surrogate_t *)calloc(1, sizeof(rrosace_surrogate_t));
+
+  if (!p_surrogate) {
+    goto out;
+  }
+
+  p_surrogate->nb_inputs = nb_inputs;
+  p_surrogate->nb_outputs = nb_outputs;
+  p_surrogate->order = order;
+  p_surrogate->nb_regressors = order * (nb_inputs + nb_outputs);
+
+  for (i = 0; i < nb_inputs; ++i) {
+    p_surrogate->u_eq[i] = u_eq[i];
+  }
+
+  for (i = 0; i < nb_outputs; ++i) {
+    p_surrogate->y_eq[i] = y_eq[i];
+  }
+
+  p_surrogate->identification = NOT_IDENTIFIED;
+
+out:
+  return (p_surrogate);
+}
+
+rrosace_surrogate_t *rrosace_surrogate_copy(const rrosace_surrogate_t *p_other) {
+  rrosace_surrogate_t *p_surrogate =
+      (rrosace_surrogate_t *)calloc(1, sizeof(rrosace_surrogate_t));
+
+  if (!p_surrogate) {
+    goto out;
+  }
+
+  memcpy(p_surrogate, p_other, sizeof(rrosace_surrogate_t));
+
+out:
+  return (p_surrogate);
+}
+
+void rrosace_surrogate_del(rrosace_surrogate_t *p_surrogate) {
+  if (p_surrogate) {
+    free(p_surrogate);
+  }
+}
+
+int rrosace_surrogate_begin_record(rrosace_surrogate_t *p_surrogate) {
+  int ret = EXIT_FAILURE;
+  size_t i;
+
+  if (!p_surrogate) {
+    goto out;
+  }
+
+  for (i = 0; i < p_surrogate->nb_regressors; ++i) {
+    p_surrogate->regressors[i] = 0.;
+  }
+
+  p_surrogate->record_length = 0;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_surrogate_add_sample(rrosace_surrogate_t *p_surrogate,
+                                 const double u[], const double y[]) {
+  int ret = EXIT_FAILURE;
+  double row[MAX_COLUMNS];
+  double du[RROSACE_SURROGATE_MAX_INPUTS];
+  double dy[RROSACE_SURROGATE_MAX_OUTPUTS];
+  size_t nb_regressors;
+  size_t i;
+
+  if (!p_surrogate || !u || !y) {
+    goto out;
+  }
+
+  nb_regressors = p_surrogate->nb_regressors;
+
+  for (i = 0; i < p_surrogate->nb_inputs; ++i) {
+    du[i] = u[i] - p_surrogate->u_eq[i];
+  }
+
+  for (i = 0; i < p_surrogate->nb_outputs; ++i) {
+    dy[i] = y[i] - p_surrogate->y_eq[i];
+  }
+
+  for (i = 0; i < nb_regressors; ++i) {
+    row[i] = p_surrogate->regressors[i];
+  }
+
+  for (i = 0; i < p_surrogate->nb_outputs; ++i) {
+    row[nb_regressors + i] = dy[i];
+  }
+
+  givens_update(p_surrogate->r, nb_regressors + p_surrogate->nb_outputs, row);
+
+  for (i = 0; i < p_surrogate->nb_outputs; ++i) {
+    p_surrogate->y_sum[i] += dy[i];
+    p_surrogate->y_sum_sq[i] += dy[i] * dy[i];
+  }
+
+  /* The trust region always contains the trim point */
+  for (i = 0; i < p_surrogate->nb_inputs; ++i) {
+    p_surrogate->u_min[i] = du[i] < p_surrogate->u_min[i] ? du[i]
+                                                          : p_surrogate->u_min[i];
+    p_surrogate->u_max[i] = du[i] > p_surrogate->u_max[i] ? du[i]
+                                                          : p_surrogate->u_max[i];
+  }
+
+  for (i = 0; i < p_surrogate->nb_outputs; ++i) {
+    p_surrogate->y_min[i] = dy[i] < p_surrogate->y_min[i] ? dy[i]
+                                                          : p_surrogate->y_min[i];
+    p_surrogate->y_max[i] = dy[i] > p_surrogate->y_max[i] ? dy[i]
+                                                          : p_surrogate->y_max[i];
+  }
+
+  shift_regressors(nb_regressors,
+                   p_surrogate->nb_inputs + p_surrogate->nb_outputs,
+                   p_surrogate->regressors, dy, p_surrogate->nb_outputs, du,
+                   p_surrogate->nb_inputs);
+
+  ++p_surrogate->nb_samples;
+  ++p_surrogate->record_length;
+  if (p_surrogate->record_length > p_surrogate->max_record_length) {
+    p_surrogate->max_record_length = p_surrogate->record_length;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
+
+int rrosace_surrogate_identify(rrosace_surrogate_t *p_surrogate) {
+  int ret = EXIT_FAILURE;
+  double(*r)[MAX_COLUMNS] = NULL;
+  double row[MAX_COLUMNS];
+  size_t nb_regressors;
+  size_t nb_columns;
+  size_t output;
+  size_t i;
+  size_t j;
+
+  if (!p_surrogate) {
+    goto out;
+  }
+
+  nb_regressors = p_surrogate->nb_regressors;
+  nb_columns = nb_regressors + p_surrogate->nb_outputs;
+
+  if (p_surrogate->nb_samples <= nb_regressors) {
+    goto out;
+  }
+
+  r = (double(*)[MAX_COLUMNS])malloc(sizeof(p_surrogate->r));
+
+  if (!r) {
+    goto out;
+  }
+
+  memcpy(r, p_surrogate->r, sizeof(p_surrogate->r));
+
+  /* Ridge rows, scaled on each regressor norm, for over-parameterized data */
+  for (i = 0; i < nb_regressors; ++i) {
+    double norm = 0.;
+
+    for (j = 0; j <= i; ++j) {
+      norm += r[j][i] * r[j][i];
+    }
+
+    for (j = 0; j < nb_columns; ++j) {
+      row[j] = 0.;
+    }
+    row[i] = RIDGE * sqrt(norm);
+
+    givens_update(r, nb_columns, row);
+  }
+
+  /* Regressor never excited */
+  for (i = 0; i < nb_regressors; ++i) {
+    if (r[i][i] == 0.) {
+      goto out;
+    }
+  }
+
+  for (output = 0; output < p_surrogate->nb_outputs; ++output) {
+    const size_t column = nb_regressors + output;
+    const double n = (double)p_surrogate->nb_samples;
+    double *theta = p_surrogate->theta[output];
+    double rss = 0.;
+    double tss;
+
+    /* Back substitution, R theta = Q' y */
+    for (i = nb_regressors; i > 0; --i) {
+      double acc = r[i - 1][column];
+      for (j = i; j < nb_regressors; ++j) {
+        acc -= r[i - 1][j] * theta[j];
+      }
+      theta[i - 1] = acc / r[i - 1][i - 1];
+    }
+
+    /* Residuals norm, the factor is orthogonally equivalent to the data */
+    for (i = 0; i <= column; ++i) {
+      double residual = -p_surrogate->r[i][column];
+      for (j = i; j < nb_regressors; ++j) {
+        residual += p_surrogate->r[i][j] * theta[j];
+      }
+      rss += residual * residual;
+    }
+
+    tss = p_surrogate->y_sum_sq[output] -
+          p_surrogate->y_sum[output] * p_surrogate->y_sum[output] / n;
+
+    p_surrogate->fit[output] =
+        tss > 0. ? 1. - rss / tss : (rss > 0. ? 0. : 1.);
+  }
+
+  p_surrogate->identification = IDENTIFIED;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  free(r);
+
+  return (ret);
+}
+
+double rrosace_surrogate_get_fit(const rrosace_surrogate_t *p_surrogate,
+                                 size_t output) {
+  double fit = 0.;
+
+  if (!p_surrogate || (output >= p_surrogate->nb_outputs) ||
+      (p_surrogate->identification != IDENTIFIED)) {
+    goto out;
+  }
+
+  fit = p_surrogate->fit[output];
+
+out:
+  return (fit);
+}
+
+rrosace_surrogate_validity_t
+rrosace_surrogate_check(const rrosace_surrogate_t *p_surrogate,
+                        const double u[], size_t nb_steps) {
+  rrosace_surrogate_validity_t validity = RROSACE_SURROGATE_UNTRUSTED;
+  size_t i;
+
+  if (!p_surrogate || !u || (p_surrogate->identification != IDENTIFIED)) {
+    goto out;
+  }
+
+  if (nb_steps > p_surrogate->max_record_length) {
+    goto out;
+  }
+
+  for (i = 0; i < p_surrogate->nb_outputs; ++i) {
+    if (p_surrogate->fit[i] < RROSACE_SURROGATE_MIN_FIT) {
+      goto out;
+    }
+  }
+
+  for (i = 0; i < p_surrogate->nb_inputs; ++i) {
+    const double du = u[i] - p_surrogate->u_eq[i];
+    if ((du < p_surrogate->u_min[i]) || (du > p_surrogate->u_max[i])) {
+      goto out;
+    }
+  }
+
+  validity = RROSACE_SURROGATE_TRUSTED;
+
+out:
+  return (validity);
+}
+
+int rrosace_surrogate_predict(const rrosace_surrogate_t *p_surrogate,
+                              const double u[], size_t nb_steps, double y[],
+                              rrosace_surrogate_validity_t *p_validity) {
+  int ret = EXIT_FAILURE;
+  /* Outputs history, duplicated so that the lags are read contiguously */
+  double history[2 * RROSACE_SURROGATE_MAX_ORDER]
+                [RROSACE_SURROGATE_MAX_OUTPUTS];
+  double forcing[RROSACE_SURROGATE_MAX_OUTPUTS];
+  double du[RROSACE_SURROGATE_MAX_INPUTS];
+  double dy[RROSACE_SURROGATE_MAX_OUTPUTS];
+  double dy_low[RROSACE_SURROGATE_MAX_OUTPUTS];
+  double dy_high[RROSACE_SURROGATE_MAX_OUTPUTS];
+  rrosace_surrogate_validity_t validity;
+  size_t nb_outputs;
+  size_t nb_inputs;
+  size_t nb_per_lag;
+  size_t order;
+  size_t head = 0;
+  size_t step;
+  size_t lag;
+  size_t i;
+  size_t j;
+
+  if (!p_surrogate || !u || !y || !p_validity ||
+      (p_surrogate->identification != IDENTIFIED)) {
+    goto out;
+  }
+
+  validity = rrosace_surrogate_check(p_surrogate, u, nb_steps);
+
+  nb_outputs = p_surrogate->nb_outputs;
+  nb_inputs = p_surrogate->nb_inputs;
+  nb_per_lag = nb_inputs + nb_outputs;
+  order = p_surrogate->order;
+
+  for (i = 0; i < nb_inputs; ++i) {
+    du[i] = u[i] - p_surrogate->u_eq[i];
+  }
+
+  for (i = 0; i < nb_outputs; ++i) {
+    const double margin = RROSACE_SURROGATE_OUTPUT_MARGIN *
+                          (p_surrogate->y_max[i] - p_surrogate->y_min[i]);
+    forcing[i] = 0.;
+    dy[i] = 0.;
+    dy_low[i] = p_surrogate->y_min[i] - margin;
+    dy_high[i] = p_surrogate->y_max[i] + margin;
+  }
+
+  for (lag = 0; lag < 2 * order; ++lag) {
+    for (i = 0; i < nb_outputs; ++i) {
+      history[lag][i] = 0.;
+    }
+  }
+
+  for (step = 0; step < nb_steps; ++step) {
+    /* Constant inputs, their contribution is constant past the order */
+    if (step < order) {
+      for (i = 0; i < nb_outputs; ++i) {
+        const double *theta = &p_surrogate->theta[i][step * nb_per_lag];
+        for (j = 0; j < nb_inputs; ++j) {
+          forcing[i] += theta[nb_outputs + j] * du[j];
+        }
+      }
+    }
+
+    for (i = 0; i < nb_outputs; ++i) {
+      const double *theta = p_surrogate->theta[i];
+      double acc = forcing[i];
+
+      for (lag = 0; lag < order; ++lag) {
+        const double *dy_lag = history[head + lag];
+        const double *theta_lag = &theta[lag * nb_per_lag];
+        for (j = 0; j < nb_outputs; ++j) {
+          acc += theta_lag[j] * dy_lag[j];
+        }
+      }
+
+      /* Extrapolation out of the identified outputs */
+      if ((acc < dy_low[i]) || (acc > dy_high[i])) {
+        validity = RROSACE_SURROGATE_UNTRUSTED;
+      }
+
+      dy[i] = acc;
+    }
+
+    head = (head + order - 1) % order;
+    for (i = 0; i < nb_outputs; ++i) {
+      history[head][i] = dy[i];
+      history[head + order][i] = dy[i];
+    }
+  }
+
+  for (i = 0; i < nb_outputs; ++i) {
+    y[i] = p_surrogate->y_eq[i] + dy[i];
+  }
+
+  *p_validity = validity;
+
+  ret = EXIT_SUCCESS;
+
+out:
+  return (ret);
+}
@@ -0,0 +1,369 @@
+/**
+ * @file campaign_test.c
+ * @brief Test of campaign sharding module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <rrosace_campaign.h>
+#include <rrosace_constants.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "test_common.h"
+
+#define MODULE "campaign"
+
+#define NB_RUNS (30)
+#define NB_RESULTS (2)
+#define NB_SHARDS (4)
+#define NB_WORKERS (2)
+#define VZ_C (2.5)
+
+/* Layout of serialized results */
+#define FIELD_SIZE (8)
+#define HEADER_SIZE (6 * FIELD_SIZE)
+#define CHECK_FIELD (2 * FIELD_SIZE)
+
+static int run_func(rrosace_sim_t * /* p_sim */, size_t /* run */,
+                    void * /* p_arg */, double results[]);
+
+static int same_results(const rrosace_campaign_t * /* p_a */,
+                        const rrosace_campaign_t * /* p_b */);
+
+static void reverse_field(unsigned char * /* p_field */);
+
+static void swap_byte_order(unsigned char * /* buffer */, size_t /* size */);
+
+static rrosace_campaign_t *run_child(const rrosace_sim_t * /* p_sim */,
+                                     size_t /* shard */);
+
+static int test_shards_func(void);
+
+static int test_serialization_func(void);
+
+static int test_processes_func(void);
+
+/**
+ * @brief Runs of lengths and commands set by their index in the campaign
+ */
+static int run_func(rrosace_sim_t *p_sim, size_t run, void *p_arg,
+                    double results[]) {
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+
+  (void)p_arg;
+
+  if ((rrosace_sim_set_commands(p_sim, RROSACE_H_EQ,
+                                VZ_C - 0.2 * (double)(run % 7),
+                                RROSACE_VA_EQ) == EXIT_FAILURE) ||
+      (rrosace_sim_run(p_sim, 20 * (run % 5 + 1)) == EXIT_FAILURE)) {
+    return (EXIT_FAILURE);
+  }
+
+  results[0] = p_values->h;
+  results[1] = p_values->delta_e_c;
+
+  return (EXIT_SUCCESS);
+}
+
+static int same_results(const rrosace_campaign_t *p_a,
+                        const rrosace_campaign_t *p_b) {
+  size_t run;
+
+  if (rrosace_campaign_get_nb_done(p_a) != rrosace_campaign_get_nb_done(p_b)) {
+    return (0);
+  }
+
+  for (run = 0; run < NB_RUNS; ++run) {
+    const double *p_results_a = rrosace_campaign_get_results(p_a, run);
+    const double *p_results_b = rrosace_campaign_get_results(p_b, run);
+
+    if ((!p_results_a != !p_results_b) ||
+        (p_results_a &&
+         memcmp(p_results_a, p_results_b, NB_RESULTS * sizeof(double)))) {
+      return (0);
+    }
+  }
+
+  return (1);
+}
+
+static void reverse_field(unsigned char *p_field) {
+  size_t i;
+
+  for (i = 0; i < FIELD_SIZE / 2; ++i) {
+    const unsigned char byte = p_field[i];
+
+    p_field[i] = p_field[FIELD_SIZE - 1 - i];
+    p_field[FIELD_SIZE - 1 - i] = byte;
+  }
+}
+
+/**
+ * @brief Rewrite serialized results as written on a host of the other byte
+ * order: the byte order check and the results reversed, then checksummed again
+ */
+static void swap_byte_order(unsigned char *buffer, size_t size) {
+  const size_t checked = size - FIELD_SIZE;
+  unsigned long hash = 2166136261UL;
+  size_t field;
+  size_t i;
+
+  reverse_field(&buffer[CHECK_FIELD]);
+  /* Run indices, first in each record, are little endian on any host */
+  for (field = HEADER_SIZE; field < checked; field += FIELD_SIZE) {
+    if ((field - HEADER_SIZE) % ((NB_RESULTS + 1) * FIELD_SIZE)) {
+      reverse_field(&buffer[field]);
+    }
+  }
+
+  /* 32-bit FNV-1a */
+  for (i = 0; i < checked; ++i) {
+    hash = ((hash ^ buffer[i]) * 16777619UL) & 0xffffffffUL;
+  }
+  for (i = 0; i < FIELD_SIZE; ++i) {
+    buffer[checked + i] = (unsigned char)(hash & 0xffU);
+    hash >>= 8;
+  }
+}
+
+/**
+ * @brief Run a shard in a child process, read back through a pipe
+ */
+static rrosace_campaign_t *run_child(const rrosace_sim_t *p_sim,
+                                     size_t shard) {
+  rrosace_campaign_t *p_campaign = NULL;
+  unsigned char buffer[4096];
+  size_t size = 0;
+  int status;
+  int fds[2];
+  pid_t pid;
+
+  if (pipe(fds)) {
+    return (NULL);
+  }
+
+  pid = fork();
+  if (!pid) {
+    int ret = EXIT_FAILURE;
+
+    close(fds[0]);
+    p_campaign = rrosace_campaign_new(NB_RUNS, NB_RESULTS);
+    if (p_campaign &&
+        (rrosace_campaign_run_shard(p_campaign, p_sim, NB_SHARDS, shard,
+                                    NB_WORKERS, run_func,
+                                    NULL) == EXIT_SUCCESS) &&
+        (rrosace_campaign_write(p_campaign, buffer, sizeof(buffer)) ==
+         EXIT_SUCCESS) &&
+        (write(fds[1], buffer, rrosace_campaign_get_size(p_campaign)) ==
+         (ssize_t)rrosace_campaign_get_size(p_campaign))) {
+      ret = EXIT_SUCCESS;
+    }
+    _exit(ret);
+  }
+
+  close(fds[1]);
+  if (pid > 0) {
+    ssize_t nb_read;
+
+    while ((nb_read = read(fds[0], &buffer[size], sizeof(buffer) - size)) >
+           0) {
+      size += (size_t)nb_read;
+    }
+    if ((waitpid(pid, &status, 0) == pid) && WIFEXITED(status) &&
+        (WEXITSTATUS(status) == EXIT_SUCCESS)) {
+      p_campaign = rrosace_campaign_read(buffer, size);
+    }
+  }
+  close(fds[0]);
+
+  return (p_campaign);
+}
+
+/**
+ * @brief Shards cover the campaign once, their sizes differing by one at most
+ */
+static int test_shards_func(void) {
+  size_t first;
+  size_t nb_runs;
+  size_t next = 0;
+  size_t shard;
+
+  for (shard = 0; shard < NB_SHARDS; ++shard) {
+    if ((rrosace_campaign_get_shard(NB_RUNS, NB_SHARDS, shard, &first,
+                                    &nb_runs) == EXIT_FAILURE) ||
+        (first != next) || (nb_runs < NB_RUNS / NB_SHARDS) ||
+        (nb_runs > NB_RUNS / NB_SHARDS + 1)) {
+      return (EXIT_FAILURE);
+    }
+    next += nb_runs;
+  }
+
+  return (((next == NB_RUNS) &&
+           (rrosace_campaign_get_shard(NB_RUNS, NB_SHARDS, NB_SHARDS, &first,
+                                       &nb_runs) == EXIT_FAILURE) &&
+           (rrosace_campaign_get_shard(NB_RUNS, 0, 0, &first, &nb_runs) ==
+            EXIT_FAILURE))
+              ? EXIT_SUCCESS
+              : EXIT_FAILURE);
+}
+
+/**
+ * @brief Results are read back as written, from a host of either byte order,
+ * and corrupted or overlapping ones are refused
+ */
+static int test_serialization_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_campaign_t *p_campaign = rrosace_campaign_new(NB_RUNS, NB_RESULTS);
+  rrosace_campaign_t *p_read = NULL;
+  unsigned char buffer[1024];
+  double results[NB_RESULTS];
+  size_t size;
+  size_t run;
+
+  if (!p_campaign) {
+    goto out;
+  }
+
+  for (run = 1; run < NB_RUNS; run += 3) {
+    results[0] = (double)run;
+    results[1] = -1. / (double)run;
+    if (rrosace_campaign_set_results(p_campaign, run, results) ==
+        EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  size = rrosace_campaign_get_size(p_campaign);
+  if ((rrosace_campaign_set_results(p_campaign, 1, results) != EXIT_FAILURE) ||
+      (size > sizeof(buffer)) ||
+      (rrosace_campaign_write(p_campaign, buffer, size - 1) != EXIT_FAILURE) ||
+      (rrosace_campaign_write(p_campaign, buffer, size) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  p_read = rrosace_campaign_read(buffer, size);
+  if (!p_read || !same_results(p_campaign, p_read) ||
+      rrosace_campaign_read(buffer, size - 1) ||
+      (rrosace_campaign_merge(p_read, p_campaign) != EXIT_FAILURE)) {
+    goto out;
+  }
+  rrosace_campaign_del(p_read);
+
+  swap_byte_order(buffer, size);
+  p_read = rrosace_campaign_read(buffer, size);
+  if (!p_read || !same_results(p_campaign, p_read)) {
+    goto out;
+  }
+
+  buffer[size / 2] ^= 1;
+  if (rrosace_campaign_read(buffer, size)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_campaign_del(p_read);
+  rrosace_campaign_del(p_campaign);
+
+  return (ret);
+}
+
+/**
+ * @brief Shards run by processes and merged in a tree give the results of a
+ * single process, statistics included
+ */
+static int test_processes_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_campaign_t *p_single = rrosace_campaign_new(NB_RUNS, NB_RESULTS);
+  rrosace_campaign_t *p_shards[NB_SHARDS];
+  double stats[2][3];
+  size_t width;
+  size_t shard;
+
+  memset(p_shards, 0, sizeof(p_shards));
+
+  if (!p_sim || !p_single) {
+    goto out;
+  }
+
+  for (shard = 0; shard < NB_SHARDS; ++shard) {
+    if (rrosace_campaign_run_shard(p_single, p_sim, NB_SHARDS, shard, 1,
+                                   run_func, NULL) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+  if (rrosace_campaign_run_shard(p_single, p_sim, NB_SHARDS, 0, 1, run_func,
+                                 NULL) != EXIT_FAILURE) {
+    goto out;
+  }
+
+  for (shard = 0; shard < NB_SHARDS; ++shard) {
+    p_shards[shard] = run_child(p_sim, shard);
+    if (!p_shards[shard]) {
+      goto out;
+    }
+  }
+
+  /* Pairs merged, then pairs of pairs */
+  for (width = 1; width < NB_SHARDS; width *= 2) {
+    for (shard = 0; shard + width < NB_SHARDS; shard += 2 * width) {
+      if (rrosace_campaign_merge(p_shards[shard], p_shards[shard + width]) ==
+          EXIT_FAILURE) {
+        goto out;
+      }
+    }
+  }
+
+  if (!same_results(p_single, p_shards[0]) ||
+      (rrosace_campaign_get_stats(p_single, 0, &stats[0][0], &stats[0][1],
+                                  &stats[0][2]) == EXIT_FAILURE) ||
+      (rrosace_campaign_get_stats(p_shards[0], 0, &stats[1][0], &stats[1][1],
+                                  &stats[1][2]) == EXIT_FAILURE) ||
+      memcmp(stats[0], stats[1], sizeof(stats[0])) ||
+      (stats[0][1] > stats[0][0]) || (stats[0][0] > stats[0][2])) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (shard = 0; shard < NB_SHARDS; ++shard) {
+    rrosace_campaign_del(p_shards[shard]);
+  }
+  rrosace_campaign_del(p_single);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_shards = {"shards", test_shards_func};
+  const test_t test_serialization = {"serialization",
+                                     test_serialization_func};
+  const test_t test_processes = {"processes", test_processes_func};
+  const test_t *p_tests[4];
+
+  p_tests[0] = &test_shards;
+  p_tests[1] = &test_serialization;
+  p_tests[2] = &test_processes;
+  p_tests[3] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
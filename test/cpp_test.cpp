@@ -10,6 +10,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 
 #include <rrosace.h>
 
@@ -19,6 +20,62 @@
 #endif /* nullptr */
 #endif /* __cplusplus <= 199711L */
 
+/** Model failing once, before a given step of the model it wraps */
+class FlakyModel : public RROSACE::Model {
+public:
+  FlakyModel(RROSACE::Model &model, size_t failing_step)
+      : r_model(model), m_failing_step(failing_step), m_nb_steps(0) {}
+
+  void step() {
+    if (++m_nb_steps == m_failing_step) {
+      throw(std::runtime_error("Flaky model failure."));
+    }
+    r_model.step();
+  }
+
+  double get_dt() const { return r_model.get_dt(); }
+
+  void register_ports(RROSACE::Ports &ports) const {
+    r_model.register_ports(ports);
+  }
+
+private:
+  RROSACE::Model &r_model;
+  size_t m_failing_step;
+  size_t m_nb_steps;
+};
+
+/** Model doubling its input, sampled at a release and written at the next
+ * one when run as a task */
+class TwoPhaseModel : public RROSACE::Model {
+public:
+  TwoPhaseModel(const double &input, double &output)
+      : r_input(input), r_output(output) {}
+
+  void step() { r_output = 2. * r_input; }
+
+  double get_dt() const { return 1. / RROSACE::DEFAULT_PHYSICAL_FREQ; }
+
+  const double &r_input;
+  double &r_output;
+};
+
+#ifdef RROSACE_COROUTINES
+/**
+ * @brief Run the model in two phases, its input kept on the frame between
+ * them
+ */
+static RROSACE::Task run(TwoPhaseModel &model, RROSACE::Scheduler &scheduler) {
+  for (;;) {
+    const double input = model.r_input;
+
+    co_await scheduler.release(1);
+    model.r_output = 2. * input;
+    co_await scheduler.release(1);
+  }
+}
+#endif /* RROSACE_COROUTINES */
+
 #if __cplusplus <= 199711L
 int main() {
 #else
@@ -241,6 +298,247 @@ auto main() -> int {
                 << output.delta_th_c << std::endl;
     }
 
+    // Dataflow
+    {
+      double values[2][9];
+      double *p_outputs[2];
+
+      std::cout << "Dataflow test" << std::endl;
+
+      for (size_t run = 0; run < 2; ++run) {
+        double *const v = values[run];
+
+        v[0] = RROSACE::DELTA_E_C_EQ;
+        v[1] = RROSACE::DELTA_TH_C_EQ;
+        v[2] = RROSACE::DELTA_E_EQ;
+        v[3] = RROSACE::T_EQ;
+
+        RROSACE::Elevator elevator(RROSACE::OMEGA, RROSACE::XI, v[0], v[2]);
+        RROSACE::Engine engine(RROSACE::TAU, v[1], v[3]);
+        RROSACE::FlightDynamics flight_dynamics(v[2], v[3], v[4], v[5], v[6],
+                                                v[7], v[8]);
+        RROSACE::AltitudeFilter h_filter(v[4], v[0]);
+        std::vector<RROSACE::Model *> models;
+
+        models.push_back(&elevator);
+        models.push_back(&engine);
+        models.push_back(&flight_dynamics);
+        models.push_back(&h_filter);
+
+        const RROSACE::Dataflow dataflow(models);
+
+        // The filter output feeds back the elevator, as a command would
+        if (!dataflow.depends(2, 0) || !dataflow.depends(2, 1) ||
+            dataflow.depends(1, 0) || !dataflow.depends(3, 0) ||
+            (dataflow.get_hyperperiod() != 4) ||
+            (dataflow.get_levels(0).size() != 3) ||
+            (dataflow.get_levels(1).size() != 2)) {
+          throw(std::runtime_error("Unexpected dataflow."));
+        }
+
+        RROSACE::ParallelExecutor executor(dataflow, run);
+        for (size_t tick = 0; tick < 400; ++tick) {
+          executor.step();
+          v[0] = RROSACE::DELTA_E_C_EQ + 1e-4 * (v[0] - RROSACE::H_EQ);
+        }
+        p_outputs[run] = v;
+      }
+
+      for (size_t value = 2; value < 9; ++value) {
+        if (p_outputs[0][value] != p_outputs[1][value]) {
+          throw(std::runtime_error("Parallel and serial runs differ."));
+        }
+      }
+
+      std::cout << "h: " << RROSACE::H_EQ << " -> " << p_outputs[1][4]
+                << std::endl;
+    }
+
+    // Allocation
+    {
+      double values[3][10];
+
+      std::cout << "Allocation test" << std::endl;
+
+      // Serial, on two cores, then on two pinned cores resuming a failed run
+      for (size_t run = 0; run < 3; ++run) {
+        double *const v = values[run];
+
+        v[0] = RROSACE::DELTA_E_C_EQ + 0.01;
+        v[1] = RROSACE::DELTA_TH_C_EQ;
+        v[2] = RROSACE::DELTA_E_EQ;
+        v[3] = RROSACE::T_EQ;
+
+        RROSACE::Elevator elevator(RROSACE::OMEGA, RROSACE::XI, v[0], v[2]);
+        RROSACE::Engine engine(RROSACE::TAU, v[1], v[3]);
+        RROSACE::FlightDynamics flight_dynamics(v[2], v[3], v[4], v[5], v[6],
+                                                v[7], v[8]);
+        RROSACE::AltitudeFilter h_filter(v[4], v[9]);
+        FlakyModel flaky(flight_dynamics, 30);
+        std::vector<RROSACE::Model *> models;
+
+        models.push_back(&elevator);
+        models.push_back(&engine);
+        if (run < 2) {
+          models.push_back(&flight_dynamics);
+        } else {
+          models.push_back(&flaky);
+        }
+        models.push_back(&h_filter);
+
+        const RROSACE::Dataflow dataflow(models);
+        RROSACE::Allocation::Costs costs(models.size(), 1e-6);
+
+        // Actuators in parallel, then the flight dynamics and the filter
+        costs[0] = 4e-6;
+        costs[1] = 4e-6;
+        const RROSACE::Allocation allocation(dataflow, costs, run ? 2 : 1);
+        size_t nb_jobs = 0;
+
+        for (size_t core = 0; core < allocation.get_nb_cores(); ++core) {
+          const RROSACE::Allocation::Jobs &schedule =
+              allocation.get_schedule(core);
+
+          for (size_t job = 0; job < schedule.size(); ++job) {
+            if (allocation.get_core(
+                    allocation.get_jobs()[schedule[job]].model) != core) {
+              throw(std::runtime_error("Job off the core of its model."));
+            }
+          }
+          nb_jobs += schedule.size();
+        }
+
+        if ((nb_jobs != allocation.get_jobs().size()) ||
+            (allocation.get_makespan() < allocation.get_lower_bound()) ||
+            (allocation.get_makespan() >
+             allocation.get_serial_cost() * (run ? 0.75 : 1.))) {
+          throw(std::runtime_error("Unexpected allocation."));
+        }
+
+        RROSACE::StaticExecutor executor(allocation, run == 2);
+        bool failed = false;
+
+        try {
+          executor.run((run < 2) ? 50 : 100);
+        } catch (const std::runtime_error &) {
+          failed = true;
+        }
+        if (failed != (run == 2)) {
+          throw(std::runtime_error("Unexpected static executor failure."));
+        }
+        executor.run(100 - executor.get_logical_time() /
+                               dataflow.get_hyperperiod());
+        if (executor.get_logical_time() != 400) {
+          throw(std::runtime_error("Unexpected static executor time."));
+        }
+      }
+
+      for (size_t value = 2; value < 10; ++value) {
+        if ((values[0][value] != values[1][value]) ||
+            (values[0][value] != values[2][value])) {
+          throw(std::runtime_error("Allocated and serial runs differ."));
+        }
+      }
+
+      std::cout << "h: " << RROSACE::H_EQ << " -> " << values[1][4]
+                << std::endl;
+    }
+
+#ifdef RROSACE_COROUTINES
+    // Coroutines
+    {
+      double values[3][9];
+
+      std::cout << "Coroutine test" << std::endl;
+
+      for (size_t run = 0; run < 3; ++run) {
+        double *const v = values[run];
+
+        v[0] = RROSACE::DELTA_E_C_EQ + 0.01;
+        v[1] = RROSACE::DELTA_TH_C_EQ;
+        v[2] = RROSACE::DELTA_E_EQ;
+        v[3] = RROSACE::T_EQ;
+
+        RROSACE::Elevator elevator(RROSACE::OMEGA, RROSACE::XI, v[0], v[2]);
+        RROSACE::Engine engine(RROSACE::TAU, v[1], v[3]);
+        RROSACE::FlightDynamics flight_dynamics(v[2], v[3], v[4], v[5], v[6],
+                                                v[7], v[8]);
+        std::vector<RROSACE::Model *> models;
+
+        models.push_back(&elevator);
+        models.push_back(&engine);
+        models.push_back(&flight_dynamics);
+
+        if (!run) {
+          const RROSACE::Dataflow dataflow(models);
+          RROSACE::ParallelExecutor executor(dataflow, 0);
+
+          for (size_t tick = 0; tick < 400; ++tick) {
+            executor.step();
+          }
+          continue;
+        }
+
+        RROSACE::Scheduler scheduler;
+        RROSACE::Scheduler other;
+        RROSACE::SchedulerPool pool(2);
+        RROSACE::SchedulerPool::Schedulers schedulers;
+
+        // On the calling thread, then on the pool
+        scheduler.spawn(RROSACE::run(elevator, scheduler));
+        scheduler.spawn(RROSACE::run(engine, scheduler));
+        scheduler.spawn(RROSACE::run(flight_dynamics, scheduler));
+        if (run == 1) {
+          scheduler.run_until(200);
+          scheduler.run_until(400);
+        } else {
+          schedulers.push_back(&scheduler);
+          schedulers.push_back(&other);
+          pool.run_until(schedulers, 400);
+        }
+
+        // Elevator at 200 Hz, engine at 200 Hz, flight dynamics at 200 Hz
+        if ((scheduler.get_logical_time() != 400) ||
+            (scheduler.get_nb_resumes() != 3 * 400)) {
+          throw(std::runtime_error("Unexpected coroutine resumptions."));
+        }
+      }
+
+      for (size_t value = 2; value < 9; ++value) {
+        if ((values[0][value] != values[1][value]) ||
+            (values[0][value] != values[2][value])) {
+          throw(std::runtime_error("Coroutine and serial runs differ."));
+        }
+      }
+
+      std::cout << "h: " << RROSACE::H_EQ << " -> " << values[1][4]
+                << std::endl;
+    }
+
+    // Multi-phase coroutine
+    {
+      double input = 0.;
+      double output = 0.;
+      TwoPhaseModel model(input, output);
+      RROSACE::Scheduler scheduler;
+
+      std::cout << "Multi-phase coroutine test" << std::endl;
+
+      // The overload found by argument-dependent lookup
+      scheduler.spawn(run(model, scheduler));
+      for (size_t tick = 0; tick < 10; ++tick) {
+        // Input sampled at the even ticks, written at the odd ones
+        const size_t sampled = tick ? (tick - 1) / 2 * 2 : 0;
+
+        input = static_cast<double>(tick);
+        scheduler.run_until(tick + 1);
+        if (output != 2. * static_cast<double>(sampled)) {
+          throw(std::runtime_error("Unexpected multi-phase outputs."));
+        }
+      }
+    }
+#endif /* RROSACE_COROUTINES */
+
     std::cout << "...OK" << std::endl;
     ret = EXIT_SUCCESS;
   } catch (std::exception &e) {
@@ -0,0 +1,201 @@
+/**
+ * @file delay_line_test.c
+ * @brief Test of transport delay line module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <rrosace_delay_line.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test_common.h"
+
+#define MODULE "delay_line"
+
+#define NB_STEPS (100)
+#define INITIAL (-1.0)
+
+static int check_delay(size_t /* nb_ticks */);
+
+static int test_delay_func(void);
+
+static int test_in_place_func(void);
+
+static int test_copy_func(void);
+
+static int test_invalid_func(void);
+
+/**
+ * @brief The k-th value written is read at the step k + nb_ticks, the
+ * initial value before
+ */
+static int check_delay(size_t nb_ticks) {
+  int ret = EXIT_FAILURE;
+  rrosace_delay_line_t *p_delay_line =
+      rrosace_delay_line_new(nb_ticks, INITIAL);
+  size_t step;
+
+  if (!p_delay_line ||
+      (rrosace_delay_line_get_nb_ticks(p_delay_line) != nb_ticks)) {
+    goto out;
+  }
+
+  for (step = 0; step < NB_STEPS; ++step) {
+    double out;
+
+    if ((rrosace_delay_line_step(p_delay_line, (double)step, &out) ==
+         EXIT_FAILURE) ||
+        (out != ((step < nb_ticks) ? INITIAL : (double)(step - nb_ticks)))) {
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_delay_line_del(p_delay_line);
+
+  return (ret);
+}
+
+/**
+ * @brief Delays below, at and above powers of two
+ */
+static int test_delay_func(void) {
+  const size_t delays[] = {0, 1, 2, 3, 4, 7, 8, 9, 63};
+  size_t i;
+
+  for (i = 0; i < sizeof(delays) / sizeof(delays[0]); ++i) {
+    if (check_delay(delays[i]) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief A value stepped in place is replaced by the delayed one
+ */
+static int test_in_place_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_delay_line_t *p_delay_line = rrosace_delay_line_new(3, INITIAL);
+  size_t step;
+
+  if (!p_delay_line) {
+    goto out;
+  }
+
+  for (step = 0; step < NB_STEPS; ++step) {
+    double value = (double)step;
+
+    if ((rrosace_delay_line_step(p_delay_line, value, &value) ==
+         EXIT_FAILURE) ||
+        (value != ((step < 3) ? INITIAL : (double)(step - 3)))) {
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_delay_line_del(p_delay_line);
+
+  return (ret);
+}
+
+/**
+ * @brief A copy carries the values in flight, and a reset drops them
+ */
+static int test_copy_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_delay_line_t *p_delay_line = rrosace_delay_line_new(5, INITIAL);
+  rrosace_delay_line_t *p_copy = NULL;
+  double out;
+  double copy_out;
+  size_t step;
+
+  if (!p_delay_line) {
+    goto out;
+  }
+
+  for (step = 0; step < 7; ++step) {
+    rrosace_delay_line_step(p_delay_line, (double)step, &out);
+  }
+
+  p_copy = rrosace_delay_line_copy(p_delay_line);
+  if (!p_copy) {
+    goto out;
+  }
+
+  for (step = 7; step < NB_STEPS; ++step) {
+    if ((rrosace_delay_line_step(p_delay_line, (double)step, &out) ==
+         EXIT_FAILURE) ||
+        (rrosace_delay_line_step(p_copy, (double)step, &copy_out) ==
+         EXIT_FAILURE) ||
+        (out != copy_out) || (out != (double)(step - 5))) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_delay_line_reset(p_copy, 0.5) == EXIT_FAILURE) ||
+      (rrosace_delay_line_step(p_copy, 1.0, &copy_out) == EXIT_FAILURE) ||
+      (copy_out != 0.5)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_delay_line_del(p_copy);
+  rrosace_delay_line_del(p_delay_line);
+
+  return (ret);
+}
+
+static int test_invalid_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_delay_line_t *p_delay_line =
+      rrosace_delay_line_new(RROSACE_DELAY_LINE_MAX_TICKS, INITIAL);
+  double out;
+
+  if (!p_delay_line ||
+      rrosace_delay_line_new(RROSACE_DELAY_LINE_MAX_TICKS + 1, INITIAL) ||
+      (rrosace_delay_line_step(NULL, 0., &out) != EXIT_FAILURE) ||
+      (rrosace_delay_line_step(p_delay_line, 0., NULL) != EXIT_FAILURE) ||
+      (rrosace_delay_line_reset(NULL, 0.) != EXIT_FAILURE) ||
+      rrosace_delay_line_copy(NULL)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_delay_line_del(p_delay_line);
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_delay = {"delay", test_delay_func};
+  const test_t test_in_place = {"in_place", test_in_place_func};
+  const test_t test_copy = {"copy", test_copy_func};
+  const test_t test_invalid = {"invalid", test_invalid_func};
+  const test_t *p_tests[5];
+
+  p_tests[0] = &test_delay;
+  p_tests[1] = &test_in_place;
+  p_tests[2] = &test_copy;
+  p_tests[3] = &test_invalid;
+  p_tests[4] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
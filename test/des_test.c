@@ -0,0 +1,246 @@
+/**
+ * @file des_test.c
+ * @brief Test of discrete-event executor module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <rrosace_constants.h>
+#include <rrosace_des.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test_common.h"
+
+#define MODULE "des"
+
+#define NB_TICKS (2000)
+#define VZ_C (2.5)
+#define SEED (42UL)
+
+/* FCCs at 30 Hz, 1 ms after the other tasks */
+#define FCC_PERIOD (33333333UL)
+#define FCC_OFFSET (1000000UL)
+#define FCC_JITTER (500000UL)
+
+static int same_values(const rrosace_sim_values_t * /* p_a */,
+                       const rrosace_sim_values_t * /* p_b */);
+
+static int set_fccs_timing(rrosace_des_t * /* p_des */,
+                           unsigned long /* jitter */);
+
+static int test_ticks_func(void);
+
+static int test_rates_func(void);
+
+static int test_jitter_func(void);
+
+static unsigned long constant_delay(void * /* p_arg */,
+                                    rrosace_sim_task_t /* task */);
+
+static int test_delay_func(void);
+
+static int same_values(const rrosace_sim_values_t *p_a,
+                       const rrosace_sim_values_t *p_b) {
+  return ((p_a->mode == p_b->mode) && (p_a->delta_e == p_b->delta_e) &&
+          (p_a->t == p_b->t) && (p_a->h == p_b->h) && (p_a->vz == p_b->vz) &&
+          (p_a->va == p_b->va) && (p_a->q == p_b->q) && (p_a->az == p_b->az) &&
+          (p_a->h_f == p_b->h_f) && (p_a->vz_f == p_b->vz_f) &&
+          (p_a->delta_e_c == p_b->delta_e_c) &&
+          (p_a->delta_th_c == p_b->delta_th_c));
+}
+
+static int set_fccs_timing(rrosace_des_t *p_des, unsigned long jitter) {
+  return (((rrosace_des_set_timing(p_des, RROSACE_SIM_TASK_FCCS_COM,
+                                   FCC_PERIOD, FCC_OFFSET,
+                                   jitter) == EXIT_FAILURE) ||
+           (rrosace_des_set_timing(p_des, RROSACE_SIM_TASK_FCCS_MON,
+                                   FCC_PERIOD, FCC_OFFSET,
+                                   jitter) == EXIT_FAILURE))
+              ? EXIT_FAILURE
+              : EXIT_SUCCESS);
+}
+
+/**
+ * @brief With the default periods, the events give the tick values
+ */
+static int test_ticks_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_ticks =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_events =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_des_t *p_des = rrosace_des_new(p_events, SEED);
+
+  if (!p_ticks || !p_events || !p_des ||
+      (rrosace_sim_run(p_ticks, NB_TICKS) == EXIT_FAILURE) ||
+      (rrosace_des_run_until(p_des, (double)NB_TICKS / 2. /
+                                        RROSACE_DEFAULT_PHYSICAL_FREQ) ==
+       EXIT_FAILURE) ||
+      (rrosace_des_run_until(p_des, (double)NB_TICKS /
+                                        RROSACE_DEFAULT_PHYSICAL_FREQ) ==
+       EXIT_FAILURE) ||
+      (rrosace_des_get_time(p_des) !=
+       (double)NB_TICKS / RROSACE_DEFAULT_PHYSICAL_FREQ) ||
+      !same_values(rrosace_sim_get_values(p_ticks),
+                   rrosace_sim_get_values(p_events))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_des_del(p_des);
+  rrosace_sim_del(p_events);
+  rrosace_sim_del(p_ticks);
+
+  return (ret);
+}
+
+/**
+ * @brief Non harmonic and offset periods release the expected events, and
+ * timings cannot change once running
+ */
+static int test_rates_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_des_t *p_des = rrosace_des_new(p_sim, SEED);
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+
+  if (!p_sim || !p_des ||
+      (rrosace_des_set_timing(p_des, RROSACE_SIM_TASK_FCU, 0, 0, 0) !=
+       EXIT_FAILURE) ||
+      (rrosace_des_set_timing(p_des, RROSACE_SIM_TASK_FCU, 10, 0, 10) !=
+       EXIT_FAILURE) ||
+      (set_fccs_timing(p_des, 0) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  /* 200 Hz: 4 * 200, 100 Hz: 4 * 100, 50 Hz: 3 * 50, 30 Hz: 2 * 30 */
+  if ((rrosace_des_run_until(p_des, 1.) == EXIT_FAILURE) ||
+      (rrosace_des_get_nb_events(p_des) != 1410) ||
+      (set_fccs_timing(p_des, 0) != EXIT_FAILURE) ||
+      (rrosace_des_run_until(p_des, 10.) == EXIT_FAILURE) ||
+      (p_values->h < RROSACE_H_EQ - 50.) || (p_values->h > RROSACE_H_EQ)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_des_del(p_des);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Jittered releases are reproducible from the seed
+ */
+static int test_jitter_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sims[3] = {NULL, NULL, NULL};
+  rrosace_des_t *p_deses[3] = {NULL, NULL, NULL};
+  size_t i;
+
+  for (i = 0; i < 3; ++i) {
+    p_sims[i] =
+        rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+    p_deses[i] = rrosace_des_new(p_sims[i], SEED + (i == 2));
+    if (!p_deses[i] || (set_fccs_timing(p_deses[i], FCC_JITTER) ==
+                        EXIT_FAILURE) ||
+        (rrosace_des_run_until(p_deses[i], 10.) == EXIT_FAILURE)) {
+      goto out;
+    }
+  }
+
+  if (!same_values(rrosace_sim_get_values(p_sims[0]),
+                   rrosace_sim_get_values(p_sims[1])) ||
+      same_values(rrosace_sim_get_values(p_sims[0]),
+                  rrosace_sim_get_values(p_sims[2]))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (i = 0; i < 3; ++i) {
+    rrosace_des_del(p_deses[i]);
+    rrosace_sim_del(p_sims[i]);
+  }
+
+  return (ret);
+}
+
+static unsigned long constant_delay(void *p_arg, rrosace_sim_task_t task) {
+  (void)task;
+
+  return (*(const unsigned long *)p_arg);
+}
+
+/**
+ * @brief A constant delay of the FCCs releases them as an offset does
+ */
+static int test_delay_func(void) {
+  int ret = EXIT_FAILURE;
+  unsigned long delay = FCC_OFFSET;
+  rrosace_sim_t *p_offsets =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_delays =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_des_t *p_offsets_des = rrosace_des_new(p_offsets, SEED);
+  rrosace_des_t *p_delays_des = rrosace_des_new(p_delays, SEED);
+
+  if (!p_offsets_des || !p_delays_des ||
+      (set_fccs_timing(p_offsets_des, 0) == EXIT_FAILURE) ||
+      (rrosace_des_set_timing(p_delays_des, RROSACE_SIM_TASK_FCCS_COM,
+                              FCC_PERIOD, 0UL, 0UL) == EXIT_FAILURE) ||
+      (rrosace_des_set_timing(p_delays_des, RROSACE_SIM_TASK_FCCS_MON,
+                              FCC_PERIOD, 0UL, 0UL) == EXIT_FAILURE) ||
+      (rrosace_des_set_delay(p_delays_des, RROSACE_SIM_TASK_FCCS_COM,
+                             constant_delay, &delay) == EXIT_FAILURE) ||
+      (rrosace_des_set_delay(p_delays_des, RROSACE_SIM_TASK_FCCS_MON,
+                             constant_delay, &delay) == EXIT_FAILURE) ||
+      (rrosace_des_run_until(p_offsets_des, 10.) == EXIT_FAILURE) ||
+      (rrosace_des_run_until(p_delays_des, 10.) == EXIT_FAILURE) ||
+      (rrosace_des_set_delay(p_delays_des, RROSACE_SIM_TASK_FCCS_COM, NULL,
+                             NULL) != EXIT_FAILURE) ||
+      !same_values(rrosace_sim_get_values(p_offsets),
+                   rrosace_sim_get_values(p_delays))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_des_del(p_delays_des);
+  rrosace_des_del(p_offsets_des);
+  rrosace_sim_del(p_delays);
+  rrosace_sim_del(p_offsets);
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_ticks = {"ticks", test_ticks_func};
+  const test_t test_rates = {"rates", test_rates_func};
+  const test_t test_jitter = {"jitter", test_jitter_func};
+  const test_t test_delay = {"delay", test_delay_func};
+  const test_t *p_tests[5];
+
+  p_tests[0] = &test_ticks;
+  p_tests[1] = &test_rates;
+  p_tests[2] = &test_jitter;
+  p_tests[3] = &test_delay;
+  p_tests[4] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
@@ -0,0 +1,427 @@
+/**
+ * @file ensemble_test.c
+ * @brief Test of ensemble runner module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#ifdef __linux__
+/* Thread affinity */
+#define _GNU_SOURCE
+#endif
+
+#include <pthread.h>
+#include <rrosace_constants.h>
+#include <rrosace_ensemble.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_common.h"
+
+#define MODULE "ensemble"
+
+#define NB_RUNS (40)
+#define NB_RESULTS (3)
+#define NB_WORKERS (4)
+#define VZ_C (2.5)
+
+static int run_func(rrosace_sim_t * /* p_sim */, size_t /* run */,
+                    void * /* p_arg */, double results[]);
+
+static int test_runs_func(void);
+
+static int test_collect_func(void);
+
+static int arena_run_func(rrosace_sim_t * /* p_sim */, size_t /* run */,
+                          void * /* p_arg */, double results[]);
+
+static int test_placed_func(void);
+
+static int affinity_run_func(rrosace_sim_t * /* p_sim */, size_t /* run */,
+                             void * /* p_arg */, double results[]);
+
+static int test_affinity_func(void);
+
+/* Ensemble of the arenas, and whether they are on huge pages */
+struct arenas {
+  const rrosace_ensemble_t *p_ensemble;
+  int huge_pages;
+};
+
+/**
+ * @brief Runs of lengths from 50 to 400 ticks, on commands set by their index
+ */
+static int run_func(rrosace_sim_t *p_sim, size_t run, void *p_arg,
+                    double results[]) {
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+
+  (void)p_arg;
+
+  if ((rrosace_sim_set_commands(p_sim, RROSACE_H_EQ,
+                                VZ_C - 0.1 * (double)(run % 5),
+                                RROSACE_VA_EQ) == EXIT_FAILURE) ||
+      (rrosace_sim_run(p_sim, 50 * (run % 8 + 1)) == EXIT_FAILURE)) {
+    return (EXIT_FAILURE);
+  }
+
+  results[0] = p_values->h;
+  results[1] = p_values->vz;
+  results[2] = (double)rrosace_sim_get_logical_time(p_sim);
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Runs give the results of sequential runs, whatever the workers, and
+ * each is run once
+ */
+static int test_runs_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_ensemble_t *p_ensembles[2] = {NULL, NULL};
+  rrosace_sim_t *p_sequential = NULL;
+  double results[NB_RESULTS];
+  size_t nb_runs;
+  size_t nb_steals;
+  size_t total;
+  size_t run;
+  size_t worker;
+  size_t i;
+
+  if (!p_sim || rrosace_ensemble_new(p_sim, 0, NB_RESULTS) ||
+      rrosace_ensemble_new(p_sim, RROSACE_ENSEMBLE_MAX_WORKERS + 1,
+                           NB_RESULTS)) {
+    goto out;
+  }
+
+  for (i = 0; i < 2; ++i) {
+    p_ensembles[i] =
+        rrosace_ensemble_new(p_sim, i ? NB_WORKERS : 1, NB_RESULTS);
+    if (!p_ensembles[i] ||
+        (rrosace_ensemble_start(p_ensembles[i], NB_RUNS, run_func, NULL) ==
+         EXIT_FAILURE) ||
+        (rrosace_ensemble_start(p_ensembles[i], NB_RUNS, run_func, NULL) !=
+         EXIT_FAILURE) ||
+        (rrosace_ensemble_wait(p_ensembles[i]) == EXIT_FAILURE)) {
+      goto out;
+    }
+
+    total = 0;
+    for (worker = 0; worker < (i ? NB_WORKERS : 1); ++worker) {
+      if ((rrosace_ensemble_get_stats(p_ensembles[i], worker, &nb_runs,
+                                     &nb_steals) == EXIT_FAILURE) ||
+          (nb_steals > nb_runs)) {
+        goto out;
+      }
+      total += nb_runs;
+    }
+    if (total != NB_RUNS) {
+      goto out;
+    }
+  }
+
+  for (run = 0; run < NB_RUNS; ++run) {
+    p_sequential = rrosace_sim_copy(p_sim);
+    if (!p_sequential ||
+        (run_func(p_sequential, run, NULL, results) == EXIT_FAILURE)) {
+      goto out;
+    }
+    rrosace_sim_del(p_sequential);
+    p_sequential = NULL;
+
+    for (i = 0; i < 2; ++i) {
+      const double *p_results =
+          rrosace_ensemble_get_results(p_ensembles[i], run);
+
+      if (!p_results || memcmp(p_results, results, sizeof(results))) {
+        goto out;
+      }
+    }
+  }
+
+  if (rrosace_ensemble_get_results(p_ensembles[0], NB_RUNS)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sequential);
+  for (i = 0; i < 2; ++i) {
+    rrosace_ensemble_del(p_ensembles[i]);
+  }
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief The collector gives each run once, a few at a time, while running
+ */
+static int test_collect_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_ensemble_t *p_ensemble =
+      p_sim ? rrosace_ensemble_new(p_sim, NB_WORKERS, NB_RESULTS) : NULL;
+  int seen[NB_RUNS];
+  size_t runs[3];
+  size_t nb_collected = 0;
+  size_t nb_runs;
+  size_t i;
+
+  memset(seen, 0, sizeof(seen));
+
+  if (!p_ensemble ||
+      (rrosace_ensemble_start(p_ensemble, NB_RUNS, run_func, NULL) ==
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  while (nb_collected < NB_RUNS) {
+    nb_runs = rrosace_ensemble_collect(p_ensemble, runs, 3);
+    for (i = 0; i < nb_runs; ++i) {
+      if ((runs[i] >= NB_RUNS) || seen[runs[i]]++ ||
+          !rrosace_ensemble_get_results(p_ensemble, runs[i])) {
+        goto out;
+      }
+    }
+    nb_collected += nb_runs;
+  }
+
+  if ((rrosace_ensemble_wait(p_ensemble) == EXIT_FAILURE) ||
+      rrosace_ensemble_collect(p_ensemble, runs, 3)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_ensemble_del(p_ensemble);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Runs of run_func, the altitudes recorded in the arena of the worker
+ */
+static int arena_run_func(rrosace_sim_t *p_sim, size_t run, void *p_arg,
+                          double results[]) {
+  const struct arenas *p_arenas = (const struct arenas *)p_arg;
+  double *p_arena =
+      (double *)rrosace_ensemble_get_arena(p_arenas->p_ensemble, p_sim);
+  const size_t nb_ticks = 50 * (run % 8 + 1);
+  size_t tick;
+
+  if (!p_arena ||
+      (p_arenas->huge_pages &&
+       ((size_t)p_arena % RROSACE_ENSEMBLE_HUGE_PAGE)) ||
+      (rrosace_sim_set_commands(p_sim, RROSACE_H_EQ,
+                                VZ_C - 0.1 * (double)(run % 5),
+                                RROSACE_VA_EQ) == EXIT_FAILURE)) {
+    return (EXIT_FAILURE);
+  }
+
+  for (tick = 0; tick < nb_ticks; ++tick) {
+    if (rrosace_sim_run(p_sim, 1) == EXIT_FAILURE) {
+      return (EXIT_FAILURE);
+    }
+    p_arena[tick] = rrosace_sim_get_values(p_sim)->h;
+  }
+
+  results[0] = p_arena[nb_ticks - 1];
+  results[1] = rrosace_sim_get_values(p_sim)->vz;
+  results[2] = (double)rrosace_sim_get_logical_time(p_sim);
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Workers placed locally or not, with arenas on huge pages or not,
+ * give the results of sequential runs
+ */
+static int test_placed_func(void) {
+  int ret = EXIT_FAILURE;
+  const int locals[3] = {0, 1, 1};
+  const int huge_pages[3] = {1, 1, 0};
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_ensemble_t *p_ensemble = NULL;
+  rrosace_sim_t *p_sequential = NULL;
+  rrosace_ensemble_placement_t placement;
+  struct arenas arenas;
+  double results[NB_RESULTS];
+  size_t run;
+  size_t i;
+
+  if (!p_sim || (rrosace_ensemble_default_placement(NULL) != EXIT_FAILURE) ||
+      (rrosace_ensemble_default_placement(&placement) == EXIT_FAILURE) ||
+      !placement.local || placement.arena_size ||
+      rrosace_ensemble_new_placed(p_sim, NB_WORKERS, NB_RESULTS, NULL)) {
+    goto out;
+  }
+
+  p_ensemble = rrosace_ensemble_new(p_sim, NB_WORKERS, NB_RESULTS);
+  if (!p_ensemble || rrosace_ensemble_get_arena(p_ensemble, p_sim) ||
+      rrosace_ensemble_get_nb_huge(p_ensemble)) {
+    goto out;
+  }
+  rrosace_ensemble_del(p_ensemble);
+  p_ensemble = NULL;
+
+  for (i = 0; i < 3; ++i) {
+    placement.local = locals[i];
+    placement.arena_size = 400 * sizeof(double);
+    placement.huge_pages = huge_pages[i];
+    p_ensemble =
+        rrosace_ensemble_new_placed(p_sim, NB_WORKERS, NB_RESULTS, &placement);
+    arenas.p_ensemble = p_ensemble;
+    arenas.huge_pages = huge_pages[i];
+    if (!p_ensemble ||
+        (rrosace_ensemble_get_nb_huge(p_ensemble) > NB_WORKERS) ||
+        (rrosace_ensemble_start(p_ensemble, NB_RUNS, arena_run_func,
+                                &arenas) == EXIT_FAILURE) ||
+        (rrosace_ensemble_wait(p_ensemble) == EXIT_FAILURE)) {
+      goto out;
+    }
+
+    for (run = 0; run < NB_RUNS; ++run) {
+      const double *p_results = rrosace_ensemble_get_results(p_ensemble, run);
+
+      p_sequential = rrosace_sim_copy(p_sim);
+      if (!p_sequential ||
+          (run_func(p_sequential, run, NULL, results) == EXIT_FAILURE) ||
+          !p_results || memcmp(p_results, results, sizeof(results))) {
+        goto out;
+      }
+      rrosace_sim_del(p_sequential);
+      p_sequential = NULL;
+    }
+
+    rrosace_ensemble_del(p_ensemble);
+    p_ensemble = NULL;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sequential);
+  rrosace_ensemble_del(p_ensemble);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Runs checking the cores of their worker are among the ones of the
+ * creating thread
+ */
+static int affinity_run_func(rrosace_sim_t *p_sim, size_t run, void *p_arg,
+                             double results[]) {
+#ifdef __linux__
+  const cpu_set_t *p_allowed = (const cpu_set_t *)p_arg;
+  cpu_set_t cores;
+  cpu_set_t outside;
+
+  if (pthread_getaffinity_np(pthread_self(), sizeof(cores), &cores)) {
+    return (EXIT_FAILURE);
+  }
+  CPU_XOR(&outside, &cores, p_allowed);
+  CPU_AND(&outside, &outside, &cores);
+  if (CPU_COUNT(&outside)) {
+    return (EXIT_FAILURE);
+  }
+#else
+  (void)p_arg;
+#endif
+
+  return (run_func(p_sim, run, NULL, results));
+}
+
+/**
+ * @brief Workers placed locally stay within the affinity mask of the creating
+ * thread, narrowed to exclude its first core when it has several
+ */
+static int test_affinity_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_ensemble_t *p_ensemble = NULL;
+  rrosace_ensemble_placement_t placement;
+  void *p_allowed = NULL;
+#ifdef __linux__
+  cpu_set_t saved;
+  cpu_set_t allowed;
+  int core;
+
+  if (pthread_getaffinity_np(pthread_self(), sizeof(saved), &saved)) {
+    goto out;
+  }
+  allowed = saved;
+  for (core = 0; (CPU_COUNT(&allowed) > 1) && (core < CPU_SETSIZE); ++core) {
+    if (CPU_ISSET(core, &allowed)) {
+      CPU_CLR(core, &allowed);
+      break;
+    }
+  }
+  if (pthread_setaffinity_np(pthread_self(), sizeof(allowed), &allowed)) {
+    goto out;
+  }
+  p_allowed = &allowed;
+#endif
+
+  if (!p_sim ||
+      (rrosace_ensemble_default_placement(&placement) == EXIT_FAILURE)) {
+    goto out;
+  }
+  placement.arena_size = 400 * sizeof(double);
+
+  p_ensemble =
+      rrosace_ensemble_new_placed(p_sim, NB_WORKERS, NB_RESULTS, &placement);
+  if (!p_ensemble ||
+      (rrosace_ensemble_start(p_ensemble, NB_RUNS, affinity_run_func,
+                              p_allowed) == EXIT_FAILURE) ||
+      (rrosace_ensemble_wait(p_ensemble) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+#ifdef __linux__
+  if (p_allowed) {
+    pthread_setaffinity_np(pthread_self(), sizeof(saved), &saved);
+  }
+#endif
+  rrosace_ensemble_del(p_ensemble);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_runs = {"runs", test_runs_func};
+  const test_t test_collect = {"collect", test_collect_func};
+  const test_t test_placed = {"placed", test_placed_func};
+  const test_t test_affinity = {"affinity", test_affinity_func};
+  const test_t *p_tests[5];
+
+  p_tests[0] = &test_runs;
+  p_tests[1] = &test_collect;
+  p_tests[2] = &test_placed;
+  p_tests[3] = &test_affinity;
+  p_tests[4] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
@@ -0,0 +1,129 @@
+/**
+ * @file events_test.c
+ * @brief Test of zero-crossing events module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <math.h>
+#include <rrosace_events.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test_common.h"
+
+#define MODULE "events"
+
+/* Falling body, exact step, state height and vertical speed */
+#define GRAVITY (9.81)
+#define HEIGHT0 (100.)
+#define FLOOR (0.)
+#define CEILING (50.)
+#define TIME_TOLERANCE (1e-9)
+
+static int fall(void * /* p_context */, const double * /* state_in */,
+                double /* dt */, double * /* state_out */);
+
+static double guard(void * /* p_context */, size_t /* guard */,
+                    const double * /* state */);
+
+static int test_step(size_t /* nb_guards */, double /* dt */,
+                     size_t /* expected_guard */, double /* expected_time */);
+
+static int test_locate_func(void);
+
+static int test_earliest_func(void);
+
+static int test_no_event_func(void);
+
+static int fall(void *p_context, const double *state_in, double dt,
+                double *state_out) {
+  (void)p_context;
+
+  state_out[0] = state_in[0] + state_in[1] * dt - GRAVITY * dt * dt / 2.;
+  state_out[1] = state_in[1] - GRAVITY * dt;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Guard 0 crosses the floor, guard 1 the ceiling
+ */
+static double guard(void *p_context, size_t guard, const double *state) {
+  (void)p_context;
+
+  return (state[0] - (guard ? CEILING : FLOOR));
+}
+
+static int test_step(size_t nb_guards, double dt, size_t expected_guard,
+                     double expected_time) {
+  int ret = EXIT_FAILURE;
+  rrosace_events_t *p_events;
+  double state[2];
+  double elapsed;
+  size_t event;
+
+  state[0] = HEIGHT0;
+  state[1] = 0.;
+
+  p_events = rrosace_events_new(2, nb_guards, fall, guard, NULL);
+  if (!p_events) {
+    goto out;
+  }
+
+  if (rrosace_events_step(p_events, state, dt, TIME_TOLERANCE, &elapsed,
+                          &event) == EXIT_FAILURE) {
+    goto out;
+  }
+
+  if ((event != expected_guard) ||
+      (fabs(elapsed - expected_time) > TIME_TOLERANCE)) {
+    goto out;
+  }
+
+  /* The guard has already crossed at the returned state */
+  if ((event != RROSACE_EVENTS_NO_EVENT) &&
+      (guard(NULL, event, state) > 0.)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_events_del(p_events);
+
+  return (ret);
+}
+
+static int test_locate_func(void) {
+  return (test_step(1, 10., 0, sqrt(2. * (HEIGHT0 - FLOOR) / GRAVITY)));
+}
+
+static int test_earliest_func(void) {
+  return (test_step(2, 10., 1, sqrt(2. * (HEIGHT0 - CEILING) / GRAVITY)));
+}
+
+static int test_no_event_func(void) {
+  return (test_step(2, 1., RROSACE_EVENTS_NO_EVENT, 1.));
+}
+
+int main() {
+  int ret;
+
+  const test_t test_locate = {"locate", test_locate_func};
+  const test_t test_earliest = {"earliest", test_earliest_func};
+  const test_t test_no_event = {"no_event", test_no_event_func};
+  const test_t *p_tests[4];
+
+  p_tests[0] = &test_locate;
+  p_tests[1] = &test_earliest;
+  p_tests[2] = &test_no_event;
+  p_tests[3] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
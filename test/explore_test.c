@@ -0,0 +1,235 @@
+/**
+ * @file explore_test.c
+ * @brief Test of schedule order exploration module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <rrosace_constants.h>
+#include <rrosace_explore.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_common.h"
+
+#define MODULE "explore"
+
+#define HORIZON (10)
+#define VZ_C (2.5)
+#define MAX_STATES (4096)
+#define NB_THREADS (3)
+
+static int same_state(const rrosace_sim_t * /* p_a */,
+                      const rrosace_sim_t * /* p_b */);
+
+static int test_serial_func(void);
+
+static int test_merge_func(void);
+
+static int test_orders_func(void);
+
+static int same_state(const rrosace_sim_t *p_a, const rrosace_sim_t *p_b) {
+  double state_a[RROSACE_SIM_STATE_SIZE];
+  double state_b[RROSACE_SIM_STATE_SIZE];
+
+  return ((rrosace_sim_get_state(p_a, state_a) == EXIT_SUCCESS) &&
+          (rrosace_sim_get_state(p_b, state_b) == EXIT_SUCCESS) &&
+          !memcmp(state_a, state_b, sizeof(state_a)));
+}
+
+/**
+ * @brief A single task explored has the tick order only
+ */
+static int test_serial_func(void) {
+  int ret = EXIT_FAILURE;
+  const rrosace_sim_task_t tasks[1] = {RROSACE_SIM_TASK_CABLES};
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_explore_t *p_explore =
+      rrosace_explore_new(p_sim, tasks, 1, NB_THREADS, MAX_STATES);
+  rrosace_sim_task_t order[RROSACE_SIM_NB_TASKS];
+  size_t task;
+
+  if (!p_explore || (rrosace_explore_run(p_explore, HORIZON) == EXIT_FAILURE) ||
+      (rrosace_explore_run(p_explore, HORIZON) != EXIT_FAILURE) ||
+      (rrosace_explore_get_nb_trajectories(p_explore) != 1) ||
+      (rrosace_explore_get_nb_schedules(p_explore, 0) != 1.) ||
+      (rrosace_explore_get_order(p_explore, 0, HORIZON - 1, order) ==
+       EXIT_FAILURE) ||
+      (rrosace_explore_get_order(p_explore, 0, HORIZON, order) !=
+       EXIT_FAILURE) ||
+      (rrosace_sim_run(p_sim, HORIZON) == EXIT_FAILURE) ||
+      !same_state(p_sim, rrosace_explore_get_sim(p_explore, 0))) {
+    goto out;
+  }
+
+  for (task = 0; task < RROSACE_SIM_NB_TASKS; ++task) {
+    if ((size_t)order[task] != task) {
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_explore_del(p_explore);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Orders of independent filters all reach the same state
+ */
+static int test_merge_func(void) {
+  int ret = EXIT_FAILURE;
+  const rrosace_sim_task_t tasks[2] = {RROSACE_SIM_TASK_Q_FILTER,
+                                       RROSACE_SIM_TASK_VA_FILTER};
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_explore_t *p_explore =
+      rrosace_explore_new(p_sim, tasks, 2, NB_THREADS, MAX_STATES);
+  size_t nb_simulated;
+  size_t nb_distinct;
+
+  /* Filters at 100 Hz, released together every other tick */
+  if (!p_explore || (rrosace_explore_run(p_explore, HORIZON) == EXIT_FAILURE) ||
+      (rrosace_explore_get_nb_trajectories(p_explore) != 1) ||
+      (rrosace_explore_get_nb_schedules(p_explore, 0) !=
+       (double)(1 << (HORIZON / 2))) ||
+      (rrosace_explore_get_nb_states(p_explore, &nb_simulated,
+                                     &nb_distinct) == EXIT_FAILURE) ||
+      (nb_simulated != HORIZON + HORIZON / 2) || (nb_distinct != HORIZON) ||
+      (rrosace_sim_run(p_sim, HORIZON) == EXIT_FAILURE) ||
+      !same_state(p_sim, rrosace_explore_get_sim(p_explore, 0))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_explore_del(p_explore);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Orders of the FCCs and cables give distinct trajectories, whatever
+ * the threads, each replayed by its orders, and precedences prune them
+ */
+static int test_orders_func(void) {
+  int ret = EXIT_FAILURE;
+  const rrosace_sim_task_t tasks[3] = {RROSACE_SIM_TASK_CABLES,
+                                       RROSACE_SIM_TASK_FCCS_MON,
+                                       RROSACE_SIM_TASK_FCCS_COM};
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_explore_t *p_explores[3] = {NULL, NULL, NULL};
+  rrosace_sim_t *p_replay = NULL;
+  double nb_schedules = 0.;
+  size_t trajectory;
+  size_t tick;
+  size_t i;
+
+  for (i = 0; i < 3; ++i) {
+    p_explores[i] = rrosace_explore_new(p_sim, tasks, 3, i ? NB_THREADS : 0,
+                                        MAX_STATES);
+    if (!p_explores[i]) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_explore_add_precedence(p_explores[2], RROSACE_SIM_TASK_FCU,
+                                      RROSACE_SIM_TASK_FCCS_COM) !=
+       EXIT_FAILURE) ||
+      (rrosace_explore_add_precedence(p_explores[2], RROSACE_SIM_TASK_FCCS_COM,
+                                      RROSACE_SIM_TASK_FCCS_MON) ==
+       EXIT_FAILURE) ||
+      (rrosace_explore_add_precedence(p_explores[2], RROSACE_SIM_TASK_FCCS_MON,
+                                      RROSACE_SIM_TASK_CABLES) ==
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (i = 0; i < 3; ++i) {
+    if (rrosace_explore_run(p_explores[i], HORIZON) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_explore_get_nb_trajectories(p_explores[0]) < 2) ||
+      (rrosace_explore_get_nb_trajectories(p_explores[1]) !=
+       rrosace_explore_get_nb_trajectories(p_explores[0])) ||
+      (rrosace_explore_get_nb_trajectories(p_explores[2]) != 1)) {
+    goto out;
+  }
+
+  for (trajectory = 0;
+       trajectory < rrosace_explore_get_nb_trajectories(p_explores[0]);
+       ++trajectory) {
+    if ((rrosace_explore_get_nb_schedules(p_explores[1], trajectory) !=
+         rrosace_explore_get_nb_schedules(p_explores[0], trajectory)) ||
+        !same_state(rrosace_explore_get_sim(p_explores[0], trajectory),
+                    rrosace_explore_get_sim(p_explores[1], trajectory))) {
+      goto out;
+    }
+    nb_schedules += rrosace_explore_get_nb_schedules(p_explores[0], trajectory);
+
+    p_replay = rrosace_sim_copy(p_sim);
+    for (tick = 0; p_replay && (tick < HORIZON); ++tick) {
+      rrosace_sim_task_t order[RROSACE_SIM_NB_TASKS];
+
+      if ((rrosace_explore_get_order(p_explores[0], trajectory, tick, order) ==
+           EXIT_FAILURE) ||
+          (rrosace_sim_run_ordered(p_replay, order) == EXIT_FAILURE)) {
+        goto out;
+      }
+    }
+    if (!p_replay ||
+        !same_state(p_replay,
+                    rrosace_explore_get_sim(p_explores[0], trajectory))) {
+      goto out;
+    }
+    rrosace_sim_del(p_replay);
+    p_replay = NULL;
+  }
+
+  /* FCCs at 50 Hz, released at ticks 0, 4 and 8 with the cables */
+  if (nb_schedules != 216.) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_replay);
+  for (i = 0; i < 3; ++i) {
+    rrosace_explore_del(p_explores[i]);
+  }
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_serial = {"serial", test_serial_func};
+  const test_t test_merge = {"merge", test_merge_func};
+  const test_t test_orders = {"orders", test_orders_func};
+  const test_t *p_tests[4];
+
+  p_tests[0] = &test_serial;
+  p_tests[1] = &test_merge;
+  p_tests[2] = &test_orders;
+  p_tests[3] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
@@ -15,6 +15,7 @@
 #define MODULE "FCC"
 
 static int test_step_func();
+static int test_state_func();
 
 static int test_step_func() {
   int ret = EXIT_FAILURE;
@@ -61,14 +62,65 @@ out:
   return (ret);
 }
 
+/**
+ * @brief An FCC restored from a state commands as the original one
+ */
+static int test_state_func() {
+  int ret = EXIT_FAILURE;
+  rrosace_fcc_t *p_fcc = rrosace_fcc_new();
+  rrosace_fcc_t *p_restored = rrosace_fcc_new();
+  const double dt = 1. / RROSACE_FCC_DEFAULT_FREQ;
+  double state[RROSACE_FCC_STATE_SIZE];
+  double delta_e_c[2];
+  double delta_th_c[2];
+  unsigned int i;
+
+  if (!p_fcc || !p_restored) {
+    goto out;
+  }
+
+  for (i = 0; i < 10; ++i) {
+    rrosace_fcc_com_step(p_fcc, RROSACE_ALTITUDE_HOLD, 10000.0, 0.1, 230.0,
+                         0.0, 0.0, 10010.0, 0.0, 230.0, &delta_e_c[0],
+                         &delta_th_c[0], dt);
+  }
+
+  ret = rrosace_fcc_get_state(p_fcc, state);
+  if (ret == EXIT_SUCCESS) {
+    ret = rrosace_fcc_set_state(p_restored, state);
+  }
+  if (ret == EXIT_FAILURE) {
+    goto out;
+  }
+
+  rrosace_fcc_com_step(p_fcc, RROSACE_ALTITUDE_HOLD, 10000.0, 0.1, 230.0, 0.0,
+                       0.0, 10010.0, 0.0, 230.0, &delta_e_c[0], &delta_th_c[0],
+                       dt);
+  rrosace_fcc_com_step(p_restored, RROSACE_ALTITUDE_HOLD, 10000.0, 0.1, 230.0,
+                       0.0, 0.0, 10010.0, 0.0, 230.0, &delta_e_c[1],
+                       &delta_th_c[1], dt);
+
+  if ((delta_e_c[0] != delta_e_c[1]) || (delta_th_c[0] != delta_th_c[1])) {
+    ret = EXIT_FAILURE;
+  }
+
+out:
+  rrosace_fcc_del(p_fcc);
+  rrosace_fcc_del(p_restored);
+
+  return (ret);
+}
+
 int main() {
   int ret;
 
   const test_t test_step = {"step", test_step_func};
-  const test_t *p_tests[2];
+  const test_t test_state = {"state", test_state_func};
+  const test_t *p_tests[3];
 
   p_tests[0] = &test_step;
-  p_tests[1] = NULL;
+  p_tests[1] = &test_state;
+  p_tests[2] = NULL;
 
   ret = exec_tests(MODULE, p_tests);
 
@@ -15,6 +15,8 @@
 #define MODULE "flight dynamics"
 
 static int test_step_func();
+static int test_state_func();
+static int test_parameters_func();
 
 static int test_step_func() {
   int ret = EXIT_FAILURE;
@@ -42,14 +44,118 @@ out:
   return (ret);
 }
 
+/**
+ * @brief A flight dynamics restored from a state steps as the original one
+ */
+static int test_state_func() {
+  int ret = EXIT_FAILURE;
+  rrosace_flight_dynamics_t *p_flight_dynamics = rrosace_flight_dynamics_new();
+  rrosace_flight_dynamics_t *p_restored = rrosace_flight_dynamics_new();
+  const double dt = 1.0 / RROSACE_FLIGHT_DYNAMICS_DEFAULT_FREQ;
+  double state[RROSACE_FLIGHT_DYNAMICS_STATE_SIZE];
+  double outputs[2][5];
+  unsigned int i;
+
+  if (!p_flight_dynamics || !p_restored) {
+    goto out;
+  }
+
+  for (i = 0; i < 10; ++i) {
+    rrosace_flight_dynamics_step(p_flight_dynamics, 0.01, 40000.0,
+                                 &outputs[0][0], &outputs[0][1],
+                                 &outputs[0][2], &outputs[0][3],
+                                 &outputs[0][4], dt);
+  }
+
+  ret = rrosace_flight_dynamics_get_state(p_flight_dynamics, state);
+  if (ret == EXIT_SUCCESS) {
+    ret = rrosace_flight_dynamics_set_state(p_restored, state);
+  }
+  if (ret == EXIT_FAILURE) {
+    goto out;
+  }
+
+  rrosace_flight_dynamics_step(p_flight_dynamics, 0.01, 40000.0,
+                               &outputs[0][0], &outputs[0][1], &outputs[0][2],
+                               &outputs[0][3], &outputs[0][4], dt);
+  rrosace_flight_dynamics_step(p_restored, 0.01, 40000.0, &outputs[1][0],
+                               &outputs[1][1], &outputs[1][2], &outputs[1][3],
+                               &outputs[1][4], dt);
+
+  for (i = 0; i < 5; ++i) {
+    if (outputs[0][i] != outputs[1][i]) {
+      ret = EXIT_FAILURE;
+    }
+  }
+
+out:
+  rrosace_flight_dynamics_del(p_flight_dynamics);
+  rrosace_flight_dynamics_del(p_restored);
+
+  return (ret);
+}
+
+/**
+ * @brief The aircraft parameters default to RROSACE_MASSE and RROSACE_I_Y
+ */
+static int test_parameters_func() {
+  int ret = EXIT_FAILURE;
+  rrosace_flight_dynamics_t *p_flight_dynamics[3];
+  const double dt = 1.0 / RROSACE_FLIGHT_DYNAMICS_DEFAULT_FREQ;
+  double outputs[3][5];
+  unsigned int i;
+
+  for (i = 0; i < 3; ++i) {
+    p_flight_dynamics[i] = rrosace_flight_dynamics_new();
+  }
+
+  if (!p_flight_dynamics[0] || !p_flight_dynamics[1] ||
+      !p_flight_dynamics[2]) {
+    goto out;
+  }
+
+  if ((rrosace_flight_dynamics_set_parameters(p_flight_dynamics[1], 0.,
+                                              RROSACE_I_Y) == EXIT_SUCCESS) ||
+      (rrosace_flight_dynamics_set_parameters(
+           p_flight_dynamics[1], RROSACE_MASSE, RROSACE_I_Y) == EXIT_FAILURE) ||
+      (rrosace_flight_dynamics_set_parameters(p_flight_dynamics[2],
+                                              2. * RROSACE_MASSE,
+                                              RROSACE_I_Y) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (i = 0; i < 3; ++i) {
+    rrosace_flight_dynamics_step(p_flight_dynamics[i], 0.01, 40000.0,
+                                 &outputs[i][0], &outputs[i][1],
+                                 &outputs[i][2], &outputs[i][3],
+                                 &outputs[i][4], dt);
+  }
+
+  /* Same vertical acceleration with the defaults, another when heavier */
+  if ((outputs[1][4] == outputs[0][4]) && (outputs[2][4] != outputs[0][4])) {
+    ret = EXIT_SUCCESS;
+  }
+
+out:
+  for (i = 0; i < 3; ++i) {
+    rrosace_flight_dynamics_del(p_flight_dynamics[i]);
+  }
+
+  return (ret);
+}
+
 int main() {
   int ret;
 
   const test_t test_step = {"step", test_step_func};
-  const test_t *p_tests[2];
+  const test_t test_state = {"state", test_state_func};
+  const test_t test_parameters = {"parameters", test_parameters_func};
+  const test_t *p_tests[4];
 
   p_tests[0] = &test_step;
-  p_tests[1] = NULL;
+  p_tests[1] = &test_state;
+  p_tests[2] = &test_parameters;
+  p_tests[3] = NULL;
 
   ret = exec_tests(MODULE, p_tests);
 
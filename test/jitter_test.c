@@ -0,0 +1,279 @@
+/**
+ * @file jitter_test.c
+ * @brief Test of release-jitter Monte Carlo module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <rrosace_constants.h>
+#include <rrosace_jitter.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_common.h"
+
+#define MODULE "jitter"
+
+#define NB_RUNS (64)
+#define NB_WORKERS (2)
+#define DURATION (1.0)
+#define VA_STEP (5.0)
+#define SEED (42UL)
+
+/* COM FCCs released 2 ms after the other tasks, MON ones up to 4 ms */
+#define COM_OFFSET (2000000UL)
+#define MON_OFFSET (4000000UL)
+
+static rrosace_sim_t *new_sim(void);
+
+static int test_none_func(void);
+
+static int test_seed_func(void);
+
+static int test_ranges_func(void);
+
+static int test_invalid_func(void);
+
+/**
+ * @brief Speeding up from trim, the throttle commands move fast
+ */
+static rrosace_sim_t *new_sim(void) {
+  return (rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, 0.,
+                          RROSACE_VA_EQ + VA_STEP));
+}
+
+/**
+ * @brief Without jitter, the MON FCCs check the commands of the tick, and no
+ * relay opens
+ */
+static int test_none_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim = new_sim();
+  rrosace_jitter_t *p_jitter = rrosace_jitter_new(p_sim, NB_WORKERS);
+  rrosace_jitter_outcome_t outcome;
+  size_t run;
+
+  if (!p_jitter ||
+      (rrosace_jitter_run(p_jitter, NB_RUNS, DURATION, SEED) ==
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (run = 0; run < NB_RUNS; ++run) {
+    if ((rrosace_jitter_get_outcome(p_jitter, run, &outcome) ==
+         EXIT_FAILURE) ||
+        outcome.nb_openings || outcome.nb_changes || (outcome.t_first >= 0.) ||
+        outcome.jitters[RROSACE_SIM_TASK_FCCS_MON][RROSACE_JITTER_OFFSET]) {
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_jitter_del(p_jitter);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief A run draws the same jitters and outcome for a seed, within the
+ * bounds of the laws, and others for another seed
+ */
+static int test_seed_func(void) {
+  int ret = EXIT_FAILURE;
+  const rrosace_jitter_distribution_t offset = {RROSACE_JITTER_UNIFORM, 0UL,
+                                                MON_OFFSET};
+  const rrosace_jitter_distribution_t release = {RROSACE_JITTER_NORMAL, 0UL,
+                                                 1000000UL};
+  const rrosace_jitter_distribution_t execution = {RROSACE_JITTER_EXTREMES,
+                                                   200000UL, 2000000UL};
+  rrosace_sim_t *p_sim = new_sim();
+  rrosace_jitter_t *p_jitter = rrosace_jitter_new(p_sim, NB_WORKERS);
+  rrosace_jitter_outcome_t outcomes[NB_RUNS];
+  rrosace_jitter_outcome_t outcome;
+  size_t nb_same = 0;
+  size_t run;
+
+  if (!p_jitter ||
+      (rrosace_jitter_set_task(p_jitter, RROSACE_SIM_TASK_FCCS_MON, &offset,
+                               &release, &execution) == EXIT_FAILURE) ||
+      (rrosace_jitter_run(p_jitter, NB_RUNS, DURATION, SEED) ==
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (run = 0; run < NB_RUNS; ++run) {
+    const unsigned long *jitters;
+
+    if (rrosace_jitter_get_outcome(p_jitter, run, &outcomes[run]) ==
+        EXIT_FAILURE) {
+      goto out;
+    }
+    jitters = outcomes[run].jitters[RROSACE_SIM_TASK_FCCS_MON];
+    if ((jitters[RROSACE_JITTER_OFFSET] > offset.max) ||
+        (jitters[RROSACE_JITTER_RELEASE] > release.max) ||
+        ((jitters[RROSACE_JITTER_EXECUTION] != execution.min) &&
+         (jitters[RROSACE_JITTER_EXECUTION] != execution.max))) {
+      goto out;
+    }
+  }
+
+  if (rrosace_jitter_run(p_jitter, NB_RUNS, DURATION, SEED) == EXIT_FAILURE) {
+    goto out;
+  }
+  for (run = 0; run < NB_RUNS; ++run) {
+    if ((rrosace_jitter_get_outcome(p_jitter, run, &outcome) ==
+         EXIT_FAILURE) ||
+        memcmp(&outcome, &outcomes[run], sizeof(outcome))) {
+      goto out;
+    }
+  }
+
+  if (rrosace_jitter_run(p_jitter, NB_RUNS, DURATION, SEED + 1) ==
+      EXIT_FAILURE) {
+    goto out;
+  }
+  for (run = 0; run < NB_RUNS; ++run) {
+    if (rrosace_jitter_get_outcome(p_jitter, run, &outcome) == EXIT_FAILURE) {
+      goto out;
+    }
+    nb_same += !memcmp(outcome.jitters, outcomes[run].jitters,
+                       sizeof(outcome.jitters));
+  }
+  if (nb_same == NB_RUNS) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_jitter_del(p_jitter);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief The MON FCCs released before the COM ones check the previous
+ * commands and open their relays, the others do not
+ */
+static int test_ranges_func(void) {
+  int ret = EXIT_FAILURE;
+  const rrosace_jitter_distribution_t com_offset = {RROSACE_JITTER_NONE,
+                                                    COM_OFFSET, COM_OFFSET};
+  const rrosace_jitter_distribution_t mon_offset = {RROSACE_JITTER_UNIFORM,
+                                                    0UL, MON_OFFSET};
+  rrosace_sim_t *p_sim = new_sim();
+  rrosace_jitter_t *p_jitter = rrosace_jitter_new(p_sim, NB_WORKERS);
+  size_t nb_runs[2];
+  size_t nb_openings[2];
+  size_t nb_changes[2];
+  size_t range;
+
+  if (!p_jitter ||
+      (rrosace_jitter_set_task(p_jitter, RROSACE_SIM_TASK_FCCS_COM,
+                               &com_offset, NULL, NULL) == EXIT_FAILURE) ||
+      (rrosace_jitter_set_task(p_jitter, RROSACE_SIM_TASK_FCCS_MON,
+                               &mon_offset, NULL, NULL) == EXIT_FAILURE) ||
+      (rrosace_jitter_run(p_jitter, NB_RUNS, DURATION, SEED) ==
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (range = 0; range < 2; ++range) {
+    if (rrosace_jitter_get_range(p_jitter, RROSACE_SIM_TASK_FCCS_MON,
+                                 RROSACE_JITTER_OFFSET, 2, range,
+                                 &nb_runs[range], &nb_openings[range],
+                                 &nb_changes[range]) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  if ((nb_runs[0] + nb_runs[1] != NB_RUNS) || !nb_runs[0] || !nb_runs[1] ||
+      (nb_openings[0] != nb_runs[0]) || (nb_changes[0] != nb_runs[0]) ||
+      nb_openings[1] || nb_changes[1]) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_jitter_del(p_jitter);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Invalid laws, and jitters reaching the period, are refused
+ */
+static int test_invalid_func(void) {
+  int ret = EXIT_FAILURE;
+  const rrosace_jitter_distribution_t reversed = {RROSACE_JITTER_UNIFORM, 2UL,
+                                                  1UL};
+  const rrosace_jitter_distribution_t unknown = {RROSACE_JITTER_NB_LAWS, 0UL,
+                                                 1UL};
+  const rrosace_jitter_distribution_t half = {RROSACE_JITTER_UNIFORM, 0UL,
+                                              10000000UL};
+  rrosace_sim_t *p_sim = new_sim();
+  rrosace_jitter_t *p_jitter = rrosace_jitter_new(p_sim, NB_WORKERS);
+  rrosace_jitter_outcome_t outcome;
+  size_t nb_runs;
+  size_t nb_openings;
+  size_t nb_changes;
+
+  if (!p_jitter ||
+      (rrosace_jitter_set_task(p_jitter, RROSACE_SIM_TASK_FCCS_COM, &reversed,
+                               NULL, NULL) != EXIT_FAILURE) ||
+      (rrosace_jitter_set_task(p_jitter, RROSACE_SIM_TASK_FCCS_COM, NULL,
+                               &unknown, NULL) != EXIT_FAILURE) ||
+      (rrosace_jitter_set_task(p_jitter, RROSACE_SIM_TASK_FCCS_COM, NULL,
+                               &half, &half) != EXIT_FAILURE) ||
+      (rrosace_jitter_set_task(p_jitter, RROSACE_SIM_NB_TASKS, NULL, NULL,
+                               NULL) != EXIT_FAILURE) ||
+      (rrosace_jitter_get_outcome(p_jitter, 0, &outcome) != EXIT_FAILURE) ||
+      (rrosace_jitter_run(p_jitter, 0, DURATION, SEED) != EXIT_FAILURE) ||
+      (rrosace_jitter_run(p_jitter, 1, 0., SEED) != EXIT_FAILURE) ||
+      (rrosace_jitter_run(p_jitter, 1, DURATION, SEED) == EXIT_FAILURE) ||
+      (rrosace_jitter_get_outcome(p_jitter, 1, &outcome) != EXIT_FAILURE) ||
+      (rrosace_jitter_get_range(p_jitter, RROSACE_SIM_TASK_FCCS_COM,
+                                RROSACE_JITTER_OFFSET, 2, 2, &nb_runs,
+                                &nb_openings,
+                                &nb_changes) != EXIT_FAILURE)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_jitter_del(p_jitter);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_none = {"none", test_none_func};
+  const test_t test_seed = {"seed", test_seed_func};
+  const test_t test_ranges = {"ranges", test_ranges_func};
+  const test_t test_invalid = {"invalid", test_invalid_func};
+  const test_t *p_tests[5];
+
+  p_tests[0] = &test_none;
+  p_tests[1] = &test_seed;
+  p_tests[2] = &test_ranges;
+  p_tests[3] = &test_invalid;
+  p_tests[4] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
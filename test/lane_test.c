@@ -0,0 +1,346 @@
+/**
+ * @file lane_test.c
+ * @brief Test of remote FCC lanes module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <rrosace_constants.h>
+#include <rrosace_lane.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "test_common.h"
+
+#define MODULE "lane"
+
+#define NB_STEPS (200)
+#define NB_POSTED (3)
+
+enum lane_index { COM_LANE, MON_LANE, NB_LANES };
+
+static pid_t start_lane(rrosace_lane_t * /* p_lane */);
+
+static int stop_lane(rrosace_lane_t * /* p_lane */, pid_t /* pid */);
+
+static int test_steps_func(void);
+
+static int test_posted_func(void);
+
+static int test_timeout_func(void);
+
+static int test_orphaned_func(void);
+
+/**
+ * @brief Fork a process serving a lane with a new FCC
+ */
+static pid_t start_lane(rrosace_lane_t *p_lane) {
+  const pid_t pid = fork();
+
+  if (!pid) {
+    rrosace_fcc_t *p_fcc = rrosace_fcc_new();
+    const int ret = p_fcc ? rrosace_lane_serve(p_lane, p_fcc) : EXIT_FAILURE;
+
+    rrosace_fcc_del(p_fcc);
+    _exit(ret);
+  }
+
+  return (pid);
+}
+
+static int stop_lane(rrosace_lane_t *p_lane, pid_t pid) {
+  int status;
+
+  return (((rrosace_lane_stop(p_lane) == EXIT_SUCCESS) &&
+           (waitpid(pid, &status, 0) == pid) && WIFEXITED(status) &&
+           (WEXITSTATUS(status) == EXIT_SUCCESS))
+              ? EXIT_SUCCESS
+              : EXIT_FAILURE);
+}
+
+/**
+ * @brief Lanes in other processes step as FCCs in the host, relays opened
+ */
+static int test_steps_func(void) {
+  int ret = EXIT_FAILURE;
+  const double dt = 1. / RROSACE_FCC_DEFAULT_FREQ;
+  rrosace_lane_t *p_lanes[NB_LANES] = {NULL, NULL};
+  pid_t pids[NB_LANES] = {-1, -1};
+  rrosace_fcc_t *p_fccs[NB_LANES] = {NULL, NULL};
+  double delta_e_c[NB_LANES];
+  double delta_th_c[NB_LANES];
+  rrosace_relay_state_t relay_delta_e_c[NB_LANES];
+  rrosace_relay_state_t relay_delta_th_c[NB_LANES];
+  rrosace_master_in_law_t master_in_law[NB_LANES];
+  size_t nb_opened = 0;
+  size_t step;
+  size_t i;
+
+  for (i = 0; i < NB_LANES; ++i) {
+    p_lanes[i] = rrosace_lane_new();
+    p_fccs[i] = rrosace_fcc_new();
+    if (!p_lanes[i] || !p_fccs[i]) {
+      goto out;
+    }
+    pids[i] = start_lane(p_lanes[i]);
+    if (pids[i] < 0) {
+      goto out;
+    }
+  }
+
+  for (step = 0; step < NB_STEPS; ++step) {
+    const double h_f = RROSACE_H_F_EQ + (double)step;
+    const double vz_f = 0.01 * (double)step;
+    /* Commands monitored corrupted from time to time */
+    const double corruption = (step % 50 == 49) ? 1. : 0.;
+
+    if ((rrosace_fcc_com_step(p_fccs[COM_LANE], RROSACE_COMMANDED, h_f, vz_f,
+                              RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                              RROSACE_AZ_F_EQ, RROSACE_H_EQ, 2.5,
+                              RROSACE_VA_EQ, &delta_e_c[0], &delta_th_c[0],
+                              dt) == EXIT_FAILURE) ||
+        (rrosace_lane_com_step(p_lanes[COM_LANE], RROSACE_COMMANDED, h_f, vz_f,
+                               RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                               RROSACE_AZ_F_EQ, RROSACE_H_EQ, 2.5,
+                               RROSACE_VA_EQ, &delta_e_c[1], &delta_th_c[1],
+                               dt) == EXIT_FAILURE) ||
+        (delta_e_c[0] != delta_e_c[1]) || (delta_th_c[0] != delta_th_c[1])) {
+      goto out;
+    }
+
+    if ((rrosace_fcc_mon_step(
+             p_fccs[MON_LANE], RROSACE_COMMANDED, h_f, vz_f, RROSACE_VA_F_EQ,
+             RROSACE_Q_F_EQ, RROSACE_AZ_F_EQ, RROSACE_H_EQ, 2.5,
+             RROSACE_VA_EQ, delta_e_c[0] + corruption, delta_th_c[0],
+             RROSACE_NOT_MASTER_IN_LAW, &relay_delta_e_c[0],
+             &relay_delta_th_c[0], &master_in_law[0], dt) == EXIT_FAILURE) ||
+        (rrosace_lane_mon_step(
+             p_lanes[MON_LANE], RROSACE_COMMANDED, h_f, vz_f, RROSACE_VA_F_EQ,
+             RROSACE_Q_F_EQ, RROSACE_AZ_F_EQ, RROSACE_H_EQ, 2.5,
+             RROSACE_VA_EQ, delta_e_c[0] + corruption, delta_th_c[0],
+             RROSACE_NOT_MASTER_IN_LAW, &relay_delta_e_c[1],
+             &relay_delta_th_c[1], &master_in_law[1], dt) == EXIT_FAILURE) ||
+        (relay_delta_e_c[0] != relay_delta_e_c[1]) ||
+        (relay_delta_th_c[0] != relay_delta_th_c[1]) ||
+        (master_in_law[0] != master_in_law[1])) {
+      goto out;
+    }
+    nb_opened += (relay_delta_e_c[0] == RROSACE_RELAY_OPENED);
+  }
+
+  if (!nb_opened) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (i = 0; i < NB_LANES; ++i) {
+    if ((pids[i] > 0) && (stop_lane(p_lanes[i], pids[i]) == EXIT_FAILURE)) {
+      ret = EXIT_FAILURE;
+    }
+    rrosace_fcc_del(p_fccs[i]);
+    rrosace_lane_del(p_lanes[i]);
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Steps posted ahead are answered in order, and a wait for the wrong
+ * kind of step fails
+ */
+static int test_posted_func(void) {
+  int ret = EXIT_FAILURE;
+  const double dt = 1. / RROSACE_FCC_DEFAULT_FREQ;
+  rrosace_lane_t *p_lane = rrosace_lane_new();
+  rrosace_fcc_t *p_fcc = rrosace_fcc_new();
+  pid_t pid = -1;
+  double delta_e_c[2];
+  double delta_th_c[2];
+  rrosace_relay_state_t relay_delta_e_c;
+  rrosace_relay_state_t relay_delta_th_c;
+  rrosace_master_in_law_t master_in_law;
+  size_t i;
+
+  if (!p_lane || !p_fcc) {
+    goto out;
+  }
+  pid = start_lane(p_lane);
+  if (pid < 0) {
+    goto out;
+  }
+
+  for (i = 0; i < NB_POSTED; ++i) {
+    if (rrosace_lane_post_com(p_lane, RROSACE_COMMANDED,
+                              RROSACE_H_F_EQ + (double)i, RROSACE_VZ_F_EQ,
+                              RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                              RROSACE_AZ_F_EQ, RROSACE_H_EQ, 2.5,
+                              RROSACE_VA_EQ, dt) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  for (i = 0; i < NB_POSTED; ++i) {
+    if ((rrosace_fcc_com_step(p_fcc, RROSACE_COMMANDED,
+                              RROSACE_H_F_EQ + (double)i, RROSACE_VZ_F_EQ,
+                              RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                              RROSACE_AZ_F_EQ, RROSACE_H_EQ, 2.5,
+                              RROSACE_VA_EQ, &delta_e_c[0], &delta_th_c[0],
+                              dt) == EXIT_FAILURE) ||
+        (rrosace_lane_wait_com(p_lane, &delta_e_c[1], &delta_th_c[1]) ==
+         EXIT_FAILURE) ||
+        (delta_e_c[0] != delta_e_c[1]) || (delta_th_c[0] != delta_th_c[1])) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_lane_post_com(p_lane, RROSACE_COMMANDED, RROSACE_H_F_EQ,
+                             RROSACE_VZ_F_EQ, RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                             RROSACE_AZ_F_EQ, RROSACE_H_EQ, 2.5,
+                             RROSACE_VA_EQ, dt) == EXIT_FAILURE) ||
+      (rrosace_lane_wait_mon(p_lane, &relay_delta_e_c, &relay_delta_th_c,
+                             &master_in_law) != EXIT_FAILURE)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  if ((pid > 0) && (stop_lane(p_lane, pid) == EXIT_FAILURE)) {
+    ret = EXIT_FAILURE;
+  }
+  rrosace_fcc_del(p_fcc);
+  rrosace_lane_del(p_lane);
+
+  return (ret);
+}
+
+/**
+ * @brief A wait on a lane that nobody serves times out, and the late outputs
+ * of the step given up are not taken for the ones of the next step
+ */
+static int test_timeout_func(void) {
+  int ret = EXIT_FAILURE;
+  const double dt = 1. / RROSACE_FCC_DEFAULT_FREQ;
+  rrosace_lane_t *p_lane = rrosace_lane_new();
+  rrosace_fcc_t *p_fcc = rrosace_fcc_new();
+  pid_t pid = -1;
+  double delta_e_c[2];
+  double delta_th_c[2];
+
+  if (!p_lane || !p_fcc ||
+      (rrosace_lane_wait_com(p_lane, &delta_e_c[1], &delta_th_c[1]) !=
+       EXIT_FAILURE) ||
+      (rrosace_lane_post_com(p_lane, RROSACE_COMMANDED, RROSACE_H_F_EQ,
+                             RROSACE_VZ_F_EQ, RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                             RROSACE_AZ_F_EQ, RROSACE_H_EQ, 2.5, RROSACE_VA_EQ,
+                             dt) == EXIT_FAILURE) ||
+      (rrosace_lane_wait_com(p_lane, &delta_e_c[1], &delta_th_c[1]) !=
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  /* The step given up answered once the lane serves */
+  pid = start_lane(p_lane);
+  if ((pid < 0) ||
+      (rrosace_fcc_com_step(p_fcc, RROSACE_COMMANDED, RROSACE_H_F_EQ,
+                            RROSACE_VZ_F_EQ, RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                            RROSACE_AZ_F_EQ, RROSACE_H_EQ, 2.5, RROSACE_VA_EQ,
+                            &delta_e_c[0], &delta_th_c[0],
+                            dt) == EXIT_FAILURE) ||
+      (rrosace_fcc_com_step(p_fcc, RROSACE_COMMANDED, RROSACE_H_F_EQ + 100.,
+                            RROSACE_VZ_F_EQ, RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                            RROSACE_AZ_F_EQ, RROSACE_H_EQ, -2.5, RROSACE_VA_EQ,
+                            &delta_e_c[0], &delta_th_c[0],
+                            dt) == EXIT_FAILURE) ||
+      (rrosace_lane_post_com(p_lane, RROSACE_COMMANDED, RROSACE_H_F_EQ + 100.,
+                             RROSACE_VZ_F_EQ, RROSACE_VA_F_EQ, RROSACE_Q_F_EQ,
+                             RROSACE_AZ_F_EQ, RROSACE_H_EQ, -2.5,
+                             RROSACE_VA_EQ, dt) == EXIT_FAILURE) ||
+      (rrosace_lane_wait_com(p_lane, &delta_e_c[1], &delta_th_c[1]) ==
+       EXIT_FAILURE) ||
+      (delta_e_c[0] != delta_e_c[1]) || (delta_th_c[0] != delta_th_c[1])) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  if ((pid > 0) && (stop_lane(p_lane, pid) == EXIT_FAILURE)) {
+    ret = EXIT_FAILURE;
+  }
+  rrosace_fcc_del(p_fcc);
+  rrosace_lane_del(p_lane);
+
+  return (ret);
+}
+
+/**
+ * @brief A lane whose host process exits without stopping it fails, its
+ * result being sent through a pipe as it is not a child of the test
+ */
+static int test_orphaned_func(void) {
+  int ret = EXIT_FAILURE;
+  int fds[2];
+  pid_t host;
+  char result;
+
+  if (pipe(fds) == -1) {
+    goto out;
+  }
+
+  host = fork();
+  if (!host) {
+    rrosace_lane_t *p_lane = rrosace_lane_new();
+
+    if (p_lane && !fork()) {
+      rrosace_fcc_t *p_fcc = rrosace_fcc_new();
+
+      result = (char)(p_fcc ? rrosace_lane_serve(p_lane, p_fcc) : EXIT_SUCCESS);
+      if (write(fds[1], &result, 1) != 1) {
+        _exit(EXIT_FAILURE);
+      }
+      _exit(EXIT_SUCCESS);
+    }
+    _exit(EXIT_SUCCESS);
+  }
+  close(fds[1]);
+
+  if ((host > 0) && (waitpid(host, NULL, 0) == host) &&
+      (read(fds[0], &result, 1) == 1) && (result == EXIT_FAILURE)) {
+    ret = EXIT_SUCCESS;
+  }
+  close(fds[0]);
+
+out:
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_steps = {"steps", test_steps_func};
+  const test_t test_posted = {"posted", test_posted_func};
+  const test_t test_timeout = {"timeout", test_timeout_func};
+  const test_t test_orphaned = {"orphaned", test_orphaned_func};
+  const test_t *p_tests[5];
+
+  p_tests[0] = &test_steps;
+  p_tests[1] = &test_posted;
+  p_tests[2] = &test_timeout;
+  p_tests[3] = &test_orphaned;
+  p_tests[4] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
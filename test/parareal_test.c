@@ -0,0 +1,137 @@
+/**
+ * @file parareal_test.c
+ * @brief Test of Parareal module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <math.h>
+#include <rrosace_parareal.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test_common.h"
+
+#define MODULE "parareal"
+
+#define NB_SLICES (16)
+#define SLICE_DURATION (0.5)
+#define NB_FINE_STEPS (1000)
+#define NB_THREADS (4)
+
+static int euler(const double * /* state_in */, double * /* state_out */,
+                 size_t /* nb_steps */);
+
+static int fine(void * /* p_context */, size_t /* slice */,
+                const double * /* state_in */, double * /* state_out */);
+
+static int coarse(void * /* p_context */, size_t /* slice */,
+                  const double * /* state_in */, double * /* state_out */);
+
+static int test_run(double /* run_tolerance */, double /* tolerance */);
+
+static int test_converge_func(void);
+
+static int test_exact_func(void);
+
+/**
+ * @brief Forward Euler of a damped oscillator over one slice
+ */
+static int euler(const double *state_in, double *state_out, size_t nb_steps) {
+  const double dt = SLICE_DURATION / nb_steps;
+  double x = state_in[0];
+  double v = state_in[1];
+  size_t i;
+
+  for (i = 0; i < nb_steps; ++i) {
+    const double a = -4. * x - 0.5 * v;
+    x += dt * v;
+    v += dt * a;
+  }
+
+  state_out[0] = x;
+  state_out[1] = v;
+
+  return (EXIT_SUCCESS);
+}
+
+static int fine(void *p_context, size_t slice, const double *state_in,
+                double *state_out) {
+  (void)p_context;
+  (void)slice;
+  return (euler(state_in, state_out, NB_FINE_STEPS));
+}
+
+static int coarse(void *p_context, size_t slice, const double *state_in,
+                  double *state_out) {
+  (void)p_context;
+  (void)slice;
+  return (euler(state_in, state_out, 5));
+}
+
+/**
+ * @brief Compare the Parareal trajectory to the serial fine one
+ */
+static int test_run(double run_tolerance, double tolerance) {
+  int ret = EXIT_FAILURE;
+  const double state0[2] = {1., 0.};
+  double serial[2];
+  double parallel[2];
+  rrosace_parareal_t *p_parareal =
+      rrosace_parareal_new(2, NB_SLICES, fine, coarse, NULL);
+  size_t slice;
+
+  if (!p_parareal) {
+    goto out;
+  }
+
+  ret = rrosace_parareal_run(p_parareal, state0, run_tolerance, NB_SLICES,
+                             NB_THREADS, NULL);
+  if (ret == EXIT_FAILURE) {
+    goto out;
+  }
+
+  serial[0] = state0[0];
+  serial[1] = state0[1];
+
+  for (slice = 1; (slice <= NB_SLICES) && (ret == EXIT_SUCCESS); ++slice) {
+    fine(NULL, slice - 1, serial, serial);
+    rrosace_parareal_get_state(p_parareal, slice, parallel);
+    if ((fabs(parallel[0] - serial[0]) > tolerance) ||
+        (fabs(parallel[1] - serial[1]) > tolerance)) {
+      ret = EXIT_FAILURE;
+    }
+  }
+
+out:
+  rrosace_parareal_del(p_parareal);
+
+  return (ret);
+}
+
+static int test_converge_func(void) { return (test_run(1e-12, 1e-9)); }
+
+/**
+ * @brief With an unreachable tolerance, all the iterations are done and the
+ * trajectory is exactly the serial one
+ */
+static int test_exact_func(void) { return (test_run(-1., 0.)); }
+
+int main() {
+  int ret;
+
+  const test_t test_converge = {"converge", test_converge_func};
+  const test_t test_exact = {"exact", test_exact_func};
+  const test_t *p_tests[3];
+
+  p_tests[0] = &test_converge;
+  p_tests[1] = &test_exact;
+  p_tests[2] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
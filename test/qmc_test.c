@@ -0,0 +1,196 @@
+/**
+ * @file qmc_test.c
+ * @brief Test of quasi-Monte Carlo campaigns module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <math.h>
+#include <rrosace_qmc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_common.h"
+
+#define MODULE "qmc"
+
+#define SEED (42UL)
+#define NB_REPLICATES (8)
+#define NB_RUNS (8192)
+#define TOLERANCE (1e-3)
+
+static int test_stratified(rrosace_qmc_sequence_t /* sequence */,
+                           unsigned int /* base */, unsigned int /* digits */,
+                           size_t /* dimension */);
+
+static int test_sobol_func(void);
+
+static int test_halton_func(void);
+
+static int test_campaign_func(void);
+
+/**
+ * @brief The first base^digits points of a dimension fall one in each
+ * interval of width base^-digits
+ */
+static int test_stratified(rrosace_qmc_sequence_t sequence, unsigned int base,
+                           unsigned int digits, size_t dimension) {
+  int ret = EXIT_FAILURE;
+  rrosace_qmc_t *p_qmc = rrosace_qmc_new(sequence, dimension + 1, SEED);
+  double point[RROSACE_QMC_MAX_DIMENSION];
+  unsigned char *hits;
+  size_t nb_cells = 1;
+  size_t i;
+
+  for (i = 0; i < digits; ++i) {
+    nb_cells *= base;
+  }
+
+  hits = (unsigned char *)calloc(nb_cells, sizeof(unsigned char));
+  if (!p_qmc || !hits) {
+    goto out;
+  }
+
+  for (i = 0; i < nb_cells; ++i) {
+    size_t cell;
+
+    if (rrosace_qmc_next(p_qmc, point) == EXIT_FAILURE) {
+      goto out;
+    }
+    if ((point[dimension] < 0.) || (point[dimension] >= 1.)) {
+      goto out;
+    }
+    cell = (size_t)(point[dimension] * (double)nb_cells);
+    if (hits[cell]) {
+      goto out;
+    }
+    hits[cell] = 1;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  free(hits);
+  rrosace_qmc_del(p_qmc);
+
+  return (ret);
+}
+
+static int test_sobol_func(void) {
+  int ret = EXIT_SUCCESS;
+  size_t dimension;
+
+  for (dimension = 0;
+       (dimension < RROSACE_QMC_MAX_DIMENSION) && (ret == EXIT_SUCCESS);
+       ++dimension) {
+    ret = test_stratified(RROSACE_QMC_SOBOL, 2, 10, dimension);
+  }
+
+  return (ret);
+}
+
+static int test_halton_func(void) {
+  int ret = test_stratified(RROSACE_QMC_HALTON, 2, 10, 0);
+
+  if (ret == EXIT_SUCCESS) {
+    ret = test_stratified(RROSACE_QMC_HALTON, 3, 6, 1);
+  }
+  if (ret == EXIT_SUCCESS) {
+    ret = test_stratified(RROSACE_QMC_HALTON, 53, 2, 15);
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief The mean and the deviation of a uniform and of a normal parameter
+ * are estimated within their confidence intervals
+ */
+static int test_campaign_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_qmc_parameter_t parameters[2];
+  const double expected[2][2] = {{3., 0.57735026918962576},
+                                 {1., 0.5}};
+  const double tolerances[2] = {TOLERANCE, TOLERANCE};
+  rrosace_qmc_campaign_t *p_campaign;
+  double values[2];
+  size_t run;
+  size_t output;
+
+  parameters[0].name = "uniform";
+  parameters[0].distribution = RROSACE_QMC_UNIFORM;
+  parameters[0].a = 2.;
+  parameters[0].b = 4.;
+  parameters[1].name = "normal";
+  parameters[1].distribution = RROSACE_QMC_NORMAL;
+  parameters[1].a = 1.;
+  parameters[1].b = 0.5;
+
+  p_campaign = rrosace_qmc_campaign_new(RROSACE_QMC_SOBOL, parameters, 2, 2,
+                                        NB_REPLICATES, SEED);
+  if (!p_campaign || (rrosace_qmc_campaign_find(p_campaign, "normal") != 1) ||
+      (rrosace_qmc_campaign_find(p_campaign, "missing") != 2)) {
+    goto out;
+  }
+
+  /* Recording without a run drawn is refused */
+  if (rrosace_qmc_campaign_record(p_campaign, values) == EXIT_SUCCESS) {
+    goto out;
+  }
+
+  for (run = 0; run < NB_RUNS; ++run) {
+    if ((rrosace_qmc_campaign_sample(p_campaign, values) == EXIT_FAILURE) ||
+        (rrosace_qmc_campaign_record(p_campaign, values) == EXIT_FAILURE)) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_qmc_campaign_get_runs(p_campaign) != NB_RUNS) ||
+      !rrosace_qmc_campaign_converged(p_campaign, tolerances)) {
+    goto out;
+  }
+
+  for (output = 0; output < 2; ++output) {
+    double mean;
+    double deviation;
+    double half_width;
+
+    if ((rrosace_qmc_campaign_get_mean(p_campaign, output, &mean,
+                                       &half_width) == EXIT_FAILURE) ||
+        (fabs(mean - expected[output][0]) > TOLERANCE) ||
+        (rrosace_qmc_campaign_get_deviation(p_campaign, output, &deviation,
+                                            &half_width) == EXIT_FAILURE) ||
+        (fabs(deviation - expected[output][1]) > TOLERANCE)) {
+      goto out;
+    }
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_qmc_campaign_del(p_campaign);
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_sobol = {"sobol", test_sobol_func};
+  const test_t test_halton = {"halton", test_halton_func};
+  const test_t test_campaign = {"campaign", test_campaign_func};
+  const test_t *p_tests[4];
+
+  p_tests[0] = &test_sobol;
+  p_tests[1] = &test_halton;
+  p_tests[2] = &test_campaign;
+  p_tests[3] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
@@ -0,0 +1,164 @@
+/**
+ * @file relaxation_test.c
+ * @brief Test of waveform relaxation module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <rrosace_relaxation.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test_common.h"
+
+#define MODULE "relaxation"
+
+#define WINDOW_TICKS (50)
+#define NB_WINDOWS (10)
+
+/* Discrete first order plant x(k+1) = A x(k) + B u(k), output x(k) */
+#define A (0.95)
+#define B (0.1)
+/* Proportional controller u(k) = K (SETPOINT - x(k)) */
+#define K (0.5)
+#define SETPOINT (1.0)
+
+struct subsystem {
+  double committed;
+  double state;
+};
+
+static int plant_simulate(void * /* p_context */, size_t /* nb_ticks */,
+                          const double * /* inputs */, double * /* outputs */);
+
+static int controller_simulate(void * /* p_context */, size_t /* nb_ticks */,
+                               const double * /* inputs */,
+                               double * /* outputs */);
+
+static int commit(void * /* p_context */, size_t /* nb_ticks */,
+                  const double * /* outputs */);
+
+static int test_relax(size_t /* nb_threads */);
+
+static int test_serial_func(void);
+
+static int test_parallel_func(void);
+
+/**
+ * @brief Plant, the command of a tick is applied at the next one
+ */
+static int plant_simulate(void *p_context, size_t nb_ticks,
+                          const double *inputs, double *outputs) {
+  struct subsystem *p_plant = (struct subsystem *)p_context;
+  size_t tick;
+
+  /* The state holds the output and the last command of the window */
+  p_plant->state = p_plant->committed;
+
+  for (tick = 0; tick < nb_ticks; ++tick) {
+    outputs[tick] = p_plant->state;
+    p_plant->state = A * p_plant->state + B * inputs[tick];
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+static int controller_simulate(void *p_context, size_t nb_ticks,
+                               const double *inputs, double *outputs) {
+  size_t tick;
+
+  (void)p_context;
+
+  for (tick = 0; tick < nb_ticks; ++tick) {
+    outputs[tick] = K * (SETPOINT - inputs[tick]);
+  }
+
+  return (EXIT_SUCCESS);
+}
+
+static int commit(void *p_context, size_t nb_ticks, const double *outputs) {
+  struct subsystem *p_subsystem = (struct subsystem *)p_context;
+
+  (void)nb_ticks;
+  (void)outputs;
+
+  p_subsystem->committed = p_subsystem->state;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief With a null tolerance, the relaxation reproduces the serial loop
+ */
+static int test_relax(size_t nb_threads) {
+  int ret = EXIT_FAILURE;
+  struct subsystem plant = {0., 0.};
+  struct subsystem controller = {0., 0.};
+  rrosace_relaxation_partition_t partitions[RROSACE_RELAXATION_NB_PARTITIONS];
+  const double plant0 = 0.;
+  const double controller0 = 0.;
+  const double *outputs0[RROSACE_RELAXATION_NB_PARTITIONS];
+  rrosace_relaxation_t *p_relaxation;
+  double x = 0.;
+  size_t window;
+  size_t tick;
+
+  partitions[0].nb_outputs = 1;
+  partitions[0].simulate = plant_simulate;
+  partitions[0].commit = commit;
+  partitions[0].p_context = &plant;
+  partitions[1].nb_outputs = 1;
+  partitions[1].simulate = controller_simulate;
+  partitions[1].commit = commit;
+  partitions[1].p_context = &controller;
+  outputs0[0] = &plant0;
+  outputs0[1] = &controller0;
+
+  p_relaxation =
+      rrosace_relaxation_new(partitions, WINDOW_TICKS, outputs0, nb_threads);
+  if (!p_relaxation) {
+    goto out;
+  }
+
+  for (window = 0, ret = EXIT_SUCCESS;
+       (window < NB_WINDOWS) && (ret == EXIT_SUCCESS); ++window) {
+    ret = rrosace_relaxation_window(p_relaxation, 0., 2 * WINDOW_TICKS + 2,
+                                    NULL);
+  }
+
+  for (tick = 0; tick < NB_WINDOWS * WINDOW_TICKS; ++tick) {
+    x = A * x + B * K * (SETPOINT - x);
+  }
+
+  if ((ret == EXIT_FAILURE) || (plant.committed != x)) {
+    ret = EXIT_FAILURE;
+  }
+
+out:
+  rrosace_relaxation_del(p_relaxation);
+
+  return (ret);
+}
+
+static int test_serial_func(void) { return (test_relax(1)); }
+
+static int test_parallel_func(void) { return (test_relax(2)); }
+
+int main() {
+  int ret;
+
+  const test_t test_serial = {"serial", test_serial_func};
+  const test_t test_parallel = {"parallel", test_parallel_func};
+  const test_t *p_tests[3];
+
+  p_tests[0] = &test_serial;
+  p_tests[1] = &test_parallel;
+  p_tests[2] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
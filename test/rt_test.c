@@ -0,0 +1,472 @@
+/**
+ * @file rt_test.c
+ * @brief Test of real-time executor module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <rrosace_constants.h>
+#include <rrosace_rt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "test_common.h"
+
+#define MODULE "rt"
+
+#define NB_TICKS (50)
+#define PERIOD (2e-3)
+#define VZ_C (2.5)
+
+/* Budgets every step, or none, overruns */
+#define TIGHT (1e-12)
+#define LOOSE (1.0)
+
+static size_t histogram_sum(const size_t /* histogram */[]);
+
+static int test_config_func(void);
+
+static int test_paced_func(void);
+
+static int test_overrun_func(void);
+
+static void count_observer(const rrosace_sim_t * /* p_sim */,
+                           void * /* p_arg */);
+
+static int count_step(rrosace_sim_t * /* p_sim */,
+                      rrosace_sim_task_t /* task */, double /* dt */,
+                      void * /* p_arg */);
+
+static int degraded_step(rrosace_sim_t * /* p_sim */,
+                         rrosace_sim_task_t /* task */, double /* dt */,
+                         void * /* p_arg */);
+
+static int run_budget(const rrosace_rt_budget_t * /* p_budget */,
+                      rrosace_sim_t ** /* pp_sim */,
+                      rrosace_rt_stats_t * /* p_stats */,
+                      rrosace_rt_event_t /* events */[],
+                      size_t /* counts */[]);
+
+static int test_budgets_func(void);
+
+static int test_policies_func(void);
+
+static int test_events_func(void);
+
+static size_t histogram_sum(const size_t histogram[]) {
+  size_t sum = 0;
+  size_t i;
+
+  for (i = 0; i < RROSACE_RT_NB_BUCKETS; ++i) {
+    sum += histogram[i];
+  }
+
+  return (sum);
+}
+
+/**
+ * @brief Invalid configurations are refused
+ */
+static int test_config_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_rt_config_t config;
+  rrosace_rt_t *p_rt = NULL;
+
+  if ((rrosace_rt_default_config(NULL) != EXIT_FAILURE) ||
+      (rrosace_rt_default_config(&config) == EXIT_FAILURE) ||
+      (config.period != 1. / RROSACE_DEFAULT_PHYSICAL_FREQ) ||
+      rrosace_rt_new(NULL)) {
+    goto out;
+  }
+
+  config.period = 0.;
+  p_rt = rrosace_rt_new(&config);
+  if (p_rt) {
+    goto out;
+  }
+
+  rrosace_rt_default_config(&config);
+  config.spin = config.period;
+  p_rt = rrosace_rt_new(&config);
+  if (p_rt) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_rt_del(p_rt);
+
+  return (ret);
+}
+
+/**
+ * @brief The ticks run on the period, each one recorded once
+ */
+static int test_paced_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_rt_config_t config;
+  rrosace_rt_t *p_rt = NULL;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_rt_stats_t stats;
+  struct timespec start;
+  struct timespec end;
+  double elapsed;
+
+  rrosace_rt_default_config(&config);
+  config.period = PERIOD;
+  config.spin = PERIOD / 10.;
+  p_rt = rrosace_rt_new(&config);
+  if (!p_rt || !p_sim) {
+    goto out;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  if (rrosace_rt_run(p_rt, p_sim, NB_TICKS) == EXIT_FAILURE) {
+    goto out;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  elapsed = (double)(end.tv_sec - start.tv_sec) +
+            (double)(end.tv_nsec - start.tv_nsec) * 1e-9;
+
+  if ((rrosace_rt_get_stats(p_rt, &stats) == EXIT_FAILURE) ||
+      (stats.nb_ticks != NB_TICKS) ||
+      (rrosace_sim_get_logical_time(p_sim) != NB_TICKS) ||
+      (elapsed < NB_TICKS * PERIOD) || (stats.jitter_min < 0.) ||
+      (stats.jitter_min > stats.jitter_mean) ||
+      (stats.jitter_mean > stats.jitter_max) ||
+      (stats.exec_min > stats.exec_mean) ||
+      (stats.exec_mean > stats.exec_max) ||
+      (histogram_sum(stats.jitter_histogram) != NB_TICKS) ||
+      (histogram_sum(stats.exec_histogram) != NB_TICKS)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sim);
+  rrosace_rt_del(p_rt);
+
+  return (ret);
+}
+
+/**
+ * @brief Ticks longer than a period overrun, and the releases catch up
+ */
+static int test_overrun_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_rt_config_t config;
+  rrosace_rt_t *p_rt = NULL;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_rt_stats_t stats;
+
+  rrosace_rt_default_config(&config);
+  config.period = 1e-9;
+  p_rt = rrosace_rt_new(&config);
+  if (!p_rt || !p_sim ||
+      (rrosace_rt_run(p_rt, p_sim, NB_TICKS) == EXIT_FAILURE) ||
+      (rrosace_rt_get_stats(p_rt, &stats) == EXIT_FAILURE) ||
+      (stats.nb_ticks != NB_TICKS) || !stats.nb_overruns ||
+      (stats.nb_overruns > NB_TICKS)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sim);
+  rrosace_rt_del(p_rt);
+
+  return (ret);
+}
+
+static void count_observer(const rrosace_sim_t *p_sim, void *p_arg) {
+  (void)p_sim;
+  ++*(size_t *)p_arg;
+}
+
+/**
+ * @brief Count the nominal steps in the first count of the argument
+ */
+static int count_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                      double dt, void *p_arg) {
+  ++((size_t *)p_arg)[0];
+
+  return (rrosace_sim_step_task(p_sim, task, dt));
+}
+
+/**
+ * @brief Count the degraded steps in the second count of the argument
+ */
+static int degraded_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                         double dt, void *p_arg) {
+  ++((size_t *)p_arg)[1];
+
+  return (rrosace_sim_step_task(p_sim, task, dt));
+}
+
+/**
+ * @brief Run ticks right away, the flight dynamics on a budget, with a
+ * mandatory observer counting in counts[0] and an optional one in counts[1]
+ */
+static int run_budget(const rrosace_rt_budget_t *p_budget,
+                      rrosace_sim_t **pp_sim, rrosace_rt_stats_t *p_stats,
+                      rrosace_rt_event_t events[], size_t counts[]) {
+  int ret = EXIT_FAILURE;
+  rrosace_rt_config_t config;
+  rrosace_rt_t *p_rt = NULL;
+
+  *pp_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_rt_default_config(&config);
+  config.period = 1e-9;
+  config.nb_events = 2 * NB_TICKS;
+  p_rt = rrosace_rt_new(&config);
+  if (!p_rt || !*pp_sim ||
+      (rrosace_rt_set_budget(p_rt, RROSACE_SIM_TASK_FLIGHT_DYNAMICS,
+                             p_budget) == EXIT_FAILURE) ||
+      (rrosace_rt_add_observer(p_rt, count_observer, &counts[0], 0) ==
+       EXIT_FAILURE) ||
+      (rrosace_rt_add_observer(p_rt, count_observer, &counts[1], 1) ==
+       EXIT_FAILURE) ||
+      (rrosace_rt_run(p_rt, *pp_sim, NB_TICKS) == EXIT_FAILURE) ||
+      (rrosace_rt_get_stats(p_rt, p_stats) == EXIT_FAILURE) ||
+      (rrosace_rt_get_events(p_rt, 0, 2 * NB_TICKS, events) !=
+       p_stats->nb_events)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_rt_del(p_rt);
+
+  return (ret);
+}
+
+/**
+ * @brief Budgets not reached leave the run as is, and observers see each
+ * tick
+ */
+static int test_budgets_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_rt_budget_t budget;
+  rrosace_sim_t *p_sim = NULL;
+  rrosace_sim_t *p_ref =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_rt_stats_t stats;
+  rrosace_rt_event_t events[2 * NB_TICKS];
+  size_t counts[2] = {0, 0};
+
+  memset(&budget, 0, sizeof(budget));
+  budget.budget = LOOSE;
+  budget.policy = RROSACE_RT_SKIP;
+  budget.nb_recovery = 1;
+
+  if (!p_ref || (rrosace_sim_run(p_ref, NB_TICKS) == EXIT_FAILURE) ||
+      (run_budget(&budget, &p_sim, &stats, events, counts) == EXIT_FAILURE) ||
+      memcmp(rrosace_sim_get_values(p_sim), rrosace_sim_get_values(p_ref),
+             sizeof(rrosace_sim_values_t)) ||
+      stats.nb_events || (counts[0] != NB_TICKS) || (counts[1] != NB_TICKS)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_ref);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Steps always over budget skip every other release, hold the trim,
+ * stay degraded, or shed the optional observer, each action recorded
+ */
+static int test_policies_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_rt_budget_t budget;
+  rrosace_sim_t *p_sim = NULL;
+  const rrosace_sim_values_t *p_values;
+  rrosace_rt_stats_t stats;
+  rrosace_rt_event_t events[2 * NB_TICKS];
+  size_t counts[2] = {0, 0};
+  size_t steps[2] = {0, 0};
+  size_t i;
+
+  memset(&budget, 0, sizeof(budget));
+  budget.budget = TIGHT;
+  budget.policy = RROSACE_RT_SKIP;
+  budget.nb_recovery = 1;
+  if ((run_budget(&budget, &p_sim, &stats, events, counts) == EXIT_FAILURE) ||
+      (stats.nb_task_overruns[RROSACE_SIM_TASK_FLIGHT_DYNAMICS] !=
+       NB_TICKS / 2) ||
+      (stats.nb_events != NB_TICKS)) {
+    goto out;
+  }
+  for (i = 0; i < NB_TICKS; ++i) {
+    if ((events[i].tick != i) ||
+        (events[i].task != RROSACE_SIM_TASK_FLIGHT_DYNAMICS) ||
+        (events[i].kind !=
+         ((i % 2) ? RROSACE_RT_EVENT_SKIPPED : RROSACE_RT_EVENT_OVERRUN))) {
+      goto out;
+    }
+  }
+  rrosace_sim_del(p_sim);
+
+  budget.policy = RROSACE_RT_HOLD;
+  if ((run_budget(&budget, &p_sim, &stats, events, counts) == EXIT_FAILURE) ||
+      (stats.nb_task_overruns[RROSACE_SIM_TASK_FLIGHT_DYNAMICS] != NB_TICKS) ||
+      (events[1].kind != RROSACE_RT_EVENT_HELD)) {
+    goto out;
+  }
+  p_values = rrosace_sim_get_values(p_sim);
+  if ((p_values->h != RROSACE_H_EQ) || (p_values->va != RROSACE_VA_EQ)) {
+    goto out;
+  }
+  rrosace_sim_del(p_sim);
+
+  budget.policy = RROSACE_RT_DEGRADE;
+  budget.step = count_step;
+  budget.degraded = degraded_step;
+  budget.p_arg = steps;
+  if ((run_budget(&budget, &p_sim, &stats, events, counts) == EXIT_FAILURE) ||
+      (steps[0] != 1) || (steps[1] != NB_TICKS - 1) ||
+      (events[1].kind != RROSACE_RT_EVENT_DEGRADED) ||
+      (events[2].kind != RROSACE_RT_EVENT_OVERRUN)) {
+    goto out;
+  }
+  rrosace_sim_del(p_sim);
+
+  counts[0] = counts[1] = 0;
+  budget.policy = RROSACE_RT_SHED;
+  budget.step = NULL;
+  if ((run_budget(&budget, &p_sim, &stats, events, counts) == EXIT_FAILURE) ||
+      (counts[0] != NB_TICKS) || counts[1] ||
+      (events[1].kind != RROSACE_RT_EVENT_SHED)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief The oldest events are overwritten, and invalid budgets, observers
+ * and semantics are refused
+ */
+static int test_events_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_rt_config_t config;
+  rrosace_rt_budget_t budget;
+  rrosace_rt_t *p_rt = NULL;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_let =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_rt_event_t events[8];
+  size_t count = 0;
+  size_t i;
+
+  rrosace_rt_default_config(&config);
+  config.period = 1e-9;
+  config.nb_events = 4;
+  memset(&budget, 0, sizeof(budget));
+  budget.budget = TIGHT;
+  budget.policy = RROSACE_RT_SKIP;
+  budget.nb_recovery = 1;
+  p_rt = rrosace_rt_new(&config);
+  if (!p_rt || !p_sim || !p_let ||
+      (rrosace_rt_set_budget(p_rt, RROSACE_SIM_TASK_FLIGHT_DYNAMICS,
+                             &budget) == EXIT_FAILURE) ||
+      (rrosace_rt_run(p_rt, p_sim, NB_TICKS) == EXIT_FAILURE) ||
+      rrosace_rt_get_events(p_rt, 0, 8, events) ||
+      rrosace_rt_get_events(p_rt, NB_TICKS, 8, events) ||
+      (rrosace_rt_get_events(p_rt, NB_TICKS - 4, 8, events) != 4)) {
+    goto out;
+  }
+  for (i = 0; i < 4; ++i) {
+    if (events[i].tick != NB_TICKS - 4 + i) {
+      goto out;
+    }
+  }
+
+  budget.budget = 0.;
+  if (rrosace_rt_set_budget(p_rt, RROSACE_SIM_TASK_FCU, &budget) !=
+      EXIT_FAILURE) {
+    goto out;
+  }
+  budget.budget = TIGHT;
+  budget.policy = RROSACE_RT_DEGRADE;
+  if ((rrosace_rt_set_budget(p_rt, RROSACE_SIM_TASK_FCU, &budget) !=
+       EXIT_FAILURE) ||
+      (rrosace_rt_set_budget(p_rt, RROSACE_SIM_NB_TASKS, NULL) !=
+       EXIT_FAILURE) ||
+      (rrosace_rt_add_observer(p_rt, NULL, NULL, 0) != EXIT_FAILURE)) {
+    goto out;
+  }
+  for (i = 0; i < RROSACE_RT_MAX_OBSERVERS; ++i) {
+    if (rrosace_rt_add_observer(p_rt, count_observer, &count, 1) ==
+        EXIT_FAILURE) {
+      goto out;
+    }
+  }
+  if ((rrosace_rt_add_observer(p_rt, count_observer, &count, 1) !=
+       EXIT_FAILURE) ||
+      (rrosace_sim_set_semantics(p_let, RROSACE_SIM_LET) == EXIT_FAILURE) ||
+      (rrosace_rt_run(p_rt, p_let, 1) != EXIT_FAILURE) ||
+      (rrosace_rt_set_budget(p_rt, RROSACE_SIM_TASK_FLIGHT_DYNAMICS, NULL) ==
+       EXIT_FAILURE) ||
+      (rrosace_rt_run(p_rt, p_let, 1) == EXIT_FAILURE) ||
+      (count != RROSACE_RT_MAX_OBSERVERS)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_let);
+  rrosace_sim_del(p_sim);
+  rrosace_rt_del(p_rt);
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_config = {"config", test_config_func};
+  const test_t test_paced = {"paced", test_paced_func};
+  const test_t test_overrun = {"overrun", test_overrun_func};
+  const test_t test_budgets = {"budgets", test_budgets_func};
+  const test_t test_policies = {"policies", test_policies_func};
+  const test_t test_events = {"events", test_events_func};
+  const test_t *p_tests[7];
+
+  p_tests[0] = &test_config;
+  p_tests[1] = &test_paced;
+  p_tests[2] = &test_overrun;
+  p_tests[3] = &test_budgets;
+  p_tests[4] = &test_policies;
+  p_tests[5] = &test_events;
+  p_tests[6] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
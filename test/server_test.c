@@ -0,0 +1,288 @@
+/**
+ * @file server_test.c
+ * @brief Test of job server module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <rrosace_constants.h>
+#include <rrosace_server.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_common.h"
+
+#define MODULE "server"
+
+#define NB_JOBS (10)
+#define NB_TICKS (200)
+#define STRIDE (50)
+#define NB_WORKERS (2)
+#define VZ_C (2.5)
+
+/* Samples and end of the jobs, each written by a single worker at a time */
+struct record {
+  size_t nb_samples;
+  double h;
+  size_t end;
+  int ended;
+};
+
+struct records {
+  struct record records[NB_JOBS];
+  /* Ids in end order */
+  unsigned long ends[NB_JOBS];
+  size_t nb_ends;
+  /* Gate holding the worker, entered then released */
+  int entered;
+  int released;
+  /* Tick cancelling the jobs, 0 for none */
+  size_t cancel;
+};
+
+static int sink_func(void * /* p_sink */,
+                     const rrosace_server_job_t * /* p_job */,
+                     size_t /* tick */,
+                     const rrosace_sim_values_t * /* p_values */);
+
+static int gate_func(void * /* p_sink */,
+                     const rrosace_server_job_t * /* p_job */,
+                     size_t /* tick */,
+                     const rrosace_sim_values_t * /* p_values */);
+
+static int test_results_func(void);
+
+static int test_priorities_func(void);
+
+static int test_cancel_func(void);
+
+static int sink_func(void *p_sink, const rrosace_server_job_t *p_job,
+                     size_t tick, const rrosace_sim_values_t *p_values) {
+  struct records *p_records = (struct records *)p_sink;
+  struct record *p_record = &p_records->records[p_job->id];
+
+  if (!p_values) {
+    p_record->end = tick;
+    p_record->ended = 1;
+    p_records->ends[__atomic_fetch_add(&p_records->nb_ends, 1,
+                                       __ATOMIC_SEQ_CST)] = p_job->id;
+    return (EXIT_SUCCESS);
+  }
+
+  ++p_record->nb_samples;
+  p_record->h = p_values->h;
+
+  return ((p_records->cancel && (tick >= p_records->cancel)) ? EXIT_FAILURE
+                                                              : EXIT_SUCCESS);
+}
+
+/**
+ * @brief Sink holding the worker until released
+ */
+static int gate_func(void *p_sink, const rrosace_server_job_t *p_job,
+                     size_t tick, const rrosace_sim_values_t *p_values) {
+  struct records *p_records = (struct records *)p_sink;
+
+  if (p_values) {
+    __atomic_store_n(&p_records->entered, 1, __ATOMIC_SEQ_CST);
+    while (!__atomic_load_n(&p_records->released, __ATOMIC_SEQ_CST)) {
+      sched_yield();
+    }
+  }
+
+  return (sink_func(p_sink, p_job, tick, p_values));
+}
+
+/**
+ * @brief Jobs give the samples of a simulation run from the initial state
+ */
+static int test_results_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_server_t *p_server = NULL;
+  rrosace_sim_t *p_sequential = NULL;
+  struct records records;
+  rrosace_server_job_t job;
+  size_t i;
+
+  memset(&records, 0, sizeof(records));
+
+  if (!p_sim || rrosace_server_new(p_sim, 0) ||
+      rrosace_server_new(p_sim, RROSACE_SERVER_MAX_WORKERS + 1)) {
+    goto out;
+  }
+
+  p_server = rrosace_server_new(p_sim, NB_WORKERS);
+  if (!p_server) {
+    goto out;
+  }
+
+  for (i = 0; i < NB_JOBS; ++i) {
+    job.id = i;
+    job.priority = 0;
+    job.h_c = RROSACE_H_EQ;
+    job.vz_c = VZ_C - 0.5 * (double)i;
+    job.va_c = RROSACE_VA_EQ;
+    job.nb_ticks = NB_TICKS;
+    job.stride = (i % 2) ? STRIDE : 0;
+    if (rrosace_server_submit(p_server, &job, sink_func, &records) ==
+        EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_server_wait(p_server) == EXIT_FAILURE) ||
+      (rrosace_server_get_nb_done(p_server) != NB_JOBS) ||
+      (records.nb_ends != NB_JOBS)) {
+    goto out;
+  }
+
+  for (i = 0; i < NB_JOBS; ++i) {
+    p_sequential = rrosace_sim_copy(p_sim);
+    if (!p_sequential ||
+        (rrosace_sim_set_commands(p_sequential, RROSACE_H_EQ,
+                                  VZ_C - 0.5 * (double)i,
+                                  RROSACE_VA_EQ) == EXIT_FAILURE) ||
+        (rrosace_sim_run(p_sequential, NB_TICKS) == EXIT_FAILURE) ||
+        !records.records[i].ended || (records.records[i].end != NB_TICKS) ||
+        (records.records[i].nb_samples !=
+         ((i % 2) ? NB_TICKS / STRIDE : 1)) ||
+        (records.records[i].h != rrosace_sim_get_values(p_sequential)->h)) {
+      goto out;
+    }
+    rrosace_sim_del(p_sequential);
+    p_sequential = NULL;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sequential);
+  rrosace_server_del(p_server);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Queued jobs run by priority, then submission order
+ */
+static int test_priorities_func(void) {
+  int ret = EXIT_FAILURE;
+  const int priorities[5] = {0, 0, 2, 1, 2};
+  const unsigned long expected[5] = {0, 2, 4, 3, 1};
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_server_t *p_server = p_sim ? rrosace_server_new(p_sim, 1) : NULL;
+  struct records records;
+  rrosace_server_job_t job;
+  size_t i;
+
+  memset(&records, 0, sizeof(records));
+
+  if (!p_server) {
+    goto out;
+  }
+
+  for (i = 0; i < 5; ++i) {
+    job.id = i;
+    job.priority = priorities[i];
+    job.h_c = RROSACE_H_EQ;
+    job.vz_c = VZ_C;
+    job.va_c = RROSACE_VA_EQ;
+    job.nb_ticks = STRIDE;
+    job.stride = 0;
+    if (rrosace_server_submit(p_server, &job, i ? sink_func : gate_func,
+                              &records) == EXIT_FAILURE) {
+      goto out;
+    }
+    /* The single worker held by the first job */
+    while (!i && !__atomic_load_n(&records.entered, __ATOMIC_SEQ_CST)) {
+      sched_yield();
+    }
+  }
+  __atomic_store_n(&records.released, 1, __ATOMIC_SEQ_CST);
+
+  if ((rrosace_server_wait(p_server) == EXIT_FAILURE) ||
+      (records.nb_ends != 5) ||
+      memcmp(records.ends, expected, sizeof(expected))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_server_del(p_server);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief A sink cancels its job, ended at the tick it stopped
+ */
+static int test_cancel_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_server_t *p_server =
+      p_sim ? rrosace_server_new(p_sim, NB_WORKERS) : NULL;
+  struct records records;
+  rrosace_server_job_t job;
+
+  memset(&records, 0, sizeof(records));
+  records.cancel = 2 * STRIDE;
+
+  job.id = 0;
+  job.priority = 0;
+  job.h_c = RROSACE_H_EQ;
+  job.vz_c = VZ_C;
+  job.va_c = RROSACE_VA_EQ;
+  job.nb_ticks = NB_TICKS;
+  job.stride = STRIDE;
+
+  if (!p_server ||
+      (rrosace_server_submit(p_server, &job, sink_func, &records) ==
+       EXIT_FAILURE) ||
+      (rrosace_server_wait(p_server) == EXIT_FAILURE) ||
+      (rrosace_server_get_nb_done(p_server) != 0) ||
+      !records.records[0].ended ||
+      (records.records[0].end != 2 * STRIDE) ||
+      (records.records[0].nb_samples != 2)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_server_del(p_server);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_results = {"results", test_results_func};
+  const test_t test_priorities = {"priorities", test_priorities_func};
+  const test_t test_cancel = {"cancel", test_cancel_func};
+  const test_t *p_tests[4];
+
+  p_tests[0] = &test_results;
+  p_tests[1] = &test_priorities;
+  p_tests[2] = &test_cancel;
+  p_tests[3] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
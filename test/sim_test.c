@@ -0,0 +1,810 @@
+/**
+ * @file sim_test.c
+ * @brief Test of simulation runtime module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <rrosace_constants.h>
+#include <rrosace_sim.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_common.h"
+
+#define MODULE "sim"
+
+#define NB_TICKS (2000)
+#define VZ_C (2.5)
+
+static int same_values(const rrosace_sim_values_t * /* p_a */,
+                       const rrosace_sim_values_t * /* p_b */);
+
+static int test_trim_func(void);
+
+static int test_interleaved_func(void);
+
+static int test_copy_func(void);
+
+static int test_let_func(void);
+
+static int test_let_copy_func(void);
+
+static int test_rate_groups_func(void);
+
+static int test_ordered_func(void);
+
+static int test_state_func(void);
+
+static int count_step(rrosace_sim_t * /* p_sim */,
+                      rrosace_sim_task_t /* task */, double /* dt */,
+                      void * /* p_arg */);
+
+static int test_delegated_func(void);
+
+static int future(rrosace_sim_t * /* p_sim */, size_t /* branch */,
+                  void * /* p_arg */, double /* results */[]);
+
+static int test_branch_func(void);
+
+static int test_team_func(void);
+
+static int test_discrete_func(void);
+
+static int test_parameters_func(void);
+
+static int same_values(const rrosace_sim_values_t *p_a,
+                       const rrosace_sim_values_t *p_b) {
+  return ((p_a->mode == p_b->mode) && (p_a->delta_e == p_b->delta_e) &&
+          (p_a->t == p_b->t) && (p_a->h == p_b->h) && (p_a->vz == p_b->vz) &&
+          (p_a->va == p_b->va) && (p_a->q == p_b->q) && (p_a->az == p_b->az) &&
+          (p_a->h_f == p_b->h_f) && (p_a->vz_f == p_b->vz_f) &&
+          (p_a->delta_e_c == p_b->delta_e_c) &&
+          (p_a->delta_th_c == p_b->delta_th_c));
+}
+
+/**
+ * @brief A simulation at trim without a vertical speed command stays at trim
+ */
+static int test_trim_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, 0., RROSACE_VA_EQ);
+  const rrosace_sim_values_t *p_values = rrosace_sim_get_values(p_sim);
+
+  if (!p_sim || (rrosace_sim_run(p_sim, 0) == EXIT_FAILURE) ||
+      (rrosace_sim_get_logical_time(p_sim) != 0) ||
+      (rrosace_sim_run(p_sim, NB_TICKS) == EXIT_FAILURE) ||
+      (rrosace_sim_get_logical_time(p_sim) != NB_TICKS) ||
+      (rrosace_sim_get_time(p_sim) !=
+       (double)NB_TICKS / RROSACE_DEFAULT_PHYSICAL_FREQ)) {
+    goto out;
+  }
+
+  if ((p_values->h < RROSACE_H_EQ - 1.) || (p_values->h > RROSACE_H_EQ + 1.) ||
+      (p_values->va < RROSACE_VA_EQ - 0.1) ||
+      (p_values->va > RROSACE_VA_EQ + 0.1)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Two simulations run tick by tick in turn reach the same values as
+ * one run alone
+ */
+static int test_interleaved_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_alone =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_first =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_second =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, -VZ_C, RROSACE_VA_EQ);
+  size_t tick;
+
+  if (!p_alone || !p_first || !p_second ||
+      (rrosace_sim_run(p_alone, NB_TICKS) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (tick = 0; tick < NB_TICKS; ++tick) {
+    if ((rrosace_sim_run(p_first, 1) == EXIT_FAILURE) ||
+        (rrosace_sim_run(p_second, 1) == EXIT_FAILURE)) {
+      goto out;
+    }
+  }
+
+  if (!same_values(rrosace_sim_get_values(p_alone),
+                   rrosace_sim_get_values(p_first)) ||
+      same_values(rrosace_sim_get_values(p_alone),
+                  rrosace_sim_get_values(p_second))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_alone);
+  rrosace_sim_del(p_first);
+  rrosace_sim_del(p_second);
+
+  return (ret);
+}
+
+/**
+ * @brief A copy taken on a tick not multiple of the hyperperiod goes on as
+ * the original
+ */
+static int test_copy_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_copy = NULL;
+
+  if (!p_sim || (rrosace_sim_run(p_sim, NB_TICKS / 2 + 1) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  p_copy = rrosace_sim_copy(p_sim);
+  if (!p_copy || (rrosace_sim_get_logical_time(p_copy) != NB_TICKS / 2 + 1) ||
+      (rrosace_sim_run(p_sim, NB_TICKS / 2) == EXIT_FAILURE) ||
+      (rrosace_sim_run(p_copy, NB_TICKS / 2) == EXIT_FAILURE) ||
+      !same_values(rrosace_sim_get_values(p_sim),
+                   rrosace_sim_get_values(p_copy))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_copy);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief The concurrent LET semantics gives the serial LET values, close to
+ * the immediate ones, and cannot be set once running
+ */
+static int test_let_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_immediate =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_let =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_concurrent =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  const rrosace_sim_values_t *p_values;
+  size_t tick;
+
+  if (!p_immediate || !p_let || !p_concurrent ||
+      (rrosace_sim_get_semantics(p_immediate) != RROSACE_SIM_IMMEDIATE) ||
+      (rrosace_sim_set_semantics(p_let, RROSACE_SIM_LET) == EXIT_FAILURE) ||
+      (rrosace_sim_set_semantics(p_concurrent, RROSACE_SIM_LET_CONCURRENT) ==
+       EXIT_FAILURE) ||
+      (rrosace_sim_get_semantics(p_concurrent) !=
+       RROSACE_SIM_LET_CONCURRENT)) {
+    goto out;
+  }
+
+  for (tick = 0; tick < NB_TICKS; ++tick) {
+    if ((rrosace_sim_run(p_let, 1) == EXIT_FAILURE) ||
+        (rrosace_sim_run(p_concurrent, 1) == EXIT_FAILURE) ||
+        !same_values(rrosace_sim_get_values(p_let),
+                     rrosace_sim_get_values(p_concurrent))) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_sim_run(p_immediate, NB_TICKS) == EXIT_FAILURE) ||
+      (rrosace_sim_set_semantics(p_let, RROSACE_SIM_IMMEDIATE) !=
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  p_values = rrosace_sim_get_values(p_immediate);
+  if ((rrosace_sim_get_values(p_let)->h < p_values->h - 1.) ||
+      (rrosace_sim_get_values(p_let)->h > p_values->h + 1.)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_concurrent);
+  rrosace_sim_del(p_let);
+  rrosace_sim_del(p_immediate);
+
+  return (ret);
+}
+
+/**
+ * @brief A copy of a concurrent LET simulation with jobs in flight goes on as
+ * the original
+ */
+static int test_let_copy_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_copy = NULL;
+
+  if (!p_sim ||
+      (rrosace_sim_set_semantics(p_sim, RROSACE_SIM_LET_CONCURRENT) ==
+       EXIT_FAILURE) ||
+      (rrosace_sim_run(p_sim, NB_TICKS / 2 + 1) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  p_copy = rrosace_sim_copy(p_sim);
+  if (!p_copy ||
+      (rrosace_sim_get_semantics(p_copy) != RROSACE_SIM_LET_CONCURRENT) ||
+      (rrosace_sim_run(p_sim, NB_TICKS / 2) == EXIT_FAILURE) ||
+      (rrosace_sim_run(p_copy, NB_TICKS / 2) == EXIT_FAILURE) ||
+      !same_values(rrosace_sim_get_values(p_sim),
+                   rrosace_sim_get_values(p_copy))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_copy);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief Rate groups, run by uneven numbers of ticks and copied mid-run, give
+ * the serial LET values
+ */
+static int test_rate_groups_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_let =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_groups =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_copy = NULL;
+  size_t n_ticks;
+
+  if (!p_let || !p_groups ||
+      (rrosace_sim_set_semantics(p_let, RROSACE_SIM_LET) == EXIT_FAILURE) ||
+      (rrosace_sim_set_semantics(p_groups, RROSACE_SIM_LET_RATE_GROUPS) ==
+       EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (n_ticks = 0; rrosace_sim_get_logical_time(p_let) < NB_TICKS;
+       n_ticks = (n_ticks + 1) % 7) {
+    if ((rrosace_sim_run(p_let, n_ticks) == EXIT_FAILURE) ||
+        (rrosace_sim_run(p_groups, n_ticks) == EXIT_FAILURE) ||
+        (rrosace_sim_get_logical_time(p_groups) !=
+         rrosace_sim_get_logical_time(p_let)) ||
+        !same_values(rrosace_sim_get_values(p_let),
+                     rrosace_sim_get_values(p_groups))) {
+      goto out;
+    }
+  }
+
+  p_copy = rrosace_sim_copy(p_groups);
+  if (!p_copy ||
+      (rrosace_sim_get_semantics(p_copy) != RROSACE_SIM_LET_RATE_GROUPS) ||
+      (rrosace_sim_run(p_let, NB_TICKS / 2 + 1) == EXIT_FAILURE) ||
+      (rrosace_sim_run(p_copy, NB_TICKS / 2 + 1) == EXIT_FAILURE) ||
+      !same_values(rrosace_sim_get_values(p_let),
+                   rrosace_sim_get_values(p_copy))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_copy);
+  rrosace_sim_del(p_groups);
+  rrosace_sim_del(p_let);
+
+  return (ret);
+}
+
+/**
+ * @brief The tick order gives the run states, an order moving the cables
+ * before the FCCs other ones, and orders not permuting the tasks are rejected
+ */
+static int test_ordered_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sims[3] = {NULL, NULL, NULL};
+  double states[3][RROSACE_SIM_STATE_SIZE];
+  rrosace_sim_task_t order[RROSACE_SIM_NB_TASKS];
+  size_t tick;
+  size_t i;
+
+  for (i = 0; i < 3; ++i) {
+    p_sims[i] =
+        rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+    if (!p_sims[i]) {
+      goto out;
+    }
+  }
+
+  for (i = 0; i < RROSACE_SIM_NB_TASKS; ++i) {
+    order[i] = (rrosace_sim_task_t)i;
+  }
+  order[0] = RROSACE_SIM_TASK_CABLES;
+  if (rrosace_sim_run_ordered(p_sims[0], order) != EXIT_FAILURE) {
+    goto out;
+  }
+  order[0] = RROSACE_SIM_TASK_ELEVATOR;
+
+  for (tick = 0; tick < NB_TICKS; ++tick) {
+    if (rrosace_sim_run_ordered(p_sims[1], order) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  order[RROSACE_SIM_TASK_FCCS_COM] = RROSACE_SIM_TASK_CABLES;
+  order[RROSACE_SIM_TASK_FCCS_MON] = RROSACE_SIM_TASK_FCCS_COM;
+  order[RROSACE_SIM_TASK_CABLES] = RROSACE_SIM_TASK_FCCS_MON;
+  for (tick = 0; tick < NB_TICKS; ++tick) {
+    if (rrosace_sim_run_ordered(p_sims[2], order) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_sim_run(p_sims[0], NB_TICKS) == EXIT_FAILURE) ||
+      (rrosace_sim_get_logical_time(p_sims[1]) != NB_TICKS)) {
+    goto out;
+  }
+  for (i = 0; i < 3; ++i) {
+    if (rrosace_sim_get_state(p_sims[i], states[i]) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+  if (memcmp(states[0], states[1], sizeof(states[0])) ||
+      !memcmp(states[0], states[2], sizeof(states[0]))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (i = 0; i < 3; ++i) {
+    rrosace_sim_del(p_sims[i]);
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief A simulation set to the state of another one runs alike, from the
+ * phase of the state
+ */
+static int test_state_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sims[2] = {NULL, NULL};
+  double states[2][RROSACE_SIM_STATE_SIZE];
+  size_t i;
+
+  for (i = 0; i < 2; ++i) {
+    p_sims[i] =
+        rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+    if (!p_sims[i]) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_sim_run(p_sims[0], NB_TICKS / 2 + 1) == EXIT_FAILURE) ||
+      (rrosace_sim_get_state(p_sims[0], states[0]) == EXIT_FAILURE) ||
+      (rrosace_sim_set_state(p_sims[1], states[0]) == EXIT_FAILURE) ||
+      (rrosace_sim_get_logical_time(p_sims[1]) !=
+       (size_t)states[0][RROSACE_SIM_VALUES_SIZE - 1])) {
+    goto out;
+  }
+
+  for (i = 0; i < 2; ++i) {
+    if ((rrosace_sim_run(p_sims[i], NB_TICKS / 2) == EXIT_FAILURE) ||
+        (rrosace_sim_get_state(p_sims[i], states[i]) == EXIT_FAILURE)) {
+      goto out;
+    }
+  }
+  if (memcmp(states[0], states[1], sizeof(states[0]))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (i = 0; i < 2; ++i) {
+    rrosace_sim_del(p_sims[i]);
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Count the releases of the tasks, stepping them
+ */
+static int count_step(rrosace_sim_t *p_sim, rrosace_sim_task_t task,
+                      double dt, void *p_arg) {
+  ++((size_t *)p_arg)[task];
+
+  return (rrosace_sim_step_task(p_sim, task, dt));
+}
+
+/**
+ * @brief Ticks delegating the steps run as the others, each task released
+ * on its period, and values set are the ones got
+ */
+static int test_delegated_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sims[2] = {NULL, NULL};
+  double states[2][RROSACE_SIM_STATE_SIZE];
+  size_t counts[RROSACE_SIM_NB_TASKS];
+  size_t tick;
+  size_t i;
+
+  for (i = 0; i < 2; ++i) {
+    p_sims[i] =
+        rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+    if (!p_sims[i]) {
+      goto out;
+    }
+  }
+  memset(counts, 0, sizeof(counts));
+
+  if ((rrosace_sim_run_delegated(p_sims[0], NULL, counts) != EXIT_FAILURE) ||
+      (rrosace_sim_set_values(p_sims[0], NULL) != EXIT_FAILURE)) {
+    goto out;
+  }
+
+  for (tick = 0; tick < NB_TICKS; ++tick) {
+    if (rrosace_sim_run_delegated(p_sims[1], count_step, counts) ==
+        EXIT_FAILURE) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_sim_run(p_sims[0], NB_TICKS) == EXIT_FAILURE) ||
+      (rrosace_sim_get_logical_time(p_sims[1]) != NB_TICKS)) {
+    goto out;
+  }
+  for (i = 0; i < 2; ++i) {
+    if (rrosace_sim_get_state(p_sims[i], states[i]) == EXIT_FAILURE) {
+      goto out;
+    }
+  }
+  if (memcmp(states[0], states[1], sizeof(states[0]))) {
+    goto out;
+  }
+
+  for (i = 0; i < RROSACE_SIM_NB_TASKS; ++i) {
+    const size_t period =
+        rrosace_sim_get_task_period(p_sims[1], (rrosace_sim_task_t)i);
+
+    if (!period || (counts[i] != (NB_TICKS + period - 1) / period)) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_sim_run(p_sims[0], 1) == EXIT_FAILURE) ||
+      (rrosace_sim_set_values(p_sims[1], rrosace_sim_get_values(p_sims[0])) ==
+       EXIT_FAILURE) ||
+      !same_values(rrosace_sim_get_values(p_sims[0]),
+                   rrosace_sim_get_values(p_sims[1]))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (i = 0; i < 2; ++i) {
+    rrosace_sim_del(p_sims[i]);
+  }
+
+  return (ret);
+}
+
+/**
+ * @brief Climb to an altitude of the branch, the last one failing
+ */
+static int future(rrosace_sim_t *p_sim, size_t branch, void *p_arg,
+                  double results[]) {
+  const size_t nb_branches = *(const size_t *)p_arg;
+
+  if ((branch == nb_branches - 1) ||
+      (rrosace_sim_set_commands(p_sim, RROSACE_H_EQ + 10. * (double)branch,
+                                VZ_C, RROSACE_VA_EQ) == EXIT_FAILURE) ||
+      (rrosace_sim_run(p_sim, NB_TICKS) == EXIT_FAILURE)) {
+    return (EXIT_FAILURE);
+  }
+
+  results[0] = rrosace_sim_get_values(p_sim)->h;
+  results[1] = (double)rrosace_sim_get_logical_time(p_sim);
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Branches run as copies of the simulation do, leaving it as is, and
+ * a branch failing fails the branching
+ */
+static int test_branch_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_copy = NULL;
+  double results[4][2];
+  double copy_results[2];
+  size_t nb_branches = 4;
+  size_t branch;
+
+  if (!p_sim || (rrosace_sim_run(p_sim, NB_TICKS / 2) == EXIT_FAILURE) ||
+      (rrosace_sim_branch(p_sim, nb_branches, 2, future, &nb_branches, 2,
+                          &results[0][0]) != EXIT_FAILURE) ||
+      (rrosace_sim_get_logical_time(p_sim) != NB_TICKS / 2) ||
+      (rrosace_sim_branch(p_sim, 0, 2, future, &nb_branches, 2,
+                          &results[0][0]) != EXIT_FAILURE) ||
+      (rrosace_sim_branch(p_sim, 1, 0, future, &nb_branches, 2,
+                          &results[0][0]) != EXIT_FAILURE)) {
+    goto out;
+  }
+
+  ++nb_branches;
+  if (rrosace_sim_branch(p_sim, nb_branches - 1, 2, future, &nb_branches, 2,
+                         &results[0][0]) == EXIT_FAILURE) {
+    goto out;
+  }
+
+  for (branch = 0; branch < nb_branches - 1; ++branch) {
+    p_copy = rrosace_sim_copy(p_sim);
+    if (!p_copy ||
+        (future(p_copy, branch, &nb_branches, copy_results) == EXIT_FAILURE) ||
+        memcmp(results[branch], copy_results, sizeof(copy_results)) ||
+        (results[branch][1] != 3 * NB_TICKS / 2)) {
+      goto out;
+    }
+    rrosace_sim_del(p_copy);
+    p_copy = NULL;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_copy);
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+/**
+ * @brief A team runs the states of the serial ticks, is tuned without
+ * disturbing them, and is left to the parent of the branches
+ */
+static int test_team_func(void) {
+  int ret = EXIT_FAILURE;
+  const unsigned int stages = RROSACE_SIM_STAGE(RROSACE_SIM_STAGE_FILTERS) |
+                              RROSACE_SIM_STAGE(RROSACE_SIM_STAGE_FCCS);
+  rrosace_sim_t *p_serial =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_team =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_let =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  rrosace_sim_t *p_copy = NULL;
+  rrosace_sim_team_costs_t costs;
+  double states[2][RROSACE_SIM_STATE_SIZE];
+  double results[2];
+  double copy_results[2];
+  size_t nb_branches = 2;
+  size_t n_ticks;
+  size_t stage;
+
+  if (!p_serial || !p_team || !p_let ||
+      (rrosace_sim_set_semantics(p_let, RROSACE_SIM_LET) == EXIT_FAILURE) ||
+      (rrosace_sim_set_team(p_let, 1, stages) != EXIT_FAILURE) ||
+      (rrosace_sim_set_team(p_team, RROSACE_SIM_MAX_TEAM_THREADS + 1,
+                            stages) != EXIT_FAILURE) ||
+      (rrosace_sim_set_team(p_team, 1,
+                            RROSACE_SIM_STAGE(RROSACE_SIM_NB_STAGES)) !=
+       EXIT_FAILURE) ||
+      (rrosace_sim_tune_team(p_team, 1, NULL) != EXIT_FAILURE) ||
+      (rrosace_sim_set_team(p_team, 2, stages) == EXIT_FAILURE) ||
+      (rrosace_sim_get_team_stages(p_team) != stages)) {
+    goto out;
+  }
+
+  for (n_ticks = 0; rrosace_sim_get_logical_time(p_serial) < NB_TICKS;
+       n_ticks = (n_ticks + 1) % 7) {
+    if ((rrosace_sim_run(p_serial, n_ticks) == EXIT_FAILURE) ||
+        (rrosace_sim_run(p_team, n_ticks) == EXIT_FAILURE) ||
+        (rrosace_sim_get_state(p_serial, states[0]) == EXIT_FAILURE) ||
+        (rrosace_sim_get_state(p_team, states[1]) == EXIT_FAILURE) ||
+        memcmp(states[0], states[1], sizeof(states[0]))) {
+      goto out;
+    }
+  }
+
+  if ((rrosace_sim_tune_team(p_team, 100, &costs) == EXIT_FAILURE) ||
+      (rrosace_sim_get_state(p_team, states[1]) == EXIT_FAILURE) ||
+      memcmp(states[0], states[1], sizeof(states[0])) ||
+      (rrosace_sim_get_logical_time(p_team) !=
+       rrosace_sim_get_logical_time(p_serial))) {
+    goto out;
+  }
+  for (stage = 0; stage < RROSACE_SIM_NB_STAGES; ++stage) {
+    if ((costs.fork_join <= 0.) || (costs.break_even[stage] <= 0.) ||
+        (!(rrosace_sim_get_team_stages(p_team) & RROSACE_SIM_STAGE(stage)) !=
+         !(costs.parallel[stage] < costs.serial[stage]))) {
+      goto out;
+    }
+  }
+
+  p_copy = rrosace_sim_copy(p_serial);
+  if ((rrosace_sim_set_team(p_team, 2, stages) == EXIT_FAILURE) ||
+      (rrosace_sim_branch(p_team, nb_branches - 1, 1, future, &nb_branches, 2,
+                          results) == EXIT_FAILURE) ||
+      !p_copy ||
+      (future(p_copy, 0, &nb_branches, copy_results) == EXIT_FAILURE) ||
+      memcmp(results, copy_results, sizeof(results)) ||
+      (rrosace_sim_run(p_team, 1) == EXIT_FAILURE) ||
+      (rrosace_sim_set_team(p_team, 0, stages) == EXIT_FAILURE) ||
+      rrosace_sim_get_team_stages(p_team)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_copy);
+  rrosace_sim_del(p_let);
+  rrosace_sim_del(p_team);
+  rrosace_sim_del(p_serial);
+
+  return (ret);
+}
+
+static int test_discrete_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sim =
+      rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+  double states[2][RROSACE_SIM_STATE_SIZE];
+
+  if (!rrosace_sim_is_discrete(0) ||
+      !rrosace_sim_is_discrete(RROSACE_SIM_VALUES_SIZE - 1) ||
+      rrosace_sim_is_discrete(1) ||
+      !rrosace_sim_is_discrete(RROSACE_SIM_FCCS_STATE_OFFSET + 1) ||
+      rrosace_sim_is_discrete(RROSACE_SIM_FCCS_STATE_OFFSET) ||
+      rrosace_sim_is_discrete(RROSACE_SIM_STATE_SIZE)) {
+    goto out;
+  }
+
+  /* Filters replaced, their states kept */
+  if (!p_sim || (rrosace_sim_run(p_sim, NB_TICKS) == EXIT_FAILURE) ||
+      (rrosace_sim_get_state(p_sim, states[0]) == EXIT_FAILURE) ||
+      (rrosace_sim_set_filters_frequency(p_sim, RROSACE_FILTER_FREQ_50HZ) ==
+       EXIT_FAILURE) ||
+      (rrosace_sim_get_state(p_sim, states[1]) == EXIT_FAILURE) ||
+      memcmp(states[0], states[1], sizeof(states[0])) ||
+      (rrosace_sim_run(p_sim, 1) == EXIT_FAILURE)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_sim_del(p_sim);
+
+  return (ret);
+}
+
+static int test_parameters_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_sim_t *p_sims[3] = {NULL, NULL, NULL};
+  rrosace_sim_parameters_t parameters;
+  double states[3][RROSACE_SIM_STATE_SIZE];
+  size_t i;
+
+  for (i = 0; i < 2; ++i) {
+    p_sims[i] =
+        rrosace_sim_new(RROSACE_COMMANDED, RROSACE_H_EQ, VZ_C, RROSACE_VA_EQ);
+    if (!p_sims[i]) {
+      goto out;
+    }
+  }
+
+  /* Nominal parameters, same flight */
+  rrosace_sim_nominal_parameters(&parameters);
+  if ((rrosace_sim_set_parameters(p_sims[1], &parameters) == EXIT_FAILURE) ||
+      (rrosace_sim_set_parameters(p_sims[1], NULL) != EXIT_FAILURE)) {
+    goto out;
+  }
+  for (i = 0; i < 2; ++i) {
+    if ((rrosace_sim_run(p_sims[i], NB_TICKS / 2) == EXIT_FAILURE) ||
+        (rrosace_sim_get_state(p_sims[i], states[i]) == EXIT_FAILURE)) {
+      goto out;
+    }
+  }
+  if (memcmp(states[0], states[1], sizeof(states[0]))) {
+    goto out;
+  }
+
+  /* Biased altitude sensor and slower engine, kept by the copies */
+  parameters.h_bias = 10.;
+  parameters.tau = 2. * RROSACE_TAU;
+  if (rrosace_sim_set_parameters(p_sims[1], &parameters) == EXIT_FAILURE) {
+    goto out;
+  }
+  p_sims[2] = rrosace_sim_copy(p_sims[1]);
+  if (!p_sims[2]) {
+    goto out;
+  }
+  for (i = 0; i < 3; ++i) {
+    if ((rrosace_sim_run(p_sims[i], NB_TICKS / 2) == EXIT_FAILURE) ||
+        (rrosace_sim_get_state(p_sims[i], states[i]) == EXIT_FAILURE)) {
+      goto out;
+    }
+  }
+  if ((rrosace_sim_get_values(p_sims[1])->h_f <=
+       rrosace_sim_get_values(p_sims[0])->h_f) ||
+      memcmp(states[1], states[2], sizeof(states[1]))) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  for (i = 0; i < 3; ++i) {
+    rrosace_sim_del(p_sims[i]);
+  }
+
+  return (ret);
+}
+
+int main() {
+  int ret;
+
+  const test_t test_trim = {"trim", test_trim_func};
+  const test_t test_interleaved = {"interleaved", test_interleaved_func};
+  const test_t test_copy = {"copy", test_copy_func};
+  const test_t test_let = {"let", test_let_func};
+  const test_t test_let_copy = {"let_copy", test_let_copy_func};
+  const test_t test_rate_groups = {"rate_groups", test_rate_groups_func};
+  const test_t test_ordered = {"ordered", test_ordered_func};
+  const test_t test_state = {"state", test_state_func};
+  const test_t test_delegated = {"delegated", test_delegated_func};
+  const test_t test_branch = {"branch", test_branch_func};
+  const test_t test_team = {"team", test_team_func};
+  const test_t test_discrete = {"discrete", test_discrete_func};
+  const test_t test_parameters = {"parameters", test_parameters_func};
+  const test_t *p_tests[14];
+
+  p_tests[0] = &test_trim;
+  p_tests[1] = &test_interleaved;
+  p_tests[2] = &test_copy;
+  p_tests[3] = &test_let;
+  p_tests[4] = &test_let_copy;
+  p_tests[5] = &test_rate_groups;
+  p_tests[6] = &test_ordered;
+  p_tests[7] = &test_state;
+  p_tests[8] = &test_delegated;
+  p_tests[9] = &test_branch;
+  p_tests[10] = &test_team;
+  p_tests[11] = &test_discrete;
+  p_tests[12] = &test_parameters;
+  p_tests[13] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE
@@ -0,0 +1,166 @@
+/**
+ * @file surrogate_test.c
+ * @brief Test of surrogate module.
+ * @author Henrick Deschamps
+ * @version 1.0.0
+ * @date 2026-10-18
+ */
+
+#include <math.h>
+#include <rrosace_surrogate.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test_common.h"
+
+#define MODULE "surrogate"
+
+#define NB_RECORDS (8)
+#define RECORD_LENGTH (200)
+
+#define A (0.9)
+#define B (0.5)
+#define U_EQ (1.0)
+#define Y_EQ (10.0)
+
+static rrosace_surrogate_t *identified_surrogate(void);
+
+static int test_identify_func(void);
+
+static int test_trust_region_func(void);
+
+/**
+ * @brief Identify a first order system y(k) = A y(k-1) + B u(k-1) around
+ * (U_EQ, Y_EQ), excited by steps of alternating signs.
+ */
+static rrosace_surrogate_t *identified_surrogate(void) {
+  const double u_eq = U_EQ;
+  const double y_eq = Y_EQ;
+  rrosace_surrogate_t *p_surrogate =
+      rrosace_surrogate_new(1, 1, 2, &u_eq, &y_eq);
+  size_t record;
+  size_t k;
+
+  if (!p_surrogate) {
+    goto out;
+  }
+
+  for (record = 0; record < NB_RECORDS; ++record) {
+    double dy = 0.;
+    double du = 0.;
+
+    rrosace_surrogate_begin_record(p_surrogate);
+
+    for (k = 0; k < RECORD_LENGTH; ++k) {
+      const double y = Y_EQ + dy;
+      double u;
+
+      du = ((k / 20 + record) % 2 ? -1. : 1.) * (double)(record + 1) / 4.;
+      u = U_EQ + du;
+
+      rrosace_surrogate_add_sample(p_surrogate, &u, &y);
+
+      dy = A * dy + B * du;
+    }
+  }
+
+  if (rrosace_surrogate_identify(p_surrogate) == EXIT_FAILURE) {
+    rrosace_surrogate_del(p_surrogate);
+    p_surrogate = NULL;
+  }
+
+out:
+  return (p_surrogate);
+}
+
+static int test_identify_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_surrogate_t *p_surrogate = identified_surrogate();
+  const double u = U_EQ + 1.;
+  const size_t nb_steps = 50;
+  double y;
+  double y_expected = 0.;
+  rrosace_surrogate_validity_t validity;
+  size_t k;
+
+  if (!p_surrogate) {
+    goto out;
+  }
+
+  if (rrosace_surrogate_get_fit(p_surrogate, 0) < 1. - 1e-9) {
+    goto out;
+  }
+
+  for (k = 0; k < nb_steps; ++k) {
+    y_expected = A * y_expected + B * (u - U_EQ);
+  }
+  y_expected += Y_EQ;
+
+  if (rrosace_surrogate_predict(p_surrogate, &u, nb_steps, &y, &validity) ==
+      EXIT_FAILURE) {
+    goto out;
+  }
+
+  if ((validity != RROSACE_SURROGATE_TRUSTED) ||
+      (fabs(y - y_expected) > 1e-9)) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_surrogate_del(p_surrogate);
+
+  return (ret);
+}
+
+static int test_trust_region_func(void) {
+  int ret = EXIT_FAILURE;
+  rrosace_surrogate_t *p_surrogate = identified_surrogate();
+  const double u_inside = U_EQ - 0.5;
+  const double u_outside = U_EQ + 10.;
+
+  if (!p_surrogate) {
+    goto out;
+  }
+
+  if (rrosace_surrogate_check(p_surrogate, &u_inside, RECORD_LENGTH) !=
+      RROSACE_SURROGATE_TRUSTED) {
+    goto out;
+  }
+
+  if (rrosace_surrogate_check(p_surrogate, &u_outside, RECORD_LENGTH) !=
+      RROSACE_SURROGATE_UNTRUSTED) {
+    goto out;
+  }
+
+  if (rrosace_surrogate_check(p_surrogate, &u_inside, RECORD_LENGTH + 1) !=
+      RROSACE_SURROGATE_UNTRUSTED) {
+    goto out;
+  }
+
+  ret = EXIT_SUCCESS;
+
+out:
+  rrosace_surrogate_del(p_surrogate);
+
+  return (ret);
+}
+
+int main(void) {
+  int ret;
+
+  const test_t test_identify = {"identify", test_identify_func};
+  const test_t test_trust_region = {"trust_region", test_trust_region_func};
+  const test_t *p_tests[3];
+
+  p_tests[0] = &test_identify;
+  p_tests[1] = &test_trust_region;
+  p_tests[2] = NULL;
+
+  ret = exec_tests(MODULE, p_tests);
+
+  return (ret);
+}
+
+#undef MODULE